@@ -0,0 +1,29 @@
+# ltc_embed_tables(<target> BRDF <ggx|beckmann|disney_diffuse> N <size>)
+# Fits the table with ltc_app --embed at build time (only the C++ sources are written) and compiles the packed tables
+# (writeTabEmbedded) into the static library <target>. Link it and include "ltc_<brdf>_<N>.h" to get the tables
+# without any file I/O at startup.
+# The fits are cached in LTC_EMBED_WORKING_DIRECTORY/cache, shared by all embedded tables.
+set(LTC_EMBED_WORKING_DIRECTORY "${CMAKE_BINARY_DIR}/ltc_embed" CACHE PATH "Working directory (and fit cache) of the table embedding")
+
+function(ltc_embed_tables target)
+	cmake_parse_arguments(EMBED "" "BRDF;N" "" ${ARGN})
+	if(NOT EMBED_BRDF OR NOT EMBED_N)
+		message(FATAL_ERROR "ltc_embed_tables: BRDF and N are required")
+	endif()
+
+	set(name "ltc_${EMBED_BRDF}_${EMBED_N}")
+	set(outFolder "${LTC_EMBED_WORKING_DIRECTORY}/${name}")
+	file(MAKE_DIRECTORY "${LTC_EMBED_WORKING_DIRECTORY}")
+	add_custom_command(
+		OUTPUT "${outFolder}/${name}.h" "${outFolder}/${name}.cpp"
+		COMMAND ltc_app --embed "${outFolder}" --brdf ${EMBED_BRDF} --N ${EMBED_N} --cache "${LTC_EMBED_WORKING_DIRECTORY}/cache"
+		WORKING_DIRECTORY "${LTC_EMBED_WORKING_DIRECTORY}"
+		DEPENDS ltc_app
+		COMMENT "Fitting the ${EMBED_BRDF} LTC table (${EMBED_N}x${EMBED_N})"
+		VERBATIM
+	)
+
+	add_library(${target} STATIC "${outFolder}/${name}.cpp")
+	target_include_directories(${target} PUBLIC "${outFolder}")
+	target_compile_features(${target} PUBLIC cxx_std_11)
+endfunction()
@@ -3,61 +3,370 @@
 #include "ltc/brdf_ggx.h"
 #include "ltc/export.h"
 #include "ltc/fit_LTC.h"
+#include "ltc/import.h"
+#include "ltc/light_texture.h"
+#include "ltc/pipeline.h"
 #include "ltc/plot.h"
-#include <glm/mat3x3.hpp>
-#include <glm/vec2.hpp>
+#include "ltc/runtime.h"
+#include "ltc/trace.h"
+#include <CImg.h>
 #include <glm/vec3.hpp>
 #include <glm/vec4.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <tbb/task_group.h>
 #include <vector>
 
 #define PARALLEL 1
 
-// size of precomputed table (theta, alpha)
-constexpr int N = 64;
+// usage: ltc_app [--brdf ggx,beckmann,disney_diffuse] [--N 32,64] [--out folder] [--approx 6,0] [--layout tiled,morton]
+//                [--cache folder | --no-cache] [initial table [--refit]]
+//        ltc_app --embed folder [--brdf ggx,beckmann,disney_diffuse] [--N 32,64] [--cache folder | --no-cache]
+//        ltc_app --prefilter image [--out folder]
+//  * every combination of BRDF and size (theta, alpha) of the precomputed table is fitted, concurrently
+//  * a single table is written to results/ and plots/ (in the output folder), several tables to <brdf>_<N>/results
+//    and <brdf>_<N>/plots
+//  * with several BRDFs, the packed tables of each size are also combined into texture arrays in array_<N>
+//    (one slice per BRDF, in the order of --brdf)
+//  * the packed tables are also written as C++ sources ltc_<brdf>_<N>.h/.cpp (see ltc_embed_tables in CMake)
+//  * ltc_app --embed folder only fits the tables (or loads them from the cache) and writes their C++ sources
+//    ltc_<brdf>_<N>.h/.cpp to folder, without the other outputs (the build step of ltc_embed_tables)
+//  * with --approx P,Q, the packed tables are also approximated by rational functions of degree P / Q (see approx.h),
+//    written as ltc_approx_<brdf>_<N>.h/.glsl with an error report ltc_approx_<brdf>_<N>.txt in the results folder
+//  * with --layout, the blob ltc_tex.bin is also written in cache friendly layouts for the CPU runtime,
+//    ltc_tex_tiled.bin and ltc_tex_morton.bin (see TableLayout in runtime.h)
+//  * ltc_app --prefilter image [--out folder] only prefilters the emission texture of a textured polygon light
+//    (see light_texture.h) and writes its levels as the mip levels of light_texture.dds
+//  * the optional initial table (.bin, .dds or .js) is used as a warm start,
+//    with --refit only the poorly converged cells of that table are fitted again (a single BRDF only, the other
+//    cells are kept)
+//  * the fitted tables are cached in ./cache (or the folder of --cache) and loaded instead of fitted again,
+//    --no-cache always fits (see FitSettings::cacheDirectory)
 
 void createFolderIfNotExists(const std::filesystem::path& folderPath) {
     if (!std::filesystem::exists(folderPath))
         std::filesystem::create_directories(folderPath);
 }
 
-int main(int argc, char* argv[])
+static std::unique_ptr<ltc::Brdf> makeBrdf(const std::string& name)
+{
+    using namespace ltc;
+    if (name == "ggx")
+        return std::make_unique<BrdfGGX>();
+    if (name == "beckmann")
+        return std::make_unique<BrdfBeckmann>();
+    if (name == "disney_diffuse")
+        return std::make_unique<BrdfDisneyDiffuse>();
+    return nullptr;
+}
+
+static std::vector<std::string> splitList(const std::string& list)
+{
+    std::vector<std::string> items;
+    std::istringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ','))
+        items.push_back(item);
+    return items;
+}
+
+struct Job {
+    std::string brdfName;
+    std::unique_ptr<ltc::Brdf> brdf;
+    int N;
+    std::filesystem::path resultsFolder;
+    std::filesystem::path plotFolder;
+    // packed textures of the fitted table, combined into the texture arrays
+    ltc::PackedTables packed;
+};
+
+static void runJob(Job& job, const std::filesystem::path& initialPath, const bool refit, const std::filesystem::path& cacheDirectory)
 {
     using namespace ltc;
+    const Brdf& brdf = *job.brdf;
+    const int N = job.N;
 
-    // BRDF to fit
-    BrdfGGX brdf;
-    //BrdfBeckmann brdf;
-    //BrdfDisneyDiffuse brdf;
+    createFolderIfNotExists(job.resultsFolder);
+    createFolderIfNotExists(job.plotFolder);
+    const std::string embedName = "ltc_" + job.brdfName + "_" + std::to_string(N);
 
     // allocate data
-    std::vector<glm::mat3> tab(N * N);
-    std::vector<glm::vec2> tabMagFresnel(N * N);
+    LTCTable tab(N);
     std::vector<float> tabSphere(N * N);
 
+    // optional warm start from a previously exported table (.bin, .dds or .js)
+    FitSettings settings;
+    // identical fits are loaded from the cache
+    settings.cacheDirectory = cacheDirectory;
+    LTCTable initialTab(N);
+    if (!initialPath.empty()) {
+        const std::string initialPathString = initialPath.string();
+        const auto extension = initialPath.extension();
+
+        bool ok = false;
+        if (extension == ".bin")
+            ok = readTabBinary(initialPathString.c_str(), initialTab);
+        else if (extension == ".dds")
+            ok = readDDS(initialPathString.c_str(), initialTab);
+        else if (extension == ".js")
+            ok = readJS(initialPathString.c_str(), initialTab);
+
+        if (ok)
+            settings.initialTab = &initialTab;
+        else
+            std::cout << "Could not read initial table " << initialPathString << ", fitting from scratch" << std::endl;
+    }
+
 // fit
 #if PARALLEL
-    fitTab(tab.data(), tabMagFresnel.data(), N, brdf);
+    if (!refit || !settings.initialTab) {
+        // fit, pack, export and plot with the stages overlapped
+        job.packed = fitTabPipelined(brdf, N, settings, job.resultsFolder, job.plotFolder, embedName);
+        return;
+    }
+
+    tab = initialTab;
+    refitTab(tab, brdf);
 #else
-    fitTabOrig(tab.data(), tabMagFresnel.data(), N, brdf);
+    fitTabOrig(tab, brdf);
 #endif
 
     // projected solid angle of a spherical cap, clipped to the horizon
     genSphereTab(tabSphere.data(), N);
 
+    // average albedo for multiple-scattering compensation
+    std::vector<float> tabAvgAlbedo(N);
+    genAvgAlbedoTab(tabAvgAlbedo.data(), tab);
+
     // pack tables (texture representation)
-    std::vector<glm::vec4> tex1(N * N);
-    std::vector<glm::vec4> tex2(N * N);
-    packTab(tex1.data(), tex2.data(), tab.data(), tabMagFresnel.data(), tabSphere.data(), N);
+    job.packed = packTables(tab, tabSphere.data(), tabAvgAlbedo.data());
+    PackedTables& packed = job.packed;
 
-    // export to C, MATLAB and DDS
-    writeTabMatlab(tab.data(), tabMagFresnel.data(), N);
-    writeTabC(tab.data(), tabMagFresnel.data(), N);
-    writeDDS(tex1.data(), tex2.data(), N);
-    writeJS(tex1.data(), tex2.data(), N);
+    // export to C, MATLAB, DDS and binary
+    writeTabMatlab(tab, job.resultsFolder);
+    writeTabBinary(tab, job.resultsFolder);
+    writeTabC(tab, job.resultsFolder);
+    writeDDS((job.resultsFolder / "ltc_1.dds").string().c_str(), packed.half1.data(), N);
+    writeDDS((job.resultsFolder / "ltc_2.dds").string().c_str(), packed.half2.data(), N);
+    writeAvgAlbedoDDS(tabAvgAlbedo.data(), N, job.resultsFolder);
+    writeTexBlob((job.resultsFolder / "ltc_tex.bin").string().c_str(), packed.half1.data(), packed.half2.data(), N);
+    writeTabEmbedded(packed.half1.data(), packed.half2.data(), N, job.resultsFolder, embedName);
+    writeJS(packed.tex1.data(), packed.tex2.data(), N, job.resultsFolder);
 
     // spherical plots
-    createFolderIfNotExists("plots");
-    make_spherical_plots(brdf, tab.data(), N, "plots");
+    make_spherical_plots(brdf, tab, job.plotFolder);
+}
+
+// 8 bit images are normalized to [0, 1], .pfm images are used as is
+static int prefilterLightTexture(const std::filesystem::path& imagePath, const std::filesystem::path& outFolder)
+{
+    cimg_library::CImg<float> image;
+    try {
+        image.load(imagePath.string().c_str());
+    } catch (const cimg_library::CImgException&) {
+    }
+    if (image.is_empty()) {
+        std::cout << "Could not read image " << imagePath.string() << std::endl;
+        return 1;
+    }
+
+    const float scale = imagePath.extension() == ".pfm" ? 1.0f : 1.0f / 255.0f;
+    const int width = image.width();
+    const int height = image.height();
+    std::vector<glm::vec4> data(width * height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            glm::vec4 texel(0.0f, 0.0f, 0.0f, 1.0f);
+            for (int c = 0; c < std::min(image.spectrum(), 4); ++c)
+                texel[c] = scale * image(x, y, 0, c);
+            // grey scale
+            if (image.spectrum() == 1)
+                texel.y = texel.z = texel.x;
+            data[y * width + x] = texel;
+        }
+    }
+
+    const ltc::LightTexturePyramid pyramid = ltc::buildLightTexturePyramid(data.data(), width, height);
+    createFolderIfNotExists(outFolder);
+    ltc::writeDDS((outFolder / "light_texture.dds").string().c_str(), pyramid);
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    // BRDFs and sizes of the precomputed tables (theta, alpha) to fit
+    std::vector<std::string> brdfNames { "ggx" };
+    std::vector<std::string> sizes { "64" };
+    std::filesystem::path outFolder = ".";
+    std::filesystem::path initialPath;
+    std::filesystem::path prefilterPath;
+    std::filesystem::path embedFolder;
+    std::vector<std::string> approxDegrees;
+    std::vector<std::string> layoutNames;
+    std::filesystem::path cacheDirectory = "cache";
+    bool refit = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--brdf" && i + 1 < argc)
+            brdfNames = splitList(argv[++i]);
+        else if (arg == "--N" && i + 1 < argc)
+            sizes = splitList(argv[++i]);
+        else if (arg == "--out" && i + 1 < argc)
+            outFolder = argv[++i];
+        else if (arg == "--approx" && i + 1 < argc)
+            approxDegrees = splitList(argv[++i]);
+        else if (arg == "--layout" && i + 1 < argc)
+            layoutNames = splitList(argv[++i]);
+        else if (arg == "--embed" && i + 1 < argc)
+            embedFolder = argv[++i];
+        else if (arg == "--prefilter" && i + 1 < argc)
+            prefilterPath = argv[++i];
+        else if (arg == "--cache" && i + 1 < argc)
+            cacheDirectory = argv[++i];
+        else if (arg == "--no-cache")
+            cacheDirectory.clear();
+        else if (arg == "--refit")
+            refit = true;
+        else if (arg.rfind("--", 0) != 0 && initialPath.empty())
+            initialPath = arg;
+        else {
+            std::cout << "usage: ltc_app [--brdf ggx,beckmann,disney_diffuse] [--N 32,64] [--out folder] [--approx 6,0] [--layout tiled,morton]" << std::endl;
+            std::cout << "               [--cache folder | --no-cache] [initial table [--refit]]" << std::endl;
+            std::cout << "       ltc_app --embed folder [--brdf ggx,beckmann,disney_diffuse] [--N 32,64] [--cache folder | --no-cache]" << std::endl;
+            std::cout << "       ltc_app --prefilter image [--out folder]" << std::endl;
+            return 1;
+        }
+    }
+
+    if (!prefilterPath.empty())
+        return prefilterLightTexture(prefilterPath, outFolder);
+
+    // the refitted tables keep most cells of the initial table, which is fitted for one BRDF
+    if (refit && !initialPath.empty() && brdfNames.size() > 1) {
+        std::cout << "--refit keeps the cells of the initial table, it needs a single BRDF (--brdf lists " << brdfNames.size() << ")" << std::endl;
+        return 1;
+    }
+
+    std::vector<ltc::TableLayout> layouts;
+    for (const std::string& name : layoutNames) {
+        if (name == "tiled")
+            layouts.push_back(ltc::TableLayout::Tiled);
+        else if (name == "morton")
+            layouts.push_back(ltc::TableLayout::Morton);
+        else {
+            std::cout << "Invalid table layout: " << name << std::endl;
+            return 1;
+        }
+    }
+
+    ltc::ApproxSettings approxSettings;
+    if (!approxDegrees.empty()) {
+        approxSettings.numeratorDegree = std::atoi(approxDegrees[0].c_str());
+        approxSettings.denominatorDegree = approxDegrees.size() > 1 ? std::atoi(approxDegrees[1].c_str()) : 0;
+        if (approxDegrees.size() > 2 || approxSettings.numeratorDegree < 0 || approxSettings.denominatorDegree < 0) {
+            std::cout << "Invalid approximation degrees, --approx numerator,denominator" << std::endl;
+            return 1;
+        }
+    }
+
+    if (cacheDirectory.empty())
+        std::cout << "Fit cache disabled" << std::endl;
+    else
+        std::cout << "Fit cache: " << cacheDirectory.string() << std::endl;
+
+    std::vector<Job> jobs;
+    for (const std::string& brdfName : brdfNames) {
+        for (const std::string& size : sizes) {
+            Job job;
+            job.brdfName = brdfName;
+            job.brdf = makeBrdf(brdfName);
+            job.N = std::atoi(size.c_str());
+            if (!job.brdf || job.N < 2) {
+                std::cout << "Invalid BRDF or table size: " << brdfName << " " << size << std::endl;
+                return 1;
+            }
+            jobs.push_back(std::move(job));
+        }
+    }
+
+    if (!embedFolder.empty()) {
+        if (!initialPath.empty()) {
+            std::cout << "--embed fits from scratch (or loads from the cache), without an initial table" << std::endl;
+            return 1;
+        }
+        createFolderIfNotExists(embedFolder);
+        tbb::task_group embedTasks;
+        for (const Job& job : jobs) {
+            embedTasks.run([&job, &embedFolder, &cacheDirectory]() {
+                ltc::FitSettings settings;
+                settings.cacheDirectory = cacheDirectory;
+                ltc::PackedTables packed = ltc::fitTabPacked(*job.brdf, job.N, settings);
+                const std::string embedName = "ltc_" + job.brdfName + "_" + std::to_string(job.N);
+                ltc::writeTabEmbedded(packed.half1.data(), packed.half2.data(), job.N, embedFolder, embedName);
+            });
+        }
+        embedTasks.wait();
+        return 0;
+    }
+
+    // each output set goes to its own folder
+    for (Job& job : jobs) {
+        const std::filesystem::path folder = jobs.size() == 1 ? outFolder : outFolder / (job.brdfName + "_" + std::to_string(job.N));
+        job.resultsFolder = folder / "results";
+        job.plotFolder = folder / "plots";
+    }
+
+    // the jobs share the thread pool, the rows of the other tables keep the threads busy during the sequential
+    // first column and the last rows of each table
+    tbb::task_group jobTasks;
+    for (Job& job : jobs)
+        jobTasks.run([&job, &initialPath, refit, &cacheDirectory]() { runJob(job, initialPath, refit, cacheDirectory); });
+    jobTasks.wait();
+
+    // the arrays combine the packed textures of the jobs of each size
+    if (brdfNames.size() > 1) {
+        for (const std::string& size : sizes) {
+            const int N = std::atoi(size.c_str());
+            std::vector<const ltc::PackedTables*> tables;
+            for (const Job& job : jobs) {
+                if (job.N == N)
+                    tables.push_back(&job.packed);
+            }
+
+            const std::filesystem::path arrayFolder = outFolder / ("array_" + size);
+            createFolderIfNotExists(arrayFolder);
+            ltc::writeTabArray(tables, arrayFolder);
+        }
+    }
+
+    // the approximations start from the packed textures of the jobs
+    if (!approxDegrees.empty()) {
+        tbb::task_group approxTasks;
+        for (const Job& job : jobs) {
+            approxTasks.run([&job, &approxSettings]() {
+                const std::string name = "ltc_approx_" + job.brdfName + "_" + std::to_string(job.N);
+                ltc::writeTabApprox(job.packed, approxSettings, job.resultsFolder, name);
+            });
+        }
+        approxTasks.wait();
+    }
+
+    // the other layouts are reordered from the row major blob
+    for (const Job& job : jobs) {
+        std::vector<glm::vec4> tex1, tex2;
+        int N;
+        ltc::TableLayout layout;
+        if (layouts.empty() || !ltc::readTexBlob((job.resultsFolder / "ltc_tex.bin").string().c_str(), tex1, tex2, N, layout))
+            continue;
+        for (const ltc::TableLayout cpuLayout : layouts)
+            ltc::writeTexBlob(tex1.data(), tex2.data(), N, job.resultsFolder, cpuLayout);
+    }
 
+    LTC_TRACE_DUMP((outFolder / "trace.json").string().c_str());
     return 0;
 }
@@ -0,0 +1,946 @@
+#include "ltc/brdf_ggx.h"
+#include "ltc/import.h"
+#include "ltc/light_bvh.h"
+#include "ltc/runtime.h"
+#include "ltc/sampling.h"
+#include <CImg.h>
+#include <glm/geometric.hpp>
+#include <glm/mat3x3.hpp>
+#include <glm/matrix.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <tbb/parallel_for.h>
+#include <vector>
+
+// usage: ltc_bench ltc_tex.bin [--size 320x180] [--spp 256] [--lookup-N 1024] [--out folder] [--sampling | --many-lights]
+//  * renders a floor of varying roughness (GGX without Fresnel) lit by a quad, a disk and a line (thin cylinder)
+//    light, once with the LTC integrals of runtime.h (the packed tables of the blob written by writeTexBlob) and once
+//    with a Monte Carlo reference (light and BRDF sampling, combined with the balance heuristic)
+//  * reports per light and for their sum the error of the LTC image against the reference (RMSE and maximum,
+//    relative to the mean of the reference), with the standard error of the reference as the noise floor, and the
+//    throughput of both estimators (all threads)
+//  * writes the images to the output folder (reference_<light>.pfm and ltc_<light>.pfm)
+//  * compares the table layouts (see TableLayout in runtime.h) for batched lookups of the shading points, tile by tile
+//    (8 x 8 pixels), with the table and with the table resampled to --lookup-N x --lookup-N (larger than the caches,
+//    0 to skip): the distinct cache lines (64 bytes, per texture) read by the lookups of a tile and the lookup
+//    throughput (all threads)
+//  * with --sampling, only checks the importance sampling of sampling.h on the quad light instead (registered as a
+//    test with CTest): per shading point, spp samples of BRDF sampling, of the LTC lobe (sampleLTC), of the polygon
+//    in the LTC (samplePolygonLTC) and of the polygon and BRDF sampling combined (balance heuristic) estimate the
+//    reflected radiance. Fails (exit code 1) unless the pdfs of the samples match pdfLTC and pdfPolygonLTC, the
+//    estimates agree with the reference of the renderer, samplePolygonLTC has a lower variance than BRDF sampling
+//    at most points (median) and the combination a lower variance overall
+//  * with --many-lights, only checks the light BVH of light_bvh.h instead (registered as a test with CTest): for
+//    256 to 65536 quad lights at a constant density (more lights cover a larger area), LightBVH::shade is compared to
+//    the sum of integratePolygon over all lights at the shading points. Reports the times of both and the growth of
+//    the time and work of the BVH with the number of lights, fails (exit code 1) if the error at a point exceeds the
+//    bound of the skipped nodes
+
+constexpr float pi = 3.14159265f;
+
+enum class LightType {
+    Quad,
+    Disk,
+    Line
+};
+
+// the quad and disk lights are one sided and emit towards normal(), the line light is a cylinder that emits all around
+struct Light {
+    const char* name;
+    LightType type;
+    glm::vec3 center;
+    // quad: half extents, disk: radii, line: half length and radius (along axis1)
+    glm::vec3 axis1;
+    glm::vec3 axis2;
+    float radius;
+    float radiance;
+
+    glm::vec3 normal() const { return glm::normalize(glm::cross(axis1, axis2)); }
+    float area() const
+    {
+        switch (type) {
+        case LightType::Quad:
+            return 4.0f * glm::length(glm::cross(axis1, axis2));
+        case LightType::Disk:
+            return pi * glm::length(glm::cross(axis1, axis2));
+        default:
+            return 2.0f * pi * radius * 2.0f * glm::length(axis1);
+        }
+    }
+};
+
+struct Camera {
+    glm::vec3 position;
+    glm::vec3 forward, right, up;
+    float tanHalfFov;
+};
+
+static std::vector<Light> makeLights()
+{
+    std::vector<Light> lights(3);
+    lights[0] = { "quad", LightType::Quad, glm::vec3(-4.0f, 4.0f, 1.5f), glm::vec3(1.2f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, 0.8f), 0.0f, 1.0f };
+    lights[1] = { "disk", LightType::Disk, glm::vec3(0.0f, 4.0f, 1.5f), glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f), 0.0f, 1.0f };
+    // axis2 is only used to build the frame of the cylinder
+    lights[2] = { "line", LightType::Line, glm::vec3(4.0f, 4.0f, 1.4f), glm::vec3(1.5f, 0.5f, 0.8f), glm::vec3(0.0f), 0.05f, 4.0f };
+    return lights;
+}
+
+// bands of 4 units along x, each from roughness 0.05 to 0.95
+static float floorRoughness(const glm::vec3& P)
+{
+    const float band = (P.x + 8.0f) / 4.0f;
+    return 0.05f + 0.9f * (band - std::floor(band));
+}
+
+// orthonormal basis of a unit vector (Frisvad 2012)
+static void basis(const glm::vec3& n, glm::vec3& b1, glm::vec3& b2)
+{
+    if (n.z < -0.9999999f) {
+        b1 = glm::vec3(0.0f, -1.0f, 0.0f);
+        b2 = glm::vec3(-1.0f, 0.0f, 0.0f);
+        return;
+    }
+    const float a = 1.0f / (1.0f + n.z);
+    const float b = -n.x * n.y * a;
+    b1 = glm::vec3(1.0f - n.x * n.x * a, b, -n.x);
+    b2 = glm::vec3(b, 1.0f - n.y * n.y * a, -n.y);
+}
+
+// point on the light and its normal (on the emitting side) for uniform (u1, u2)
+static void sampleLight(const Light& light, float u1, float u2, glm::vec3& q, glm::vec3& n)
+{
+    switch (light.type) {
+    case LightType::Quad:
+        q = light.center + (2.0f * u1 - 1.0f) * light.axis1 + (2.0f * u2 - 1.0f) * light.axis2;
+        n = light.normal();
+        break;
+    case LightType::Disk: {
+        const float r = std::sqrt(u1);
+        const float phi = 2.0f * pi * u2;
+        q = light.center + r * std::cos(phi) * light.axis1 + r * std::sin(phi) * light.axis2;
+        n = light.normal();
+        break;
+    }
+    case LightType::Line: {
+        glm::vec3 b1, b2;
+        basis(glm::normalize(light.axis1), b1, b2);
+        const float phi = 2.0f * pi * u2;
+        n = std::cos(phi) * b1 + std::sin(phi) * b2;
+        q = light.center + (2.0f * u1 - 1.0f) * light.axis1 + light.radius * n;
+        break;
+    }
+    }
+}
+
+// distance along the ray to the light and its normal there, false if missed
+static bool intersectLight(const Light& light, const glm::vec3& origin, const glm::vec3& dir, float& t, glm::vec3& n)
+{
+    if (light.type == LightType::Line) {
+        const float halfLength = glm::length(light.axis1);
+        const glm::vec3 axis = light.axis1 / halfLength;
+        const glm::vec3 o = origin - light.center;
+        const glm::vec3 dPerp = dir - glm::dot(dir, axis) * axis;
+        const glm::vec3 oPerp = o - glm::dot(o, axis) * axis;
+        const float A = glm::dot(dPerp, dPerp);
+        const float B = 2.0f * glm::dot(dPerp, oPerp);
+        const float C = glm::dot(oPerp, oPerp) - light.radius * light.radius;
+        const float disc = B * B - 4.0f * A * C;
+        if (A == 0.0f || disc < 0.0f)
+            return false;
+        // the shading points are outside of the cylinder, the first root is the visible one
+        t = (-B - std::sqrt(disc)) / (2.0f * A);
+        if (t <= 0.0f)
+            return false;
+        const glm::vec3 p = o + t * dir;
+        const float along = glm::dot(p, axis);
+        if (std::abs(along) > halfLength)
+            return false;
+        n = glm::normalize(p - along * axis);
+        return true;
+    }
+
+    n = light.normal();
+    const float denom = glm::dot(dir, n);
+    if (denom == 0.0f)
+        return false;
+    t = glm::dot(light.center - origin, n) / denom;
+    if (t <= 0.0f)
+        return false;
+    const glm::vec3 p = origin + t * dir - light.center;
+    if (light.type == LightType::Quad) {
+        const float x = glm::dot(p, light.axis1) / glm::dot(light.axis1, light.axis1);
+        const float y = glm::dot(p, light.axis2) / glm::dot(light.axis2, light.axis2);
+        return std::abs(x) <= 1.0f && std::abs(y) <= 1.0f;
+    }
+    const float x = glm::dot(p, light.axis1) / glm::dot(light.axis1, light.axis1);
+    const float y = glm::dot(p, light.axis2) / glm::dot(light.axis2, light.axis2);
+    return x * x + y * y <= 1.0f;
+}
+
+struct ShadingPoint {
+    glm::vec3 P;
+    glm::vec3 V;
+    float roughness;
+    bool valid;
+};
+
+// the floor z = 0 (normal +z) in [-8, 8] x [-2, 10]
+static std::vector<ShadingPoint> traceFloor(const Camera& camera, int width, int height)
+{
+    std::vector<ShadingPoint> points(width * height);
+    const float aspect = float(width) / height;
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            const float sx = (2.0f * (x + 0.5f) / width - 1.0f) * camera.tanHalfFov * aspect;
+            const float sy = (1.0f - 2.0f * (y + 0.5f) / height) * camera.tanHalfFov;
+            const glm::vec3 dir = glm::normalize(camera.forward + sx * camera.right + sy * camera.up);
+
+            ShadingPoint& point = points[x + y * width];
+            point.valid = false;
+            if (dir.z >= 0.0f)
+                continue;
+            point.P = camera.position - camera.position.z / dir.z * dir;
+            point.P.z = 0.0f;
+            point.V = -dir;
+            point.roughness = floorRoughness(point.P);
+            point.valid = std::abs(point.P.x) <= 8.0f && point.P.y >= -2.0f && point.P.y <= 10.0f;
+        }
+    }
+    return points;
+}
+
+// world to the local frame of the floor with V in the xz-plane, as ltcWorldToCosine
+static glm::mat3 localFrame(const glm::vec3& V)
+{
+    return ltc::ltcWorldToCosine(glm::mat3(1.0f), glm::vec3(0.0f, 0.0f, 1.0f), V);
+}
+
+// reflected radiance of the light with the packed tables
+static float shadeLTC(const ltc::PackedTable& table, const Light& light, const ShadingPoint& point)
+{
+    const glm::vec3 N(0.0f, 0.0f, 1.0f);
+    const ltc::ShadingLTC ltc = ltc::lookupLTC(table, point.roughness, glm::dot(N, point.V));
+    const glm::mat3 worldToCosine = ltc::ltcWorldToCosine(ltc.invM, N, point.V);
+
+    float integral = 0.0f;
+    switch (light.type) {
+    case LightType::Quad: {
+        // counterclockwise around the normal (see integratePolygon)
+        const glm::vec3 corners[4] = {
+            light.center - light.axis1 - light.axis2,
+            light.center - light.axis1 + light.axis2,
+            light.center + light.axis1 + light.axis2,
+            light.center + light.axis1 - light.axis2
+        };
+        glm::vec3 L[4];
+        for (int i = 0; i < 4; ++i)
+            L[i] = worldToCosine * (corners[i] - point.P);
+        integral = ltc::integratePolygon(L, 4, false);
+        break;
+    }
+    case LightType::Disk:
+        // emits away from cross(V1, V2)
+        integral = ltc::integrateDisk(worldToCosine * (light.center - point.P), worldToCosine * light.axis2,
+            worldToCosine * light.axis1, false, table);
+        break;
+    case LightType::Line: {
+        const glm::mat3 frame = localFrame(point.V);
+        integral = ltc::integrateLine(ltc.invM, frame * (light.center - light.axis1 - point.P),
+            frame * (light.center + light.axis1 - point.P), light.radius);
+        break;
+    }
+    }
+    return light.radiance * integral * ltc.terms.x;
+}
+
+// reflected radiance of the light, one light and one BRDF sample per sample, balance heuristic
+// returns the mean and sets the variance of the mean
+static float shadeReference(const ltc::Brdf& brdf, const Light& light, const ShadingPoint& point, int spp,
+    std::mt19937& rng, float& variance)
+{
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+    const glm::mat3 frame = localFrame(point.V);
+    const glm::vec3 V = frame * point.V;
+    const float alpha = std::max(point.roughness * point.roughness, 1e-4f);
+    const float area = light.area();
+
+    double sum = 0.0, sumSquares = 0.0;
+    for (int s = 0; s < spp; ++s) {
+        float value = 0.0f;
+
+        // light sample
+        {
+            glm::vec3 q, n;
+            sampleLight(light, uniform(rng), uniform(rng), q, n);
+            glm::vec3 w = q - point.P;
+            const float d2 = glm::dot(w, w);
+            w /= std::sqrt(d2);
+            const float cosLight = glm::dot(-w, n);
+            const glm::vec3 L = frame * w;
+            if (cosLight > 0.0f && L.z > 0.0f) {
+                float pdfBrdf;
+                const float f = brdf.eval(V, L, alpha, pdfBrdf);
+                const float pdfLight = d2 / (cosLight * area);
+                value += light.radiance * f / (pdfLight + pdfBrdf);
+            }
+        }
+
+        // BRDF sample
+        {
+            const glm::vec3 L = brdf.sample(V, alpha, uniform(rng), uniform(rng));
+            float pdfBrdf;
+            const float f = L.z > 0.0f ? brdf.eval(V, L, alpha, pdfBrdf) : 0.0f;
+            const glm::vec3 w = glm::transpose(frame) * L;
+            float t;
+            glm::vec3 n;
+            if (f > 0.0f && pdfBrdf > 0.0f && intersectLight(light, point.P, w, t, n)) {
+                const float cosLight = glm::dot(-w, n);
+                if (cosLight > 0.0f) {
+                    const float pdfLight = t * t / (cosLight * area);
+                    value += light.radiance * f / (pdfLight + pdfBrdf);
+                }
+            }
+        }
+
+        sum += value;
+        sumSquares += double(value) * value;
+    }
+
+    const double mean = sum / spp;
+    variance = float(std::max(sumSquares / spp - mean * mean, 0.0) / spp);
+    return float(mean);
+}
+
+static void saveImage(const std::vector<float>& image, int width, int height, const std::filesystem::path& path)
+{
+    cimg_library::CImg<float> output(width, height, 1, 1);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x)
+            output(x, y, 0, 0) = image[x + y * width];
+    }
+    output.save(path.string().c_str());
+}
+
+struct Errors {
+    double meanReference = 0.0;
+    double rmse = 0.0;
+    double maxError = 0.0;
+    double standardError = 0.0;
+};
+
+static Errors compare(const std::vector<ShadingPoint>& points, const std::vector<float>& ltcImage,
+    const std::vector<float>& referenceImage, const std::vector<float>& varianceImage)
+{
+    Errors errors;
+    int count = 0;
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (!points[i].valid)
+            continue;
+        const double error = ltcImage[i] - referenceImage[i];
+        errors.meanReference += referenceImage[i];
+        errors.rmse += error * error;
+        errors.maxError = std::max(errors.maxError, std::abs(error));
+        errors.standardError += varianceImage[i];
+        ++count;
+    }
+    errors.meanReference /= std::max(count, 1);
+    errors.rmse = std::sqrt(errors.rmse / std::max(count, 1));
+    errors.standardError = std::sqrt(errors.standardError / std::max(count, 1));
+    return errors;
+}
+
+static void report(const char* name, const Errors& errors)
+{
+    const double mean = std::max(errors.meanReference, 1e-30);
+    std::cout << std::left << std::setw(6) << name << std::right << std::scientific << std::setprecision(3)
+              << " mean " << errors.meanReference
+              << "  LTC rmse " << errors.rmse / mean << " max " << errors.maxError / mean
+              << "  (reference standard error " << errors.standardError / mean << ")" << std::endl;
+}
+
+// estimators of the reflected radiance of a light, compared by --sampling
+enum SamplingEstimator {
+    SampleReference, // light and BRDF sampling (shadeReference)
+    SampleBrdf,
+    SampleLobe, // sampleLTC
+    SamplePolygon, // samplePolygonLTC
+    SamplePolygonBrdf, // half samplePolygonLTC, half BRDF sampling, balance heuristic (pdfPolygonLTC)
+    NumSamplingEstimators
+};
+
+struct SamplingResult {
+    float mean[NumSamplingEstimators];
+    // variance of the mean
+    float variance[NumSamplingEstimators];
+    // largest relative difference between the pdfs of sampleLTC and pdfLTC, of samplePolygonLTC and pdfPolygonLTC
+    float lobePdfError;
+    float polygonPdfError;
+};
+
+// reflected radiance of the quad light with spp samples of every estimator
+static SamplingResult estimateSampling(const ltc::PackedTable& table, const ltc::Brdf& brdf, const Light& light,
+    const ShadingPoint& point, int spp, std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+    SamplingResult result {};
+    result.mean[SampleReference] = shadeReference(brdf, light, point, spp, rng, result.variance[SampleReference]);
+
+    const glm::mat3 frame = localFrame(point.V);
+    const glm::vec3 V = frame * point.V;
+    const float alpha = std::max(point.roughness * point.roughness, 1e-4f);
+    const ltc::ShadingLTC ltc = ltc::lookupLTC(table, point.roughness, V.z);
+
+    // counterclockwise around the normal, relative to the shading point in the local frame
+    const glm::vec3 corners[4] = {
+        light.center - light.axis1 - light.axis2,
+        light.center - light.axis1 + light.axis2,
+        light.center + light.axis1 + light.axis2,
+        light.center + light.axis1 - light.axis2
+    };
+    glm::vec3 polygon[4];
+    for (int i = 0; i < 4; ++i)
+        polygon[i] = frame * (corners[i] - point.P);
+
+    std::vector<float> U1(spp), U2(spp), pdfs(spp), checkPdfs(spp);
+    std::vector<glm::vec3> directions(spp);
+    const auto generate = [&]() {
+        for (int s = 0; s < spp; ++s) {
+            U1[s] = uniform(rng);
+            U2[s] = uniform(rng);
+        }
+    };
+    const auto pdfError = [&](int count) {
+        float error = 0.0f;
+        for (int s = 0; s < count; ++s) {
+            if (pdfs[s] > 0.0f)
+                error = std::max(error, std::abs(checkPdfs[s] - pdfs[s]) / pdfs[s]);
+        }
+        return error;
+    };
+    // emitted radiance times the BRDF (with the cosine) in the direction L (local frame), sets the pdf of BRDF sampling
+    const auto radiance = [&](const glm::vec3& L, float& pdfBrdf) {
+        pdfBrdf = 0.0f;
+        if (!(L.z > 0.0f))
+            return 0.0f;
+        const float f = brdf.eval(V, L, alpha, pdfBrdf);
+        float t;
+        glm::vec3 n;
+        const glm::vec3 w = glm::transpose(frame) * L;
+        return intersectLight(light, point.P, w, t, n) && glm::dot(-w, n) > 0.0f ? light.radiance * f : 0.0f;
+    };
+    const auto store = [&](SamplingEstimator estimator, double sum, double sumSquares, int count) {
+        const double mean = sum / count;
+        result.mean[estimator] = float(mean);
+        result.variance[estimator] = float(std::max(sumSquares / count - mean * mean, 0.0) / count);
+    };
+    // the directions that reach the light contribute radiance / pdf
+    const auto estimate = [&](SamplingEstimator estimator) {
+        double sum = 0.0, sumSquares = 0.0;
+        for (int s = 0; s < spp; ++s) {
+            float pdfBrdf;
+            const float value = pdfs[s] > 0.0f ? radiance(directions[s], pdfBrdf) / pdfs[s] : 0.0f;
+            sum += value;
+            sumSquares += double(value) * value;
+        }
+        store(estimator, sum, sumSquares, spp);
+    };
+    const auto sampleBrdf = [&](int count) {
+        for (int s = 0; s < count; ++s) {
+            // only for its pdf
+            directions[s] = brdf.sample(V, alpha, U1[s], U2[s]);
+            radiance(directions[s], pdfs[s]);
+        }
+    };
+
+    generate();
+    sampleBrdf(spp);
+    estimate(SampleBrdf);
+
+    generate();
+    ltc::sampleLTC(ltc.invM, spp, U1.data(), U2.data(), directions.data(), pdfs.data());
+    ltc::pdfLTC(ltc.invM, spp, directions.data(), checkPdfs.data());
+    result.lobePdfError = pdfError(spp);
+    estimate(SampleLobe);
+
+    generate();
+    if (ltc::samplePolygonLTC(ltc.invM, polygon, 4, spp, U1.data(), U2.data(), directions.data(), pdfs.data())) {
+        ltc::pdfPolygonLTC(ltc.invM, polygon, 4, spp, directions.data(), checkPdfs.data());
+        result.polygonPdfError = pdfError(spp);
+    }
+    estimate(SamplePolygon);
+
+    // spp / 2 pairs of a polygon and a BRDF sample, each weighted by the sum of both pdfs
+    const int pairs = std::max(spp / 2, 1);
+    std::vector<glm::vec3> brdfDirections(pairs);
+    std::vector<float> brdfPdfs(pairs), polygonPdfs(pairs);
+    generate();
+    sampleBrdf(pairs);
+    std::copy(directions.begin(), directions.begin() + pairs, brdfDirections.begin());
+    std::copy(pdfs.begin(), pdfs.begin() + pairs, brdfPdfs.begin());
+    ltc::pdfPolygonLTC(ltc.invM, polygon, 4, pairs, brdfDirections.data(), polygonPdfs.data());
+
+    generate();
+    ltc::samplePolygonLTC(ltc.invM, polygon, 4, pairs, U1.data(), U2.data(), directions.data(), pdfs.data());
+    double sum = 0.0, sumSquares = 0.0;
+    for (int s = 0; s < pairs; ++s) {
+        float value = 0.0f, pdfBrdf;
+        if (pdfs[s] > 0.0f) {
+            const float emitted = radiance(directions[s], pdfBrdf);
+            value += emitted / (pdfs[s] + pdfBrdf);
+        }
+        if (brdfPdfs[s] > 0.0f)
+            value += radiance(brdfDirections[s], pdfBrdf) / (polygonPdfs[s] + brdfPdfs[s]);
+        sum += value;
+        sumSquares += double(value) * value;
+    }
+    store(SamplePolygonBrdf, sum, sumSquares, pairs);
+    return result;
+}
+
+// checks the importance sampling of sampling.h, returns the exit code
+static int checkSampling(const ltc::PackedTable& table, const ltc::Brdf& brdf, const Light& light,
+    const std::vector<ShadingPoint>& points, int spp)
+{
+    std::vector<SamplingResult> results(points.size());
+    tbb::parallel_for(0, int(points.size()), [&](int i) {
+        // deterministic per point
+        std::mt19937 rng { unsigned(i) };
+        if (points[i].valid)
+            results[i] = estimateSampling(table, brdf, light, points[i], spp, rng);
+    });
+
+    // sums over the shading points, and the median relative standard deviation of a sample
+    double sum[NumSamplingEstimators] = {}, variance[NumSamplingEstimators] = {};
+    std::vector<float> relativeDeviations[NumSamplingEstimators];
+    float lobePdfError = 0.0f, polygonPdfError = 0.0f;
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (!points[i].valid)
+            continue;
+        const SamplingResult& result = results[i];
+        for (int e = 0; e < NumSamplingEstimators; ++e) {
+            sum[e] += result.mean[e];
+            variance[e] += result.variance[e];
+            if (result.mean[e] > 0.0f)
+                relativeDeviations[e].push_back(std::sqrt(result.variance[e] * spp) / result.mean[e]);
+        }
+        lobePdfError = std::max(lobePdfError, result.lobePdfError);
+        polygonPdfError = std::max(polygonPdfError, result.polygonPdfError);
+    }
+    float median[NumSamplingEstimators];
+    for (int e = 0; e < NumSamplingEstimators; ++e) {
+        std::vector<float>& deviations = relativeDeviations[e];
+        std::nth_element(deviations.begin(), deviations.begin() + deviations.size() / 2, deviations.end());
+        median[e] = deviations.empty() ? 0.0f : deviations[deviations.size() / 2];
+    }
+
+    // the LTC alone underestimates the BRDF in places (f / pdf is unbounded, heavy tailed at low roughness), so the
+    // variance of its estimates is unreliable and their means are only compared relatively
+    const char* names[NumSamplingEstimators] = { "reference", "brdf", "ltc lobe", "ltc polygon", "polygon+brdf" };
+    const bool heavyTailed[NumSamplingEstimators] = { false, false, true, true, false };
+    const double maxDeviations = 4.0, maxRelativeDifference = 0.05;
+    bool pass = true;
+    std::cout << light.name << " light, " << spp << " samples per point and estimator" << std::endl;
+    for (int e = 0; e < NumSamplingEstimators; ++e) {
+        const double difference = std::abs(sum[e] - sum[SampleReference]);
+        const double deviations = difference / std::sqrt(std::max(variance[e] + variance[SampleReference], 1e-30));
+        const double relativeDifference = difference / std::max(sum[SampleReference], 1e-30);
+        std::cout << "  " << std::left << std::setw(13) << names[e] << std::right << std::scientific << std::setprecision(3)
+                  << " sum " << sum[e] << " standard error " << std::sqrt(variance[e])
+                  << std::fixed << std::setprecision(2) << "  median relative std " << median[e];
+        if (e != SampleReference) {
+            std::cout << "  difference " << 100.0 * relativeDifference << "%, " << deviations << " standard errors";
+            pass = pass && (heavyTailed[e] ? relativeDifference < maxRelativeDifference : deviations < maxDeviations);
+        }
+        std::cout << std::endl;
+    }
+    std::cout << std::scientific << std::setprecision(2)
+              << "  largest relative pdf difference: sampleLTC / pdfLTC " << lobePdfError
+              << ", samplePolygonLTC / pdfPolygonLTC " << polygonPdfError << std::endl;
+
+    // samplePolygonLTC has a lower variance than BRDF sampling at most points, and combined with BRDF sampling
+    // a lower total variance
+    const float maxPdfError = 1e-3f;
+    pass = pass && lobePdfError < maxPdfError && polygonPdfError < maxPdfError;
+    pass = pass && median[SamplePolygon] < median[SampleBrdf] && variance[SamplePolygonBrdf] < variance[SampleBrdf];
+    std::cout << (pass ? "PASS" : "FAIL") << std::endl;
+    return pass ? 0 : 1;
+}
+
+// count quad lights facing the floor, one per 6 x 6 units on average over a square around the floor (more lights
+// cover more area)
+static std::vector<ltc::PolygonLight> makeManyLights(int count)
+{
+    const float spacing = 6.0f;
+    const float side = spacing * std::sqrt(float(count));
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+
+    std::vector<ltc::PolygonLight> lights(count);
+    for (ltc::PolygonLight& light : lights) {
+        const glm::vec3 center((uniform(rng) - 0.5f) * side, 4.0f + (uniform(rng) - 0.5f) * side, 1.0f + 3.0f * uniform(rng));
+        // normal -z, counterclockwise around it (see integratePolygon)
+        const glm::vec3 axis1(0.0f, 0.1f + 0.2f * uniform(rng), 0.0f);
+        const glm::vec3 axis2(0.1f + 0.2f * uniform(rng), 0.0f, 0.0f);
+        light.points[0] = center - axis1 - axis2;
+        light.points[1] = center - axis1 + axis2;
+        light.points[2] = center + axis1 + axis2;
+        light.points[3] = center + axis1 - axis2;
+        light.radiance = 0.5f + uniform(rng);
+    }
+    return lights;
+}
+
+// compares LightBVH::shade to the sum of integratePolygon over all lights as the number of lights grows, returns the
+// exit code
+static int checkManyLights(const ltc::PackedTable& table, const std::vector<ShadingPoint>& points)
+{
+    const glm::vec3 N(0.0f, 0.0f, 1.0f);
+    const float threshold = 1e-4f;
+
+    std::vector<int> indices;
+    for (int i = 0; i < int(points.size()); ++i) {
+        if (points[i].valid)
+            indices.push_back(i);
+    }
+    std::vector<glm::mat3> worldToCosine(indices.size());
+    for (size_t k = 0; k < indices.size(); ++k) {
+        const ShadingPoint& point = points[indices[k]];
+        worldToCosine[k] = ltc::ltcWorldToCosine(ltc::lookupLTC(table, point.roughness, glm::dot(N, point.V)).invM, N, point.V);
+    }
+
+    std::cout << indices.size() << " shading points, threshold " << threshold << std::endl;
+    bool pass = true;
+    double previousSeconds = 0.0, previousWork = 0.0;
+    for (int count = 256; count <= 65536; count *= 4) {
+        const std::vector<ltc::PolygonLight> lights = makeManyLights(count);
+        const auto buildStart = std::chrono::steady_clock::now();
+        const ltc::LightBVH bvh(lights);
+        const double buildSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - buildStart).count();
+
+        std::vector<float> shaded(indices.size());
+        std::vector<ltc::LightBVHStats> stats(indices.size());
+        const auto bvhStart = std::chrono::steady_clock::now();
+        tbb::parallel_for(0, int(indices.size()), [&](int k) {
+            shaded[k] = bvh.shade(points[indices[k]].P, worldToCosine[k], false, threshold, &stats[k]);
+        });
+        const double bvhSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - bvhStart).count();
+
+        std::vector<double> brute(indices.size());
+        const auto bruteStart = std::chrono::steady_clock::now();
+        tbb::parallel_for(0, int(indices.size()), [&](int k) {
+            double sum = 0.0;
+            for (const ltc::PolygonLight& light : lights) {
+                glm::vec3 L[4];
+                for (int i = 0; i < 4; ++i)
+                    L[i] = worldToCosine[k] * (light.points[i] - points[indices[k]].P);
+                sum += light.radiance * ltc::integratePolygon(L, 4, false);
+            }
+            brute[k] = sum;
+        });
+        const double bruteSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - bruteStart).count();
+        float maxRadiance = 0.0f;
+        for (const ltc::PolygonLight& light : lights)
+            maxRadiance = std::max(maxRadiance, light.radiance);
+
+        // the error stays within the skipped bound, up to the rounding of the evaluated lights: integratePolygon sums
+        // edge terms of order 1 that cancel for small lights, so its rounding is absolute, about float epsilon times
+        // the radiance per light (the transforms are rounded differently in the BVH)
+        double sumError = 0.0, sumBrute = 0.0, lightsEvaluated = 0.0, nodesVisited = 0.0;
+        int violations = 0;
+        for (size_t k = 0; k < indices.size(); ++k) {
+            const double error = std::abs(shaded[k] - brute[k]);
+            const double rounding = stats[k].lightsEvaluated * double(std::numeric_limits<float>::epsilon()) * maxRadiance;
+            if (error > stats[k].skippedBound + rounding)
+                ++violations;
+            sumError += error;
+            sumBrute += brute[k];
+            lightsEvaluated += stats[k].lightsEvaluated;
+            nodesVisited += stats[k].nodesVisited;
+        }
+        pass = pass && violations == 0;
+
+        // exponents of the growth of the time of the BVH and of its work (nodes and lights) since the previous count,
+        // below 1 if sub-linear
+        const double work = lightsEvaluated + nodesVisited;
+        const double timeExponent = previousSeconds > 0.0 ? std::log(bvhSeconds / previousSeconds) / std::log(4.0) : 0.0;
+        const double workExponent = previousWork > 0.0 ? std::log(work / previousWork) / std::log(4.0) : 0.0;
+        previousSeconds = bvhSeconds;
+        previousWork = work;
+
+        std::cout << "  " << std::setw(6) << count << " lights: BVH " << std::fixed << std::setprecision(2)
+                  << bvhSeconds * 1e3 << " ms (build " << buildSeconds * 1e3 << " ms), brute force " << bruteSeconds * 1e3
+                  << " ms, " << bruteSeconds / bvhSeconds << "x faster" << std::endl;
+        std::cout << "         " << std::setprecision(1) << nodesVisited / indices.size() << " nodes and "
+                  << lightsEvaluated / indices.size() << " lights per point";
+        if (count > 256)
+            std::cout << std::setprecision(2) << ", growth time ~ n^" << timeExponent << ", work ~ n^" << workExponent;
+        std::cout << ", relative error " << std::scientific << std::setprecision(2) << sumError / std::max(sumBrute, 1e-30)
+                  << ", " << violations << " points above the bound" << std::endl;
+    }
+    std::cout << (pass ? "PASS" : "FAIL") << std::endl;
+    return pass ? 0 : 1;
+}
+
+// row major texels of a table in any layout
+static std::vector<glm::vec4> rowMajor(const std::vector<glm::vec4>& tex, int N, ltc::TableLayout layout)
+{
+    std::vector<glm::vec4> texels(N * N);
+    for (int t = 0; t < N; ++t) {
+        for (int a = 0; a < N; ++a)
+            texels[a + t * N] = tex[ltc::tableTexelIndex(layout, N, a, t)];
+    }
+    return texels;
+}
+
+// bilinear resampling of row major texels to M x M
+static std::vector<glm::vec4> resample(const std::vector<glm::vec4>& tex, int N, int M)
+{
+    std::vector<glm::vec4> texels(M * M);
+    for (int t = 0; t < M; ++t) {
+        for (int a = 0; a < M; ++a) {
+            const float x = a / float(M - 1) * (N - 1);
+            const float y = t / float(M - 1) * (N - 1);
+            const int a0 = std::min(int(x), N - 2);
+            const int t0 = std::min(int(y), N - 2);
+            const float fa = x - a0;
+            const float ft = y - t0;
+            texels[a + t * M] = (1.0f - ft) * ((1.0f - fa) * tex[a0 + t0 * N] + fa * tex[a0 + 1 + t0 * N])
+                + ft * ((1.0f - fa) * tex[a0 + (t0 + 1) * N] + fa * tex[a0 + 1 + (t0 + 1) * N]);
+        }
+    }
+    return texels;
+}
+
+// packed table in a layout, 64 byte aligned so that the lines of the layout are cache lines
+struct LayoutTable {
+    std::vector<glm::vec4> storage1, storage2;
+    ltc::PackedTable table;
+};
+
+static LayoutTable makeLayoutTable(const std::vector<glm::vec4>& tex1, const std::vector<glm::vec4>& tex2, int N, ltc::TableLayout layout)
+{
+    const auto align = [](glm::vec4* p) {
+        return reinterpret_cast<glm::vec4*>((reinterpret_cast<uintptr_t>(p) + 63) & ~uintptr_t(63));
+    };
+
+    const int numTexels = ltc::tableNumTexels(layout, N);
+    LayoutTable result;
+    result.storage1.resize(numTexels + 4);
+    result.storage2.resize(numTexels + 4);
+    result.table = { align(result.storage1.data()), align(result.storage2.data()), N, layout };
+    ltc::reorderTable(tex1.data(), const_cast<glm::vec4*>(result.table.tex1), N, layout);
+    ltc::reorderTable(tex2.data(), const_cast<glm::vec4*>(result.table.tex2), N, layout);
+    return result;
+}
+
+// the shading points of 8 x 8 pixel tiles, in tile order
+static std::vector<std::vector<int>> pixelTiles(const std::vector<ShadingPoint>& points, int width, int height)
+{
+    const int tileSize = 8;
+    std::vector<std::vector<int>> tiles;
+    for (int ty = 0; ty < height; ty += tileSize) {
+        for (int tx = 0; tx < width; tx += tileSize) {
+            std::vector<int> tile;
+            for (int y = ty; y < std::min(ty + tileSize, height); ++y) {
+                for (int x = tx; x < std::min(tx + tileSize, width); ++x) {
+                    if (points[x + y * width].valid)
+                        tile.push_back(x + y * width);
+                }
+            }
+            if (!tile.empty())
+                tiles.push_back(std::move(tile));
+        }
+    }
+    return tiles;
+}
+
+// distinct cache lines of a texture read by the lookups of a tile, as the bilinear taps of lookupLTC
+static int tileCacheLines(const ltc::PackedTable& table, const std::vector<ShadingPoint>& points, const std::vector<int>& tile)
+{
+    const int N = table.N;
+    std::vector<int> lines;
+    for (int i : tile) {
+        const float x = std::clamp(points[i].roughness, 0.0f, 1.0f) * (N - 1);
+        const float y = std::sqrt(1.0f - std::clamp(points[i].V.z, 0.0f, 1.0f)) * (N - 1);
+        const int a0 = std::min(int(x), N - 2);
+        const int t0 = std::min(int(y), N - 2);
+        for (int tap = 0; tap < 4; ++tap)
+            lines.push_back(ltc::tableTexelIndex(table.layout, N, a0 + tap % 2, t0 + tap / 2) / 4);
+    }
+    std::sort(lines.begin(), lines.end());
+    return int(std::unique(lines.begin(), lines.end()) - lines.begin());
+}
+
+// cache lines and throughput of batched lookups in every layout
+static void benchmarkLayouts(const std::vector<glm::vec4>& tex1, const std::vector<glm::vec4>& tex2, int N,
+    const std::vector<ShadingPoint>& points, const std::vector<std::vector<int>>& tiles, size_t numValid)
+{
+    const char* names[] = { "row major", "tiled", "morton" };
+    for (const ltc::TableLayout layout : { ltc::TableLayout::RowMajor, ltc::TableLayout::Tiled, ltc::TableLayout::Morton }) {
+        const LayoutTable layoutTable = makeLayoutTable(tex1, tex2, N, layout);
+        const ltc::PackedTable& table = layoutTable.table;
+
+        double lines = 0.0;
+        for (const std::vector<int>& tile : tiles)
+            lines += tileCacheLines(table, points, tile);
+
+        // the sum of the magnitudes keeps the lookups
+        std::vector<float> sums(tiles.size(), 0.0f);
+        const int passes = 16;
+        const auto start = std::chrono::steady_clock::now();
+        for (int pass = 0; pass < passes; ++pass) {
+            tbb::parallel_for(0, int(tiles.size()), [&](int i) {
+                float sum = 0.0f;
+                for (int p : tiles[i])
+                    sum += ltc::lookupLTC(table, points[p].roughness, points[p].V.z).terms.x;
+                sums[i] += sum;
+            });
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / passes;
+        volatile float total = 0.0f;
+        for (float sum : sums)
+            total = total + sum;
+
+        std::cout << "       " << std::left << std::setw(10) << names[int(layout)] << std::right << std::fixed << std::setprecision(2)
+                  << lines / tiles.size() << " cache lines per tile (" << lines / numValid << " per lookup), "
+                  << numValid / seconds * 1e-6 << " M lookups/s" << std::endl;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    std::filesystem::path tablePath;
+    std::filesystem::path outFolder = "bench";
+    int width = 320, height = 180, spp = 256, lookupN = 1024;
+    bool sampling = false;
+    bool manyLights = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--size" && i + 1 < argc) {
+            const std::string size = argv[++i];
+            const size_t x = size.find('x');
+            width = std::atoi(size.substr(0, x).c_str());
+            height = x == std::string::npos ? width : std::atoi(size.substr(x + 1).c_str());
+        } else if (arg == "--spp" && i + 1 < argc)
+            spp = std::atoi(argv[++i]);
+        else if (arg == "--lookup-N" && i + 1 < argc)
+            lookupN = std::atoi(argv[++i]);
+        else if (arg == "--out" && i + 1 < argc)
+            outFolder = argv[++i];
+        else if (arg == "--sampling")
+            sampling = true;
+        else if (arg == "--many-lights")
+            manyLights = true;
+        else if (arg.rfind("--", 0) != 0 && tablePath.empty())
+            tablePath = arg;
+        else
+            tablePath.clear(), width = 0;
+    }
+    if (tablePath.empty() || width <= 0 || height <= 0 || spp <= 0) {
+        std::cout << "usage: ltc_bench ltc_tex.bin [--size 320x180] [--spp 256] [--lookup-N 1024] [--out folder] [--sampling | --many-lights]" << std::endl;
+        return 1;
+    }
+
+    std::vector<glm::vec4> tex1, tex2;
+    int N;
+    ltc::TableLayout layout;
+    if (!ltc::readTexBlob(tablePath.string().c_str(), tex1, tex2, N, layout)) {
+        std::cout << "Could not read packed tables " << tablePath.string() << std::endl;
+        return 1;
+    }
+    const ltc::PackedTable table { tex1.data(), tex2.data(), N, layout };
+    const ltc::BrdfGGX brdf;
+
+    Camera camera;
+    camera.position = glm::vec3(0.0f, -6.0f, 3.0f);
+    camera.forward = glm::normalize(glm::vec3(0.0f, 3.0f, 0.3f) - camera.position);
+    camera.right = glm::normalize(glm::cross(camera.forward, glm::vec3(0.0f, 0.0f, 1.0f)));
+    camera.up = glm::cross(camera.right, camera.forward);
+    camera.tanHalfFov = std::tan(0.5f * 50.0f * pi / 180.0f);
+
+    const std::vector<ShadingPoint> points = traceFloor(camera, width, height);
+    const std::vector<Light> lights = makeLights();
+    const size_t numValid = std::count_if(points.begin(), points.end(), [](const ShadingPoint& p) { return p.valid; });
+    if (sampling)
+        return checkSampling(table, brdf, lights[0], points, spp);
+    if (manyLights)
+        return checkManyLights(table, points);
+
+    std::filesystem::create_directories(outFolder);
+    std::cout << width << " x " << height << " (" << numValid << " shading points), " << spp
+              << " samples per point and light for the reference, table " << N << " x " << N << std::endl;
+
+    std::vector<float> ltcSum(points.size(), 0.0f), referenceSum(points.size(), 0.0f), varianceSum(points.size(), 0.0f);
+    for (size_t l = 0; l < lights.size(); ++l) {
+        const Light& light = lights[l];
+        std::vector<float> ltcImage(points.size(), 0.0f), referenceImage(points.size(), 0.0f), varianceImage(points.size(), 0.0f);
+
+        // the LTC estimator is timed over several passes, it is fast
+        const int passes = 8;
+        const auto ltcStart = std::chrono::steady_clock::now();
+        for (int pass = 0; pass < passes; ++pass) {
+            tbb::parallel_for(0, height, [&](int y) {
+                for (int x = 0; x < width; ++x) {
+                    const int i = x + y * width;
+                    if (points[i].valid)
+                        ltcImage[i] = shadeLTC(table, light, points[i]);
+                }
+            });
+        }
+        const double ltcSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - ltcStart).count() / passes;
+
+        const auto referenceStart = std::chrono::steady_clock::now();
+        tbb::parallel_for(0, height, [&](int y) {
+            // deterministic per row and light
+            std::mt19937 rng(unsigned(y + l * height));
+            for (int x = 0; x < width; ++x) {
+                const int i = x + y * width;
+                if (points[i].valid)
+                    referenceImage[i] = shadeReference(brdf, light, points[i], spp, rng, varianceImage[i]);
+            }
+        });
+        const double referenceSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - referenceStart).count();
+
+        report(light.name, compare(points, ltcImage, referenceImage, varianceImage));
+        std::cout << std::fixed << std::setprecision(2)
+                  << "       LTC " << numValid / ltcSeconds * 1e-6 << " M points/s, reference "
+                  << numValid / referenceSeconds * 1e-3 << " k points/s ("
+                  << 2.0 * spp * numValid / referenceSeconds * 1e-6 << " M samples/s)" << std::endl;
+
+        saveImage(ltcImage, width, height, outFolder / ("ltc_" + std::string(light.name) + ".pfm"));
+        saveImage(referenceImage, width, height, outFolder / ("reference_" + std::string(light.name) + ".pfm"));
+        for (size_t i = 0; i < points.size(); ++i) {
+            ltcSum[i] += ltcImage[i];
+            referenceSum[i] += referenceImage[i];
+            varianceSum[i] += varianceImage[i];
+        }
+    }
+
+    report("all", compare(points, ltcSum, referenceSum, varianceSum));
+    saveImage(ltcSum, width, height, outFolder / "ltc_all.pfm");
+    saveImage(referenceSum, width, height, outFolder / "reference_all.pfm");
+
+    // batched lookups in the layouts, from the row major texels
+    const std::vector<std::vector<int>> tiles = pixelTiles(points, width, height);
+    const std::vector<glm::vec4> rowMajor1 = rowMajor(tex1, N, layout);
+    const std::vector<glm::vec4> rowMajor2 = rowMajor(tex2, N, layout);
+    std::cout << "lookups in " << tiles.size() << " tiles of 8 x 8 pixels, table " << N << " x " << N << std::endl;
+    benchmarkLayouts(rowMajor1, rowMajor2, N, points, tiles, numValid);
+    if (lookupN >= 2) {
+        std::cout << "lookups in " << tiles.size() << " tiles of 8 x 8 pixels, table resampled to " << lookupN << " x " << lookupN << std::endl;
+        benchmarkLayouts(resample(rowMajor1, N, lookupN), resample(rowMajor2, N, lookupN), lookupN, points, tiles, numValid);
+    }
+    return 0;
+}
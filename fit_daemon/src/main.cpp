@@ -0,0 +1,306 @@
+// Local fitting service: fits (or looks up) tables for the bundled BRDFs on request over a UNIX-domain socket.
+//
+//  ltc_daemon <socket> [cache directory]                    serve requests
+//  ltc_daemon --client <socket> <request> <brdf> <N> <out>  send a request and save the table (for testing)
+//
+// protocol, one request per connection:
+//  request: "fit <brdf> <N>\n" or "lookup <brdf> <N>\n", brdf is ggx, beckmann or disney_diffuse
+//  reply:   "OK <size>\n" followed by the binary table (writeTabBinary, see import.h), or "ERROR <message>\n"
+// fit requests are fitted unless the table is cached, lookup requests only return cached tables.
+// Identical requests in flight are fitted once, all fits share one TBB arena.
+// At most MaxConnections are served at once (the others are refused), a request line has to arrive within
+// RequestTimeout seconds.
+#include "ltc/brdf_beckmann.h"
+#include "ltc/brdf_disney_diffuse.h"
+#include "ltc/brdf_ggx.h"
+#include "ltc/fit_LTC.h"
+#include "ltc/import.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <tbb/task_arena.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace ltc;
+
+// connections served concurrently (each one on its own thread)
+constexpr int MaxConnections = 64;
+// time to receive a request line, in seconds
+constexpr int RequestTimeout = 10;
+
+static std::unique_ptr<Brdf> makeBrdf(const std::string& name)
+{
+    if (name == "ggx")
+        return std::make_unique<BrdfGGX>();
+    if (name == "beckmann")
+        return std::make_unique<BrdfBeckmann>();
+    if (name == "disney_diffuse")
+        return std::make_unique<BrdfDisneyDiffuse>();
+    return nullptr;
+}
+
+static bool sendAll(int fd, const void* data, size_t size)
+{
+    const char* bytes = static_cast<const char*>(data);
+    while (size > 0) {
+        const ssize_t sent = send(fd, bytes, size, MSG_NOSIGNAL);
+        if (sent <= 0)
+            return false;
+        bytes += sent;
+        size -= sent;
+    }
+    return true;
+}
+
+static bool readFile(const std::filesystem::path& path, std::vector<char>& data)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return false;
+    data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+// a cached table is valid if it can be read back (checksum)
+static bool readCached(const std::filesystem::path& path, int N, std::vector<char>& data)
+{
+    LTCTable tab(N);
+    return readTabBinary(path.string().c_str(), tab) && readFile(path, data);
+}
+
+class Daemon {
+public:
+    explicit Daemon(std::filesystem::path cacheDirectory_)
+        : cacheDirectory(std::move(cacheDirectory_))
+    {
+    }
+
+    // returns the binary table, throws a std::runtime_error on failure
+    std::vector<char> handle(const std::string& request, const std::string& brdfName, int N)
+    {
+        const std::unique_ptr<Brdf> brdf = makeBrdf(brdfName);
+        if (!brdf)
+            throw std::runtime_error("unknown BRDF " + brdfName);
+        if (N < 2 || N > 1024)
+            throw std::runtime_error("invalid table size");
+
+        FitSettings settings;
+        settings.cacheDirectory = cacheDirectory;
+        const std::filesystem::path path = fitCachePath(*brdf, N, settings);
+
+        std::vector<char> data;
+        if (readCached(path, N, data))
+            return data;
+        if (request == "lookup")
+            throw std::runtime_error("not cached");
+        if (request != "fit")
+            throw std::runtime_error("unknown request " + request);
+
+        // identical requests wait for the same fit
+        std::shared_future<std::vector<char>> result;
+        std::promise<std::vector<char>> promise;
+        bool owner = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            const auto it = inFlight.find(path.string());
+            if (it != inFlight.end()) {
+                result = it->second;
+            } else {
+                // a fit leaves inFlight once its table is in the cache, it may have done so since the check above
+                if (readCached(path, N, data))
+                    return data;
+                result = promise.get_future().share();
+                inFlight.emplace(path.string(), result);
+                owner = true;
+            }
+        }
+
+        if (owner) {
+            try {
+                LTCTable tab(N);
+                arena.execute([&]() { fitTab(tab, *brdf, settings); });
+                if (!readCached(path, N, data))
+                    throw std::runtime_error("could not write the table to the cache");
+                promise.set_value(std::move(data));
+            } catch (...) {
+                promise.set_exception(std::current_exception());
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            inFlight.erase(path.string());
+        }
+        return result.get();
+    }
+
+    void serve(int client)
+    {
+        // read the request line, recv times out after RequestTimeout (see runServer), as does the whole line
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(RequestTimeout);
+        std::string line;
+        char c = 0;
+        while (line.size() < 256 && std::chrono::steady_clock::now() < deadline && recv(client, &c, 1, 0) == 1 && c != '\n')
+            line += c;
+        if (c != '\n') {
+            const std::string header = "ERROR incomplete request\n";
+            sendAll(client, header.data(), header.size());
+            close(client);
+            return;
+        }
+
+        std::istringstream stream(line);
+        std::string request, brdfName;
+        int N = 0;
+        stream >> request >> brdfName >> N;
+
+        try {
+            const std::vector<char> data = handle(request, brdfName, N);
+            const std::string header = "OK " + std::to_string(data.size()) + "\n";
+            if (sendAll(client, header.data(), header.size()))
+                sendAll(client, data.data(), data.size());
+        } catch (const std::exception& e) {
+            const std::string header = std::string("ERROR ") + e.what() + "\n";
+            sendAll(client, header.data(), header.size());
+        }
+        close(client);
+    }
+
+private:
+    const std::filesystem::path cacheDirectory;
+    tbb::task_arena arena;
+
+    std::mutex mutex;
+    std::map<std::string, std::shared_future<std::vector<char>>> inFlight;
+};
+
+static bool socketAddress(const char* path, sockaddr_un& address)
+{
+    if (std::strlen(path) >= sizeof(address.sun_path))
+        return false;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    std::strcpy(address.sun_path, path);
+    return true;
+}
+
+static int runServer(const char* socketPath, const std::filesystem::path& cacheDirectory)
+{
+    sockaddr_un address;
+    if (!socketAddress(socketPath, address)) {
+        std::cerr << "Socket path too long" << std::endl;
+        return 1;
+    }
+
+    // a socket left by a previous daemon is replaced, any other file is kept
+    struct stat status;
+    if (lstat(socketPath, &status) == 0) {
+        if (!S_ISSOCK(status.st_mode)) {
+            std::cerr << socketPath << " exists and is not a socket" << std::endl;
+            return 1;
+        }
+        unlink(socketPath);
+    }
+
+    const int server = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (server < 0 || bind(server, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(server, 16) != 0) {
+        std::perror("Could not listen on the socket");
+        return 1;
+    }
+    std::cout << "Listening on " << socketPath << std::endl;
+
+    Daemon daemon(cacheDirectory);
+    std::atomic_int numConnections { 0 };
+    for (;;) {
+        const int client = accept(server, nullptr, nullptr);
+        if (client < 0)
+            continue;
+
+        if (numConnections >= MaxConnections) {
+            const std::string header = "ERROR too many connections\n";
+            sendAll(client, header.data(), header.size());
+            close(client);
+            continue;
+        }
+
+        // a client that never completes its request line does not keep its thread
+        const timeval timeout { RequestTimeout, 0 };
+        setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+        ++numConnections;
+        std::thread([&daemon, &numConnections, client]() {
+            daemon.serve(client);
+            --numConnections;
+        }).detach();
+    }
+}
+
+static int runClient(const char* socketPath, const std::string& request, const std::string& brdfName, const std::string& N, const char* outPath)
+{
+    sockaddr_un address;
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (!socketAddress(socketPath, address) || fd < 0 || connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        std::perror("Could not connect to the daemon");
+        return 1;
+    }
+
+    const std::string line = request + " " + brdfName + " " + N + "\n";
+    sendAll(fd, line.data(), line.size());
+
+    std::string header;
+    char c;
+    while (recv(fd, &c, 1, 0) == 1 && c != '\n')
+        header += c;
+    if (header.rfind("OK ", 0) != 0) {
+        std::cerr << header << std::endl;
+        close(fd);
+        return 1;
+    }
+
+    size_t size = std::stoull(header.substr(3));
+    std::vector<char> data(size);
+    size_t received = 0;
+    while (received < size) {
+        const ssize_t n = recv(fd, data.data() + received, size - received, 0);
+        if (n <= 0)
+            break;
+        received += n;
+    }
+    close(fd);
+    if (received != size) {
+        std::cerr << "Incomplete reply" << std::endl;
+        return 1;
+    }
+
+    std::ofstream file(outPath, std::ios::binary);
+    file.write(data.data(), data.size());
+    std::cout << "Received " << size << " bytes" << std::endl;
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc == 7 && std::string(argv[1]) == "--client")
+        return runClient(argv[2], argv[3], argv[4], argv[5], argv[6]);
+    if (argc == 2 || argc == 3)
+        return runServer(argv[1], argc == 3 ? argv[2] : "cache");
+
+    std::cerr << "usage: ltc_daemon <socket> [cache directory]" << std::endl;
+    std::cerr << "       ltc_daemon --client <socket> fit|lookup <brdf> <N> <output file>" << std::endl;
+    return 1;
+}
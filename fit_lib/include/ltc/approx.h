@@ -0,0 +1,70 @@
+#pragma once
+#include "runtime.h"
+#include <glm/vec4.hpp>
+#include <vector>
+
+namespace ltc {
+
+// Analytic approximation of the packed tables (see packTab), to shade without table fetches.
+// Each of the 8 channels (tex1 xyzw, tex2 xyzw) is a rational function P(x, y) / Q(x, y) of the coordinates of the
+// tables, x = roughness and y = sqrt(1 - cos(theta_v)) in [0, 1], with P and Q bivariate polynomials of total degree
+// numeratorDegree and denominatorDegree (a polynomial for denominatorDegree 0). The constant term of Q is 1 and
+// Q >= ApproxSettings::minDenominator on all of [0, 1]^2 (no poles, bounded with the Bernstein form of Q).
+// tex2.w is the sphere table (see genSphereTab), its coordinates are x = avgDir.z * 0.5 + 0.5 and y = formFactor
+// of a disk light instead (see integrateDisk in runtime.h): the exported evaluators have a separate function for it.
+// The coefficients of the term x^i y^j are stored by increasing j, then i (see approxTermIndex).
+
+struct ApproxSettings {
+    int numeratorDegree = 6;
+    int denominatorDegree = 2;
+    // Sanathanan-Koerner iterations of the rational fit (reweighted linear least squares)
+    int iterations = 8;
+    // lower bound of Q on [0, 1]^2 (Q is 1 at the origin)
+    float minDenominator = 0.1f;
+};
+
+struct ChannelApprox {
+    std::vector<float> numerator;
+    // the constant term is 1, empty for a polynomial
+    std::vector<float> denominator;
+};
+
+struct TableApprox {
+    int numeratorDegree = 0;
+    int denominatorDegree = 0;
+    ChannelApprox channels[8];
+};
+
+// error of a channel against the table, over the N x N cells
+struct ApproxError {
+    float maxAbs = 0.0f;
+    float rms = 0.0f;
+    // cell (a, t) of maxAbs
+    int worstA = 0;
+    int worstT = 0;
+};
+
+// index of the coefficient of x^i y^j in a polynomial of total degree
+inline int approxTermIndex(int i, int j, int degree)
+{
+    return j * (degree + 1) - j * (j - 1) / 2 + i;
+}
+
+inline int approxNumTerms(int degree)
+{
+    return (degree + 1) * (degree + 2) / 2;
+}
+
+// fit the channels of the N x N packed tables, in parallel
+TableApprox approximateTab(const glm::vec4* tex1, const glm::vec4* tex2, int N, const ApproxSettings& settings = ApproxSettings());
+
+// errors[8] of approx against the packed tables
+void approxErrors(const TableApprox& approx, const glm::vec4* tex1, const glm::vec4* tex2, int N, ApproxError* errors);
+
+// the packed texels at (x, y) of the tables (see above), tex2.w included
+void evalApprox(const TableApprox& approx, float x, float y, glm::vec4& tex1, glm::vec4& tex2);
+
+// LTC of a shading point from the approximation, replaces lookupLTC of the packed tables (see runtime.h)
+ShadingLTC lookupLTC(const TableApprox& approx, float roughness, float cosThetaV);
+
+}
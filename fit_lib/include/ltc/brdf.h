@@ -1,5 +1,6 @@
 #pragma once
 #include <glm/vec3.hpp>
+#include <string>
 
 namespace ltc {
 
@@ -12,7 +13,16 @@ public:
     virtual float eval(const glm::vec3& V, const glm::vec3& L, const float alpha, float& pdf) const = 0;
 
     // sampling
+    // the fit assumes an isotropic BRDF: for V in the xz-plane, U2 and 1 - U2 must give mirror images (y -> -y)
+    // so that only half of the domain needs to be integrated (see FitSettings::symmetric)
     virtual glm::vec3 sample(const glm::vec3& V, const float alpha, const float U1, const float U2) const = 0;
+
+    // stable identifier of the BRDF, its parameters and its sampling routine, part of the key of the table cache
+    // (see FitSettings::cacheDirectory), change it whenever eval or sample change. An empty identity disables caching.
+    virtual std::string identity() const
+    {
+        return {};
+    }
 };
 
 }
@@ -0,0 +1,45 @@
+#pragma once
+#include "brdf.h"
+#include <cstdint>
+#include <vector>
+
+namespace ltc {
+
+// BRDF tabulated on a regular grid (measured or authored data).
+// For each (alpha, theta_v) slice the BRDF (not cosine-weighted) is stored over the hemisphere of L in cells of
+// (cos(theta_l), phi_l - phi_v), with the relative azimuth in [0, pi] since the BRDF is assumed to be isotropic.
+//  * alpha is uniform in [alphaMin, alphaMax] and theta_v is uniform in [0, pi/2] (end points included)
+//  * cos(theta_l) and phi_l - phi_v are sampled at the centers of numCosThetaL x numPhi equally sized cells
+//  * values[((alpha * numThetaV + thetaV) * numCosThetaL + cosThetaL) * numPhi + phi]
+// eval interpolates the table, sample and pdf use precomputed alias tables of the nearest slice (O(1) per sample).
+class BrdfTabulated : public Brdf {
+public:
+    // binary file: "LTCB", uint32 version, uint32 numAlpha, numThetaV, numCosThetaL, numPhi,
+    // float alphaMin, alphaMax, followed by the values
+    // returns false if the file could not be read
+    bool load(const char* path);
+    void set(int numAlpha, int numThetaV, int numCosThetaL, int numPhi, float alphaMin, float alphaMax, std::vector<float> values);
+
+    float eval(const glm::vec3& V, const glm::vec3& L, const float alpha, float& pdf) const override;
+    glm::vec3 sample(const glm::vec3& V, const float alpha, const float U1, const float U2) const override;
+    // includes a hash of the table
+    std::string identity() const override;
+
+private:
+    void buildSamplingTables();
+    float lookup(int a, int v, float mu, float phi) const;
+    int nearestSlice(const glm::vec3& V, const float alpha) const;
+    void sliceCoordinates(const glm::vec3& V, const float alpha, float& a, float& v) const;
+
+    int numAlpha = 0, numThetaV = 0, numCosThetaL = 0, numPhi = 0;
+    float alphaMin = 0.0f, alphaMax = 1.0f;
+    std::vector<float> values;
+    uint64_t valuesHash = 0;
+
+    // per slice and cell: probability of the cell and alias table (Vose)
+    std::vector<float> cellProbability;
+    std::vector<float> aliasProbability;
+    std::vector<int> alias;
+};
+
+}
@@ -1,16 +1,59 @@
 #pragma once
+#include "runtime.h"
+#include <cstdint>
+#include <filesystem>
+#include <string>
 #include <glm/fwd.hpp>
 
 namespace ltc {
 
-// export data to C
-void writeTabC(glm::mat3* tab, glm::vec2* tabMagFresnel, int N);
+struct LightTexturePyramid;
+struct LTCTable;
+struct TableApprox;
+struct ApproxError;
+
+// the writers without a path write to fixed file names in outFolder
+
+// export data to C, one array per term of the table (see table.h)
+void writeTabC(const LTCTable& tab, const std::filesystem::path& outFolder = "results");
+
+// export data to a binary table (see import.h)
+void writeTabBinary(const char* path, const LTCTable& tab);
+void writeTabBinary(const LTCTable& tab, const std::filesystem::path& outFolder = "results");
 
 // export data to MATLAB
-void writeTabMatlab(glm::mat3* tab, glm::vec2* tabMagFresnel, int N);
+void writeTabMatlab(const LTCTable& tab, const std::filesystem::path& outFolder = "results");
 void writeDDS(const char* path, float* data, int N);
-void writeDDS(glm::vec4* data1, glm::vec4* data2, int N);
+// N x N RGBA texels already encoded to half floats (float_to_half_fast)
+void writeDDS(const char* path, const uint16_t* halfData, int N);
+void writeDDS(glm::vec4* data1, glm::vec4* data2, int N, const std::filesystem::path& outFolder = "results");
+// prefiltered light texture with its levels as mip levels (RGBA16F, see light_texture.h)
+void writeDDS(const char* path, const LightTexturePyramid& pyramid);
+// N x N RGBA half float texture array (DX10 header) with numSlices slices, slices[i] is slice i
+void writeDDSArray(const char* path, const uint16_t* const* slices, int numSlices, int N);
+// average albedo (1D table over alpha) for multiple-scattering compensation
+void writeAvgAlbedoDDS(const float* tabAvgAlbedo, int N, const std::filesystem::path& outFolder = "results");
+// export the packed textures as one binary blob for the WebGL demos (loaded through an ArrayBuffer):
+// "LTCP", version, N, number of textures (uint32), then N*N RGBA half floats per texture
+// the halfData are in the given layout (see runtime.h), the blobs of the other layouts are for the CPU runtime
+// (readTexBlob) and have a version 2 header with the layout
+void writeTexBlob(const char* path, const uint16_t* halfData1, const uint16_t* halfData2, int N, TableLayout layout = TableLayout::RowMajor);
+// row major data, reordered to the layout and written to ltc_tex.bin, ltc_tex_tiled.bin or ltc_tex_morton.bin
+void writeTexBlob(glm::vec4* data1, glm::vec4* data2, int N, const std::filesystem::path& outFolder = "results", TableLayout layout = TableLayout::RowMajor);
+// export the packed textures as C++ sources to compile into an application (see ltc_embed_tables in CMake):
+// <name>.h declares N and the 16 byte aligned tables tex1 and tex2 (N*N RGBA half floats) in namespace <name>,
+// <name>.cpp defines them
+void writeTabEmbedded(const uint16_t* halfData1, const uint16_t* halfData2, int N, const std::filesystem::path& outFolder = "results", const std::string& name = "ltc_tables");
+void writeTabEmbedded(glm::vec4* data1, glm::vec4* data2, int N, const std::filesystem::path& outFolder = "results", const std::string& name = "ltc_tables");
+// export the analytic approximation of the packed textures (see approx.h):
+// <name>.h defines the header only C++ evaluators <name>::eval and <name>::sphere, <name>.glsl the GLSL functions
+// <name>_tex1, <name>_tex2 and <name>_sphere (drop-in replacements of the texture lookups, tex2.w is the sphere
+// table, looked up at other coordinates), <name>.txt reports the errors (errors[8], see approxErrors) and lists the
+// coefficients
+void writeApproxCpp(const TableApprox& approx, int N, const std::filesystem::path& outFolder = "results", const std::string& name = "ltc_approx");
+void writeApproxGLSL(const TableApprox& approx, int N, const std::filesystem::path& outFolder = "results", const std::string& name = "ltc_approx");
+void writeApproxReport(const TableApprox& approx, const ApproxError* errors, int N, const std::filesystem::path& outFolder = "results", const std::string& name = "ltc_approx");
 // export data to Javascript
-void writeJS(glm::vec4* data1, glm::vec4* data2, int N);
+void writeJS(glm::vec4* data1, glm::vec4* data2, int N, const std::filesystem::path& outFolder = "results");
 
 }
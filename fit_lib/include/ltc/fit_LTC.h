@@ -1,18 +1,85 @@
 #pragma once
 #include "brdf.h"
+#include "table.h"
+#include <filesystem>
+#include <functional>
 #include <glm/fwd.hpp>
 
 namespace ltc {
 
-// Multi threaded and original single threaded version.
-void fitTab(glm::mat3* tab, glm::vec2* tabMagFresnel, const int N, const Brdf& brdf);
-void fitTabOrig(glm::mat3* tab, glm::vec2* tabMagFresnel, const int N, const Brdf& brdf);
+struct FitSettings {
+    // optional table of the same size used as the first guess of every cell (warm start, see import.h)
+    // cells no longer depend on their neighbors so the whole table is fitted in parallel
+    // cells whose matrix cannot be expressed in the frame of the cell start from the default first guess (reported)
+    const LTCTable* initialTab = nullptr;
+    // integrate over half of the hemisphere (y >= 0) and mirror it, V lies in the xz-plane and the BRDF is isotropic
+    // checked against the full hemisphere before fitting, falls back to the full hemisphere on mismatch
+    bool symmetric = true;
+    // evaluate the candidate points of Nelder-Mead concurrently while fewer rows than threads are being fitted
+    // gives the same result, trades extra evaluations for a shorter latency per cell
+    bool speculative = true;
+    // fit groups of rows (alpha) in lockstep, the error of the cells of a group is evaluated together so that the LTC
+    // math is vectorized across cells (the BRDF is still evaluated per cell)
+    bool lockstep = false;
+    // called from the fitting thread once all the cells of row a (alpha) are final, the rows complete in any order
+    // (see pipeline.h)
+    std::function<void(int a)> rowDone;
+    // optional directory of previously fitted tables, keyed by Brdf::identity(), N and the settings that affect the result
+    // a matching table is loaded instead of fitted (after verifying its checksum), new fits are added to it
+    // the key does not depend on the code: a change to the fitting code must increment FIT_VERSION (fit_LTC.cpp) and a
+    // change to a BRDF its Brdf::identity(), otherwise stale tables are loaded
+    std::filesystem::path cacheDirectory;
+};
+
+// Multi threaded and original single threaded version, fit the tab.N x tab.N cells of tab.
+void fitTab(LTCTable& tab, const Brdf& brdf, const FitSettings& settings = FitSettings());
+void fitTabOrig(LTCTable& tab, const Brdf& brdf);
+
+// binary table (see import.h) in settings.cacheDirectory that fitTab loads or writes for this fit
+// empty if the fit is not cached (no cache directory or BRDF without identity)
+std::filesystem::path fitCachePath(const Brdf& brdf, const int N, const FitSettings& settings);
+
+struct RefitSettings {
+    // a cell is an outlier if, along every axis (alpha and theta), its error exceeds errorThreshold times the
+    // error interpolated from its two neighbors or one of its packed coefficients deviates from the interpolation
+    // of its neighbors by more than discontinuityThreshold (relative)
+    float errorThreshold = 4.0f;
+    float discontinuityThreshold = 0.25f;
+    // number of samples (per dimension) used to measure the error and to refit outliers
+    int numSamples = 64;
+    // number of restarts from the best fit, the initial simplex doubles with every restart
+    int numRestarts = 2;
+    // see FitSettings::symmetric
+    bool symmetric = true;
+};
+
+// Refit the cells of a fitted table that converged to a poor minimum, in parallel.
+// The outliers are refitted starting from their own and their neighbors' matrices and patched in place.
+// The magnitude and fresnel terms of the patched cells are recomputed with settings.numSamples, those of the other
+// cells are kept unless missing (zero), so tab may come from an imported table with the matrices only.
+// Returns the number of patched cells.
+int refitTab(LTCTable& tab, const Brdf& brdf, const RefitSettings& settings = RefitSettings());
 
 void genSphereTab(float* tabSphere, int N);
+
+// average albedo (1D table over alpha) from the directional albedo (magnitude) of a fitted table
+// used for multiple-scattering energy compensation (Kulla & Conty 2017):
+// fms = (1 - E(mu_o)) * (1 - E(mu_i)) / (pi * (1 - Eavg))
+void genAvgAlbedoTab(float* tabAvgAlbedo, const LTCTable& tab);
+// average albedo of row a only (reads the cells of that row)
+void genAvgAlbedoRow(float* tabAvgAlbedo, const LTCTable& tab, int a);
+
+// tabAvgAlbedo is optional, when provided it is replicated into the unused channel of tex2
 void packTab(
     glm::vec4* tex1, glm::vec4* tex2,
-    const glm::mat3* tab,
-    const glm::vec2* tabMagFresnel,
+    const LTCTable& tab,
+    const float* tabSphere,
+    const float* tabAvgAlbedo = nullptr);
+// pack row a only (the cells a + t * N), reads tabSphere of the same cells
+void packTabRow(
+    glm::vec4* tex1, glm::vec4* tex2,
+    const LTCTable& tab,
     const float* tabSphere,
-    int N);
+    int a,
+    const float* tabAvgAlbedo = nullptr);
 }
\ No newline at end of file
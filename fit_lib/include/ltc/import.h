@@ -0,0 +1,24 @@
+#pragma once
+#include "runtime.h"
+#include "table.h"
+#include <glm/fwd.hpp>
+#include <vector>
+
+namespace ltc {
+
+// import previously exported tables, e.g. as a first guess for fitting (FitSettings::initialTab)
+// the tables are resampled to tab.N x tab.N when the stored table has a different size
+// returns false if the file could not be read
+
+// binary table (writeTabBinary), the checksum is verified, with the magnitude and fresnel terms
+bool readTabBinary(const char* path, LTCTable& tab);
+// packed DDS texture (ltc_1.dds from writeDDS), only the matrices
+bool readDDS(const char* path, LTCTable& tab);
+// packed Javascript arrays (ltc.js from writeJS), only the matrices
+bool readJS(const char* path, LTCTable& tab);
+
+// packed textures of a blob (ltc_tex.bin from writeTexBlob) as they are, N and the layout are read from the file
+// (tableNumTexels(layout, N) texels per texture, see runtime.h)
+bool readTexBlob(const char* path, std::vector<glm::vec4>& tex1, std::vector<glm::vec4>& tex2, int& N, TableLayout& layout);
+
+}
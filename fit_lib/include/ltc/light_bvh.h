@@ -0,0 +1,56 @@
+#pragma once
+#include <glm/mat3x3.hpp>
+#include <glm/vec3.hpp>
+#include <vector>
+
+namespace ltc {
+
+// quad light (planar, convex), vertices wound as for integratePolygon (see runtime.h)
+struct PolygonLight {
+    glm::vec3 points[4];
+    // emitted radiance
+    float radiance;
+};
+
+struct LightBVHStats {
+    int nodesVisited = 0;
+    int lightsEvaluated = 0;
+    // sum of the bounds of the skipped nodes, an upper bound of the error of shade
+    float skippedBound = 0.0f;
+};
+
+// Bounding volume hierarchy over polygon lights, to shade with many lights at a cost that grows with the number of
+// lights that contribute rather than with the number of lights.
+// The contribution of a node is bounded through the LTC of the shading point, by the smaller of:
+//  * the projected solid angle (ihemi) of the cap that contains the corners of its box in the space of the cosine,
+//    times the sum of the radiance of its lights
+//  * the maximum of the LTC distribution times the solid angle of its lights (area / distance^2, times radiance)
+class LightBVH {
+public:
+    explicit LightBVH(std::vector<PolygonLight> lights);
+
+    // Sum of radiance * integratePolygon of the lights at P, worldToCosine from ltcWorldToCosine (the magnitude and
+    // fresnel terms are applied by the caller). Nodes whose contribution is bounded by threshold are skipped.
+    float shade(const glm::vec3& P, const glm::mat3& worldToCosine, bool twoSided, float threshold,
+        LightBVHStats* stats = nullptr) const;
+
+private:
+    struct Node {
+        glm::vec3 boundsMin, boundsMax;
+        float sumRadiance;
+        float sumPower; // radiance * area
+        // inner node: the children are this + 1 and secondChild, leaf: the lights [firstLight, firstLight + numLights)
+        int secondChild;
+        int firstLight;
+        int numLights;
+    };
+
+    int build(int begin, int end);
+    // the cap is only computed when the cheaper bound is above threshold
+    float bound(const Node& node, const glm::vec3& P, const glm::mat3& worldToCosine, float maxDensity, float threshold) const;
+
+    std::vector<PolygonLight> lights;
+    std::vector<Node> nodes;
+};
+
+}
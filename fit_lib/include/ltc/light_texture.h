@@ -0,0 +1,39 @@
+#pragma once
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+#include <vector>
+
+namespace ltc {
+
+// Prefiltered emission texture of a textured polygon light (Heitz et al. 2016, "Real-Time Polygonal-Light Shading
+// with Linearly Transformed Cosines", section 5.3).
+// The texture is placed in the center of a canvas with a border of about LightTextureBorder (of the canvas) on each
+// side, filled with the clamped edge of the texture, so that footprints partly outside the light find its edge color.
+// Level l is the canvas blurred with a Gaussian of about 2^l texels (of level 0), at the resolution of mip level l.
+constexpr float LightTextureBorder = 0.125f;
+
+struct LightTexturePyramid {
+    // levels[l] is widths[l] x heights[l] RGBA, row major
+    std::vector<int> widths;
+    std::vector<int> heights;
+    std::vector<std::vector<glm::vec4>> levels;
+
+    // canvas coordinates of the texture coordinates of the light: uvOffset + uv * uvScale
+    glm::vec2 uvOffset;
+    glm::vec2 uvScale;
+    // size of the light in level 0 texels, sqrt(width * height)
+    float lightTexels;
+};
+
+// data is width x height RGBA, row major; the levels are filtered in parallel (separable, by rows)
+LightTexturePyramid buildLightTexturePyramid(const glm::vec4* data, int width, int height);
+
+// Filtered emission to multiply with the LTC polygon integral. p0, p1 and p3 are the corners of the (parallelogram)
+// light at texture coordinates (0, 0), (1, 0) and (0, 1), transformed to the space of the clamped cosine
+// (by the inverse LTC matrix) relative to the shading point.
+// The texture is looked up at the orthogonal projection of the shading point on the plane of the light, in the level
+// of the footprint of the cosine lobe at the distance of that plane (trilinear).
+glm::vec4 lookupLightTexture(const LightTexturePyramid& pyramid, const glm::vec3& p0, const glm::vec3& p1, const glm::vec3& p3);
+
+}
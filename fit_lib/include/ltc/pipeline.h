@@ -0,0 +1,51 @@
+#pragma once
+#include "approx.h"
+#include "brdf.h"
+#include "fit_LTC.h"
+#include <cstdint>
+#include <filesystem>
+#include <glm/vec4.hpp>
+#include <string>
+#include <vector>
+
+namespace ltc {
+
+// packed textures of a fitted table (see packTab), N x N texels each, and their half float encoding (the exported
+// textures)
+struct PackedTables {
+    int N = 0;
+    std::vector<glm::vec4> tex1;
+    std::vector<glm::vec4> tex2;
+    std::vector<uint16_t> half1;
+    std::vector<uint16_t> half2;
+};
+
+// pack a fitted table with packTab and encode it to half floats
+PackedTables packTables(const LTCTable& tab, const float* tabSphere, const float* tabAvgAlbedo);
+
+// fit a table (through the cache of settings.cacheDirectory when set) and pack it, without any export
+PackedTables fitTabPacked(const Brdf& brdf, const int N, const FitSettings& settings);
+
+// Fit a table and export it, with the same outputs as fitTab followed by genSphereTab, genAvgAlbedoTab, packTab,
+// the writers of export.h and make_spherical_plots, but with the stages overlapped:
+//  * genSphereTab runs concurrently with the fit
+//  * every row (alpha) is packed and encoded to half floats as soon as it is fitted (and the sphere table is ready)
+//  * the plots of a roughness are rendered as soon as the rows they interpolate are fitted
+// the writers need the whole table and run concurrently once the last row is packed
+// the tables are written to resultsFolder and the plots to plotFolder, settings.rowDone is used by the pipeline
+// embedName names the C++ sources of writeTabEmbedded, returns the packed textures
+PackedTables fitTabPipelined(const Brdf& brdf, const int N, const FitSettings& settings,
+    const std::filesystem::path& resultsFolder, const std::filesystem::path& plotFolder,
+    const std::string& embedName = "ltc_tables");
+
+// Write the packed textures of tables of the same size (one per BRDF) as the slices of two texture arrays,
+// ltc_1_array.dds and ltc_2_array.dds (DX10 header, RGBA16F), slice i is tables[i]. A shader binds both arrays once
+// and selects the BRDF by slice index.
+void writeTabArray(const std::vector<const PackedTables*>& tables, const std::filesystem::path& resultsFolder);
+
+// Approximate the packed textures of a table with approximateTab and write the approximation with writeApproxCpp,
+// writeApproxGLSL and writeApproxReport
+void writeTabApprox(const PackedTables& table, const ApproxSettings& approxSettings,
+    const std::filesystem::path& resultsFolder, const std::string& name = "ltc_approx");
+
+}
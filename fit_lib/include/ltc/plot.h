@@ -1,5 +1,6 @@
 #pragma once
 #include "brdf.h"
+#include "table.h"
 #include <filesystem>
 #include <glm/fwd.hpp>
 
@@ -9,7 +10,15 @@ namespace ltc {
 // evaluate the BRDF or the LTC
 // call the color map
 void make_spherical_plots(
-    const Brdf& brdf, const glm::mat3* tab, const int N,
+    const Brdf& brdf, const LTCTable& tab,
+    const std::filesystem::path& outFolder);
+
+// plots of a single roughness (alphaIndex < NumSphericalPlotAlphas), only reads the rows [minRow, maxRow] of tab
+// so they can be rendered while the other rows are being fitted
+constexpr int NumSphericalPlotAlphas = 7;
+void sphericalPlotRows(int alphaIndex, int N, int& minRow, int& maxRow);
+void make_spherical_plots(
+    const Brdf& brdf, const LTCTable& tab, const int alphaIndex,
     const std::filesystem::path& outFolder);
 
 }
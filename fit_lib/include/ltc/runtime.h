@@ -0,0 +1,75 @@
+#pragma once
+#include <cstdint>
+#include <glm/mat3x3.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+
+namespace ltc {
+
+// CPU shading of polygon lights with the packed tables (see packTab), as in the WebGL demos
+
+// order of the texels of the packed tables in memory, texel (a, t) at roughness a / (N - 1) and
+// sqrt(1 - cos(theta_v)) = t / (N - 1)
+enum class TableLayout : uint32_t {
+    // texel a + t * N, as the textures of the shaders
+    RowMajor = 0,
+    // row major tiles of TableTileSize x TableTileSize row major texels, N is padded to a multiple of TableTileSize
+    // a tile is one cache line (64 bytes) in 64 byte aligned tables, the four taps of a bilinear lookup are in one to
+    // four lines (2.25 on average, 2.5 row major)
+    Tiled = 1,
+    // Morton (Z) order, the bits of a and t interleaved (a in the even bits), N is padded to a power of two
+    // the aligned 2 x 2 blocks are lines as the tiles, and neighbouring blocks are close at every scale
+    Morton = 2
+};
+
+constexpr int TableTileSize = 2;
+
+// N x N texels in the given layout
+struct PackedTable {
+    const glm::vec4* tex1;
+    const glm::vec4* tex2;
+    int N;
+    TableLayout layout = TableLayout::RowMajor;
+};
+
+// index of texel (a, t) in the layout
+int tableTexelIndex(TableLayout layout, int N, int a, int t);
+// number of texels of an N x N table in the layout, with the padding
+int tableNumTexels(TableLayout layout, int N);
+// reorder the N x N row major texels of src to the layout, dst holds tableNumTexels texels (the padding is zero)
+void reorderTable(const glm::vec4* src, glm::vec4* dst, int N, TableLayout layout);
+
+// LTC of a shading point: the inverse matrix in the local frame (normal along z, V in the xz-plane)
+// and the terms of tex2 (magnitude, fresnel, average albedo, sphere)
+struct ShadingLTC {
+    glm::mat3 invM;
+    glm::vec4 terms;
+};
+
+// bilinear lookup of the packed tables, like the shaders
+ShadingLTC lookupLTC(const PackedTable& table, float roughness, float cosThetaV);
+
+// matrix that transforms world directions (relative to the shading point) to the space of the clamped cosine,
+// invM of lookupLTC rotated to the frame of the normal N and view direction V
+glm::mat3 ltcWorldToCosine(const glm::mat3& invM, const glm::vec3& N, const glm::vec3& V);
+
+// maximum number of vertices of the polygons passed to integratePolygon
+constexpr int MaxPolygonVertices = 8;
+
+// Integral of the normalized clamped cosine over the polygon L[0], ..., L[n - 1] (in the space of the cosine,
+// relative to the shading point), clipped to the horizon. Multiplied by the radiance of the light and the
+// magnitude / fresnel terms, this is the reflected radiance.
+// One sided lights emit towards the side from which their vertices appear clockwise (counterclockwise around z
+// when seen from above), the integral is 0 from the other side.
+float integratePolygon(const glm::vec3* L, int n, bool twoSided);
+
+// Integral over the ellipse of center C and axes V1 and V2 (the conjugate semi-diameters, in the space of the cosine
+// relative to the shading point), as ltc_disk.fs: the form factor of the ellipse, corrected for the horizon with the
+// sphere term of tex2 (see genSphereTab). One sided disks emit away from cross(V1, V2).
+float integrateDisk(const glm::vec3& C, const glm::vec3& V1, const glm::vec3& V2, bool twoSided, const PackedTable& table);
+
+// Integral over the cylinder p1 -> p2 of the given (small) radius, relative to the shading point in the local frame of
+// invM (not transformed), as ltc_line.fs: a line of the width of the cylinder, without its end caps.
+float integrateLine(const glm::mat3& invM, const glm::vec3& p1, const glm::vec3& p2, float radius);
+
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include "runtime.h"
+#include <glm/mat3x3.hpp>
+#include <glm/vec3.hpp>
+
+namespace ltc {
+
+// Importance sampling with the fitted LTCs, for path tracers.
+// invM transforms directions to the space of the clamped cosine: the invM of lookupLTC (directions in its local
+// frame) or ltcWorldToCosine (world directions). The pdfs are with respect to solid angle and do not include the
+// magnitude of the LTC.
+// For area lights, sampling the LTC lobe has a higher variance than BRDF sampling (most samples miss the light):
+// use samplePolygonLTC instead. It has a much lower variance at most shading points, but the LTC underestimates the
+// BRDF in places at low roughness, so combine it with BRDF sampling (multiple importance sampling with pdfPolygonLTC)
+// to bound the weights of those samples.
+
+// count directions of the LTC lobe, from count pairs of uniform numbers
+void sampleLTC(const glm::mat3& invM, int count, const float* U1, const float* U2, glm::vec3* directions, float* pdfs);
+// pdf of sampleLTC for count directions
+void pdfLTC(const glm::mat3& invM, int count, const glm::vec3* directions, float* pdfs);
+
+// one direction per (roughness, cos(theta_v)), each with its own LTC looked up in the packed tables,
+// in the local frame of lookupLTC
+void sampleLTC(const PackedTable& table, int count, const float* roughness, const float* cosThetaV,
+    const float* U1, const float* U2, glm::vec3* directions, float* pdfs);
+
+// count directions uniformly distributed over the polygon light (in the space of the cosine, clipped to the horizon),
+// so the directions are within the light and distributed like the LTC restricted to it, up to the cosine.
+// points are the vertices of a convex polygon (at most MaxPolygonVertices) relative to the shading point.
+// Returns false (and zero pdfs) if the polygon is below the horizon.
+bool samplePolygonLTC(const glm::mat3& invM, const glm::vec3* points, int n, int count,
+    const float* U1, const float* U2, glm::vec3* directions, float* pdfs);
+// pdf of samplePolygonLTC for count directions, 0 outside of the light
+void pdfPolygonLTC(const glm::mat3& invM, const glm::vec3* points, int n, int count,
+    const glm::vec3* directions, float* pdfs);
+
+}
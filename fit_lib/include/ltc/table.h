@@ -0,0 +1,50 @@
+#pragma once
+#include <glm/mat3x3.hpp>
+#include <vector>
+
+namespace ltc {
+
+// Fitted table of N x N cells, cell a + t * N at roughness a / (N - 1) and sqrt(1 - cos(theta)) = t / (N - 1).
+// V lies in the xz-plane and the BRDFs are isotropic, so the matrix M of a fitted LTC has five non-zero terms
+//     | m00  0   m20 |
+//     |  0  m11   0  |
+//     | m02  0   m22 |
+// (mij = M[i][j], column i and row j as glm), stored one array per term (SoA) with the magnitude and fresnel terms.
+struct LTCTable {
+    LTCTable() = default;
+    explicit LTCTable(int N_)
+        : N(N_)
+        , m00(N_ * N_)
+        , m02(N_ * N_)
+        , m11(N_ * N_)
+        , m20(N_ * N_)
+        , m22(N_ * N_)
+        , magnitude(N_ * N_)
+        , fresnel(N_ * N_)
+    {
+    }
+
+    int N = 0;
+    std::vector<float> m00, m02, m11, m20, m22;
+    std::vector<float> magnitude, fresnel;
+
+    glm::mat3 matrix(int i) const
+    {
+        return glm::mat3(
+            m00[i], 0, m02[i],
+            0, m11[i], 0,
+            m20[i], 0, m22[i]);
+    }
+
+    // the other terms of M are dropped
+    void setMatrix(int i, const glm::mat3& M)
+    {
+        m00[i] = M[0][0];
+        m02[i] = M[0][2];
+        m11[i] = M[1][1];
+        m20[i] = M[2][0];
+        m22[i] = M[2][2];
+    }
+};
+
+}
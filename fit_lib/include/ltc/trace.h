@@ -0,0 +1,34 @@
+#pragma once
+
+// Timeline instrumentation, enabled with the LTC_ENABLE_TRACING CMake option.
+// LTC_TRACE_ZONE(name) records the duration of the enclosing scope into a ring buffer of the calling thread,
+// LTC_TRACE_DUMP(path) writes the zones of all threads as Chrome trace JSON (chrome://tracing or ui.perfetto.dev).
+// name must be a string literal. Both macros compile to nothing when tracing is disabled.
+#ifdef LTC_ENABLE_TRACING
+#include <cstdint>
+
+namespace ltc::trace {
+
+class Zone {
+public:
+    explicit Zone(const char* name);
+    ~Zone();
+
+private:
+    const char* name;
+    int64_t start;
+};
+
+// call once the traced work is done, zones still being recorded may be missing
+bool dump(const char* path);
+
+}
+
+#define LTC_TRACE_CONCAT_(a, b) a##b
+#define LTC_TRACE_CONCAT(a, b) LTC_TRACE_CONCAT_(a, b)
+#define LTC_TRACE_ZONE(name) const ::ltc::trace::Zone LTC_TRACE_CONCAT(ltcTraceZone, __LINE__)(name)
+#define LTC_TRACE_DUMP(path) ::ltc::trace::dump(path)
+#else
+#define LTC_TRACE_ZONE(name)
+#define LTC_TRACE_DUMP(path)
+#endif
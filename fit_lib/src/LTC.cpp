@@ -23,7 +23,7 @@ void LTC::update() // compute matrix from parameters
 {
     M = glm::mat3(X, Y, Z) * glm::mat3(m11, 0, 0, 0, m22, 0, m13, 0, 1);
     invM = inverse(M);
-    detM = abs(glm::determinant(M));
+    detM = std::abs(glm::determinant(M));
 }
 
 float LTC::eval(const glm::vec3& L) const
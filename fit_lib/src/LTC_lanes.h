@@ -0,0 +1,74 @@
+#pragma once
+#include "LTC.h"
+#include <cmath>
+
+namespace ltc {
+
+// W LTCs in structure of arrays form, one per lane, so that the matrix math of LTC::eval and LTC::sample
+// is evaluated for all lanes with the same instructions
+template <int W>
+struct LTCLanes {
+    // column major (M[3 * column + row])
+    float M[9][W];
+    float invM[9][W];
+    float detM[W];
+    float magnitude[W];
+
+    void set(int lane, const LTC& ltc)
+    {
+        for (int c = 0; c < 3; ++c) {
+            for (int r = 0; r < 3; ++r) {
+                M[3 * c + r][lane] = ltc.M[c][r];
+                invM[3 * c + r][lane] = ltc.invM[c][r];
+            }
+        }
+        detM[lane] = ltc.detM;
+        magnitude[lane] = ltc.magnitude;
+    }
+
+    // same as LTC::sample, for every lane
+    void sample(const float U1, const float U2, float (&L)[3][W]) const
+    {
+        // the direction in the original (clamped cosine) distribution is shared by all lanes
+        const float theta = std::acos(std::sqrt(U1));
+        const float phi = 2.0f * 3.14159f * U2;
+        const float x = std::sin(theta) * std::cos(phi);
+        const float y = std::sin(theta) * std::sin(phi);
+        const float z = std::cos(theta);
+
+        for (int l = 0; l < W; ++l) {
+            const float Lx = M[0][l] * x + M[3][l] * y + M[6][l] * z;
+            const float Ly = M[1][l] * x + M[4][l] * y + M[7][l] * z;
+            const float Lz = M[2][l] * x + M[5][l] * y + M[8][l] * z;
+            const float invLength = 1.0f / std::sqrt(Lx * Lx + Ly * Ly + Lz * Lz);
+            L[0][l] = Lx * invLength;
+            L[1][l] = Ly * invLength;
+            L[2][l] = Lz * invLength;
+        }
+    }
+
+    // same as LTC::eval, for every lane
+    void eval(const float (&L)[3][W], float (&result)[W]) const
+    {
+        for (int l = 0; l < W; ++l) {
+            float x = invM[0][l] * L[0][l] + invM[3][l] * L[1][l] + invM[6][l] * L[2][l];
+            float y = invM[1][l] * L[0][l] + invM[4][l] * L[1][l] + invM[7][l] * L[2][l];
+            float z = invM[2][l] * L[0][l] + invM[5][l] * L[1][l] + invM[8][l] * L[2][l];
+            const float invLength = 1.0f / std::sqrt(x * x + y * y + z * z);
+            x *= invLength;
+            y *= invLength;
+            z *= invLength;
+
+            const float Lx = M[0][l] * x + M[3][l] * y + M[6][l] * z;
+            const float Ly = M[1][l] * x + M[4][l] * y + M[7][l] * z;
+            const float Lz = M[2][l] * x + M[5][l] * y + M[8][l] * z;
+            const float length = std::sqrt(Lx * Lx + Ly * Ly + Lz * Lz);
+            const float Jacobian = detM[l] / (length * length * length);
+
+            const float D = 1.0f / 3.14159f * std::max<float>(0.0f, z);
+            result[l] = magnitude[l] * D / Jacobian;
+        }
+    }
+};
+
+}
@@ -0,0 +1,327 @@
+#include "ltc/approx.h"
+#include "ltc/trace.h"
+#include <algorithm>
+#include <cmath>
+#include <tbb/parallel_for.h>
+
+namespace ltc {
+
+static float evalPolynomial(const float* coefficients, int degree, float x, float y)
+{
+    // Horner in y of Horner in x
+    float p = 0.0f;
+    for (int j = degree; j >= 0; --j) {
+        float q = 0.0f;
+        for (int i = degree - j; i >= 0; --i)
+            q = q * x + coefficients[approxTermIndex(i, j, degree)];
+        p = p * y + q;
+    }
+    return p;
+}
+
+static float evalDenominator(const ChannelApprox& channel, int degree, float x, float y)
+{
+    return channel.denominator.empty() ? 1.0f : evalPolynomial(channel.denominator.data(), degree, x, y);
+}
+
+static float evalChannel(const ChannelApprox& channel, int numeratorDegree, int denominatorDegree, float x, float y)
+{
+    return evalPolynomial(channel.numerator.data(), numeratorDegree, x, y)
+        / evalDenominator(channel, denominatorDegree, x, y);
+}
+
+// least squares solution of A x = b (rows x cols, row major), Householder QR with normalized columns
+static std::vector<double> solveLeastSquares(std::vector<double> A, std::vector<double> b, int rows, int cols)
+{
+    std::vector<double> scale(cols, 0.0);
+    for (int c = 0; c < cols; ++c) {
+        for (int r = 0; r < rows; ++r)
+            scale[c] += A[r * cols + c] * A[r * cols + c];
+        scale[c] = scale[c] > 0.0 ? 1.0 / std::sqrt(scale[c]) : 1.0;
+        for (int r = 0; r < rows; ++r)
+            A[r * cols + c] *= scale[c];
+    }
+
+    for (int c = 0; c < cols; ++c) {
+        double norm = 0.0;
+        for (int r = c; r < rows; ++r)
+            norm += A[r * cols + c] * A[r * cols + c];
+        norm = std::sqrt(norm);
+        if (norm == 0.0)
+            continue;
+
+        // reflect column c onto -sign(A[c][c]) * norm * e_c
+        const double alpha = A[c * cols + c] > 0.0 ? -norm : norm;
+        std::vector<double> v(rows - c);
+        for (int r = c; r < rows; ++r)
+            v[r - c] = A[r * cols + c];
+        v[0] -= alpha;
+        double vv = 0.0;
+        for (double vi : v)
+            vv += vi * vi;
+        if (vv == 0.0)
+            continue;
+
+        for (int k = c; k < cols; ++k) {
+            double dot = 0.0;
+            for (int r = c; r < rows; ++r)
+                dot += v[r - c] * A[r * cols + k];
+            const double f = 2.0 * dot / vv;
+            for (int r = c; r < rows; ++r)
+                A[r * cols + k] -= f * v[r - c];
+        }
+        double dot = 0.0;
+        for (int r = c; r < rows; ++r)
+            dot += v[r - c] * b[r];
+        const double f = 2.0 * dot / vv;
+        for (int r = c; r < rows; ++r)
+            b[r] -= f * v[r - c];
+    }
+
+    // back substitution, dependent columns are set to 0
+    std::vector<double> x(cols, 0.0);
+    for (int c = cols - 1; c >= 0; --c) {
+        double sum = b[c];
+        for (int k = c + 1; k < cols; ++k)
+            sum -= A[c * cols + k] * x[k];
+        x[c] = std::abs(A[c * cols + c]) > 1e-12 ? sum / A[c * cols + c] : 0.0;
+    }
+    for (int c = 0; c < cols; ++c)
+        x[c] *= scale[c];
+    return x;
+}
+
+// sum of the squared errors over the cells
+static double fitError(const ChannelApprox& channel, int numeratorDegree, int denominatorDegree, const std::vector<float>& values, int N)
+{
+    double sum = 0.0;
+    for (int t = 0; t < N; ++t) {
+        for (int a = 0; a < N; ++a) {
+            const double error = evalChannel(channel, numeratorDegree, denominatorDegree, a / float(N - 1), t / float(N - 1)) - values[a + t * N];
+            sum += error * error;
+        }
+    }
+    return sum;
+}
+
+// the monomials x^i y^j of a polynomial of total degree, in the order of approxTermIndex
+static void monomials(double x, double y, int degree, double* terms)
+{
+    double yj = 1.0;
+    for (int j = 0; j <= degree; ++j, yj *= y) {
+        double xi = 1.0;
+        for (int i = 0; i <= degree - j; ++i, xi *= x)
+            terms[approxTermIndex(i, j, degree)] = xi * yj;
+    }
+}
+
+static double binomial(int n, int k)
+{
+    double c = 1.0;
+    for (int i = 1; i <= k; ++i)
+        c = c * (n - k + i) / i;
+    return c;
+}
+
+// lower bound of the polynomial on the square [x0, x0 + h] x [y0, y0 + h]: the smallest coefficient of its tensor
+// Bernstein form, of which the polynomial is a convex combination
+static double bernsteinBound(const std::vector<float>& polynomial, int degree, double x0, double y0, double h)
+{
+    // coefficients of u^k v^l of the polynomial at (x0 + h u, y0 + h v)
+    const int n = degree + 1;
+    std::vector<double> local(n * n, 0.0);
+    for (int j = 0; j <= degree; ++j) {
+        for (int i = 0; i <= degree - j; ++i) {
+            const double c = polynomial[approxTermIndex(i, j, degree)];
+            for (int l = 0; l <= j; ++l) {
+                for (int k = 0; k <= i; ++k)
+                    local[k + l * n] += c * binomial(i, k) * std::pow(x0, i - k) * binomial(j, l) * std::pow(y0, j - l) * std::pow(h, k + l);
+            }
+        }
+    }
+
+    double bound = INFINITY;
+    for (int q = 0; q <= degree; ++q) {
+        for (int m = 0; m <= degree; ++m) {
+            double b = 0.0;
+            for (int l = 0; l <= q; ++l) {
+                for (int k = 0; k <= m; ++k)
+                    b += binomial(m, k) / binomial(degree, k) * binomial(q, l) / binomial(degree, l) * local[k + l * n];
+            }
+            bound = std::min(bound, b);
+        }
+    }
+    return bound;
+}
+
+// whether the polynomial is >= minimum on the square [x0, x0 + h] x [y0, y0 + h], the squares where the Bernstein
+// bound is not conclusive are subdivided (up to squares of 1 / 256)
+static bool boundedBelow(const std::vector<float>& polynomial, int degree, float minimum, double x0 = 0.0, double y0 = 0.0, double h = 1.0)
+{
+    if (evalPolynomial(polynomial.data(), degree, float(x0), float(y0)) < minimum)
+        return false;
+    if (bernsteinBound(polynomial, degree, x0, y0, h) >= minimum)
+        return true;
+    if (h <= 1.0 / 256.0)
+        return false;
+    h *= 0.5;
+    return boundedBelow(polynomial, degree, minimum, x0, y0, h) && boundedBelow(polynomial, degree, minimum, x0 + h, y0, h)
+        && boundedBelow(polynomial, degree, minimum, x0, y0 + h, h) && boundedBelow(polynomial, degree, minimum, x0 + h, y0 + h, h);
+}
+
+// Rational fit by Sanathanan-Koerner iterations: the linearized residual P - f Q is weighted by 1 / Q of the
+// previous iteration, the polynomial fit is the first iteration and the iteration of least squared error is kept.
+// If Q drops below settings.minDenominator on [0, 1]^2, its negative coefficients are dropped one at a time (most
+// negative first) until it no longer does, at worst all of them so that Q >= 1: the approximation has no poles.
+static ChannelApprox fitChannel(const std::vector<float>& values, int N, const ApproxSettings& settings)
+{
+    const int numeratorTerms = approxNumTerms(settings.numeratorDegree);
+    const int denominatorTerms = settings.denominatorDegree > 0 ? approxNumTerms(settings.denominatorDegree) : 0;
+    const int rows = N * N;
+
+    // design matrices of P and Q (rows x terms)
+    std::vector<double> numeratorBasis(rows * numeratorTerms);
+    std::vector<double> denominatorBasis(rows * denominatorTerms);
+    for (int t = 0; t < N; ++t) {
+        for (int a = 0; a < N; ++a) {
+            const int r = a + t * N;
+            monomials(a / double(N - 1), t / double(N - 1), settings.numeratorDegree, &numeratorBasis[r * numeratorTerms]);
+            if (denominatorTerms > 0)
+                monomials(a / double(N - 1), t / double(N - 1), settings.denominatorDegree, &denominatorBasis[r * denominatorTerms]);
+        }
+    }
+
+    std::vector<double> weights(rows, 1.0);
+    ChannelApprox best;
+    double bestError = INFINITY;
+
+    const int iterations = denominatorTerms > 0 ? std::max(settings.iterations, 1) : 0;
+    for (int iteration = 0; iteration <= iterations; ++iteration) {
+        // free terms of Q, without the constant term (1), none for the polynomial fit
+        std::vector<int> free;
+        for (int k = 1; iteration > 0 && k < denominatorTerms; ++k)
+            free.push_back(k);
+
+        std::vector<double> solution;
+        while (true) {
+            const int cols = numeratorTerms + int(free.size());
+            std::vector<double> A(rows * cols);
+            std::vector<double> b(rows);
+            for (int r = 0; r < rows; ++r) {
+                const double f = values[r];
+                for (int k = 0; k < numeratorTerms; ++k)
+                    A[r * cols + k] = weights[r] * numeratorBasis[r * numeratorTerms + k];
+                for (int k = 0; k < int(free.size()); ++k)
+                    A[r * cols + numeratorTerms + k] = -weights[r] * f * denominatorBasis[r * denominatorTerms + free[k]];
+                b[r] = weights[r] * f;
+            }
+            solution = solveLeastSquares(std::move(A), std::move(b), rows, cols);
+
+            // accepted if Q stays away from 0 on all of [0, 1]^2, between the cells too
+            std::vector<float> denominator(denominatorTerms, 0.0f);
+            if (!free.empty()) {
+                denominator[0] = 1.0f;
+                for (int k = 0; k < int(free.size()); ++k)
+                    denominator[free[k]] = float(solution[numeratorTerms + k]);
+                if (boundedBelow(denominator, settings.denominatorDegree, settings.minDenominator))
+                    break;
+            }
+
+            int mostNegative = -1;
+            for (int k = 0; k < int(free.size()); ++k) {
+                if (solution[numeratorTerms + k] < 0.0 && (mostNegative < 0 || solution[numeratorTerms + k] < solution[numeratorTerms + mostNegative]))
+                    mostNegative = k;
+            }
+            if (mostNegative < 0)
+                break;
+            free.erase(free.begin() + mostNegative);
+        }
+
+        ChannelApprox channel;
+        channel.numerator.assign(solution.begin(), solution.begin() + numeratorTerms);
+        if (iteration > 0) {
+            channel.denominator.assign(denominatorTerms, 0.0f);
+            channel.denominator[0] = 1.0f;
+            for (int k = 0; k < int(free.size()); ++k)
+                channel.denominator[free[k]] = float(solution[numeratorTerms + k]);
+        }
+
+        const double error = fitError(channel, settings.numeratorDegree, settings.denominatorDegree, values, N);
+        if (error < bestError) {
+            best = channel;
+            bestError = error;
+        }
+
+        for (int t = 0; t < N; ++t) {
+            for (int a = 0; a < N; ++a)
+                weights[a + t * N] = 1.0 / evalDenominator(channel, settings.denominatorDegree, a / float(N - 1), t / float(N - 1));
+        }
+    }
+    return best;
+}
+
+TableApprox approximateTab(const glm::vec4* tex1, const glm::vec4* tex2, int N, const ApproxSettings& settings)
+{
+    LTC_TRACE_ZONE("approximateTab");
+    TableApprox approx;
+    approx.numeratorDegree = settings.numeratorDegree;
+    approx.denominatorDegree = settings.denominatorDegree;
+
+    tbb::parallel_for(0, 8, [&](int c) {
+        const glm::vec4* tex = c < 4 ? tex1 : tex2;
+        std::vector<float> values(N * N);
+        for (int i = 0; i < N * N; ++i)
+            values[i] = tex[i][c % 4];
+        approx.channels[c] = fitChannel(values, N, settings);
+    });
+    return approx;
+}
+
+void approxErrors(const TableApprox& approx, const glm::vec4* tex1, const glm::vec4* tex2, int N, ApproxError* errors)
+{
+    for (int c = 0; c < 8; ++c)
+        errors[c] = ApproxError();
+
+    for (int t = 0; t < N; ++t) {
+        for (int a = 0; a < N; ++a) {
+            glm::vec4 t1, t2;
+            evalApprox(approx, a / float(N - 1), t / float(N - 1), t1, t2);
+            for (int c = 0; c < 8; ++c) {
+                const float error = c < 4 ? std::abs(t1[c] - tex1[a + t * N][c]) : std::abs(t2[c - 4] - tex2[a + t * N][c - 4]);
+                errors[c].rms += error * error;
+                if (error > errors[c].maxAbs) {
+                    errors[c].maxAbs = error;
+                    errors[c].worstA = a;
+                    errors[c].worstT = t;
+                }
+            }
+        }
+    }
+    for (int c = 0; c < 8; ++c)
+        errors[c].rms = std::sqrt(errors[c].rms / (N * N));
+}
+
+void evalApprox(const TableApprox& approx, float x, float y, glm::vec4& tex1, glm::vec4& tex2)
+{
+    for (int c = 0; c < 4; ++c) {
+        tex1[c] = evalChannel(approx.channels[c], approx.numeratorDegree, approx.denominatorDegree, x, y);
+        tex2[c] = evalChannel(approx.channels[c + 4], approx.numeratorDegree, approx.denominatorDegree, x, y);
+    }
+}
+
+ShadingLTC lookupLTC(const TableApprox& approx, float roughness, float cosThetaV)
+{
+    const float x = std::clamp(roughness, 0.0f, 1.0f);
+    const float y = std::sqrt(1.0f - std::clamp(cosThetaV, 0.0f, 1.0f));
+    glm::vec4 t1;
+
+    ShadingLTC ltc;
+    evalApprox(approx, x, y, t1, ltc.terms);
+    ltc.invM = glm::mat3(
+        glm::vec3(t1.x, 0, t1.y),
+        glm::vec3(0, 1, 0),
+        glm::vec3(t1.z, 0, t1.w));
+    return ltc;
+}
+
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace ltc {
+
+// layout of the binary table files written by writeTabBinary:
+// header, the N*N floats of each term of the table in the order m00, m02, m11, m20, m22, magnitude, fresnel (see
+// table.h) and the FNV-1a checksum of these floats (uint64)
+// versions 1 and 2 stored N*N matrices (9 floats, column major) and N*N (magnitude, fresnel) pairs, followed by their
+// checksum since version 2
+#pragma pack(push, 1)
+struct BinaryTableHeader {
+    char magic[4]; // "LTCT"
+    uint32_t version;
+    uint32_t N;
+};
+#pragma pack(pop)
+
+constexpr char BINARY_TABLE_MAGIC[4] = { 'L', 'T', 'C', 'T' };
+constexpr uint32_t BINARY_TABLE_VERSION = 3;
+
+// layout of the texture blobs written by writeTexBlob:
+// magic, version, N, number of textures (uint32), then N*N RGBA half floats per texture (row major)
+// version 2 (tables in another TableLayout, see runtime.h) adds the layout and 3 reserved uint32 to the header
+// (32 bytes) and stores tableNumTexels(layout, N) texels per texture
+// row major tables are still written as version 1, as the WebGL demos read them
+constexpr char TEX_BLOB_MAGIC[4] = { 'L', 'T', 'C', 'P' };
+constexpr uint32_t TEX_BLOB_VERSION = 2;
+
+// largest N accepted from the headers, the sizes of the buffers of larger tables overflow int
+constexpr uint32_t MAX_TABLE_N = 4096;
+
+// 64 bit FNV-1a hash, can be chained by passing the previous hash
+constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+inline uint64_t fnv1a(const void* data, size_t size, uint64_t hash = FNV_OFFSET_BASIS)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+}
@@ -1,4 +1,5 @@
 #include "ltc/brdf_beckmann.h"
+#include <algorithm>
 #include <cmath>
 #include <glm/geometric.hpp>
 
@@ -10,6 +11,97 @@ static float lambda(const float alpha, const float cosTheta)
     return (cosTheta < 1.0f) ? (1.0f - 1.259f * a + 0.396f * a * a) / (3.535f * a + 2.181f * a * a) : 0.0f;
 }
 
+// exact masking function, the distribution of visible normals is normalized by it
+static float lambdaExact(const float alpha, const float cosTheta)
+{
+    if (cosTheta >= 1.0f)
+        return 0.0f;
+    const float a = 1.0f / alpha / std::tan(std::acos(cosTheta));
+    return 0.5f * (std::erf(a) - 1.0f) + std::exp(-a * a) / (2.0f * a * std::sqrt(3.14159f));
+}
+
+// inverse error function:
+// Giles, "Approximating the erfinv function" (GPU Computing Gems Jade Edition, 2011)
+static float erfinv(const float x)
+{
+    float w = -std::log(std::max((1.0f - x) * (1.0f + x), 1e-30f));
+    float p;
+    if (w < 5.0f) {
+        w = w - 2.5f;
+        p = 2.81022636e-08f;
+        p = 3.43273939e-07f + p * w;
+        p = -3.5233877e-06f + p * w;
+        p = -4.39150654e-06f + p * w;
+        p = 0.00021858087f + p * w;
+        p = -0.00125372503f + p * w;
+        p = -0.00417768164f + p * w;
+        p = 0.246640727f + p * w;
+        p = 1.50140941f + p * w;
+    } else {
+        w = std::sqrt(w) - 3.0f;
+        p = -0.000200214257f;
+        p = 0.000100950558f + p * w;
+        p = 0.00134934322f + p * w;
+        p = -0.00367342844f + p * w;
+        p = 0.00573950773f + p * w;
+        p = -0.0076224613f + p * w;
+        p = 0.00943887047f + p * w;
+        p = 1.00167406f + p * w;
+        p = 2.83297682f + p * w;
+    }
+    return p * x;
+}
+
+// sample the slopes of the visible normals of the unit roughness distribution for a view direction in the xz-plane
+// numerical inversion of the CDF as in Mitsuba (Jakob), which is free of the discontinuities of:
+// Heitz and d'Eon, "Importance Sampling Microfacet-Based BSDFs using the Distribution of Visible Normals" (2014)
+static void sampleSlopes(const float thetaV, const float U1, const float U2, float& slopeX, float& slopeY)
+{
+    // normal incidence
+    if (thetaV < 1e-4f) {
+        const float r = std::sqrt(-std::log(std::max(1.0f - U1, 1e-6f)));
+        const float phi = 2.0f * 3.14159f * U2;
+        slopeX = r * std::cos(phi);
+        slopeY = r * std::sin(phi);
+        return;
+    }
+
+    const float sqrtPiInv = 1.0f / std::sqrt(3.14159f);
+    const float tanThetaV = std::tan(thetaV);
+    const float cotThetaV = 1.0f / tanThetaV;
+
+    // search interval, parameterized in the erf() domain
+    float a = -1.0f;
+    float c = std::erf(cotThetaV);
+    const float sampleX = std::max(U1, 1e-6f);
+
+    // initial guess and normalization of the CDF
+    const float fit = 1.0f + thetaV * (-0.876f + thetaV * (0.4265f - 0.0594f * thetaV));
+    float b = c - (1.0f + c) * std::pow(1.0f - sampleX, fit);
+    const float normalization = 1.0f / (1.0f + c + sqrtPiInv * tanThetaV * std::exp(-cotThetaV * cotThetaV));
+
+    for (int it = 0; it < 10; ++it) {
+        // bisection if Newton steps out of the interval (also catches NaNs)
+        if (!(b >= a && b <= c))
+            b = 0.5f * (a + c);
+
+        const float invErf = erfinv(b);
+        const float value = normalization * (1.0f + b + sqrtPiInv * tanThetaV * std::exp(-invErf * invErf)) - sampleX;
+        const float derivative = normalization * (1.0f - invErf * tanThetaV);
+        if (std::abs(value) < 1e-5f)
+            break;
+
+        if (value > 0.0f)
+            c = b;
+        else
+            a = b;
+        b -= value / derivative;
+    }
+
+    slopeX = erfinv(b);
+    slopeY = erfinv(2.0f * std::max(U2, 1e-6f) - 1.0f);
+}
+
 float BrdfBeckmann::eval(const glm::vec3& V, const glm::vec3& L, const float alpha, float& pdf) const
 {
     if (V.z <= 0) {
@@ -35,19 +127,43 @@ float BrdfBeckmann::eval(const glm::vec3& V, const glm::vec3& L, const float alp
     const float slopey = H.y / H.z;
     float D = std::exp(-(slopex * slopex + slopey * slopey) / (alpha * alpha)) / (3.14159f * alpha * alpha * H.z * H.z * H.z * H.z);
 
-    pdf = std::abs(D * H.z / 4.0f / glm::dot(V, H));
+    // pdf of sampling the visible normals
+    const float G1V = 1.0f / (1.0f + lambdaExact(alpha, V.z));
+    pdf = H.z > 0.0f ? D * G1V / 4.0f / V.z : 0.0f;
     float res = D * G2 / 4.0f / V.z;
 
     return res;
 }
 
+// sampling the distribution of visible normals
+// with V in the xz-plane, U2 and 1 - U2 give samples that are mirrored in y
 glm::vec3 BrdfBeckmann::sample(const glm::vec3& V, const float alpha, const float U1, const float U2) const
 {
-    const float phi = 2.0f * 3.14159f * U1;
-    const float r = alpha * std::sqrt(-logf(U2));
-    const glm::vec3 N = glm::normalize(glm::vec3(r * std::cos(phi), r * std::sin(phi), 1.0f));
+    // stretch view vector to unit roughness
+    const glm::vec3 Vs = glm::normalize(glm::vec3(alpha * V.x, alpha * V.y, V.z));
+    float theta = 0.0f, phi = 0.0f;
+    if (Vs.z < 0.99999f) {
+        theta = std::acos(Vs.z);
+        phi = std::atan2(Vs.y, Vs.x);
+    }
+
+    float slopeX, slopeY;
+    sampleSlopes(theta, U1, U2, slopeX, slopeY);
+
+    // rotate and unstretch
+    const float cosPhi = std::cos(phi);
+    const float sinPhi = std::sin(phi);
+    const float sx = alpha * (cosPhi * slopeX - sinPhi * slopeY);
+    const float sy = alpha * (sinPhi * slopeX + cosPhi * slopeY);
+
+    const glm::vec3 N = glm::normalize(glm::vec3(-sx, -sy, 1.0f));
     const glm::vec3 L = -V + 2.0f * N * glm::dot(N, V);
     return L;
 }
 
+std::string BrdfBeckmann::identity() const
+{
+    return "beckmann/vndf-1";
+}
+
 }
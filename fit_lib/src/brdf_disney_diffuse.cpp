@@ -31,4 +31,9 @@ glm::vec3 BrdfDisneyDiffuse::sample(const glm::vec3& V, const float alpha, const
     return L;
 }
 
+std::string BrdfDisneyDiffuse::identity() const
+{
+    return "disney_diffuse/1";
+}
+
 }
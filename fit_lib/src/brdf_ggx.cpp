@@ -1,4 +1,5 @@
 #include "ltc/brdf_ggx.h"
+#include <algorithm>
 #include <cmath>
 #include <glm/geometric.hpp>
 
@@ -40,19 +41,47 @@ float BrdfGGX::eval(const glm::vec3& V, const glm::vec3& L, const float alpha, f
     D = D * D;
     D = D / (3.14159f * alpha * alpha * H.z * H.z * H.z * H.z);
 
-    pdf = std::abs(D * H.z / 4.0f / glm::dot(V, H));
+    // pdf of sampling the visible normals
+    const float G1V = 1.0f / (1.0f + LambdaV);
+    pdf = H.z > 0.0f ? D * G1V / 4.0f / V.z : 0.0f;
     float res = D * G2 / 4.0f / V.z;
 
     return res;
 }
 
+// sampling the distribution of visible normals:
+// http://jcgt.org/published/0007/04/01/
+// with V in the xz-plane, U2 and 1 - U2 give samples that are mirrored in y
 glm::vec3 BrdfGGX::sample(const glm::vec3& V, const float alpha, const float U1, const float U2) const
 {
-    const float phi = 2.0f * 3.14159f * U1;
-    const float r = alpha * std::sqrt(U2 / (1.0f - U2));
-    const glm::vec3 N = glm::normalize(glm::vec3(r * std::cos(phi), r * std::sin(phi), 1.0f));
+    // stretch view vector to the hemisphere configuration
+    const glm::vec3 Vh = glm::normalize(glm::vec3(alpha * V.x, alpha * V.y, V.z));
+
+    // orthonormal basis
+    const float lensq = Vh.x * Vh.x + Vh.y * Vh.y;
+    const glm::vec3 T1 = lensq > 0.0f ? glm::vec3(-Vh.y, Vh.x, 0.0f) / std::sqrt(lensq) : glm::vec3(0, 1, 0);
+    const glm::vec3 T2 = glm::cross(Vh, T1);
+
+    // parameterization of the projected area
+    const float r = std::sqrt(U1);
+    const float phi = 2.0f * 3.14159f * U2;
+    const float t1 = r * std::sin(phi);
+    float t2 = r * std::cos(phi);
+    const float s = 0.5f * (1.0f + Vh.z);
+    t2 = (1.0f - s) * std::sqrt(std::max(0.0f, 1.0f - t1 * t1)) + s * t2;
+
+    // reprojection onto the hemisphere
+    const glm::vec3 Nh = t1 * T1 + t2 * T2 + std::sqrt(std::max(0.0f, 1.0f - t1 * t1 - t2 * t2)) * Vh;
+
+    // unstretch
+    const glm::vec3 N = glm::normalize(glm::vec3(alpha * Nh.x, alpha * Nh.y, std::max(0.0f, Nh.z)));
     const glm::vec3 L = -V + 2.0f * N * glm::dot(N, V);
     return L;
 }
 
+std::string BrdfGGX::identity() const
+{
+    return "ggx/vndf-1";
+}
+
 }
@@ -0,0 +1,227 @@
+#include "ltc/brdf_tabulated.h"
+#include "binary_table.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <glm/geometric.hpp>
+#include <tbb/parallel_for.h>
+
+namespace ltc {
+
+constexpr char TABULATED_MAGIC[4] = { 'L', 'T', 'C', 'B' };
+constexpr uint32_t TABULATED_VERSION = 1;
+
+bool BrdfTabulated::load(const char* path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return false;
+
+    char magic[4];
+    uint32_t header[5];
+    float range[2];
+    if (!file.read(magic, sizeof(magic)) || !file.read(reinterpret_cast<char*>(header), sizeof(header)) || !file.read(reinterpret_cast<char*>(range), sizeof(range)))
+        return false;
+    if (std::memcmp(magic, TABULATED_MAGIC, sizeof(magic)) != 0 || header[0] != TABULATED_VERSION)
+        return false;
+    if (header[1] == 0 || header[2] == 0 || header[3] == 0 || header[4] == 0)
+        return false;
+
+    std::vector<float> data(size_t(header[1]) * header[2] * header[3] * header[4]);
+    if (!file.read(reinterpret_cast<char*>(data.data()), data.size() * sizeof(float)))
+        return false;
+
+    set(header[1], header[2], header[3], header[4], range[0], range[1], std::move(data));
+    return true;
+}
+
+void BrdfTabulated::set(int numAlpha_, int numThetaV_, int numCosThetaL_, int numPhi_, float alphaMin_, float alphaMax_, std::vector<float> values_)
+{
+    numAlpha = numAlpha_;
+    numThetaV = numThetaV_;
+    numCosThetaL = numCosThetaL_;
+    numPhi = numPhi_;
+    alphaMin = alphaMin_;
+    alphaMax = alphaMax_;
+    values = std::move(values_);
+
+    const int dims[4] = { numAlpha, numThetaV, numCosThetaL, numPhi };
+    const float range[2] = { alphaMin, alphaMax };
+    valuesHash = fnv1a(dims, sizeof(dims));
+    valuesHash = fnv1a(range, sizeof(range), valuesHash);
+    valuesHash = fnv1a(values.data(), values.size() * sizeof(float), valuesHash);
+
+    buildSamplingTables();
+}
+
+std::string BrdfTabulated::identity() const
+{
+    return "tabulated/1/" + std::to_string(valuesHash);
+}
+
+void BrdfTabulated::buildSamplingTables()
+{
+    const int numSlices = numAlpha * numThetaV;
+    const int numCells = numCosThetaL * numPhi;
+    cellProbability.resize(size_t(numSlices) * numCells);
+    aliasProbability.resize(size_t(numSlices) * numCells);
+    alias.resize(size_t(numSlices) * numCells);
+
+    // the slices are independent
+    tbb::parallel_for(0, numSlices, [&](int slice) {
+        const size_t offset = size_t(slice) * numCells;
+        const float* sliceValues = &values[offset];
+        float* p = &cellProbability[offset];
+
+        // the cells have the same solid angle, so sample proportionally to the cosine-weighted BRDF
+        // a small floor keeps the pdf positive where the interpolated BRDF is non-zero
+        double sum = 0.0;
+        for (int k = 0; k < numCosThetaL; ++k) {
+            const float mu = (k + 0.5f) / numCosThetaL;
+            for (int m = 0; m < numPhi; ++m) {
+                p[k * numPhi + m] = std::max<float>(sliceValues[k * numPhi + m], 0.0f) * mu;
+                sum += p[k * numPhi + m];
+            }
+        }
+        const float floor = sum > 0.0 ? float(1e-3 * sum / numCells) : 1.0f;
+        sum = 0.0;
+        for (int i = 0; i < numCells; ++i) {
+            p[i] = std::max<float>(p[i], floor);
+            sum += p[i];
+        }
+        for (int i = 0; i < numCells; ++i)
+            p[i] = float(p[i] / sum);
+
+        // Vose's alias method
+        float* prob = &aliasProbability[offset];
+        int* aliasIndex = &alias[offset];
+        std::vector<float> scaled(numCells);
+        std::vector<int> small, large;
+        for (int i = 0; i < numCells; ++i) {
+            scaled[i] = p[i] * numCells;
+            (scaled[i] < 1.0f ? small : large).push_back(i);
+        }
+        while (!small.empty() && !large.empty()) {
+            const int s = small.back();
+            const int l = large.back();
+            small.pop_back();
+            large.pop_back();
+
+            prob[s] = scaled[s];
+            aliasIndex[s] = l;
+            scaled[l] = (scaled[l] + scaled[s]) - 1.0f;
+            (scaled[l] < 1.0f ? small : large).push_back(l);
+        }
+        for (int i : large) {
+            prob[i] = 1.0f;
+            aliasIndex[i] = i;
+        }
+        for (int i : small) {
+            prob[i] = 1.0f;
+            aliasIndex[i] = i;
+        }
+    });
+}
+
+// bilinear interpolation of a slice, mu and phi are in cell units
+float BrdfTabulated::lookup(int a, int v, float mu, float phi) const
+{
+    mu = std::clamp<float>(mu, 0.0f, numCosThetaL - 1.0f);
+    phi = std::clamp<float>(phi, 0.0f, numPhi - 1.0f);
+    const int k0 = std::min<int>(int(mu), std::max<int>(numCosThetaL - 2, 0));
+    const int m0 = std::min<int>(int(phi), std::max<int>(numPhi - 2, 0));
+    const int k1 = std::min<int>(k0 + 1, numCosThetaL - 1);
+    const int m1 = std::min<int>(m0 + 1, numPhi - 1);
+    const float fk = mu - k0;
+    const float fm = phi - m0;
+
+    const float* slice = &values[(size_t(a) * numThetaV + v) * numCosThetaL * numPhi];
+    return (1.0f - fk) * ((1.0f - fm) * slice[k0 * numPhi + m0] + fm * slice[k0 * numPhi + m1])
+        + fk * ((1.0f - fm) * slice[k1 * numPhi + m0] + fm * slice[k1 * numPhi + m1]);
+}
+
+void BrdfTabulated::sliceCoordinates(const glm::vec3& V, const float alpha, float& a, float& v) const
+{
+    const float alphaRange = alphaMax - alphaMin;
+    a = alphaRange > 0.0f ? (alpha - alphaMin) / alphaRange * (numAlpha - 1) : 0.0f;
+    a = std::clamp<float>(a, 0.0f, numAlpha - 1.0f);
+    v = std::acos(std::clamp<float>(V.z, 0.0f, 1.0f)) / (0.5f * 3.14159f) * (numThetaV - 1);
+    v = std::clamp<float>(v, 0.0f, numThetaV - 1.0f);
+}
+
+int BrdfTabulated::nearestSlice(const glm::vec3& V, const float alpha) const
+{
+    float a, v;
+    sliceCoordinates(V, alpha, a, v);
+    return int(a + 0.5f) * numThetaV + int(v + 0.5f);
+}
+
+float BrdfTabulated::eval(const glm::vec3& V, const glm::vec3& L, const float alpha, float& pdf) const
+{
+    if (V.z <= 0 || L.z <= 0 || values.empty()) {
+        pdf = 0;
+        return 0;
+    }
+
+    // azimuth relative to V, folded to [0, pi]
+    float phi = std::atan2(L.y, L.x) - std::atan2(V.y, V.x);
+    phi = std::abs(std::remainder(phi, 2.0f * 3.14159265f));
+    phi = std::min<float>(phi, 3.14159265f);
+
+    // pdf of the cell (and its mirror image) in the nearest slice
+    const int k = std::min<int>(int(L.z * numCosThetaL), numCosThetaL - 1);
+    const int m = std::min<int>(int(phi / 3.14159265f * numPhi), numPhi - 1);
+    const float cellSolidAngle = 2.0f * (1.0f / numCosThetaL) * (3.14159265f / numPhi);
+    pdf = cellProbability[size_t(nearestSlice(V, alpha)) * numCosThetaL * numPhi + k * numPhi + m] / cellSolidAngle;
+
+    // multilinear interpolation over (alpha, theta_v, cos(theta_l), phi)
+    float a, v;
+    sliceCoordinates(V, alpha, a, v);
+    const int a0 = int(a);
+    const int v0 = int(v);
+    const int a1 = std::min<int>(a0 + 1, numAlpha - 1);
+    const int v1 = std::min<int>(v0 + 1, numThetaV - 1);
+    const float fa = a - a0;
+    const float fv = v - v0;
+
+    const float mu = L.z * numCosThetaL - 0.5f;
+    const float phiCell = phi / 3.14159265f * numPhi - 0.5f;
+    const float value = (1.0f - fa) * ((1.0f - fv) * lookup(a0, v0, mu, phiCell) + fv * lookup(a0, v1, mu, phiCell))
+        + fa * ((1.0f - fv) * lookup(a1, v0, mu, phiCell) + fv * lookup(a1, v1, mu, phiCell));
+
+    return std::max<float>(value, 0.0f) * L.z;
+}
+
+glm::vec3 BrdfTabulated::sample(const glm::vec3& V, const float alpha, const float U1, const float U2) const
+{
+    const int numCells = numCosThetaL * numPhi;
+    const size_t offset = size_t(nearestSlice(V, alpha)) * numCells;
+
+    // pick a cell with the alias table, reuse the remainder of U1 to jitter cos(theta_l) within the cell
+    const float u = U1 * numCells;
+    int cell = std::min<int>(int(u), numCells - 1);
+    float jitter = u - cell;
+    const float prob = aliasProbability[offset + cell];
+    if (jitter < prob) {
+        jitter = jitter / prob;
+    } else {
+        jitter = (jitter - prob) / (1.0f - prob);
+        cell = alias[offset + cell];
+    }
+    jitter = std::min<float>(jitter, 0.99999f);
+
+    const int k = cell / numPhi;
+    const int m = cell % numPhi;
+    const float mu = (k + jitter) / numCosThetaL;
+
+    // U2 selects the side of the plane of V (U2 and 1 - U2 give mirror images) and the azimuth within the cell
+    const float side = U2 < 0.5f ? 1.0f : -1.0f;
+    const float phi = std::atan2(V.y, V.x) + side * (m + std::abs(1.0f - 2.0f * U2)) / numPhi * 3.14159265f;
+
+    const float sinTheta = std::sqrt(std::max<float>(0.0f, 1.0f - mu * mu));
+    return glm::vec3(sinTheta * std::cos(phi), sinTheta * std::sin(phi), mu);
+}
+
+}
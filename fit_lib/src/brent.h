@@ -0,0 +1,165 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace ltc {
+
+// One dimensional minimization, for objectives with a single active parameter:
+// bracket the minimum by walking downhill from the start point, then refine it with Brent's method
+// (golden section search with parabolic interpolation), see Numerical Recipes in C++ (3rd Ed.) 10.1-10.3
+// tolerance is absolute on the parameter
+template <typename FUNC>
+float Brent(float& xmin, float start, float delta, float tolerance, int maxIters, FUNC objectiveFn)
+{
+    const float gold = 1.618034f;
+    const float glimit = 100.0f;
+    const float cgold = 0.3819660f;
+    const float tiny = 1e-20f;
+
+    const auto sign = [](float a, float b) { return b >= 0.0f ? std::abs(a) : -std::abs(a); };
+
+    // bracket: find ax, bx, cx with f(bx) < f(ax) and f(bx) < f(cx)
+    float ax = start, bx = start + delta;
+    float fa = objectiveFn(ax);
+    float fb = objectiveFn(bx);
+    if (fb > fa) {
+        std::swap(ax, bx);
+        std::swap(fa, fb);
+    }
+    float cx = bx + gold * (bx - ax);
+    float fc = objectiveFn(cx);
+
+    for (int j = 0; j < maxIters && fb > fc; j++) {
+        // parabolic extrapolation
+        const float r = (bx - ax) * (fb - fc);
+        const float q = (bx - cx) * (fb - fa);
+        float u = bx - ((bx - cx) * q - (bx - ax) * r) / (2.0f * sign(std::max(std::abs(q - r), tiny), q - r));
+        const float ulim = bx + glimit * (cx - bx);
+        float fu;
+
+        if ((bx - u) * (u - cx) > 0.0f) {
+            fu = objectiveFn(u);
+            if (fu < fc) {
+                ax = bx;
+                bx = u;
+                fa = fb;
+                fb = fu;
+                break;
+            } else if (fu > fb) {
+                cx = u;
+                fc = fu;
+                break;
+            }
+            u = cx + gold * (cx - bx);
+            fu = objectiveFn(u);
+        } else if ((cx - u) * (u - ulim) > 0.0f) {
+            fu = objectiveFn(u);
+            if (fu < fc) {
+                bx = cx;
+                cx = u;
+                u = cx + gold * (cx - bx);
+                fb = fc;
+                fc = fu;
+                fu = objectiveFn(u);
+            }
+        } else if ((u - ulim) * (ulim - cx) >= 0.0f) {
+            u = ulim;
+            fu = objectiveFn(u);
+        } else {
+            u = cx + gold * (cx - bx);
+            fu = objectiveFn(u);
+        }
+
+        ax = bx;
+        bx = cx;
+        cx = u;
+        fa = fb;
+        fb = fc;
+        fc = fu;
+    }
+
+    // the bracket search ran out of iterations, return the best point found
+    if (fb > fc) {
+        xmin = cx;
+        return fc;
+    }
+
+    // refine
+    float a = std::min(ax, cx), b = std::max(ax, cx);
+    float x = bx, w = bx, v = bx;
+    float fx = fb, fw = fb, fv = fb;
+    float d = 0.0f, e = 0.0f;
+
+    for (int j = 0; j < maxIters; j++) {
+        const float xm = 0.5f * (a + b);
+        const float tol1 = tolerance;
+        const float tol2 = 2.0f * tol1;
+
+        // stop if the bracket is small enough
+        if (std::abs(x - xm) <= (tol2 - 0.5f * (b - a)))
+            break;
+
+        if (std::abs(e) > tol1) {
+            // parabolic step
+            const float r = (x - w) * (fx - fv);
+            float q = (x - v) * (fx - fw);
+            float p = (x - v) * q - (x - w) * r;
+            q = 2.0f * (q - r);
+            if (q > 0.0f)
+                p = -p;
+            q = std::abs(q);
+
+            const float etemp = e;
+            e = d;
+            if (std::abs(p) >= std::abs(0.5f * q * etemp) || p <= q * (a - x) || p >= q * (b - x)) {
+                e = (x >= xm) ? a - x : b - x;
+                d = cgold * e;
+            } else {
+                d = p / q;
+                const float u = x + d;
+                if (u - a < tol2 || b - u < tol2)
+                    d = sign(tol1, xm - x);
+            }
+        } else {
+            // golden section step
+            e = (x >= xm) ? a - x : b - x;
+            d = cgold * e;
+        }
+
+        const float u = std::abs(d) >= tol1 ? x + d : x + sign(tol1, d);
+        const float fu = objectiveFn(u);
+
+        if (fu <= fx) {
+            if (u >= x)
+                a = x;
+            else
+                b = x;
+            v = w;
+            w = x;
+            x = u;
+            fv = fw;
+            fw = fx;
+            fx = fu;
+        } else {
+            if (u < x)
+                a = u;
+            else
+                b = u;
+            if (fu <= fw || w == x) {
+                v = w;
+                w = u;
+                fv = fw;
+                fw = fu;
+            } else if (fu <= fv || v == x || v == w) {
+                v = u;
+                fv = fu;
+            }
+        }
+    }
+
+    xmin = x;
+    return fx;
+}
+
+}
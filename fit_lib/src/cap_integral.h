@@ -0,0 +1,42 @@
+#pragma once
+#include <cmath>
+
+namespace ltc {
+
+// projected (cosine-weighted) solid angle of a spherical cap, clipped to the horizon (Snyder 1996)
+// used by genSphereTab and to bound the contribution of light clusters (see light_bvh.h)
+
+inline float ihemiG(float w, float s, float g)
+{
+    const float pi = 3.14159265f;
+    return -2.0f * std::sin(w) * std::cos(s) * std::cos(g) + pi / 2.0f - g + std::sin(g) * std::cos(g);
+}
+
+inline float ihemiH(float w, float s, float g)
+{
+    float sinsSq = std::sin(s) * std::sin(s);
+    float cosgSq = std::cos(g) * std::cos(g);
+
+    return std::cos(w) * (std::cos(g) * std::sqrt(sinsSq - cosgSq) + sinsSq * std::asin(std::cos(g) / std::sin(s)));
+}
+
+// w: angle between the axis of the cap and the normal, s: half angle of the cap
+inline float ihemi(float w, float s)
+{
+    const float pi = 3.14159265f;
+    float g = std::asin(std::cos(s) / std::sin(w));
+    float sinsSq = std::sin(s) * std::sin(s);
+
+    if (w >= 0.0f && w <= (pi / 2.0f - s))
+        return pi * std::cos(w) * sinsSq;
+
+    if (w >= (pi / 2.0f - s) && w < pi / 2.0f)
+        return pi * std::cos(w) * sinsSq + ihemiG(w, s, g) - ihemiH(w, s, g);
+
+    if (w >= pi / 2.0f && w < (pi / 2.0f + s))
+        return ihemiG(w, s, g) + ihemiH(w, s, g);
+
+    return 0.0f;
+}
+
+}
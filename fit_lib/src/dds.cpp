@@ -1,5 +1,6 @@
 #define _CRT_SECURE_NO_WARNINGS 1
 #include "dds.h"
+#include "float_to_half.h"
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
@@ -37,17 +38,34 @@ struct DDS_HEADER
     uint32_t        dwCaps4;
     uint32_t        dwReserved2;
 };
+
+struct DDS_HEADER_DXT10
+{
+    uint32_t dxgiFormat;
+    uint32_t resourceDimension;
+    uint32_t miscFlag;
+    uint32_t arraySize;
+    uint32_t miscFlags2;
+};
 #pragma pack(pop)
 
 uint32_t const DDS_MAGIC                        = 0x20534444; // "DDS "
 uint32_t const DDS_HEADER_FLAGS_TEXTURE         = 0x00001007; // DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT
 uint32_t const DDS_HEADER_FLAGS_PITCH           = 0x00000008;
+uint32_t const DDS_HEADER_FLAGS_MIPMAP          = 0x00020000; // DDSD_MIPMAPCOUNT
 uint32_t const DDS_SURFACE_FLAGS_TEXTURE        = 0x00001000; // DDSCAPS_TEXTURE
+uint32_t const DDS_SURFACE_FLAGS_MIPMAP         = 0x00400008; // DDSCAPS_COMPLEX | DDSCAPS_MIPMAP
 uint32_t const DDS_PF_FLAGS_FOURCC              = 0x00000004;
 uint32_t const DDS_RESOURCE_DIMENSION_TEXTURE2D = 3;
+uint32_t const DDS_FOURCC_DX10                  = 0x30315844; // "DX10"
+
+uint32_t const DXGI_FORMAT_R32G32B32A32_FLOAT   = 2;
+uint32_t const DXGI_FORMAT_R16G16B16A16_FLOAT   = 10;
+uint32_t const DXGI_FORMAT_R32_FLOAT            = 41;
 
 DDS_PIXELFORMAT const DDSPF_RGBA16F = { sizeof(DDS_PIXELFORMAT), DDS_PF_FLAGS_FOURCC, 113, 0, 0, 0, 0, 0 };
 DDS_PIXELFORMAT const DDSPF_RGBA32F = { sizeof(DDS_PIXELFORMAT), DDS_PF_FLAGS_FOURCC, 116, 0, 0, 0, 0, 0 };
+DDS_PIXELFORMAT const DDSPF_R32F    = { sizeof(DDS_PIXELFORMAT), DDS_PF_FLAGS_FOURCC, 114, 0, 0, 0, 0, 0 };
 
 static DDS_PIXELFORMAT const* GetDDSPixelFormat(ltc::PixelFormat format)
 {
@@ -55,13 +73,26 @@ static DDS_PIXELFORMAT const* GetDDSPixelFormat(ltc::PixelFormat format)
     {
         case DDS_FORMAT_R16G16B16A16_FLOAT: return &DDSPF_RGBA16F;
         case DDS_FORMAT_R32G32B32A32_FLOAT: return &DDSPF_RGBA32F;
+        case DDS_FORMAT_R32_FLOAT:          return &DDSPF_R32F;
     }
 
     return nullptr;
 }
 
+static uint32_t GetDXGIFormat(ltc::PixelFormat format)
+{
+    switch (format)
+    {
+        case DDS_FORMAT_R16G16B16A16_FLOAT: return DXGI_FORMAT_R16G16B16A16_FLOAT;
+        case DDS_FORMAT_R32G32B32A32_FLOAT: return DXGI_FORMAT_R32G32B32A32_FLOAT;
+        case DDS_FORMAT_R32_FLOAT:          return DXGI_FORMAT_R32_FLOAT;
+    }
 
-bool SaveDDS(char const* path, PixelFormat format, unsigned texelSizeInBytes, unsigned width, unsigned height, void const* data)
+    return 0;
+}
+
+
+bool SaveDDS(char const* path, PixelFormat format, unsigned texelSizeInBytes, unsigned width, unsigned height, void const* data, unsigned mipCount)
 {
     FILE* f = fopen(path, "wb");
     if (!f)
@@ -80,17 +111,118 @@ bool SaveDDS(char const* path, PixelFormat format, unsigned texelSizeInBytes, un
     hdr.dwHeight            = height;
     hdr.dwWidth             = width;
     hdr.dwDepth             = 1;
-    hdr.dwMipMapCount       = 1;
+    hdr.dwMipMapCount       = mipCount;
     hdr.dwPitchOrLinearSize = width*texelSizeInBytes;
     hdr.ddspf               = *ddspf;
     hdr.dwCaps              = DDS_SURFACE_FLAGS_TEXTURE;
+    if (mipCount > 1) {
+        hdr.dwFlags |= DDS_HEADER_FLAGS_MIPMAP;
+        hdr.dwCaps  |= DDS_SURFACE_FLAGS_MIPMAP;
+    }
+    fwrite(&hdr, sizeof(hdr), 1, f);
+
+    size_t size = 0;
+    for (unsigned level = 0; level < mipCount; ++level) {
+        unsigned const levelWidth  = width >> level ? width >> level : 1;
+        unsigned const levelHeight = height >> level ? height >> level : 1;
+        size += size_t(levelWidth) * levelHeight * texelSizeInBytes;
+    }
+    fwrite(data, size, 1, f);
+
+    fclose(f);
+
+    return true;
+}
+
+bool SaveDDSArray(char const* path, PixelFormat format, unsigned texelSizeInBytes, unsigned width, unsigned height, unsigned arraySize, void const* data)
+{
+    uint32_t const dxgiFormat = GetDXGIFormat(format);
+    if (dxgiFormat == 0)
+        return false;
+
+    FILE* f = fopen(path, "wb");
+    if (!f)
+        return false;
+
+    fwrite(&DDS_MAGIC, sizeof(DDS_MAGIC), 1, f);
+
+    DDS_HEADER hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.dwSize              = sizeof(hdr);
+    hdr.dwFlags             = DDS_HEADER_FLAGS_TEXTURE | DDS_HEADER_FLAGS_PITCH;
+    hdr.dwHeight            = height;
+    hdr.dwWidth             = width;
+    hdr.dwDepth             = 1;
+    hdr.dwMipMapCount       = 1;
+    hdr.dwPitchOrLinearSize = width*texelSizeInBytes;
+    hdr.ddspf.dwSize        = sizeof(DDS_PIXELFORMAT);
+    hdr.ddspf.dwFlags       = DDS_PF_FLAGS_FOURCC;
+    hdr.ddspf.dwFourCC      = DDS_FOURCC_DX10;
+    hdr.dwCaps              = DDS_SURFACE_FLAGS_TEXTURE;
     fwrite(&hdr, sizeof(hdr), 1, f);
 
-    fwrite(data, width * height * texelSizeInBytes, 1, f);
+    DDS_HEADER_DXT10 hdr10;
+    memset(&hdr10, 0, sizeof(hdr10));
+    hdr10.dxgiFormat        = dxgiFormat;
+    hdr10.resourceDimension = DDS_RESOURCE_DIMENSION_TEXTURE2D;
+    hdr10.arraySize         = arraySize;
+    fwrite(&hdr10, sizeof(hdr10), 1, f);
+
+    fwrite(data, size_t(width) * height * texelSizeInBytes * arraySize, 1, f);
 
     fclose(f);
 
     return true;
 }
 
+bool LoadDDS(char const* path, unsigned& width, unsigned& height, std::vector<float>& data)
+{
+    FILE* f = fopen(path, "rb");
+    if (!f)
+        return false;
+
+    uint32_t magic = 0;
+    DDS_HEADER hdr;
+    if (fread(&magic, sizeof(magic), 1, f) != 1 || magic != DDS_MAGIC || fread(&hdr, sizeof(hdr), 1, f) != 1) {
+        fclose(f);
+        return false;
+    }
+
+    bool isHalf = hdr.ddspf.dwFourCC == DDSPF_RGBA16F.dwFourCC;
+    bool isFloat = hdr.ddspf.dwFourCC == DDSPF_RGBA32F.dwFourCC;
+    if ((hdr.ddspf.dwFlags & DDS_PF_FLAGS_FOURCC) && hdr.ddspf.dwFourCC == DDS_FOURCC_DX10) {
+        // the format is in the extended header, the first slice comes first
+        DDS_HEADER_DXT10 hdr10;
+        if (fread(&hdr10, sizeof(hdr10), 1, f) != 1) {
+            fclose(f);
+            return false;
+        }
+        isHalf = hdr10.dxgiFormat == DXGI_FORMAT_R16G16B16A16_FLOAT;
+        isFloat = hdr10.dxgiFormat == DXGI_FORMAT_R32G32B32A32_FLOAT;
+    }
+    if (!(hdr.ddspf.dwFlags & DDS_PF_FLAGS_FOURCC) || !(isHalf || isFloat)) {
+        fclose(f);
+        return false;
+    }
+
+    width = hdr.dwWidth;
+    height = hdr.dwHeight;
+    const size_t numTerms = size_t(width) * height * 4;
+    data.resize(numTerms);
+
+    bool ok;
+    if (isHalf) {
+        std::vector<uint16_t> half(numTerms);
+        ok = fread(half.data(), sizeof(uint16_t), numTerms, f) == numTerms;
+        for (size_t i = 0; i < numTerms; ++i)
+            data[i] = half_to_float_fast(half[i]);
+    } else {
+        ok = fread(data.data(), sizeof(float), numTerms, f) == numTerms;
+    }
+
+    fclose(f);
+
+    return ok;
+}
+
 }
@@ -1,12 +1,20 @@
 #pragma once
+#include <vector>
 
 namespace ltc {
 
 enum PixelFormat {
     DDS_FORMAT_R16G16B16A16_FLOAT = 0,
-    DDS_FORMAT_R32G32B32A32_FLOAT = 1
+    DDS_FORMAT_R32G32B32A32_FLOAT = 1,
+    DDS_FORMAT_R32_FLOAT = 2
 };
 
-bool SaveDDS(char const* path, PixelFormat format, unsigned texelSizeInBytes, unsigned width, unsigned height, void const* data);
+// with mipCount > 1, data holds the mip levels one after the other (level l is max(width >> l, 1) x max(height >> l, 1))
+bool SaveDDS(char const* path, PixelFormat format, unsigned texelSizeInBytes, unsigned width, unsigned height, void const* data, unsigned mipCount = 1);
+// 2D texture array with the DX10 extended header, the arraySize slices are stored one after the other in data
+bool SaveDDSArray(char const* path, PixelFormat format, unsigned texelSizeInBytes, unsigned width, unsigned height, unsigned arraySize, void const* data);
+
+// load a 2D RGBA16F or RGBA32F surface (as written by SaveDDS, or the first slice of SaveDDSArray) into RGBA floats
+bool LoadDDS(char const* path, unsigned& width, unsigned& height, std::vector<float>& data);
 
 }
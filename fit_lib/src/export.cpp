@@ -1,20 +1,29 @@
 #include "ltc/export.h"
 // export data to DDS
+#include "binary_table.h"
 #include "dds.h"
 #include "float_to_half.h"
+#include "ltc/approx.h"
+#include "ltc/light_texture.h"
+#include "ltc/table.h"
+#include "ltc/trace.h"
+#include <algorithm>
 #include <fstream>
-#include <glm/mat3x3.hpp>
-#include <glm/vec2.hpp>
 #include <glm/vec4.hpp>
 #include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <utility>
 #include <vector>
 
 namespace ltc {
 
 // export data to C
-void writeTabC(glm::mat3* tab, glm::vec2* tabMagFresnel, int N)
+void writeTabC(const LTCTable& tab, const std::filesystem::path& outFolder)
 {
-    std::ofstream file("results/ltc.inc");
+    LTC_TRACE_ZONE("writeTabC");
+    std::ofstream file(outFolder / "ltc.inc");
+    const int N = tab.N;
 
     file << std::fixed;
     file << std::setprecision(6);
@@ -22,113 +31,250 @@ void writeTabC(glm::mat3* tab, glm::vec2* tabMagFresnel, int N)
     file << "static const int size = " << N << ";" << std::endl
          << std::endl;
 
-    file << "static const mat33 tabM[size*size] = {" << std::endl;
-    for (int t = 0; t < N; ++t) {
-        for (int a = 0; a < N; ++a) {
-            file << "{";
-            file << tab[a + t * N][0][0] << ", " << tab[a + t * N][0][1] << ", " << tab[a + t * N][0][2] << ", ";
-            file << tab[a + t * N][1][0] << ", " << tab[a + t * N][1][1] << ", " << tab[a + t * N][1][2] << ", ";
-            file << tab[a + t * N][2][0] << ", " << tab[a + t * N][2][1] << ", " << tab[a + t * N][2][2] << "}";
-            if (a != N - 1 || t != N - 1)
+    // M = {m00, 0, m02; 0, m11, 0; m20, 0, m22} (column major), the inverse follows from the 2 x 2 block of the
+    // xz-plane and 1 / m11
+    file << "// non-zero terms of the matrices M, mij = M[i][j] (column i, row j)" << std::endl;
+    const std::pair<const char*, const std::vector<float>*> arrays[] = {
+        { "tabM00", &tab.m00 }, { "tabM02", &tab.m02 }, { "tabM11", &tab.m11 }, { "tabM20", &tab.m20 }, { "tabM22", &tab.m22 },
+        { "tabMagnitude", &tab.magnitude }, { "tabFresnel", &tab.fresnel }
+    };
+    for (const auto& [name, values] : arrays) {
+        file << "static const float " << name << "[size*size] = {" << std::endl;
+        for (int i = 0; i < N * N; ++i) {
+            file << (*values)[i] << "f";
+            if (i != N * N - 1)
                 file << ", ";
-            file << std::endl;
+            if (i % N == N - 1)
+                file << std::endl;
         }
+        file << "};" << std::endl
+             << std::endl;
     }
-    file << "};" << std::endl
-         << std::endl;
 
-    file << "static const mat33 tabMinv[size*size] = {" << std::endl;
-    for (int t = 0; t < N; ++t) {
-        for (int a = 0; a < N; ++a) {
-            glm::mat3 Minv = glm::inverse(tab[a + t * N]);
+    file.close();
+}
 
-            file << "{";
-            file << Minv[0][0] << ", " << Minv[0][1] << ", " << Minv[0][2] << ", ";
-            file << Minv[1][0] << ", " << Minv[1][1] << ", " << Minv[1][2] << ", ";
-            file << Minv[2][0] << ", " << Minv[2][1] << ", " << Minv[2][2] << "}";
-            if (a != N - 1 || t != N - 1)
-                file << ", ";
-            file << std::endl;
-        }
-    }
-    file << "};" << std::endl
-         << std::endl;
+// export data to a binary table
+void writeTabBinary(const char* path, const LTCTable& tab)
+{
+    LTC_TRACE_ZONE("writeTabBinary");
+    std::ofstream file(path, std::ios::binary);
+    const int N = tab.N;
 
-    file << "static const float tabMagnitude[size*size] = {" << std::endl;
-    for (int t = 0; t < N; ++t) {
-        for (int a = 0; a < N; ++a) {
-            file << tabMagFresnel[a + t * N][0] << "f";
-            if (a != N - 1 || t != N - 1)
-                file << ", ";
-            file << std::endl;
-        }
+    BinaryTableHeader header;
+    std::copy(std::begin(BINARY_TABLE_MAGIC), std::end(BINARY_TABLE_MAGIC), header.magic);
+    header.version = BINARY_TABLE_VERSION;
+    header.N = N;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    uint64_t checksum = FNV_OFFSET_BASIS;
+    for (const std::vector<float>* terms : { &tab.m00, &tab.m02, &tab.m11, &tab.m20, &tab.m22, &tab.magnitude, &tab.fresnel }) {
+        file.write(reinterpret_cast<const char*>(terms->data()), N * N * sizeof(float));
+        checksum = fnv1a(terms->data(), N * N * sizeof(float), checksum);
     }
-    file << "};" << std::endl;
+    file.write(reinterpret_cast<const char*>(&checksum), sizeof(checksum));
 
     file.close();
 }
 
+void writeTabBinary(const LTCTable& tab, const std::filesystem::path& outFolder)
+{
+    writeTabBinary((outFolder / "ltc.bin").string().c_str(), tab);
+}
+
 // export data to MATLAB
-void writeTabMatlab(glm::mat3* tab, glm::vec2* tabMagFresnel, int N)
+void writeTabMatlab(const LTCTable& tab, const std::filesystem::path& outFolder)
 {
-    std::ofstream file("results/ltc.mat");
+    LTC_TRACE_ZONE("writeTabMatlab");
+    std::ofstream file(outFolder / "ltc.mat");
+    const int N = tab.N;
 
-    file << "# name: tabMagnitude" << std::endl;
-    file << "# type: matrix" << std::endl;
-    file << "# ndims: 2" << std::endl;
-    file << " " << N << " " << N << std::endl;
+    // tab<column><row>, the non-zero terms of the matrices
+    const std::pair<const char*, const std::vector<float>*> arrays[] = {
+        { "tabMagnitude", &tab.magnitude },
+        { "tab00", &tab.m00 }, { "tab02", &tab.m02 }, { "tab11", &tab.m11 }, { "tab20", &tab.m20 }, { "tab22", &tab.m22 }
+    };
+    for (const auto& [name, values] : arrays) {
+        file << "# name: " << name << std::endl;
+        file << "# type: matrix" << std::endl;
+        file << "# ndims: 2" << std::endl;
+        file << " " << N << " " << N << std::endl;
 
-    for (int t = 0; t < N; ++t) {
-        for (int a = 0; a < N; ++a) {
-            file << tabMagFresnel[a + t * N][0] << " ";
+        for (int t = 0; t < N; ++t) {
+            for (int a = 0; a < N; ++a)
+                file << (*values)[a + t * N] << " ";
+            file << std::endl;
         }
+
         file << std::endl;
     }
 
-    for (int row = 0; row < 3; ++row) {
-        for (int column = 0; column < 3; ++column) {
+    file.close();
+}
 
-            file << "# name: tab" << column << row << std::endl;
-            file << "# type: matrix" << std::endl;
-            file << "# ndims: 2" << std::endl;
-            file << " " << N << " " << N << std::endl;
+void writeDDS(const char* path, float* data, int N)
+{
+    LTC_TRACE_ZONE("writeDDS");
+    int numTerms = N * N * 4;
 
-            for (int t = 0; t < N; ++t) {
-                for (int a = 0; a < N; ++a)
-                    file << tab[a + t * N][column][row] << " ";
-                file << std::endl;
-            }
+    std::vector<uint16_t> half(numTerms);
 
-            file << std::endl;
+    for (int i = 0; i < numTerms; ++i) {
+        half[i] = float_to_half_fast(data[i]);
+    }
+
+    writeDDS(path, half.data(), N);
+}
+
+void writeDDS(const char* path, const uint16_t* halfData, int N)
+{
+    LTC_TRACE_ZONE("writeDDS");
+    SaveDDS(path, DDS_FORMAT_R16G16B16A16_FLOAT, sizeof(uint16_t) * 4, N, N, (void const*)halfData);
+}
+
+void writeDDS(glm::vec4* data1, glm::vec4* data2, int N, const std::filesystem::path& outFolder)
+{
+    writeDDS((outFolder / "ltc_1.dds").string().c_str(), &data1[0][0], N);
+    writeDDS((outFolder / "ltc_2.dds").string().c_str(), &data2[0][0], N);
+}
+
+void writeDDS(const char* path, const LightTexturePyramid& pyramid)
+{
+    LTC_TRACE_ZONE("writeDDS");
+    std::vector<uint16_t> half;
+    for (const std::vector<glm::vec4>& level : pyramid.levels) {
+        for (const glm::vec4& texel : level) {
+            for (int c = 0; c < 4; ++c)
+                half.push_back(float_to_half_fast(texel[c]));
         }
     }
 
+    SaveDDS(path, DDS_FORMAT_R16G16B16A16_FLOAT, sizeof(uint16_t) * 4, pyramid.widths[0], pyramid.heights[0], (void const*)half.data(), unsigned(pyramid.levels.size()));
+}
+
+void writeDDSArray(const char* path, const uint16_t* const* slices, int numSlices, int N)
+{
+    LTC_TRACE_ZONE("writeDDSArray");
+    std::vector<uint16_t> data(size_t(numSlices) * N * N * 4);
+    for (int i = 0; i < numSlices; ++i)
+        std::copy(slices[i], slices[i] + N * N * 4, data.begin() + size_t(i) * N * N * 4);
+
+    SaveDDSArray(path, DDS_FORMAT_R16G16B16A16_FLOAT, sizeof(uint16_t) * 4, N, N, numSlices, (void const*)data.data());
+}
+
+void writeAvgAlbedoDDS(const float* tabAvgAlbedo, int N, const std::filesystem::path& outFolder)
+{
+    LTC_TRACE_ZONE("writeAvgAlbedoDDS");
+    SaveDDS((outFolder / "ltc_avg.dds").string().c_str(), DDS_FORMAT_R32_FLOAT, sizeof(float), N, 1, (void const*)tabAvgAlbedo);
+}
+
+// export the packed textures as a binary blob
+void writeTexBlob(const char* path, const uint16_t* halfData1, const uint16_t* halfData2, int N, TableLayout layout)
+{
+    LTC_TRACE_ZONE("writeTexBlob");
+    std::ofstream file(path, std::ios::binary);
+
+    // 16 (32) byte header, so that the texels can be viewed in place as 16 bit values
+    file.write(TEX_BLOB_MAGIC, sizeof(TEX_BLOB_MAGIC));
+    if (layout == TableLayout::RowMajor) {
+        const uint32_t header[3] = { 1, uint32_t(N), 2 };
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    } else {
+        const uint32_t header[7] = { TEX_BLOB_VERSION, uint32_t(N), 2, uint32_t(layout), 0, 0, 0 };
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    }
+
+    const int numTexels = tableNumTexels(layout, N);
+    file.write(reinterpret_cast<const char*>(halfData1), numTexels * 4 * sizeof(uint16_t));
+    file.write(reinterpret_cast<const char*>(halfData2), numTexels * 4 * sizeof(uint16_t));
+
     file.close();
 }
 
-void writeDDS(const char* path, float* data, int N)
+void writeTexBlob(glm::vec4* data1, glm::vec4* data2, int N, const std::filesystem::path& outFolder, TableLayout layout)
 {
-    int numTerms = N * N * 4;
+    // reordered to the layout
+    const int numTexels = tableNumTexels(layout, N);
+    std::vector<glm::vec4> texels1(numTexels);
+    std::vector<glm::vec4> texels2(numTexels);
+    reorderTable(data1, texels1.data(), N, layout);
+    reorderTable(data2, texels2.data(), N, layout);
 
-    std::vector<uint16_t> half(numTerms);
+    std::vector<uint16_t> half1(numTexels * 4);
+    std::vector<uint16_t> half2(numTexels * 4);
+    for (int i = 0; i < numTexels * 4; ++i) {
+        half1[i] = float_to_half_fast((&texels1[0][0])[i]);
+        half2[i] = float_to_half_fast((&texels2[0][0])[i]);
+    }
 
-    for (int i = 0; i < numTerms; ++i) {
-        half[i] = float_to_half_fast(data[i]);
+    const char* names[] = { "ltc_tex.bin", "ltc_tex_tiled.bin", "ltc_tex_morton.bin" };
+    writeTexBlob((outFolder / names[int(layout)]).string().c_str(), half1.data(), half2.data(), N, layout);
+}
+
+// export the packed textures as C++ sources
+void writeTabEmbedded(const uint16_t* halfData1, const uint16_t* halfData2, int N, const std::filesystem::path& outFolder, const std::string& name)
+{
+    LTC_TRACE_ZONE("writeTabEmbedded");
+    std::ofstream header(outFolder / (name + ".h"));
+
+    header << "// generated by ltc_app, do not edit" << std::endl;
+    header << "#pragma once" << std::endl;
+    header << "#include <cstdint>" << std::endl
+           << std::endl;
+    header << "namespace " << name << " {" << std::endl
+           << std::endl;
+    header << "// size of the tables (theta, alpha), texel a + t * N" << std::endl;
+    header << "constexpr int N = " << N << ";" << std::endl
+           << std::endl;
+    header << "// packed textures (see packTab), N * N RGBA half floats" << std::endl;
+    header << "alignas(16) extern const uint16_t tex1[N * N * 4];" << std::endl;
+    header << "alignas(16) extern const uint16_t tex2[N * N * 4];" << std::endl
+           << std::endl;
+    header << "}" << std::endl;
+    header.close();
+
+    std::ofstream source(outFolder / (name + ".cpp"));
+    source << "// generated by ltc_app, do not edit" << std::endl;
+    source << "#include \"" << name << ".h\"" << std::endl
+           << std::endl;
+    source << "namespace " << name << " {" << std::endl;
+    source << std::hex << std::setfill('0');
+
+    const uint16_t* tables[2] = { halfData1, halfData2 };
+    for (int k = 0; k < 2; ++k) {
+        source << std::endl
+               << "alignas(16) const uint16_t tex" << (k + 1) << "[N * N * 4] = {" << std::endl;
+        for (int i = 0; i < N * N; ++i) {
+            // one texel per line
+            for (int c = 0; c < 4; ++c)
+                source << "0x" << std::setw(4) << tables[k][4 * i + c] << ",";
+            source << std::endl;
+        }
+        source << "};" << std::endl;
     }
 
-    SaveDDS(path, DDS_FORMAT_R16G16B16A16_FLOAT, sizeof(uint16_t) * 4, N, N, (void const*)half.data());
+    source << std::endl
+           << "}" << std::endl;
+    source.close();
 }
 
-void writeDDS(glm::vec4* data1, glm::vec4* data2, int N)
+void writeTabEmbedded(glm::vec4* data1, glm::vec4* data2, int N, const std::filesystem::path& outFolder, const std::string& name)
 {
-    writeDDS("results/ltc_1.dds", &data1[0][0], N);
-    writeDDS("results/ltc_2.dds", &data2[0][0], N);
+    std::vector<uint16_t> half1(N * N * 4);
+    std::vector<uint16_t> half2(N * N * 4);
+    for (int i = 0; i < N * N * 4; ++i) {
+        half1[i] = float_to_half_fast((&data1[0][0])[i]);
+        half2[i] = float_to_half_fast((&data2[0][0])[i]);
+    }
+
+    writeTabEmbedded(half1.data(), half2.data(), N, outFolder, name);
 }
 
 // export data to Javascript
-void writeJS(glm::vec4* data1, glm::vec4* data2, int N)
+void writeJS(glm::vec4* data1, glm::vec4* data2, int N, const std::filesystem::path& outFolder)
 {
-    std::ofstream file("results/ltc.js");
+    LTC_TRACE_ZONE("writeJS");
+    std::ofstream file(outFolder / "ltc.js");
 
     file << "var g_ltc_1 = [" << std::endl;
 
@@ -153,4 +299,150 @@ void writeJS(glm::vec4* data1, glm::vec4* data2, int N)
     file.close();
 }
 
+// float literal for C++ (suffix "f") or GLSL
+static std::string approxLiteral(float value, const char* suffix)
+{
+    std::ostringstream literal;
+    literal << std::setprecision(9) << value;
+    std::string text = literal.str();
+    if (text.find_first_of(".e") == std::string::npos)
+        text += ".0";
+    return text + suffix;
+}
+
+// Horner form of a polynomial of x and y (see approxTermIndex)
+static std::string approxHorner(const std::vector<float>& coefficients, int degree, const char* suffix)
+{
+    std::string outer;
+    for (int j = degree; j >= 0; --j) {
+        std::string inner;
+        for (int i = degree - j; i >= 0; --i) {
+            const std::string c = approxLiteral(coefficients[approxTermIndex(i, j, degree)], suffix);
+            inner = inner.empty() ? c : c + " + x * (" + inner + ")";
+        }
+        outer = outer.empty() ? inner : "(" + inner + ") + y * (" + outer + ")";
+    }
+    return outer;
+}
+
+static std::string approxExpression(const TableApprox& approx, int channel, const char* suffix)
+{
+    const ChannelApprox& c = approx.channels[channel];
+    const std::string numerator = approxHorner(c.numerator, approx.numeratorDegree, suffix);
+    if (c.denominator.empty())
+        return numerator;
+    return "(" + numerator + ") / (" + approxHorner(c.denominator, approx.denominatorDegree, suffix) + ")";
+}
+
+static void writeApproxComment(std::ofstream& file, const TableApprox& approx, int N)
+{
+    file << "// generated by ltc_app, do not edit" << std::endl;
+    file << "// packed LTC tables (" << N << " x " << N << ") approximated by rational functions of degree "
+         << approx.numeratorDegree << " / " << approx.denominatorDegree << std::endl;
+    file << "// of x = roughness and y = sqrt(1 - cos(theta_v)), see ltc/approx.h and the error report" << std::endl;
+    file << "// (the sphere table, tex2.w, of x = z * 0.5 + 0.5 and y = formFactor)" << std::endl;
+}
+
+// export the analytic approximation to C++
+void writeApproxCpp(const TableApprox& approx, int N, const std::filesystem::path& outFolder, const std::string& name)
+{
+    LTC_TRACE_ZONE("writeApproxCpp");
+    std::ofstream file(outFolder / (name + ".h"));
+
+    writeApproxComment(file, approx, N);
+    file << "#pragma once" << std::endl;
+    file << "#include <algorithm>" << std::endl;
+    file << "#include <cmath>" << std::endl
+         << std::endl;
+    file << "namespace " << name << " {" << std::endl
+         << std::endl;
+    file << "// the texels of tex1 and tex2 at (roughness, cos(theta_v)), tex2[3] is 0 (the sphere table, see sphere)" << std::endl;
+    file << "inline void eval(float roughness, float cosThetaV, float tex1[4], float tex2[4])" << std::endl;
+    file << "{" << std::endl;
+    file << "    const float x = std::clamp(roughness, 0.0f, 1.0f);" << std::endl;
+    file << "    const float y = std::sqrt(1.0f - std::clamp(cosThetaV, 0.0f, 1.0f));" << std::endl;
+    for (int c = 0; c < 7; ++c)
+        file << "    tex" << (c / 4 + 1) << "[" << (c % 4) << "] = " << approxExpression(approx, c, "f") << ";" << std::endl;
+    file << "    tex2[3] = 0.0f;" << std::endl;
+    file << "}" << std::endl
+         << std::endl;
+    file << "// the sphere table (tex2.w) of a disk light, at the z of its average direction and its form factor" << std::endl;
+    file << "inline float sphere(float z, float formFactor)" << std::endl;
+    file << "{" << std::endl;
+    file << "    const float x = std::clamp(z * 0.5f + 0.5f, 0.0f, 1.0f);" << std::endl;
+    file << "    const float y = std::clamp(formFactor, 0.0f, 1.0f);" << std::endl;
+    file << "    return " << approxExpression(approx, 7, "f") << ";" << std::endl;
+    file << "}" << std::endl
+         << std::endl;
+    file << "}" << std::endl;
+    file.close();
+}
+
+// export the analytic approximation to GLSL
+void writeApproxGLSL(const TableApprox& approx, int N, const std::filesystem::path& outFolder, const std::string& name)
+{
+    LTC_TRACE_ZONE("writeApproxGLSL");
+    std::ofstream file(outFolder / (name + ".glsl"));
+
+    writeApproxComment(file, approx, N);
+    for (int k = 0; k < 2; ++k) {
+        file << std::endl
+             << "// replaces texture(ltc_" << (k + 1) << ", uv) at uv = (roughness, sqrt(1 - cosTheta))"
+             << (k == 1 ? ", w is 0 (see " + name + "_sphere)" : "") << std::endl;
+        file << "vec4 " << name << "_tex" << (k + 1) << "(float roughness, float cosTheta)" << std::endl;
+        file << "{" << std::endl;
+        file << "    float x = clamp(roughness, 0.0, 1.0);" << std::endl;
+        file << "    float y = sqrt(1.0 - clamp(cosTheta, 0.0, 1.0));" << std::endl;
+        file << "    return vec4(" << std::endl;
+        for (int c = 0; c < 4; ++c)
+            file << "        " << (4 * k + c == 7 ? "0.0" : approxExpression(approx, 4 * k + c, "")) << (c < 3 ? "," : ");") << std::endl;
+        file << "}" << std::endl;
+    }
+
+    file << std::endl
+         << "// replaces texture(ltc_2, uv).w at uv = (z * 0.5 + 0.5, formFactor), the sphere table of a disk light" << std::endl;
+    file << "float " << name << "_sphere(float z, float formFactor)" << std::endl;
+    file << "{" << std::endl;
+    file << "    float x = clamp(z * 0.5 + 0.5, 0.0, 1.0);" << std::endl;
+    file << "    float y = clamp(formFactor, 0.0, 1.0);" << std::endl;
+    file << "    return " << approxExpression(approx, 7, "") << ";" << std::endl;
+    file << "}" << std::endl;
+    file.close();
+}
+
+// export the errors and coefficients of the analytic approximation
+void writeApproxReport(const TableApprox& approx, const ApproxError* errors, int N, const std::filesystem::path& outFolder, const std::string& name)
+{
+    LTC_TRACE_ZONE("writeApproxReport");
+    std::ofstream file(outFolder / (name + ".txt"));
+    const char* channelNames[8] = { "tex1.x", "tex1.y", "tex1.z", "tex1.w", "tex2.x", "tex2.y", "tex2.z", "tex2.w" };
+
+    file << "rational functions of degree " << approx.numeratorDegree << " / " << approx.denominatorDegree
+         << " of x = roughness and y = sqrt(1 - cos(theta_v))" << std::endl;
+    file << "(tex2.w, the sphere table: of x = z * 0.5 + 0.5 and y = formFactor of a disk light)" << std::endl;
+    file << "errors against the " << N << " x " << N << " packed table (worst cell a, t):" << std::endl;
+    file << std::scientific << std::setprecision(3);
+    for (int c = 0; c < 8; ++c) {
+        file << channelNames[c] << ": max " << errors[c].maxAbs << " (" << errors[c].worstA << ", " << errors[c].worstT
+             << "), rms " << errors[c].rms << (approx.channels[c].denominator.empty() ? ", polynomial" : "") << std::endl;
+    }
+
+    file << std::endl
+         << "coefficients of x^i y^j, by increasing j then i:" << std::endl;
+    file << std::setprecision(9);
+    for (int c = 0; c < 8; ++c) {
+        file << channelNames[c] << " P:";
+        for (float coefficient : approx.channels[c].numerator)
+            file << " " << coefficient;
+        file << std::endl;
+        if (!approx.channels[c].denominator.empty()) {
+            file << channelNames[c] << " Q:";
+            for (float coefficient : approx.channels[c].denominator)
+                file << " " << coefficient;
+            file << std::endl;
+        }
+    }
+    file.close();
+}
+
 }
@@ -2,26 +2,45 @@
 //
 #include "ltc/fit_LTC.h"
 #include "LTC.h"
+#include "LTC_lanes.h"
+#include "binary_table.h"
 #include "ltc/brdf.h"
 #include "ltc/brdf_beckmann.h"
 #include "ltc/brdf_disney_diffuse.h"
 #include "ltc/brdf_ggx.h"
 #include "ltc/export.h"
+#include "ltc/import.h"
 #include "ltc/plot.h"
+#include "ltc/trace.h"
+#include "brent.h"
+#include "cap_integral.h"
 #include "nelder_mead.h"
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
 #include <cmath>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <sstream>
+#include <thread>
+#include <limits>
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#include <vector>
 
 // number of samples used to compute the error during fitting
 constexpr int Nsample = 32;
 // minimal roughness (avoid singularities)
 constexpr float MIN_ALPHA = 0.0005f;
+// initial simplex of a fit started from a known matrix (warm start, refit), relative to the size of the lobe (m11)
+constexpr float WARM_START_EPSILON = 0.1f;
+// version of the fitting procedure, part of the cache key (see fitCachePath): the key does not depend on the code, so
+// any change to the fitting code (first guesses, error, sampling, Nelder-Mead, ...) that affects the fitted tables
+// must increment it, otherwise the cache keeps serving the tables of the previous version
+constexpr int FIT_VERSION = 2;
 
 const float pi = std::acos(-1.0f);
 
@@ -37,17 +56,19 @@ namespace ltc {
 // * the norm (albedo) of the BRDF
 // * the average Schlick Fresnel value
 // * the average direction of the BRDF
+// if symmetric only the first half of the U2 strata is sampled, the other half are their mirror images
 static void computeAvgTerms(const Brdf& brdf, const glm::vec3& V, const float alpha,
-    float& norm, float& fresnel, glm::vec3& averageDir)
+    float& norm, float& fresnel, glm::vec3& averageDir, const int numSamples = Nsample, const bool symmetric = false)
 {
     norm = 0.0f;
     fresnel = 0.0f;
     averageDir = glm::vec3(0, 0, 0);
 
-    for (int j = 0; j < Nsample; ++j) {
-        for (int i = 0; i < Nsample; ++i) {
-            const float U1 = (i + 0.5f) / Nsample;
-            const float U2 = (j + 0.5f) / Nsample;
+    const int numStrata = symmetric ? numSamples / 2 : numSamples;
+    for (int j = 0; j < numStrata; ++j) {
+        for (int i = 0; i < numSamples; ++i) {
+            const float U1 = (i + 0.5f) / numSamples;
+            const float U2 = (j + 0.5f) / numSamples;
 
             // sample
             const glm::vec3 L = brdf.sample(V, alpha, U1, U2);
@@ -69,8 +90,8 @@ static void computeAvgTerms(const Brdf& brdf, const glm::vec3& V, const float al
         }
     }
 
-    norm /= (float)(Nsample * Nsample);
-    fresnel /= (float)(Nsample * Nsample);
+    norm /= (float)(numStrata * numSamples);
+    fresnel /= (float)(numStrata * numSamples);
 
     // clear y component, which should be zero with isotropic BRDFs
     averageDir.y = 0.0f;
@@ -80,14 +101,23 @@ static void computeAvgTerms(const Brdf& brdf, const glm::vec3& V, const float al
 
 // compute the error between the BRDF and the LTC
 // using Multiple Importance Sampling
-static float computeError(const LTC& ltc, const Brdf& brdf, const glm::vec3& V, const float alpha)
+// if symmetric only the first half of the U2 strata is sampled, the other half are their mirror images
+// the error is a sum of non-negative terms: stops as soon as it exceeds bound and returns the partial (lower) value
+static float computeError(const LTC& ltc, const Brdf& brdf, const glm::vec3& V, const float alpha, const int numSamples = Nsample, const bool symmetric = false,
+    const float bound = std::numeric_limits<float>::infinity())
 {
     double error = 0.0;
 
-    for (int j = 0; j < Nsample; ++j) {
-        for (int i = 0; i < Nsample; ++i) {
-            const float U1 = (i + 0.5f) / Nsample;
-            const float U2 = (j + 0.5f) / Nsample;
+    const int numStrata = symmetric ? numSamples / 2 : numSamples;
+    // margin for the rounding of the final division
+    const double threshold = (double)bound * (numStrata * numSamples) * (1.0 + 1e-5);
+    for (int j = 0; j < numStrata; ++j) {
+        if (error > threshold)
+            break;
+
+        for (int i = 0; i < numSamples; ++i) {
+            const float U1 = (i + 0.5f) / numSamples;
+            const float U2 = (j + 0.5f) / numSamples;
 
             // importance sample LTC
             {
@@ -123,24 +153,30 @@ static float computeError(const LTC& ltc, const Brdf& brdf, const glm::vec3& V,
         }
     }
 
-    return (float)error / (float)(Nsample * Nsample);
+    return (float)error / (float)(numStrata * numSamples);
 }
 
 struct FitLTC {
-    FitLTC(LTC& ltc_, const Brdf& brdf, bool isotropic_, const glm::vec3& V_, float alpha_)
+    FitLTC(LTC& ltc_, const Brdf& brdf, bool isotropic_, const glm::vec3& V_, float alpha_, int numSamples_, bool symmetric_)
         : ltc(ltc_)
         , brdf(brdf)
         , V(V_)
         , alpha(alpha_)
         , isotropic(isotropic_)
+        , numSamples(numSamples_)
+        , symmetric(symmetric_)
     {
     }
 
+    // active parameters: (m11) if isotropic, (m11, m22, m13) otherwise
     void update(const float* params)
+    {
+        update(ltc, params);
+    }
+
+    void update(LTC& ltc, const float* params) const
     {
         float m11 = std::max<float>(params[0], 1e-7f);
-        float m22 = std::max<float>(params[1], 1e-7f);
-        float m13 = params[2];
 
         if (isotropic) {
             ltc.m11 = m11;
@@ -148,16 +184,18 @@ struct FitLTC {
             ltc.m13 = 0.0f;
         } else {
             ltc.m11 = m11;
-            ltc.m22 = m22;
-            ltc.m13 = m13;
+            ltc.m22 = std::max<float>(params[1], 1e-7f);
+            ltc.m13 = params[2];
         }
         ltc.update();
     }
 
-    float operator()(const float* params)
+    // evaluates a copy of the LTC, can be called concurrently
+    float operator()(const float* params, float bound = std::numeric_limits<float>::infinity()) const
     {
-        update(params);
-        return computeError(ltc, brdf, V, alpha);
+        LTC candidate = ltc;
+        update(candidate, params);
+        return computeError(candidate, brdf, V, alpha, numSamples, symmetric, bound);
     }
 
     const Brdf& brdf;
@@ -166,126 +204,680 @@ struct FitLTC {
 
     const glm::vec3& V;
     float alpha;
+    int numSamples;
+    bool symmetric;
 };
 
+// set the parameters (m11, m22, m13) of the LTC from a matrix expressed in the frame (X, Y, Z) of the LTC
+// returns false and keeps the current parameters if the matrix cannot be represented in that frame
+static bool initFromMatrix(LTC& ltc, const glm::mat3& M)
+{
+    // M = [X Y Z] * [m11 0 m13; 0 m22 0; 0 0 1] up to a scale factor
+    const glm::mat3 P = glm::transpose(glm::mat3(ltc.X, ltc.Y, ltc.Z)) * M;
+    const float scale = P[2][2];
+    if (!(scale > 0.0f) || !(P[0][0] > 0.0f) || !(P[1][1] > 0.0f))
+        return false;
+
+    ltc.m11 = P[0][0] / scale;
+    ltc.m22 = P[1][1] / scale;
+    ltc.m13 = P[2][0] / scale;
+    ltc.update();
+    return true;
+}
+
 // fit brute force
 // refine first guess by exploring parameter space
-static void fit(LTC& ltc, const Brdf& brdf, const glm::vec3& V, const float alpha, const float epsilon = 0.05f, const bool isotropic = false)
+// returns the error of the best fit
+// speculative evaluates the candidate points of the simplex concurrently (see NelderMead)
+static float fit(LTC& ltc, const Brdf& brdf, const glm::vec3& V, const float alpha, const float epsilon = 0.05f, const bool isotropic = false, const int numSamples = Nsample, const bool symmetric = false,
+    const bool speculative = false)
 {
-    float startFit[3] = { ltc.m11, ltc.m22, ltc.m13 };
-    float resultFit[3];
-
-    FitLTC fitter(ltc, brdf, isotropic, V, alpha);
+    LTC_TRACE_ZONE("fit");
+    FitLTC fitter(ltc, brdf, isotropic, V, alpha, numSamples, symmetric);
 
-    // Find best-fit LTC lobe (scale, alphax, alphay)
-    float error = NelderMead<3>(resultFit, startFit, epsilon, 1e-5f, 100, fitter);
+    float resultFit[3];
+    float error;
+    if (isotropic) {
+        // a single active parameter, search log(m11) since it spans several orders of magnitude
+        const float m11 = std::max<float>(ltc.m11, 1e-7f);
+        const float delta = std::min<float>(epsilon / m11, 1.0f);
+        float logM11;
+        error = Brent(logM11, std::log(m11), delta, 1e-4f, 100, [&](float x) {
+            const float params[1] = { std::exp(x) };
+            return fitter(params);
+        });
+        resultFit[0] = std::exp(logM11);
+    } else {
+        // Find best-fit LTC lobe (scale, alphax, alphay)
+        const float startFit[3] = { ltc.m11, ltc.m22, ltc.m13 };
+        if (speculative)
+            error = NelderMead<3, true>(resultFit, startFit, epsilon, 1e-5f, 100, fitter);
+        else
+            error = NelderMead<3>(resultFit, startFit, epsilon, 1e-5f, 100, fitter);
+    }
 
     // Update LTC with best fitting values
     fitter.update(resultFit);
+
+    return error;
 }
 
-// fit data
-void fitTab(glm::mat3* tab, glm::vec2* tabMagFresnel, const int N, const Brdf& brdf)
+// number of cells fitted in lockstep (8 floats fill an AVX register)
+constexpr int LaneWidth = 8;
+
+// computeError for the LTCs of several cells at once, the LTC math is evaluated for all lanes together
+// while the (virtual) BRDF is evaluated per lane
+// lanes that are not active, or whose error exceeds their bound (see computeError), are skipped
+static void computeErrorLanes(const LTCLanes<LaneWidth>& ltcs, const Brdf& brdf, const glm::vec3* V, const float* alpha,
+    const int numSamples, const bool symmetric, const float* bound, const bool* active, float* result)
 {
-    const auto alphaIteration = [&](int a, int startT, int endT) {
-        // NOTE(Mathijs): This should NOT be moved into the inner loop because it uses values from the previous iterations.
-        LTC ltc;
+    double error[LaneWidth] = {};
+    bool running[LaneWidth];
+
+    const int numStrata = symmetric ? numSamples / 2 : numSamples;
+    double threshold[LaneWidth];
+    for (int l = 0; l < LaneWidth; ++l) {
+        running[l] = active[l];
+        // margin for the rounding of the final division
+        threshold[l] = (double)bound[l] * (numStrata * numSamples) * (1.0 + 1e-5);
+    }
 
-        for (int t = startT; t < endT; ++t) {
-            // parameterized by sqrt(1 - cos(theta))
-            float x = t / float(N - 1);
-            float ct = 1.0f - x * x;
-            float theta = std::min<float>(1.57f, std::acos(ct)); // 1.57 ~= pi/2
-            const glm::vec3 V = glm::vec3(std::sin(theta), 0, std::cos(theta));
+    for (int j = 0; j < numStrata; ++j) {
+        bool any = false;
+        for (int l = 0; l < LaneWidth; ++l) {
+            running[l] = running[l] && !(error[l] > threshold[l]);
+            any = any || running[l];
+        }
+        if (!any)
+            break;
 
-            // alpha = roughness^2
-            float roughness = a / float(N - 1);
-            float alpha = std::max<float>(roughness * roughness, MIN_ALPHA);
+        for (int i = 0; i < numSamples; ++i) {
+            const float U1 = (i + 0.5f) / numSamples;
+            const float U2 = (j + 0.5f) / numSamples;
 
-            glm::vec3 averageDir;
-            computeAvgTerms(brdf, V, alpha, ltc.magnitude, ltc.fresnel, averageDir);
+            float L[3][LaneWidth];
+            float evalBrdf[LaneWidth], pdfBrdf[LaneWidth], evalLtc[LaneWidth];
 
-            bool isotropic;
+            // importance sample LTC
+            ltcs.sample(U1, U2, L);
+            ltcs.eval(L, evalLtc);
+            for (int l = 0; l < LaneWidth; ++l) {
+                if (running[l])
+                    evalBrdf[l] = brdf.eval(V[l], glm::vec3(L[0][l], L[1][l], L[2][l]), alpha[l], pdfBrdf[l]);
+            }
+            for (int l = 0; l < LaneWidth; ++l) {
+                if (!running[l])
+                    continue;
+                const float pdfLtc = evalLtc[l] / ltcs.magnitude[l];
 
-            // 1. first guess for the fit
-            // init the hemisphere in which the distribution is fitted
-            // if theta == 0 the lobe is rotationally symmetric and aligned with Z = (0 0 1)
-            if (t == 0) {
-                ltc.X = glm::vec3(1, 0, 0);
-                ltc.Y = glm::vec3(0, 1, 0);
-                ltc.Z = glm::vec3(0, 0, 1);
+                // error with MIS weight
+                double error_ = std::abs(evalBrdf[l] - evalLtc[l]);
+                error_ = error_ * error_ * error_;
+                error[l] += error_ / (pdfLtc + pdfBrdf[l]);
+            }
 
-                if (a == N - 1) { // roughness = 1
-                    ltc.m11 = 1.0f;
-                    ltc.m22 = 1.0f;
-                } else { // init with roughness of previous fit
-                    ltc.m11 = tab[a + 1 + t * N][0][0];
-                    ltc.m22 = tab[a + 1 + t * N][1][1];
+            // importance sample BRDF
+            for (int l = 0; l < LaneWidth; ++l) {
+                if (!running[l]) {
+                    // any direction, the result is unused
+                    L[0][l] = L[1][l] = 0.0f;
+                    L[2][l] = 1.0f;
+                    continue;
                 }
+                const glm::vec3 Lb = brdf.sample(V[l], alpha[l], U1, U2);
+                L[0][l] = Lb.x;
+                L[1][l] = Lb.y;
+                L[2][l] = Lb.z;
+                evalBrdf[l] = brdf.eval(V[l], Lb, alpha[l], pdfBrdf[l]);
+            }
+            ltcs.eval(L, evalLtc);
+            for (int l = 0; l < LaneWidth; ++l) {
+                if (!running[l])
+                    continue;
+                const float pdfLtc = evalLtc[l] / ltcs.magnitude[l];
 
-                ltc.m13 = 0;
-                ltc.update();
+                // error with MIS weight
+                double error_ = std::abs(evalBrdf[l] - evalLtc[l]);
+                error_ = error_ * error_ * error_;
+                error[l] += error_ / (pdfLtc + pdfBrdf[l]);
+            }
+        }
+    }
 
-                isotropic = true;
-            } else { // otherwise use previous configuration as first guess
-                glm::vec3 L = averageDir;
-                glm::vec3 T1(L.z, 0, -L.x);
-                glm::vec3 T2(0, 1, 0);
-                ltc.X = T1;
-                ltc.Y = T2;
-                ltc.Z = L;
+    for (int l = 0; l < LaneWidth; ++l)
+        result[l] = (float)error[l] / (float)(numStrata * numSamples);
+}
 
-                ltc.update();
+// fit (non isotropic) cells in lockstep, one Nelder-Mead instance per lane
+// every step evaluates the pending point of all the instances that have not converged yet
+static void fitLanes(LTC* ltcs, const int numLanes, const Brdf& brdf, const glm::vec3* V, const float* alpha, const float* epsilon,
+    const int numSamples, const bool symmetric)
+{
+    std::vector<FitLTC> fitters;
+    NelderMeadState<3> solvers[LaneWidth];
+    for (int l = 0; l < numLanes; ++l) {
+        fitters.emplace_back(ltcs[l], brdf, false, V[l], alpha[l], numSamples, symmetric);
+        const float startFit[3] = { ltcs[l].m11, ltcs[l].m22, ltcs[l].m13 };
+        solvers[l].init(startFit, epsilon[l], 1e-5f, 100);
+    }
 
-                isotropic = false;
+    LTCLanes<LaneWidth> candidates;
+    for (int l = 0; l < LaneWidth; ++l)
+        candidates.set(l, ltcs[0]);
+
+    for (;;) {
+        bool active[LaneWidth] = {};
+        float bound[LaneWidth] = {};
+        bool any = false;
+        for (int l = 0; l < numLanes; ++l) {
+            if (solvers[l].done())
+                continue;
+
+            LTC candidate = ltcs[l];
+            fitters[l].update(candidate, solvers[l].point());
+            candidates.set(l, candidate);
+            bound[l] = solvers[l].bound();
+            active[l] = true;
+            any = true;
+        }
+        if (!any)
+            break;
+
+        float errors[LaneWidth];
+        computeErrorLanes(candidates, brdf, V, alpha, numSamples, symmetric, bound, active, errors);
+        for (int l = 0; l < numLanes; ++l) {
+            if (active[l])
+                solvers[l].submit(errors[l]);
+        }
+    }
+
+    // Update LTCs with best fitting values
+    for (int l = 0; l < numLanes; ++l) {
+        float resultFit[3];
+        solvers[l].result(resultFit);
+        fitters[l].update(resultFit);
+    }
+}
+
+// view direction and roughness of cell (a, t) of the table
+static void cellConfiguration(int a, int t, int N, glm::vec3& V, float& alpha)
+{
+    // parameterized by sqrt(1 - cos(theta))
+    float x = t / float(N - 1);
+    float ct = 1.0f - x * x;
+    float theta = std::min<float>(1.57f, std::acos(ct)); // 1.57 ~= pi/2
+    V = glm::vec3(std::sin(theta), 0, std::cos(theta));
+
+    // alpha = roughness^2
+    float roughness = a / float(N - 1);
+    alpha = std::max<float>(roughness * roughness, MIN_ALPHA);
+}
+
+// init the hemisphere in which the distribution is fitted
+// if theta == 0 the lobe is rotationally symmetric and aligned with Z = (0 0 1)
+// otherwise it is aligned with the average direction of the BRDF
+static void initFrame(LTC& ltc, const glm::vec3& averageDir, bool isotropic)
+{
+    if (isotropic) {
+        ltc.X = glm::vec3(1, 0, 0);
+        ltc.Y = glm::vec3(0, 1, 0);
+        ltc.Z = glm::vec3(0, 0, 1);
+    } else {
+        glm::vec3 L = averageDir;
+        glm::vec3 T1(L.z, 0, -L.x);
+        glm::vec3 T2(0, 1, 0);
+        ltc.X = T1;
+        ltc.Y = T2;
+        ltc.Z = L;
+    }
+}
+
+// kill useless coefs in matrix
+static void storeMatrix(glm::mat3& m, const LTC& ltc)
+{
+    m = ltc.M;
+    m[0][1] = 0;
+    m[1][0] = 0;
+    m[2][1] = 0;
+    m[1][2] = 0;
+}
+
+// terms of the inverse matrix normalized by its middle element, as packed in tex1 (see packTab):
+// invM[0][0], invM[0][2], invM[2][0], invM[2][2], the inverse of the block of the xz-plane times m11
+static void packedTerms(const LTCTable& tab, int i, float* terms)
+{
+    const float scale = tab.m11[i] / (tab.m00[i] * tab.m22[i] - tab.m20[i] * tab.m02[i]);
+    terms[0] = tab.m22[i] * scale;
+    terms[1] = -tab.m02[i] * scale;
+    terms[2] = -tab.m20[i] * scale;
+    terms[3] = tab.m00[i] * scale;
+}
+
+// check that integrating over half of the hemisphere gives the same result as the full hemisphere
+// on a few cells of the table (requires an even number of samples and a BRDF that honors the U2 mirror contract)
+static bool validateSymmetry(const Brdf& brdf, int N, int numSamples)
+{
+    if (numSamples % 2 != 0)
+        return false;
+
+    const auto relativeDifference = [](float x, float y) {
+        return std::abs(x - y) / std::max<float>(std::max<float>(std::abs(x), std::abs(y)), 1e-6f);
+    };
+
+    for (int a : { N / 4, N - 1 }) {
+        for (int t : { N / 3, N - 1 }) {
+            glm::vec3 V;
+            float alpha;
+            cellConfiguration(a, t, N, V, alpha);
+
+            LTC full, half;
+            glm::vec3 fullDir, halfDir;
+            computeAvgTerms(brdf, V, alpha, full.magnitude, full.fresnel, fullDir, numSamples, false);
+            computeAvgTerms(brdf, V, alpha, half.magnitude, half.fresnel, halfDir, numSamples, true);
+            if (relativeDifference(full.magnitude, half.magnitude) > 1e-3f || relativeDifference(full.fresnel, half.fresnel) > 1e-3f || glm::dot(fullDir, halfDir) < 0.9999f)
+                return false;
+
+            // an arbitrary (non isotropic) lobe around the average direction
+            initFrame(full, fullDir, false);
+            full.m11 = 0.5f;
+            full.m22 = 0.3f;
+            full.m13 = -0.2f;
+            full.update();
+            if (relativeDifference(computeError(full, brdf, V, alpha, numSamples, false), computeError(full, brdf, V, alpha, numSamples, true)) > 1e-3f)
+                return false;
+        }
+    }
+    return true;
+}
+
+// number of rows being fitted, by all the concurrent calls to fitTab
+static std::atomic_int activeRows { 0 };
+
+// counts the rows being fitted
+struct ActiveRow {
+    ActiveRow(std::atomic_int& counter_)
+        : counter(counter_)
+    {
+        ++counter;
+    }
+    ~ActiveRow()
+    {
+        --counter;
+    }
+
+    std::atomic_int& counter;
+};
+
+// fit data
+static void fitTabUncached(LTCTable& tab, const Brdf& brdf, const FitSettings& settings)
+{
+    const int N = tab.N;
+    const bool symmetric = settings.symmetric && validateSymmetry(brdf, N, Nsample);
+    if (settings.symmetric && !symmetric)
+        std::cout << "BRDF is not mirror symmetric, integrating over the full hemisphere" << std::endl;
+
+    // the simplex is evaluated speculatively when some threads would be idle otherwise
+    // (towards the end of the parallel phase, the low roughness rows take the longest)
+    const int numThreads = tbb::this_task_arena::max_concurrency();
+
+    // cells of the warm start that fall back to the default first guess
+    std::atomic_int numColdCells { 0 };
+
+    // 1. first guess for the fit of cell (a, t), returns the size of the neighborhood to explore
+    const auto initCell = [&](LTC& ltc, int a, int t, glm::vec3& V, float& alpha) {
+        cellConfiguration(a, t, N, V, alpha);
+
+        glm::vec3 averageDir;
+        computeAvgTerms(brdf, V, alpha, ltc.magnitude, ltc.fresnel, averageDir, Nsample, symmetric);
+
+        initFrame(ltc, averageDir, t == 0);
+        if (t == 0) {
+            if (a == N - 1 || settings.initialTab) { // roughness = 1 or warm start (see below)
+                ltc.m11 = 1.0f;
+                ltc.m22 = 1.0f;
+            } else { // init with roughness of previous fit
+                ltc.m11 = tab.m00[a + 1 + t * N];
+                ltc.m22 = tab.m11[a + 1 + t * N];
             }
 
+            ltc.m13 = 0;
+        } // otherwise use previous configuration as first guess
+        ltc.update();
+
+        // warm start: express the previous fit in the frame of this cell
+        if (!settings.initialTab)
+            return 0.05f;
+        if (!initFromMatrix(ltc, settings.initialTab->matrix(a + t * N))) {
+            ++numColdCells;
+            return 0.05f;
+        }
+
+        // a warm start is already close to the minimum, only explore its neighborhood
+        return WARM_START_EPSILON * std::min<float>(ltc.m11, 0.5f);
+    };
+
+    // copy data
+    const auto storeCell = [&](const LTC& ltc, int a, int t) {
+        const auto idx = a + t * N;
+        tab.setMatrix(idx, ltc.M);
+        tab.magnitude[idx] = ltc.magnitude;
+        tab.fresnel[idx] = ltc.fresnel;
+    };
+
+    const auto alphaIteration = [&](int a, int startT, int endT) {
+        LTC_TRACE_ZONE("alphaIteration");
+        const ActiveRow activeRow(activeRows);
+
+        // NOTE(Mathijs): This should NOT be moved into the inner loop because it uses values from the previous iterations.
+        LTC ltc;
+
+        for (int t = startT; t < endT; ++t) {
+            glm::vec3 V;
+            float alpha;
+            const float epsilon = initCell(ltc, a, t, V, alpha);
+
             // 2. fit (explore parameter space and refine first guess)
-            float epsilon = 0.05f;
-            fit(ltc, brdf, V, alpha, epsilon, isotropic);
+            const bool speculative = settings.speculative && activeRows < numThreads;
+            fit(ltc, brdf, V, alpha, epsilon, t == 0, Nsample, symmetric, speculative);
 
-            // copy data
-            const auto idx = a + t * N;
-            tab[idx] = ltc.M;
-            tabMagFresnel[idx][0] = ltc.magnitude;
-            tabMagFresnel[idx][1] = ltc.fresnel;
-
-            // kill useless coefs in matrix
-            tab[idx][0][1] = 0;
-            tab[idx][1][0] = 0;
-            tab[idx][2][1] = 0;
-            tab[idx][1][2] = 0;
+            storeCell(ltc, a, t);
+        }
+
+        if (endT == N && settings.rowDone)
+            settings.rowDone(a);
+    };
+
+    // rows [startA, endA) fitted together, one row per lane
+    const auto lockstepIteration = [&](int startA, int endA) {
+        LTC_TRACE_ZONE("lockstepIteration");
+        const int numLanes = endA - startA;
+        LTC ltcs[LaneWidth];
+
+        for (int t = 0; t < N; ++t) {
+            glm::vec3 V[LaneWidth];
+            float alpha[LaneWidth];
+            float epsilon[LaneWidth];
+            for (int l = 0; l < numLanes; ++l)
+                epsilon[l] = initCell(ltcs[l], startA + l, t, V[l], alpha[l]);
+
+            // 2. fit, the isotropic cells are fitted with the one dimensional search
+            if (t == 0) {
+                for (int l = 0; l < numLanes; ++l)
+                    fit(ltcs[l], brdf, V[l], alpha[l], epsilon[l], true, Nsample, symmetric);
+            } else {
+                fitLanes(ltcs, numLanes, brdf, V, alpha, epsilon, Nsample, symmetric);
+            }
+
+            for (int l = 0; l < numLanes; ++l)
+                storeCell(ltcs[l], startA + l, t);
+        }
+
+        if (settings.rowDone) {
+            for (int a = startA; a < endA; ++a)
+                settings.rowDone(a);
+        }
+    };
+
+    // fit all the rows, in parallel
+    const auto parallelPhase = [&]() {
+        if (settings.lockstep) {
+            const int numGroups = (N + LaneWidth - 1) / LaneWidth;
+            tbb::parallel_for(0, numGroups, [&](int g) { lockstepIteration(g * LaneWidth, std::min(N, (g + 1) * LaneWidth)); });
+            return;
         }
+
+        const tbb::blocked_range<int> globalRange { 0, N };
+        tbb::parallel_for(
+            globalRange,
+            [&](tbb::blocked_range<int> localRange) {
+                for (int a = localRange.begin(); a < localRange.end(); ++a) {
+                    alphaIteration(a, 0, N);
+                }
+            });
     };
 
+    if (settings.initialTab) {
+        // Every cell has its own first guess so there is no need for the sequential pass.
+        std::cout << "Warm start parallel phase" << std::endl;
+        LTC_TRACE_ZONE("Warm start parallel phase");
+        parallelPhase();
+        if (numColdCells > 0)
+            std::cout << "Warm start: " << numColdCells << " of " << N * N << " cells of the initial table could not be used, fitted from the default first guess" << std::endl;
+        return;
+    }
+
     // Initialize the first column (theta) of the table on a single thread.
     std::cout << "Initial scalar phase" << std::endl;
-    for (int a = N - 1; a >= 0; --a) {
-        alphaIteration(a, 0, 1);
+    {
+        LTC_TRACE_ZONE("Initial scalar phase");
+        for (int a = N - 1; a >= 0; --a) {
+            alphaIteration(a, 0, 1);
+        }
     }
 
     // Process the rows (alpha) in parallel after the first column has been initialized.
     // This reads from the first column of the previous row, hence the need for the initial sequential pass:
-    // ltc.m11 = tab[a + 1 + t * N][0][0];
-    // ltc.m22 = tab[a + 1 + t * N][1][1];
+    // ltc.m11 = tab.m00[a + 1 + t * N];
+    // ltc.m22 = tab.m11[a + 1 + t * N];
     std::cout << "Main parallel phase" << std::endl;
-    const tbb::blocked_range<int> globalRange { 0, N };
-    tbb::parallel_for(
-        globalRange,
-        [&](tbb::blocked_range<int> localRange) {
-            const int range = localRange.end() - localRange.begin();
-            for (int a = localRange.begin(); a < localRange.end(); ++a) {
-                alphaIteration(a, 0, N);
-            }
-        });
+    {
+        LTC_TRACE_ZONE("Main parallel phase");
+        parallelPhase();
+    }
     //for (int a = N - 1; a >= 0; --a) {
     //    alphaIteration(a, 0, N);
     //}
 }
 
+std::filesystem::path fitCachePath(const Brdf& brdf, const int N, const FitSettings& settings)
+{
+    const std::string identity = brdf.identity();
+    if (settings.cacheDirectory.empty() || identity.empty())
+        return {};
+
+    // everything that affects the fitted table
+    std::ostringstream description;
+    description << "fit " << FIT_VERSION << "\n"
+                << "brdf " << identity << "\n"
+                << "N " << N << " samples " << Nsample << " min alpha " << MIN_ALPHA << "\n"
+                << "parameterization roughness, sqrt(1 - cos(theta))\n"
+                << "symmetric " << settings.symmetric << " lockstep " << settings.lockstep << "\n";
+    const std::string text = description.str();
+    uint64_t key = fnv1a(text.data(), text.size());
+    if (settings.initialTab) {
+        const LTCTable& initial = *settings.initialTab;
+        for (const std::vector<float>* terms : { &initial.m00, &initial.m02, &initial.m11, &initial.m20, &initial.m22 })
+            key = fnv1a(terms->data(), terms->size() * sizeof(float), key);
+    }
+
+    std::ostringstream fileName;
+    fileName << std::hex << std::setw(16) << std::setfill('0') << key << ".bin";
+    return settings.cacheDirectory / fileName.str();
+}
+
+void fitTab(LTCTable& tab, const Brdf& brdf, const FitSettings& settings)
+{
+    LTC_TRACE_ZONE("fitTab");
+    const int N = tab.N;
+
+    const std::filesystem::path path = fitCachePath(brdf, N, settings);
+    const std::string pathString = path.string();
+    if (!path.empty() && readTabBinary(pathString.c_str(), tab)) {
+        std::cout << "Loaded cached table " << pathString << std::endl;
+        if (settings.rowDone) {
+            for (int a = 0; a < N; ++a)
+                settings.rowDone(a);
+        }
+        return;
+    }
+
+    fitTabUncached(tab, brdf, settings);
+
+    if (!path.empty()) {
+        // write to a unique temporary file and rename it, so that concurrent fits never see a partial table
+        std::error_code error;
+        std::filesystem::create_directories(settings.cacheDirectory, error);
+        std::ostringstream suffix;
+        suffix << ".tmp" << std::hash<std::thread::id>()(std::this_thread::get_id()) << "_" << std::chrono::steady_clock::now().time_since_epoch().count();
+        std::filesystem::path temporaryPath = path;
+        temporaryPath += suffix.str();
+
+        writeTabBinary(temporaryPath.string().c_str(), tab);
+        std::filesystem::rename(temporaryPath, path, error);
+        if (error) {
+            std::cout << "Could not add the table to the cache: " << error.message() << std::endl;
+            std::filesystem::remove(temporaryPath, error);
+        }
+    }
+}
+
+// refit cells that converged to a poor minimum
+int refitTab(LTCTable& tab, const Brdf& brdf, const RefitSettings& settings)
+{
+    LTC_TRACE_ZONE("refitTab");
+    const int N = tab.N;
+    const int numSamples = settings.numSamples;
+    const bool symmetric = settings.symmetric && validateSymmetry(brdf, N, numSamples);
+    if (settings.symmetric && !symmetric)
+        std::cout << "BRDF is not mirror symmetric, integrating over the full hemisphere" << std::endl;
+
+    // 1. measure the error of every cell with the stored matrix
+    std::cout << "Refit: measuring error" << std::endl;
+    std::vector<float> errors(N * N);
+    std::vector<glm::vec3> averageDirs(N * N);
+    std::vector<float> magnitudes(N * N), fresnels(N * N);
+    tbb::parallel_for(0, N * N, [&](int idx) {
+        const int a = idx % N;
+        const int t = idx / N;
+
+        glm::vec3 V;
+        float alpha;
+        cellConfiguration(a, t, N, V, alpha);
+
+        LTC ltc;
+        computeAvgTerms(brdf, V, alpha, ltc.magnitude, ltc.fresnel, averageDirs[idx], numSamples, symmetric);
+        initFrame(ltc, averageDirs[idx], t == 0);
+        initFromMatrix(ltc, tab.matrix(idx));
+
+        magnitudes[idx] = ltc.magnitude;
+        fresnels[idx] = ltc.fresnel;
+        errors[idx] = computeError(ltc, brdf, V, alpha, numSamples, symmetric);
+
+        // tables imported from .dds or .js only have the matrices
+        if (!(tab.magnitude[idx] > 0.0f)) {
+            tab.magnitude[idx] = ltc.magnitude;
+            tab.fresnel[idx] = ltc.fresnel;
+        }
+    });
+
+    // 2. find the outliers, either by error or by discontinuity of the (normalized) inverse matrix
+    // both vary over orders of magnitude across the table, so a cell is only compared with the interpolation of its
+    // neighbors and has to stand out along every axis (alpha and theta) to be considered an outlier
+    std::vector<std::array<float, 4>> terms(N * N);
+    std::array<float, 4> termsRange {};
+    for (int idx = 0; idx < N * N; ++idx) {
+        packedTerms(tab, idx, terms[idx].data());
+        for (int i = 0; i < 4; ++i)
+            termsRange[i] = std::max<float>(termsRange[i], std::abs(terms[idx][i]));
+    }
+
+    const auto standsOut = [&](int idx, int prev, int next) {
+        // errors are interpolated geometrically, arithmetically if a neighbor fits exactly (the geometric mean would
+        // flag any error)
+        const float expectedError = errors[prev] > 0.0f && errors[next] > 0.0f
+            ? std::sqrt(errors[prev]) * std::sqrt(errors[next])
+            : 0.5f * (errors[prev] + errors[next]);
+        if (!(errors[idx] <= settings.errorThreshold * expectedError))
+            return true;
+
+        for (int i = 0; i < 4; ++i) {
+            const float expected = 0.5f * (terms[prev][i] + terms[next][i]);
+            const float scale = std::max<float>({ std::abs(terms[prev][i]), std::abs(terms[next][i]), 0.05f * termsRange[i] });
+            if (!(std::abs(terms[idx][i] - expected) <= settings.discontinuityThreshold * scale))
+                return true;
+        }
+        return false;
+    };
+
+    std::vector<int> outliers;
+    for (int t = 0; t < N; ++t) {
+        for (int a = 0; a < N; ++a) {
+            const int idx = a + t * N;
+            const bool interiorA = a > 0 && a < N - 1;
+            const bool interiorT = t > 0 && t < N - 1;
+            if (!interiorA && !interiorT)
+                continue;
+
+            if ((!interiorA || standsOut(idx, idx - 1, idx + 1)) && (!interiorT || standsOut(idx, idx - N, idx + N)))
+                outliers.push_back(idx);
+        }
+    }
+
+    // 3. refit the outliers from their own and their neighbors' matrices, then restart from the best fit
+    std::cout << "Refit: " << outliers.size() << " outlier cells" << std::endl;
+    const LTCTable original = tab;
+    std::vector<char> improved(outliers.size(), 0);
+    tbb::parallel_for(0, (int)outliers.size(), [&](int i) {
+        const int idx = outliers[i];
+        const int a = idx % N;
+        const int t = idx / N;
+        const bool isotropic = t == 0;
+
+        glm::vec3 V;
+        float alpha;
+        cellConfiguration(a, t, N, V, alpha);
+
+        std::vector<glm::mat3> guesses { original.matrix(idx) };
+        if (a > 0)
+            guesses.push_back(original.matrix(idx - 1));
+        if (a < N - 1)
+            guesses.push_back(original.matrix(idx + 1));
+        if (t > 0)
+            guesses.push_back(original.matrix(idx - N));
+        if (t < N - 1)
+            guesses.push_back(original.matrix(idx + N));
+
+        float bestError = errors[idx];
+        glm::mat3 best = original.matrix(idx);
+        const auto refit = [&](const glm::mat3& guess, float relativeEpsilon) {
+            LTC ltc;
+            ltc.magnitude = magnitudes[idx];
+            ltc.fresnel = fresnels[idx];
+            initFrame(ltc, averageDirs[idx], isotropic);
+            initFromMatrix(ltc, guess);
+
+            const float epsilon = relativeEpsilon * std::min<float>(ltc.m11, 0.5f);
+            const float error = fit(ltc, brdf, V, alpha, epsilon, isotropic, numSamples, symmetric);
+            if (error < bestError) {
+                bestError = error;
+                storeMatrix(best, ltc);
+            }
+        };
+
+        for (const glm::mat3& guess : guesses)
+            refit(guess, WARM_START_EPSILON);
+        // restarts explore the neighborhood of the best fit, doubling its size every time
+        for (int restart = 1; restart <= settings.numRestarts; ++restart)
+            refit(best, WARM_START_EPSILON * float(1 << restart));
+
+        // 4. patch the table, with the terms the cell was refitted with
+        if (bestError < errors[idx]) {
+            tab.setMatrix(idx, best);
+            tab.magnitude[idx] = magnitudes[idx];
+            tab.fresnel[idx] = fresnels[idx];
+            improved[i] = 1;
+        }
+    });
+
+    const int numImproved = (int)std::count(improved.begin(), improved.end(), 1);
+    std::cout << "Refit: improved " << numImproved << " cells" << std::endl;
+    return numImproved;
+}
+
 // fit data
-void fitTabOrig(glm::mat3* tab, glm::vec2* tabMagFresnel, const int N, const Brdf& brdf)
+void fitTabOrig(LTCTable& tab, const Brdf& brdf)
 {
+    const int N = tab.N;
     // loop over theta and alpha
     for (int a = N - 1; a >= 0; --a) {
         LTC ltc;
@@ -324,8 +916,8 @@ void fitTabOrig(glm::mat3* tab, glm::vec2* tabMagFresnel, const int N, const Brd
                     ltc.m11 = 1.0f;
                     ltc.m22 = 1.0f;
                 } else { // init with roughness of previous fit
-                    ltc.m11 = tab[a + 1 + t * N][0][0];
-                    ltc.m22 = tab[a + 1 + t * N][1][1];
+                    ltc.m11 = tab.m00[a + 1 + t * N];
+                    ltc.m22 = tab.m11[a + 1 + t * N];
                 }
 
                 ltc.m13 = 0;
@@ -351,63 +943,23 @@ void fitTabOrig(glm::mat3* tab, glm::vec2* tabMagFresnel, const int N, const Brd
             float epsilon = 0.05f;
             fit(ltc, brdf, V, alpha, epsilon, isotropic);
 
-            // copy data
+            // copy data, the useless coefs of the matrix are dropped
             const auto idx = a + t * N;
-            tab[idx] = ltc.M;
-            tabMagFresnel[idx][0] = ltc.magnitude;
-            tabMagFresnel[idx][1] = ltc.fresnel;
-
-            // kill useless coefs in matrix
-            tab[idx][0][1] = 0;
-            tab[idx][1][0] = 0;
-            tab[idx][2][1] = 0;
-            tab[idx][1][2] = 0;
-
-            std::cout << tab[a + t * N][0][0] << "\t " << tab[a + t * N][1][0] << "\t " << tab[a + t * N][2][0] << std::endl;
-            std::cout << tab[a + t * N][0][1] << "\t " << tab[a + t * N][1][1] << "\t " << tab[a + t * N][2][1] << std::endl;
-            std::cout << tab[a + t * N][0][2] << "\t " << tab[a + t * N][1][2] << "\t " << tab[a + t * N][2][2] << std::endl;
+            tab.setMatrix(idx, ltc.M);
+            tab.magnitude[idx] = ltc.magnitude;
+            tab.fresnel[idx] = ltc.fresnel;
+
+            std::cout << tab.m00[idx] << "\t " << 0.0f << "\t " << tab.m20[idx] << std::endl;
+            std::cout << 0.0f << "\t " << tab.m11[idx] << "\t " << 0.0f << std::endl;
+            std::cout << tab.m02[idx] << "\t " << 0.0f << "\t " << tab.m22[idx] << std::endl;
             std::cout << std::endl;
         }
     }
 }
 
-static float sqr(float x)
-{
-    return x * x;
-}
-
-static float G(float w, float s, float g)
-{
-    return -2.0f * std::sin(w) * std::cos(s) * std::cos(g) + pi / 2.0f - g + std::sin(g) * std::cos(g);
-}
-
-static float H(float w, float s, float g)
-{
-    float sinsSq = sqr(sin(s));
-    float cosgSq = sqr(cos(g));
-
-    return std::cos(w) * (std::cos(g) * std::sqrt(sinsSq - cosgSq) + sinsSq * std::asin(std::cos(g) / std::sin(s)));
-}
-
-static float ihemi(float w, float s)
-{
-    float g = std::asin(std::cos(s) / std::sin(w));
-    float sinsSq = sqr(std::sin(s));
-
-    if (w >= 0.0f && w <= (pi / 2.0f - s))
-        return pi * std::cos(w) * sinsSq;
-
-    if (w >= (pi / 2.0f - s) && w < pi / 2.0f)
-        return pi * std::cos(w) * sinsSq + G(w, s, g) - H(w, s, g);
-
-    if (w >= pi / 2.0f && w < (pi / 2.0f + s))
-        return G(w, s, g) + H(w, s, g);
-
-    return 0.0f;
-}
-
 void genSphereTab(float* tabSphere, int N)
 {
+    LTC_TRACE_ZONE("genSphereTab");
     for (int j = 0; j < N; ++j) {
         for (int i = 0; i < N; ++i) {
             const float U1 = float(i) / (N - 1);
@@ -438,30 +990,73 @@ void genSphereTab(float* tabSphere, int N)
     }
 }
 
+void genAvgAlbedoRow(float* tabAvgAlbedo, const LTCTable& tab, int a)
+{
+    const int N = tab.N;
+    // Eavg = 2 * integral of E(mu) * mu over mu in [0, 1]
+    // the rows of the table are parameterized by sqrt(1 - cos(theta)) so integrate over mu with the trapezoidal rule
+    float Eavg = 0.0f;
+    float prevMu = 0.0f;
+    float prevValue = 0.0f;
+
+    for (int t = N - 1; t >= 0; --t) {
+        float x = t / float(N - 1);
+        float ct = 1.0f - x * x;
+        float mu = std::cos(std::min<float>(1.57f, std::acos(ct)));
+        float value = tab.magnitude[a + t * N] * mu;
+
+        if (t != N - 1)
+            Eavg += 0.5f * (value + prevValue) * (mu - prevMu);
+
+        prevMu = mu;
+        prevValue = value;
+    }
+
+    tabAvgAlbedo[a] = std::min<float>(2.0f * Eavg, 1.0f);
+}
+
+void genAvgAlbedoTab(float* tabAvgAlbedo, const LTCTable& tab)
+{
+    tbb::parallel_for(0, tab.N, [&](int a) { genAvgAlbedoRow(tabAvgAlbedo, tab, a); });
+}
+
+static void packCell(
+    glm::vec4* tex1, glm::vec4* tex2,
+    const LTCTable& tab,
+    const float* tabSphere,
+    int i,
+    const float* tabAvgAlbedo)
+{
+    float terms[4];
+    packedTerms(tab, i, terms);
+
+    // store the variable terms
+    tex1[i] = glm::vec4(terms[0], terms[1], terms[2], terms[3]);
+    tex2[i].x = tab.magnitude[i];
+    tex2[i].y = tab.fresnel[i];
+    tex2[i].z = tabAvgAlbedo ? tabAvgAlbedo[i % tab.N] : 0.0f; // average albedo of the row (alpha)
+    tex2[i].w = tabSphere[i];
+}
+
 void packTab(
     glm::vec4* tex1, glm::vec4* tex2,
-    const glm::mat3* tab,
-    const glm::vec2* tabMagFresnel,
+    const LTCTable& tab,
     const float* tabSphere,
-    int N)
+    const float* tabAvgAlbedo)
 {
-    for (int i = 0; i < N * N; ++i) {
-        const glm::mat3& m = tab[i];
-
-        glm::mat3 invM = inverse(m);
-
-        // glm::normalize by the middle element
-        invM /= invM[1][1];
-
-        // store the variable terms
-        tex1[i].x = invM[0][0];
-        tex1[i].y = invM[0][2];
-        tex1[i].z = invM[2][0];
-        tex1[i].w = invM[2][2];
-        tex2[i].x = tabMagFresnel[i][0];
-        tex2[i].y = tabMagFresnel[i][1];
-        tex2[i].z = 0.0f; // unused
-        tex2[i].w = tabSphere[i];
-    }
+    LTC_TRACE_ZONE("packTab");
+    for (int i = 0; i < tab.N * tab.N; ++i)
+        packCell(tex1, tex2, tab, tabSphere, i, tabAvgAlbedo);
+}
+
+void packTabRow(
+    glm::vec4* tex1, glm::vec4* tex2,
+    const LTCTable& tab,
+    const float* tabSphere,
+    int a,
+    const float* tabAvgAlbedo)
+{
+    for (int t = 0; t < tab.N; ++t)
+        packCell(tex1, tex2, tab, tabSphere, a + t * tab.N, tabAvgAlbedo);
 }
 }
@@ -3,4 +3,5 @@
 
 namespace ltc {
 uint16_t float_to_half_fast(float x);
+float half_to_float_fast(uint16_t h);
 }
@@ -0,0 +1,214 @@
+#include "ltc/import.h"
+#include "binary_table.h"
+#include "dds.h"
+#include "float_to_half.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <glm/mat3x3.hpp>
+#include <glm/vec4.hpp>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace ltc {
+
+// resample a srcN x srcN term to N x N
+// both tables share the parameterization [roughness, sqrt(1 - cos(theta))] so bilinear interpolation suffices
+static void resampleTerm(const std::vector<float>& src, int srcN, std::vector<float>& term, int N)
+{
+    if (srcN == N) {
+        term = src;
+        return;
+    }
+
+    for (int t = 0; t < N; ++t) {
+        for (int a = 0; a < N; ++a) {
+            const float x = a / float(N - 1) * (srcN - 1);
+            const float y = t / float(N - 1) * (srcN - 1);
+            const int x0 = std::min<int>(int(x), srcN - 2);
+            const int y0 = std::min<int>(int(y), srcN - 2);
+            const float fx = x - x0;
+            const float fy = y - y0;
+
+            term[a + t * N] = (1.0f - fy) * ((1.0f - fx) * src[x0 + y0 * srcN] + fx * src[x0 + 1 + y0 * srcN])
+                + fy * ((1.0f - fx) * src[x0 + (y0 + 1) * srcN] + fx * src[x0 + 1 + (y0 + 1) * srcN]);
+        }
+    }
+}
+
+// resample the matrices of src to the size of tab, and the magnitude and fresnel terms if magFresnel
+static void resampleTab(const LTCTable& src, LTCTable& tab, bool magFresnel)
+{
+    resampleTerm(src.m00, src.N, tab.m00, tab.N);
+    resampleTerm(src.m02, src.N, tab.m02, tab.N);
+    resampleTerm(src.m11, src.N, tab.m11, tab.N);
+    resampleTerm(src.m20, src.N, tab.m20, tab.N);
+    resampleTerm(src.m22, src.N, tab.m22, tab.N);
+    if (magFresnel) {
+        resampleTerm(src.magnitude, src.N, tab.magnitude, tab.N);
+        resampleTerm(src.fresnel, src.N, tab.fresnel, tab.N);
+    }
+}
+
+// rebuild the matrices from the variable terms of the packed inverse matrices (see packTab)
+static bool unpackTab(const std::vector<float>& tex1, LTCTable& tab)
+{
+    const int srcN = (int)std::lround(std::sqrt(tex1.size() / 4.0));
+    if (srcN < 2 || size_t(srcN * srcN * 4) != tex1.size())
+        return false;
+
+    LTCTable src(srcN);
+    for (int i = 0; i < srcN * srcN; ++i) {
+        const float* v = &tex1[i * 4];
+        const glm::mat3 invM(
+            v[0], 0, v[1],
+            0, 1, 0,
+            v[2], 0, v[3]);
+        src.setMatrix(i, glm::inverse(invM));
+    }
+
+    resampleTab(src, tab, false);
+    return true;
+}
+
+// read a binary table at its own resolution, the checksum is verified since version 2
+static bool readBinaryTable(const char* path, LTCTable& src)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return false;
+
+    BinaryTableHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+        return false;
+    if (std::memcmp(header.magic, BINARY_TABLE_MAGIC, sizeof(header.magic)) != 0 || header.version < 1 || header.version > BINARY_TABLE_VERSION || header.N < 2 || header.N > MAX_TABLE_N)
+        return false;
+
+    const int srcN = (int)header.N;
+    src = LTCTable(srcN);
+    uint64_t checksum = FNV_OFFSET_BASIS;
+    if (header.version >= 3) {
+        for (std::vector<float>* terms : { &src.m00, &src.m02, &src.m11, &src.m20, &src.m22, &src.magnitude, &src.fresnel }) {
+            if (!file.read(reinterpret_cast<char*>(terms->data()), srcN * srcN * sizeof(float)))
+                return false;
+            checksum = fnv1a(terms->data(), srcN * srcN * sizeof(float), checksum);
+        }
+    } else {
+        // matrices and (magnitude, fresnel) pairs
+        for (int i = 0; i < srcN * srcN; ++i) {
+            float v[9];
+            if (!file.read(reinterpret_cast<char*>(v), sizeof(v)))
+                return false;
+            checksum = fnv1a(v, sizeof(v), checksum);
+            src.setMatrix(i, glm::mat3(v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7], v[8]));
+        }
+        for (int i = 0; i < srcN * srcN; ++i) {
+            float v[2];
+            if (!file.read(reinterpret_cast<char*>(v), sizeof(v)))
+                return false;
+            checksum = fnv1a(v, sizeof(v), checksum);
+            src.magnitude[i] = v[0];
+            src.fresnel[i] = v[1];
+        }
+    }
+
+    if (header.version >= 2) {
+        uint64_t storedChecksum;
+        if (!file.read(reinterpret_cast<char*>(&storedChecksum), sizeof(storedChecksum)) || storedChecksum != checksum)
+            return false;
+    }
+    return true;
+}
+
+bool readTabBinary(const char* path, LTCTable& tab)
+{
+    LTCTable src;
+    if (!readBinaryTable(path, src))
+        return false;
+
+    resampleTab(src, tab, true);
+    return true;
+}
+
+bool readDDS(const char* path, LTCTable& tab)
+{
+    unsigned width, height;
+    std::vector<float> tex1;
+    if (!LoadDDS(path, width, height, tex1) || width != height)
+        return false;
+
+    return unpackTab(tex1, tab);
+}
+
+bool readJS(const char* path, LTCTable& tab)
+{
+    std::ifstream file(path);
+    if (!file)
+        return false;
+
+    const std::string text { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+
+    // var g_ltc_1 = [ x, y, z, w, ... ];
+    const size_t var = text.find("g_ltc_1");
+    if (var == std::string::npos)
+        return false;
+    const size_t begin = text.find('[', var);
+    const size_t end = text.find(']', begin);
+    if (begin == std::string::npos || end == std::string::npos)
+        return false;
+
+    std::vector<float> tex1;
+    const char* p = text.c_str() + begin + 1;
+    const char* last = text.c_str() + end;
+    while (p < last) {
+        char* next;
+        const float value = std::strtof(p, &next);
+        if (next == p) {
+            // skip separators
+            ++p;
+            continue;
+        }
+        tex1.push_back(value);
+        p = next;
+    }
+
+    return unpackTab(tex1, tab);
+}
+
+bool readTexBlob(const char* path, std::vector<glm::vec4>& tex1, std::vector<glm::vec4>& tex2, int& N, TableLayout& layout)
+{
+    std::ifstream file(path, std::ios::binary);
+    char magic[4];
+    uint32_t header[3];
+    if (!file.read(magic, sizeof(magic)) || !file.read(reinterpret_cast<char*>(header), sizeof(header)))
+        return false;
+    if (std::memcmp(magic, TEX_BLOB_MAGIC, sizeof(magic)) != 0 || header[0] < 1 || header[0] > TEX_BLOB_VERSION || header[1] < 2 || header[1] > MAX_TABLE_N || header[2] != 2)
+        return false;
+
+    layout = TableLayout::RowMajor;
+    if (header[0] >= 2) {
+        uint32_t extension[4];
+        if (!file.read(reinterpret_cast<char*>(extension), sizeof(extension)) || extension[0] > uint32_t(TableLayout::Morton))
+            return false;
+        layout = TableLayout(extension[0]);
+    }
+
+    N = int(header[1]);
+    const int numTexels = tableNumTexels(layout, N);
+    std::vector<uint16_t> halfData(numTexels * 4 * 2);
+    if (!file.read(reinterpret_cast<char*>(halfData.data()), halfData.size() * sizeof(uint16_t)))
+        return false;
+
+    tex1.resize(numTexels);
+    tex2.resize(numTexels);
+    for (int i = 0; i < numTexels * 4; ++i) {
+        (&tex1[0][0])[i] = half_to_float_fast(halfData[i]);
+        (&tex2[0][0])[i] = half_to_float_fast(halfData[numTexels * 4 + i]);
+    }
+    return true;
+}
+
+}
@@ -0,0 +1,205 @@
+#include "ltc/light_bvh.h"
+#include "cap_integral.h"
+#include "ltc/runtime.h"
+#include <algorithm>
+#include <cmath>
+#include <glm/geometric.hpp>
+#include <glm/matrix.hpp>
+#include <limits>
+
+namespace ltc {
+
+// lights per leaf
+constexpr int MaxLeafLights = 4;
+
+static glm::vec3 centroid(const PolygonLight& light)
+{
+    return 0.25f * (light.points[0] + light.points[1] + light.points[2] + light.points[3]);
+}
+
+static float area(const PolygonLight& light)
+{
+    const glm::vec3& p = light.points[0];
+    return 0.5f * (glm::length(glm::cross(light.points[1] - p, light.points[2] - p))
+        + glm::length(glm::cross(light.points[2] - p, light.points[3] - p)));
+}
+
+LightBVH::LightBVH(std::vector<PolygonLight> lights_)
+    : lights(std::move(lights_))
+{
+    if (!lights.empty())
+        build(0, int(lights.size()));
+}
+
+int LightBVH::build(int begin, int end)
+{
+    const int index = int(nodes.size());
+    nodes.emplace_back();
+
+    Node node;
+    node.boundsMin = glm::vec3(std::numeric_limits<float>::max());
+    node.boundsMax = glm::vec3(-std::numeric_limits<float>::max());
+    node.sumRadiance = 0.0f;
+    node.sumPower = 0.0f;
+    glm::vec3 centroidMin = node.boundsMin;
+    glm::vec3 centroidMax = node.boundsMax;
+    for (int i = begin; i < end; ++i) {
+        for (const glm::vec3& p : lights[i].points) {
+            node.boundsMin = glm::min(node.boundsMin, p);
+            node.boundsMax = glm::max(node.boundsMax, p);
+        }
+        centroidMin = glm::min(centroidMin, centroid(lights[i]));
+        centroidMax = glm::max(centroidMax, centroid(lights[i]));
+        node.sumRadiance += lights[i].radiance;
+        node.sumPower += lights[i].radiance * area(lights[i]);
+    }
+
+    if (end - begin <= MaxLeafLights) {
+        node.secondChild = -1;
+        node.firstLight = begin;
+        node.numLights = end - begin;
+        nodes[index] = node;
+        return index;
+    }
+
+    // median split along the largest extent of the centroids
+    const glm::vec3 extent = centroidMax - centroidMin;
+    const int axis = extent.x > extent.y ? (extent.x > extent.z ? 0 : 2) : (extent.y > extent.z ? 1 : 2);
+    const int middle = (begin + end) / 2;
+    std::nth_element(lights.begin() + begin, lights.begin() + middle, lights.begin() + end,
+        [axis](const PolygonLight& a, const PolygonLight& b) { return centroid(a)[axis] < centroid(b)[axis]; });
+
+    build(begin, middle);
+    node.secondChild = build(middle, end);
+    node.firstLight = 0;
+    node.numLights = 0;
+    nodes[index] = node;
+    return index;
+}
+
+// smallest singular value of m (square root of the smallest eigenvalue of m^T m, closed form for symmetric matrices)
+static float smallestSingularValue(const glm::mat3& m)
+{
+    double a[3][3];
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j)
+            a[i][j] = double(glm::dot(m[i], m[j]));
+    }
+
+    const double p1 = a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+    const double q = (a[0][0] + a[1][1] + a[2][2]) / 3.0;
+    if (p1 <= 0.0)
+        return float(std::sqrt(std::min({ a[0][0], a[1][1], a[2][2] })));
+
+    const double p2 = (a[0][0] - q) * (a[0][0] - q) + (a[1][1] - q) * (a[1][1] - q) + (a[2][2] - q) * (a[2][2] - q) + 2.0 * p1;
+    const double p = std::sqrt(p2 / 6.0);
+    double b[3][3];
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j)
+            b[i][j] = (a[i][j] - (i == j ? q : 0.0)) / p;
+    }
+    const double detB = b[0][0] * (b[1][1] * b[2][2] - b[1][2] * b[2][1])
+        - b[0][1] * (b[1][0] * b[2][2] - b[1][2] * b[2][0])
+        + b[0][2] * (b[1][0] * b[2][1] - b[1][1] * b[2][0]);
+    const double phi = std::acos(std::clamp(detB / 2.0, -1.0, 1.0)) / 3.0;
+    const double smallest = q + 2.0 * p * std::cos(phi + 2.0 * 3.14159265358979 / 3.0);
+    return float(std::sqrt(std::max(smallest, 0.0)));
+}
+
+float LightBVH::bound(const Node& node, const glm::vec3& P, const glm::mat3& worldToCosine, float maxDensity, float threshold) const
+{
+    const float pi = 3.14159265f;
+    const float unbounded = std::numeric_limits<float>::infinity();
+
+    // distance to the box, the shading point may be inside
+    const glm::vec3 delta = glm::max(glm::max(node.boundsMin - P, P - node.boundsMax), glm::vec3(0.0f));
+    const float distanceSq = glm::dot(delta, delta);
+    if (distanceSq <= 0.0f)
+        return unbounded;
+
+    // every light subtends at most area / distance^2
+    const float powerBound = maxDensity * node.sumPower / distanceSq;
+    if (powerBound < threshold)
+        return powerBound;
+
+    // cap around the corners of the box in the space of the cosine: the box is convex and does not contain the
+    // shading point, so neither does its (linear) image, whose directions are within any cap of half angle
+    // below pi / 2 that contains the directions of its corners
+    glm::vec3 corners[8];
+    glm::vec3 axis(0.0f);
+    for (int i = 0; i < 8; ++i) {
+        const glm::vec3 corner(
+            i & 1 ? node.boundsMax.x : node.boundsMin.x,
+            i & 2 ? node.boundsMax.y : node.boundsMin.y,
+            i & 4 ? node.boundsMax.z : node.boundsMin.z);
+        corners[i] = glm::normalize(worldToCosine * (corner - P));
+        axis += corners[i];
+    }
+
+    // the whole hemisphere integrates to 1
+    float capIntegral = 1.0f;
+    if (glm::dot(axis, axis) > 0.0f) {
+        axis = glm::normalize(axis);
+        float cosSigma = 1.0f;
+        for (const glm::vec3& corner : corners)
+            cosSigma = std::min(cosSigma, glm::dot(axis, corner));
+        if (cosSigma > 0.0f) {
+            const float sigma = std::acos(cosSigma);
+            const float omega = std::acos(std::clamp(axis.z, -1.0f, 1.0f));
+            capIntegral = std::clamp(ihemi(omega, sigma) / pi, 0.0f, 1.0f);
+        }
+    }
+
+    return std::min(capIntegral * node.sumRadiance, powerBound);
+}
+
+float LightBVH::shade(const glm::vec3& P, const glm::mat3& worldToCosine, bool twoSided, float threshold,
+    LightBVHStats* stats) const
+{
+    if (nodes.empty())
+        return 0.0f;
+
+    // maximum of the LTC distribution D(w) = D_cos(M w / |M w|) |det M| / |M w|^3 (M = worldToCosine):
+    // D_cos <= 1 / pi and |M w| >= the smallest singular value of M (with a margin for its rounding)
+    const float det = std::abs(glm::determinant(worldToCosine));
+    const float sigmaMin = 0.999f * smallestSingularValue(worldToCosine);
+    const float maxDensity = det / (3.14159265f * sigmaMin * sigmaMin * sigmaMin);
+
+    LightBVHStats localStats;
+    float sum = 0.0f;
+
+    int stack[64];
+    int stackSize = 0;
+    stack[stackSize++] = 0;
+    while (stackSize > 0) {
+        const Node& node = nodes[stack[--stackSize]];
+        localStats.nodesVisited++;
+
+        const float nodeBound = bound(node, P, worldToCosine, maxDensity, threshold);
+        if (nodeBound < threshold) {
+            localStats.skippedBound += nodeBound;
+            continue;
+        }
+
+        if (node.secondChild < 0) {
+            for (int i = node.firstLight; i < node.firstLight + node.numLights; ++i) {
+                glm::vec3 L[4];
+                for (int k = 0; k < 4; ++k)
+                    L[k] = worldToCosine * (lights[i].points[k] - P);
+                sum += lights[i].radiance * integratePolygon(L, 4, twoSided);
+                localStats.lightsEvaluated++;
+            }
+            continue;
+        }
+
+        const int first = int(&node - nodes.data()) + 1;
+        stack[stackSize++] = node.secondChild;
+        stack[stackSize++] = first;
+    }
+
+    if (stats)
+        *stats = localStats;
+    return sum;
+}
+
+}
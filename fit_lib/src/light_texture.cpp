@@ -0,0 +1,181 @@
+#include "ltc/light_texture.h"
+#include "ltc/trace.h"
+#include <algorithm>
+#include <cmath>
+#include <glm/common.hpp>
+#include <glm/geometric.hpp>
+#include <tbb/parallel_for.h>
+#include <utility>
+
+namespace ltc {
+
+// separable Gaussian blur with clamped edges, rows in parallel
+static std::vector<glm::vec4> blur(const std::vector<glm::vec4>& image, int width, int height, float sigma)
+{
+    const int radius = int(std::ceil(3.0f * sigma));
+    std::vector<float> weights(2 * radius + 1);
+    float sum = 0.0f;
+    for (int i = -radius; i <= radius; ++i) {
+        weights[i + radius] = std::exp(-0.5f * i * i / (sigma * sigma));
+        sum += weights[i + radius];
+    }
+    for (float& w : weights)
+        w /= sum;
+
+    std::vector<glm::vec4> horizontal(image.size());
+    tbb::parallel_for(0, height, [&](int y) {
+        for (int x = 0; x < width; ++x) {
+            glm::vec4 value(0.0f);
+            for (int i = -radius; i <= radius; ++i)
+                value += weights[i + radius] * image[y * width + std::clamp(x + i, 0, width - 1)];
+            horizontal[y * width + x] = value;
+        }
+    });
+
+    std::vector<glm::vec4> result(image.size());
+    tbb::parallel_for(0, height, [&](int y) {
+        for (int x = 0; x < width; ++x) {
+            glm::vec4 value(0.0f);
+            for (int i = -radius; i <= radius; ++i)
+                value += weights[i + radius] * horizontal[std::clamp(y + i, 0, height - 1) * width + x];
+            result[y * width + x] = value;
+        }
+    });
+    return result;
+}
+
+// source texels covered by each texel of an axis reduced from size to newSize, with their coverage
+static std::vector<std::vector<std::pair<int, float>>> boxWeights(int size, int newSize)
+{
+    std::vector<std::vector<std::pair<int, float>>> weights(newSize);
+    const float scale = float(size) / newSize;
+    for (int i = 0; i < newSize; ++i) {
+        const float begin = i * scale;
+        const float end = (i + 1) * scale;
+        for (int j = int(begin); j < std::min(int(std::ceil(end)), size); ++j) {
+            const float coverage = std::min(end, j + 1.0f) - std::max(begin, float(j));
+            if (coverage > 0.0f)
+                weights[i].emplace_back(j, coverage / scale);
+        }
+    }
+    return weights;
+}
+
+// box filter to the next mip level (sizes rounded down as in DDS, so odd sizes are covered with partial texels)
+static std::vector<glm::vec4> downsample(const std::vector<glm::vec4>& image, int width, int height, int newWidth, int newHeight)
+{
+    const auto weightsX = boxWeights(width, newWidth);
+    const auto weightsY = boxWeights(height, newHeight);
+
+    std::vector<glm::vec4> result(size_t(newWidth) * newHeight);
+    tbb::parallel_for(0, newHeight, [&](int y) {
+        for (int x = 0; x < newWidth; ++x) {
+            glm::vec4 value(0.0f);
+            for (const auto& [sy, wy] : weightsY[y]) {
+                for (const auto& [sx, wx] : weightsX[x])
+                    value += (wx * wy) * image[sy * width + sx];
+            }
+            result[y * newWidth + x] = value;
+        }
+    });
+    return result;
+}
+
+LightTexturePyramid buildLightTexturePyramid(const glm::vec4* data, int width, int height)
+{
+    LTC_TRACE_ZONE("buildLightTexturePyramid");
+    LightTexturePyramid pyramid;
+
+    // canvas with the clamped texture in the border
+    const int padX = int(std::ceil(width * LightTextureBorder / (1.0f - 2.0f * LightTextureBorder)));
+    const int padY = int(std::ceil(height * LightTextureBorder / (1.0f - 2.0f * LightTextureBorder)));
+    int levelWidth = width + 2 * padX;
+    int levelHeight = height + 2 * padY;
+    pyramid.uvOffset = glm::vec2(float(padX) / levelWidth, float(padY) / levelHeight);
+    pyramid.uvScale = glm::vec2(float(width) / levelWidth, float(height) / levelHeight);
+    pyramid.lightTexels = std::sqrt(float(width) * height);
+
+    std::vector<glm::vec4> canvas(size_t(levelWidth) * levelHeight);
+    tbb::parallel_for(0, levelHeight, [&](int y) {
+        const int v = std::clamp(y - padY, 0, height - 1);
+        for (int x = 0; x < levelWidth; ++x)
+            canvas[y * levelWidth + x] = data[v * width + std::clamp(x - padX, 0, width - 1)];
+    });
+
+    pyramid.widths.push_back(levelWidth);
+    pyramid.heights.push_back(levelHeight);
+    pyramid.levels.push_back(std::move(canvas));
+
+    while (levelWidth > 1 || levelHeight > 1) {
+        // level l - 1 is blurred by 2^(l - 1) texels of level 0 (one texel of its own), add the variance that
+        // brings it to 2^l before halving the resolution: sqrt(4 - 1) texels of level l - 1
+        const std::vector<glm::vec4> blurred = blur(pyramid.levels.back(), levelWidth, levelHeight, std::sqrt(3.0f));
+
+        const int newWidth = std::max(levelWidth / 2, 1);
+        const int newHeight = std::max(levelHeight / 2, 1);
+        pyramid.levels.push_back(downsample(blurred, levelWidth, levelHeight, newWidth, newHeight));
+        pyramid.widths.push_back(newWidth);
+        pyramid.heights.push_back(newHeight);
+        levelWidth = newWidth;
+        levelHeight = newHeight;
+    }
+
+    return pyramid;
+}
+
+// bilinear lookup with clamped edges, uv in [0, 1]
+static glm::vec4 sampleLevel(const LightTexturePyramid& pyramid, int level, const glm::vec2& uv)
+{
+    const int width = pyramid.widths[level];
+    const int height = pyramid.heights[level];
+    const std::vector<glm::vec4>& image = pyramid.levels[level];
+
+    const float x = std::clamp(uv.x * width - 0.5f, 0.0f, width - 1.0f);
+    const float y = std::clamp(uv.y * height - 0.5f, 0.0f, height - 1.0f);
+    const int x0 = int(x);
+    const int y0 = int(y);
+    const int x1 = std::min(x0 + 1, width - 1);
+    const int y1 = std::min(y0 + 1, height - 1);
+    const float fx = x - x0;
+    const float fy = y - y0;
+
+    return (1.0f - fy) * ((1.0f - fx) * image[y0 * width + x0] + fx * image[y0 * width + x1])
+        + fy * ((1.0f - fx) * image[y1 * width + x0] + fx * image[y1 * width + x1]);
+}
+
+glm::vec4 lookupLightTexture(const LightTexturePyramid& pyramid, const glm::vec3& p0, const glm::vec3& p1, const glm::vec3& p3)
+{
+    // plane of the light
+    const glm::vec3 V1 = p1 - p0;
+    const glm::vec3 V2 = p3 - p0;
+    const glm::vec3 planeOrtho = glm::cross(V1, V2);
+    const float planeAreaSquared = glm::dot(planeOrtho, planeOrtho);
+    const float planeDistxPlaneArea = glm::dot(planeOrtho, p0);
+    if (planeAreaSquared <= 0.0f)
+        return glm::vec4(0.0f);
+
+    // orthogonal projection of the shading point (the origin) on the plane, relative to p0
+    const glm::vec3 P = planeDistxPlaneArea * planeOrtho / planeAreaSquared - p0;
+
+    // its texture coordinates
+    const float dot_V1_V2 = glm::dot(V1, V2);
+    const float inv_dot_V1_V1 = 1.0f / glm::dot(V1, V1);
+    const glm::vec3 V2_ = V2 - V1 * dot_V1_V2 * inv_dot_V1_V1;
+    glm::vec2 uv;
+    uv.y = glm::dot(V2_, P) / glm::dot(V2_, V2_);
+    uv.x = glm::dot(V1, P) * inv_dot_V1_V1 - dot_V1_V2 * inv_dot_V1_V1 * uv.y;
+
+    // the footprint of the cosine lobe on the plane is about as wide as the distance to the plane,
+    // relative to the size of the light: distance / sqrt(area)
+    const float d = std::abs(planeDistxPlaneArea) / std::pow(planeAreaSquared, 0.75f);
+    const int maxLevel = int(pyramid.levels.size()) - 1;
+    const float lod = std::clamp(std::log2(std::max(d * pyramid.lightTexels, 1.0f)), 0.0f, float(maxLevel));
+
+    const glm::vec2 canvasUV = glm::clamp(pyramid.uvOffset + uv * pyramid.uvScale, glm::vec2(0.0f), glm::vec2(1.0f));
+    const int level0 = int(lod);
+    const int level1 = std::min(level0 + 1, maxLevel);
+    const float t = lod - level0;
+    return (1.0f - t) * sampleLevel(pyramid, level0, canvasUV) + t * sampleLevel(pyramid, level1, canvasUV);
+}
+
+}
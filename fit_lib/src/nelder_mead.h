@@ -1,4 +1,8 @@
 #pragma once
+#include <cmath>
+#include <limits>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
 
 namespace ltc {
 
@@ -23,7 +27,11 @@ void add(float* r, const float* v, int dim)
 // Downhill simplex solver:
 // http://en.wikipedia.org/wiki/Nelder%E2%80%93Mead_method#One_possible_variation_of_the_NM_algorithm
 // using the termination criterion from Numerical Recipes in C++ (3rd Ed.)
-template <int DIM, typename FUNC>
+// objectiveFn(point, bound) may stop early and return any value above bound once the result is known to exceed it,
+// the candidates only need to be compared with f[nh], fr or f[hi]
+// SPECULATIVE evaluates the reflection, expansion and contraction points (and the shrunk vertices) concurrently,
+// objectiveFn must then be thread safe. The accepted points, and therefore the result, are the same.
+template <int DIM, bool SPECULATIVE = false, typename FUNC>
 float NelderMead(
     float* pmin, const float* start, float delta, float tolerance, int maxIters, FUNC objectiveFn)
 {
@@ -35,6 +43,7 @@ float NelderMead(
 
     typedef float point[DIM];
     const int NB_POINTS = DIM + 1;
+    const float unbounded = std::numeric_limits<float>::infinity();
 
     point s[NB_POINTS];
     float f[NB_POINTS];
@@ -47,8 +56,12 @@ float NelderMead(
     }
 
     // evaluate function at each point on simplex
-    for (int i = 0; i < NB_POINTS; i++)
-        f[i] = objectiveFn(s[i]);
+    if constexpr (SPECULATIVE) {
+        tbb::parallel_for(0, NB_POINTS, [&](int i) { f[i] = objectiveFn(s[i], unbounded); });
+    } else {
+        for (int i = 0; i < NB_POINTS; i++)
+            f[i] = objectiveFn(s[i], unbounded);
+    }
 
     int lo = 0, hi, nh;
 
@@ -83,20 +96,30 @@ float NelderMead(
         for (int i = 0; i < DIM; i++)
             o[i] /= DIM;
 
-        // reflection
-        point r;
-        for (int i = 0; i < DIM; i++)
+        // reflection, expansion and contraction points
+        point r, e, c;
+        for (int i = 0; i < DIM; i++) {
             r[i] = o[i] + reflect * (o[i] - s[hi][i]);
+            e[i] = o[i] + expand * (o[i] - s[hi][i]);
+            c[i] = o[i] - contract * (o[i] - s[hi][i]);
+        }
+
+        float fr, fe, fc;
+        if constexpr (SPECULATIVE) {
+            // the expansion is only used if fr < f[lo] and the contraction if fr >= f[nh]
+            tbb::parallel_invoke(
+                [&]() { fr = objectiveFn(r, f[nh]); },
+                [&]() { fe = objectiveFn(e, f[lo]); },
+                [&]() { fc = objectiveFn(c, f[hi]); });
+        } else {
+            fr = objectiveFn(r, f[nh]);
+        }
 
-        float fr = objectiveFn(r);
         if (fr < f[nh]) {
             if (fr < f[lo]) {
                 // expansion
-                point e;
-                for (int i = 0; i < DIM; i++)
-                    e[i] = o[i] + expand * (o[i] - s[hi][i]);
-
-                float fe = objectiveFn(e);
+                if constexpr (!SPECULATIVE)
+                    fe = objectiveFn(e, fr);
                 if (fe < fr) {
                     mov(s[hi], e, DIM);
                     f[hi] = fe;
@@ -110,11 +133,8 @@ float NelderMead(
         }
 
         // contraction
-        point c;
-        for (int i = 0; i < DIM; i++)
-            c[i] = o[i] - contract * (o[i] - s[hi][i]);
-
-        float fc = objectiveFn(c);
+        if constexpr (!SPECULATIVE)
+            fc = objectiveFn(c, f[hi]);
         if (fc < f[hi]) {
             mov(s[hi], c, DIM);
             f[hi] = fc;
@@ -127,7 +147,16 @@ float NelderMead(
                 continue;
             for (int i = 0; i < DIM; i++)
                 s[k][i] = s[lo][i] + shrink * (s[k][i] - s[lo][i]);
-            f[k] = objectiveFn(s[k]);
+        }
+        const auto evaluateVertex = [&](int k) {
+            if (k != lo)
+                f[k] = objectiveFn(s[k], unbounded);
+        };
+        if constexpr (SPECULATIVE) {
+            tbb::parallel_for(0, NB_POINTS, evaluateVertex);
+        } else {
+            for (int k = 0; k < NB_POINTS; k++)
+                evaluateVertex(k);
         }
     }
 
@@ -136,4 +165,208 @@ float NelderMead(
     return f[lo];
 }
 
+// NelderMead as a state machine: the caller evaluates point() (with value at most bound()) and passes the result
+// to submit() until done(). Takes the same steps as NelderMead, so that several instances can be advanced in
+// lockstep with their objective evaluated together.
+template <int DIM>
+class NelderMeadState {
+public:
+    void init(const float* start, float delta, float tolerance_, int maxIters_)
+    {
+        tolerance = tolerance_;
+        maxIters = maxIters_;
+        iteration = 0;
+        lo = hi = nh = 0;
+
+        // initialise simplex
+        mov(s[0], start, DIM);
+        for (int i = 1; i < NB_POINTS; i++) {
+            mov(s[i], start, DIM);
+            s[i][i - 1] += delta;
+        }
+
+        phase = Phase::Init;
+        vertex = 0;
+    }
+
+    bool done() const
+    {
+        return phase == Phase::Done;
+    }
+
+    const float* point() const
+    {
+        switch (phase) {
+        case Phase::Reflect:
+            return r;
+        case Phase::Expand:
+            return e;
+        case Phase::Contract:
+            return c;
+        default:
+            return s[vertex];
+        }
+    }
+
+    float bound() const
+    {
+        switch (phase) {
+        case Phase::Reflect:
+            return f[nh];
+        case Phase::Expand:
+            return fr;
+        case Phase::Contract:
+            return f[hi];
+        default:
+            return std::numeric_limits<float>::infinity();
+        }
+    }
+
+    void submit(float value)
+    {
+        switch (phase) {
+        case Phase::Init:
+            f[vertex] = value;
+            if (++vertex == NB_POINTS)
+                beginIteration();
+            break;
+        case Phase::Reflect:
+            fr = value;
+            if (fr < f[nh]) {
+                if (fr < f[lo])
+                    phase = Phase::Expand;
+                else
+                    replaceWorst(r, fr);
+            } else {
+                phase = Phase::Contract;
+            }
+            break;
+        case Phase::Expand:
+            if (value < fr)
+                replaceWorst(e, value);
+            else
+                replaceWorst(r, fr);
+            break;
+        case Phase::Contract:
+            if (value < f[hi]) {
+                replaceWorst(c, value);
+            } else {
+                // reduction
+                for (int k = 0; k < NB_POINTS; k++) {
+                    if (k == lo)
+                        continue;
+                    for (int i = 0; i < DIM; i++)
+                        s[k][i] = s[lo][i] + shrink * (s[k][i] - s[lo][i]);
+                }
+                phase = Phase::Shrink;
+                vertex = lo == 0 ? 1 : 0;
+            }
+            break;
+        case Phase::Shrink:
+            f[vertex] = value;
+            if (++vertex == lo)
+                ++vertex;
+            if (vertex == NB_POINTS) {
+                ++iteration;
+                beginIteration();
+            }
+            break;
+        case Phase::Done:
+            break;
+        }
+    }
+
+    // best point and its value
+    float result(float* pmin) const
+    {
+        mov(pmin, s[lo], DIM);
+        return f[lo];
+    }
+
+private:
+    void replaceWorst(const float* p, float value)
+    {
+        mov(s[hi], p, DIM);
+        f[hi] = value;
+        ++iteration;
+        beginIteration();
+    }
+
+    void beginIteration()
+    {
+        if (iteration >= maxIters) {
+            phase = Phase::Done;
+            return;
+        }
+
+        // find lowest, highest and next highest
+        lo = hi = nh = 0;
+        for (int i = 1; i < NB_POINTS; i++) {
+            if (f[i] < f[lo])
+                lo = i;
+            if (f[i] > f[hi]) {
+                nh = hi;
+                hi = i;
+            } else if (f[i] > f[nh])
+                nh = i;
+        }
+
+        // stop if we've reached the required tolerance level
+        float a = std::abs(f[lo]);
+        float b = std::abs(f[hi]);
+        if (2.0f * std::abs(a - b) < (a + b) * tolerance) {
+            phase = Phase::Done;
+            return;
+        }
+
+        // compute centroid (excluding the worst point)
+        coords o;
+        set(o, 0.0f, DIM);
+        for (int i = 0; i < NB_POINTS; i++) {
+            if (i == hi)
+                continue;
+            add(o, s[i], DIM);
+        }
+
+        for (int i = 0; i < DIM; i++)
+            o[i] /= DIM;
+
+        // reflection, expansion and contraction points
+        for (int i = 0; i < DIM; i++) {
+            r[i] = o[i] + reflect * (o[i] - s[hi][i]);
+            e[i] = o[i] + expand * (o[i] - s[hi][i]);
+            c[i] = o[i] - contract * (o[i] - s[hi][i]);
+        }
+        phase = Phase::Reflect;
+    }
+
+    // standard coefficients from Nelder-Mead
+    static constexpr float reflect = 1.0f;
+    static constexpr float expand = 2.0f;
+    static constexpr float contract = 0.5f;
+    static constexpr float shrink = 0.5f;
+
+    typedef float coords[DIM];
+    static constexpr int NB_POINTS = DIM + 1;
+
+    enum class Phase {
+        Init,
+        Reflect,
+        Expand,
+        Contract,
+        Shrink,
+        Done
+    };
+
+    coords s[NB_POINTS];
+    float f[NB_POINTS];
+    coords r, e, c;
+    float fr;
+    int lo, hi, nh;
+    int iteration, maxIters;
+    float tolerance;
+    Phase phase;
+    int vertex;
+};
+
 }
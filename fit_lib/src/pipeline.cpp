@@ -0,0 +1,179 @@
+#include "ltc/pipeline.h"
+#include "float_to_half.h"
+#include "ltc/export.h"
+#include "ltc/plot.h"
+#include "ltc/trace.h"
+#include <glm/vec4.hpp>
+#include <mutex>
+#include <tbb/parallel_invoke.h>
+#include <tbb/task_group.h>
+#include <vector>
+
+namespace ltc {
+
+PackedTables packTables(const LTCTable& tab, const float* tabSphere, const float* tabAvgAlbedo)
+{
+    const int N = tab.N;
+    PackedTables packed;
+    packed.N = N;
+    packed.tex1.resize(N * N);
+    packed.tex2.resize(N * N);
+    packed.half1.resize(N * N * 4);
+    packed.half2.resize(N * N * 4);
+
+    packTab(packed.tex1.data(), packed.tex2.data(), tab, tabSphere, tabAvgAlbedo);
+    for (int i = 0; i < N * N; ++i) {
+        for (int c = 0; c < 4; ++c) {
+            packed.half1[4 * i + c] = float_to_half_fast(packed.tex1[i][c]);
+            packed.half2[4 * i + c] = float_to_half_fast(packed.tex2[i][c]);
+        }
+    }
+    return packed;
+}
+
+PackedTables fitTabPacked(const Brdf& brdf, const int N, const FitSettings& settings)
+{
+    LTC_TRACE_ZONE("fitTabPacked");
+    LTCTable tab(N);
+    std::vector<float> tabSphere(N * N);
+    std::vector<float> tabAvgAlbedo(N);
+
+    tbb::parallel_invoke(
+        [&]() { fitTab(tab, brdf, settings); },
+        [&]() { genSphereTab(tabSphere.data(), N); });
+    genAvgAlbedoTab(tabAvgAlbedo.data(), tab);
+    return packTables(tab, tabSphere.data(), tabAvgAlbedo.data());
+}
+
+PackedTables fitTabPipelined(const Brdf& brdf, const int N, const FitSettings& settings,
+    const std::filesystem::path& resultsFolder, const std::filesystem::path& plotFolder,
+    const std::string& embedName)
+{
+    // allocate data
+    LTCTable tab(N);
+    std::vector<float> tabSphere(N * N);
+    std::vector<float> tabAvgAlbedo(N);
+    std::vector<glm::vec4> tex1(N * N);
+    std::vector<glm::vec4> tex2(N * N);
+    std::vector<uint16_t> half1(N * N * 4);
+    std::vector<uint16_t> half2(N * N * 4);
+
+    // average albedo, packing and half float encoding of a row
+    const auto packRow = [&](int a) {
+        LTC_TRACE_ZONE("packRow");
+        genAvgAlbedoRow(tabAvgAlbedo.data(), tab, a);
+        packTabRow(tex1.data(), tex2.data(), tab, tabSphere.data(), a, tabAvgAlbedo.data());
+        for (int t = 0; t < N; ++t) {
+            const int i = a + t * N;
+            for (int c = 0; c < 4; ++c) {
+                half1[4 * i + c] = float_to_half_fast(tex1[i][c]);
+                half2[4 * i + c] = float_to_half_fast(tex2[i][c]);
+            }
+        }
+    };
+
+    // a row is packed either by the thread that fitted it, or by the sphere task if it was fitted first
+    std::mutex mutex;
+    bool sphereDone = false;
+    std::vector<char> rowFitted(N, 0);
+    std::vector<char> plotStarted(NumSphericalPlotAlphas, 0);
+
+    tbb::task_group sphereTask;
+    sphereTask.run([&]() {
+        // projected solid angle of a spherical cap, clipped to the horizon
+        genSphereTab(tabSphere.data(), N);
+
+        std::vector<int> pending;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            sphereDone = true;
+            for (int a = 0; a < N; ++a) {
+                if (rowFitted[a])
+                    pending.push_back(a);
+            }
+        }
+        for (int a : pending)
+            packRow(a);
+    });
+
+    tbb::task_group plotTasks;
+    FitSettings pipelineSettings = settings;
+    pipelineSettings.rowDone = [&](int a) {
+        bool pack;
+        std::vector<int> plots;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            rowFitted[a] = 1;
+            pack = sphereDone;
+
+            for (int p = 0; p < NumSphericalPlotAlphas; ++p) {
+                int minRow, maxRow;
+                sphericalPlotRows(p, N, minRow, maxRow);
+                if (!plotStarted[p] && rowFitted[minRow] && rowFitted[maxRow]) {
+                    plotStarted[p] = 1;
+                    plots.push_back(p);
+                }
+            }
+        }
+
+        if (pack)
+            packRow(a);
+        for (int p : plots)
+            plotTasks.run([&, p]() { make_spherical_plots(brdf, tab, p, plotFolder); });
+    };
+
+    // fit
+    fitTab(tab, brdf, pipelineSettings);
+    sphereTask.wait();
+
+    // export to C, MATLAB, DDS, binary, the WebGL blob, embeddable C++ and Javascript
+    LTC_TRACE_ZONE("export");
+    tbb::parallel_invoke(
+        [&]() { writeTabMatlab(tab, resultsFolder); },
+        [&]() { writeTabBinary(tab, resultsFolder); },
+        [&]() { writeTabC(tab, resultsFolder); },
+        [&]() { writeDDS((resultsFolder / "ltc_1.dds").string().c_str(), half1.data(), N); },
+        [&]() { writeDDS((resultsFolder / "ltc_2.dds").string().c_str(), half2.data(), N); },
+        [&]() { writeAvgAlbedoDDS(tabAvgAlbedo.data(), N, resultsFolder); },
+        [&]() { writeTexBlob((resultsFolder / "ltc_tex.bin").string().c_str(), half1.data(), half2.data(), N); },
+        [&]() { writeTabEmbedded(half1.data(), half2.data(), N, resultsFolder, embedName); },
+        [&]() { writeJS(tex1.data(), tex2.data(), N, resultsFolder); });
+
+    plotTasks.wait();
+
+    PackedTables packed;
+    packed.N = N;
+    packed.tex1 = std::move(tex1);
+    packed.tex2 = std::move(tex2);
+    packed.half1 = std::move(half1);
+    packed.half2 = std::move(half2);
+    return packed;
+}
+
+void writeTabArray(const std::vector<const PackedTables*>& tables, const std::filesystem::path& resultsFolder)
+{
+    LTC_TRACE_ZONE("writeTabArray");
+    std::vector<const uint16_t*> slices1, slices2;
+    for (const PackedTables* table : tables) {
+        slices1.push_back(table->half1.data());
+        slices2.push_back(table->half2.data());
+    }
+    const int N = tables.empty() ? 0 : tables[0]->N;
+    writeDDSArray((resultsFolder / "ltc_1_array.dds").string().c_str(), slices1.data(), int(slices1.size()), N);
+    writeDDSArray((resultsFolder / "ltc_2_array.dds").string().c_str(), slices2.data(), int(slices2.size()), N);
+}
+
+void writeTabApprox(const PackedTables& table, const ApproxSettings& approxSettings,
+    const std::filesystem::path& resultsFolder, const std::string& name)
+{
+    LTC_TRACE_ZONE("writeTabApprox");
+    const TableApprox approx = approximateTab(table.tex1.data(), table.tex2.data(), table.N, approxSettings);
+    ApproxError errors[8];
+    approxErrors(approx, table.tex1.data(), table.tex2.data(), table.N, errors);
+
+    writeApproxCpp(approx, table.N, resultsFolder, name);
+    writeApproxGLSL(approx, table.N, resultsFolder, name);
+    writeApproxReport(approx, errors, table.N, resultsFolder, name);
+}
+
+}
@@ -1,7 +1,9 @@
 #include "ltc/plot.h"
 #include "LTC.h"
 #include "ltc/brdf.h"
+#include "ltc/trace.h"
 #include <CImg.h>
+#include <algorithm>
 #include <cmath>
 #include <glm/geometric.hpp>
 #include <glm/vec3.hpp>
@@ -12,8 +14,6 @@
 
 namespace ltc {
 
-cimg_library::CImg<float> colorMap(33, 1, 1, 3);
-
 const unsigned char colorMap_data[33 * 3] = {
     59, 76, 192,
     68, 90, 204,
@@ -50,6 +50,25 @@ const unsigned char colorMap_data[33 * 3] = {
     180, 4, 38
 };
 
+// color map texture (for linear interpolation), initialized once (thread safe)
+static const cimg_library::CImg<float>& colorMap()
+{
+    static const cimg_library::CImg<float> texture = []() {
+        cimg_library::CImg<float> map(33, 1, 1, 3);
+        for (int i = 0; i < 33; ++i) {
+            map(i, 0, 0, 0) = colorMap_data[3 * i + 0];
+            map(i, 0, 0, 1) = colorMap_data[3 * i + 1];
+            map(i, 0, 0, 2) = colorMap_data[3 * i + 2];
+        }
+        return map;
+    }();
+    return texture;
+}
+
+// configurations of the plots
+const float alpha_tab[] = { 0.05f, 0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 1.0f };
+const float theta_tab[] = { 0.0f, 15.0f, 30.0f, 45.0f, 60.0f, 75.0f, 89.0f };
+
 class BrdfOrLTC {
 public:
     BrdfOrLTC(
@@ -118,6 +137,7 @@ void spherical_plot(const BrdfOrLTC& brdforltc, const std::filesystem::path& sav
 
     // maximum value of the function (color map scaling)
     float max_value = brdforltc.computeMaxValue();
+    const cimg_library::CImg<float>& colorMap = ltc::colorMap();
 
     // loop over pixels
     for (int j = 0; j < image_size; ++j)
@@ -147,71 +167,75 @@ void spherical_plot(const BrdfOrLTC& brdforltc, const std::filesystem::path& sav
     image.save(savePathString.c_str());
 }
 
+void sphericalPlotRows(int alphaIndex, int N, int& minRow, int& maxRow)
+{
+    // rows read by the bilinear interpolation below
+    const float x = std::sqrt(alpha_tab[alphaIndex]) * (N - 1.0f);
+    minRow = std::min<int>((int)x, N - 1);
+    maxRow = std::min<int>(minRow + 1, N - 1);
+}
+
 void make_spherical_plots(
-    const Brdf& brdf, const glm::mat3* tab, const int N,
+    const Brdf& brdf, const LTCTable& tab, const int alphaIndex,
     const std::filesystem::path& outFolder)
 {
-    // init color map texture (for linear interpolation)
-    for (int i = 0; i < 33; ++i) {
-        colorMap(i, 0, 0, 0) = colorMap_data[3 * i + 0];
-        colorMap(i, 0, 0, 1) = colorMap_data[3 * i + 1];
-        colorMap(i, 0, 0, 2) = colorMap_data[3 * i + 2];
-    }
+    LTC_TRACE_ZONE("make_spherical_plots");
+    const int N = tab.N;
+    int minRow, maxRow;
+    sphericalPlotRows(alphaIndex, N, minRow, maxRow);
 
     // fill LTC matrices in texture (for linear interpolation)
-    cimg_library::CImg<float> LTC_matrices(N, N, 1, 9);
+    // only the rows used by this roughness are read, the others may still be fitted
+    // the non-zero terms m00, m02, m11, m20 and m22 (see table.h)
+    cimg_library::CImg<float> LTC_matrices(N, N, 1, 5, 0.0f);
     for (int j = 0; j < N; ++j)
-        for (int i = 0; i < N; ++i) {
-            LTC_matrices(i, j, 0, 0) = tab[i + j * N][0][0];
-            LTC_matrices(i, j, 0, 1) = tab[i + j * N][0][1];
-            LTC_matrices(i, j, 0, 2) = tab[i + j * N][0][2];
-            LTC_matrices(i, j, 0, 3) = tab[i + j * N][1][0];
-            LTC_matrices(i, j, 0, 4) = tab[i + j * N][1][1];
-            LTC_matrices(i, j, 0, 5) = tab[i + j * N][1][2];
-            LTC_matrices(i, j, 0, 6) = tab[i + j * N][2][0];
-            LTC_matrices(i, j, 0, 7) = tab[i + j * N][2][1];
-            LTC_matrices(i, j, 0, 8) = tab[i + j * N][2][2];
+        for (int i = minRow; i <= maxRow; ++i) {
+            LTC_matrices(i, j, 0, 0) = tab.m00[i + j * N];
+            LTC_matrices(i, j, 0, 1) = tab.m02[i + j * N];
+            LTC_matrices(i, j, 0, 2) = tab.m11[i + j * N];
+            LTC_matrices(i, j, 0, 3) = tab.m20[i + j * N];
+            LTC_matrices(i, j, 0, 4) = tab.m22[i + j * N];
         }
 
     // render spherical plots
-    float alpha_tab[] = { 0.05f, 0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 1.0f };
-    float theta_tab[] = { 0.0f, 15.0f, 30.0f, 45.0f, 60.0f, 75.0f, 89.0f };
-    for (int a = 0; a < 7; ++a)
-        for (int t = 0; t < 7; ++t) {
-            // configuration
-            const float alpha = alpha_tab[a];
-            const float theta = theta_tab[t] * 3.14159f / 180.0f;
-            const glm::vec3 V(std::sin(theta), 0.0f, std::cos(theta));
-
-            // fetch texture with parameterization = [(std::sqrt(alpha), sqrt(1 - std::cos(theta))]
-            float x = std::sqrt(alpha) * (LTC_matrices.width() - 1.0f);
-            float y = std::sqrt(1.0f - V.z) * (LTC_matrices.height() - 1.0f);
-            glm::mat3 M = glm::mat3(
-                LTC_matrices.linear_atXY(x, y, 0, 0),
-                LTC_matrices.linear_atXY(x, y, 0, 1),
-                LTC_matrices.linear_atXY(x, y, 0, 2),
-                LTC_matrices.linear_atXY(x, y, 0, 3),
-                LTC_matrices.linear_atXY(x, y, 0, 4),
-                LTC_matrices.linear_atXY(x, y, 0, 5),
-                LTC_matrices.linear_atXY(x, y, 0, 6),
-                LTC_matrices.linear_atXY(x, y, 0, 7),
-                LTC_matrices.linear_atXY(x, y, 0, 8));
-
-            // init LTC
-            LTC ltc;
-            ltc.M = M;
-            ltc.invM = inverse(M);
-            ltc.detM = abs(glm::determinant(M));
-
-            const auto filePathLTC = outFolder / fmt::format("alpha_{:03}_theta_{:02}_ltc.bmp", (int)(alpha_tab[a] * 100.0f), (int)theta_tab[t]);
-            const auto filePathBRDF = outFolder / fmt::format("alpha_{:03}_theta_{:02}_brdf.bmp", (int)(alpha_tab[a] * 100.0f), (int)theta_tab[t]);
-
-            // plot LTC
-            spherical_plot(BrdfOrLTC(&ltc, NULL), filePathLTC);
-
-            // plot BRDF
-            spherical_plot(BrdfOrLTC(NULL, &brdf, V, alpha), filePathBRDF);
-        }
+    const int a = alphaIndex;
+    for (int t = 0; t < 7; ++t) {
+        // configuration
+        const float alpha = alpha_tab[a];
+        const float theta = theta_tab[t] * 3.14159f / 180.0f;
+        const glm::vec3 V(std::sin(theta), 0.0f, std::cos(theta));
+
+        // fetch texture with parameterization = [(std::sqrt(alpha), sqrt(1 - std::cos(theta))]
+        float x = std::sqrt(alpha) * (LTC_matrices.width() - 1.0f);
+        float y = std::sqrt(1.0f - V.z) * (LTC_matrices.height() - 1.0f);
+        glm::mat3 M = glm::mat3(
+            LTC_matrices.linear_atXY(x, y, 0, 0), 0, LTC_matrices.linear_atXY(x, y, 0, 1),
+            0, LTC_matrices.linear_atXY(x, y, 0, 2), 0,
+            LTC_matrices.linear_atXY(x, y, 0, 3), 0, LTC_matrices.linear_atXY(x, y, 0, 4));
+
+        // init LTC
+        LTC ltc;
+        ltc.M = M;
+        ltc.invM = inverse(M);
+        ltc.detM = std::abs(glm::determinant(M));
+
+        const auto filePathLTC = outFolder / fmt::format("alpha_{:03}_theta_{:02}_ltc.bmp", (int)(alpha_tab[a] * 100.0f), (int)theta_tab[t]);
+        const auto filePathBRDF = outFolder / fmt::format("alpha_{:03}_theta_{:02}_brdf.bmp", (int)(alpha_tab[a] * 100.0f), (int)theta_tab[t]);
+
+        // plot LTC
+        spherical_plot(BrdfOrLTC(&ltc, NULL), filePathLTC);
+
+        // plot BRDF
+        spherical_plot(BrdfOrLTC(NULL, &brdf, V, alpha), filePathBRDF);
+    }
+}
+
+void make_spherical_plots(
+    const Brdf& brdf, const LTCTable& tab,
+    const std::filesystem::path& outFolder)
+{
+    for (int a = 0; a < NumSphericalPlotAlphas; ++a)
+        make_spherical_plots(brdf, tab, a, outFolder);
 }
 
 }
@@ -0,0 +1,22 @@
+#pragma once
+#include <glm/vec3.hpp>
+
+namespace ltc {
+
+// clip the convex polygon L[0], ..., L[n - 1] to the upper hemisphere (Sutherland-Hodgman with the plane z = 0),
+// clipped needs room for n + 1 vertices, returns the number of vertices of the clipped polygon
+inline int clipPolygonToHorizon(const glm::vec3* L, int n, glm::vec3* clipped)
+{
+    int m = 0;
+    for (int i = 0; i < n; ++i) {
+        const glm::vec3& a = L[i];
+        const glm::vec3& b = L[(i + 1) % n];
+        if (a.z > 0.0f)
+            clipped[m++] = a;
+        if ((a.z > 0.0f) != (b.z > 0.0f))
+            clipped[m++] = (a.z * b - b.z * a) / (a.z - b.z);
+    }
+    return m;
+}
+
+}
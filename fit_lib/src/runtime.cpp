@@ -0,0 +1,291 @@
+#include "ltc/runtime.h"
+#include "polygon_clip.h"
+#include <algorithm>
+#include <cmath>
+#include <glm/geometric.hpp>
+#include <glm/matrix.hpp>
+
+namespace ltc {
+
+// spread the bits of x to the even bits
+static inline uint32_t spreadBits(uint32_t x)
+{
+    x = (x | (x << 8)) & 0x00ff00ffu;
+    x = (x | (x << 4)) & 0x0f0f0f0fu;
+    x = (x | (x << 2)) & 0x33333333u;
+    x = (x | (x << 1)) & 0x55555555u;
+    return x;
+}
+
+static inline int mortonIndex(int a, int t)
+{
+    return int(spreadBits(uint32_t(a)) | (spreadBits(uint32_t(t)) << 1));
+}
+
+static inline int tiledIndex(int tilesPerRow, int a, int t)
+{
+    const int tile = a / TableTileSize + (t / TableTileSize) * tilesPerRow;
+    return tile * TableTileSize * TableTileSize + a % TableTileSize + (t % TableTileSize) * TableTileSize;
+}
+
+int tableTexelIndex(TableLayout layout, int N, int a, int t)
+{
+    switch (layout) {
+    case TableLayout::Tiled:
+        return tiledIndex((N + TableTileSize - 1) / TableTileSize, a, t);
+    case TableLayout::Morton:
+        return mortonIndex(a, t);
+    default:
+        return a + t * N;
+    }
+}
+
+int tableNumTexels(TableLayout layout, int N)
+{
+    switch (layout) {
+    case TableLayout::Tiled: {
+        const int size = (N + TableTileSize - 1) / TableTileSize * TableTileSize;
+        return size * size;
+    }
+    case TableLayout::Morton: {
+        int size = 1;
+        while (size < N)
+            size *= 2;
+        return size * size;
+    }
+    default:
+        return N * N;
+    }
+}
+
+void reorderTable(const glm::vec4* src, glm::vec4* dst, int N, TableLayout layout)
+{
+    std::fill(dst, dst + tableNumTexels(layout, N), glm::vec4(0.0f));
+    for (int t = 0; t < N; ++t) {
+        for (int a = 0; a < N; ++a)
+            dst[tableTexelIndex(layout, N, a, t)] = src[a + t * N];
+    }
+}
+
+// the texels and weights of a bilinear lookup at (u, v) in [0, 1]^2, texel (a, t) at (a / (N - 1), t / (N - 1)) as
+// with the LUT scale and bias of the shaders
+struct BilinearTaps {
+    int index[4];
+    float weight[4];
+};
+
+static BilinearTaps bilinearTaps(const PackedTable& table, float u, float v)
+{
+    const int N = table.N;
+    const float x = std::clamp(u, 0.0f, 1.0f) * (N - 1);
+    const float y = std::clamp(v, 0.0f, 1.0f) * (N - 1);
+    const int a0 = std::min(int(x), N - 2);
+    const int t0 = std::min(int(y), N - 2);
+    const float fa = x - a0;
+    const float ft = y - t0;
+
+    BilinearTaps taps;
+    switch (table.layout) {
+    case TableLayout::Tiled: {
+        const int tilesPerRow = (N + TableTileSize - 1) / TableTileSize;
+        taps.index[0] = tiledIndex(tilesPerRow, a0, t0);
+        taps.index[1] = tiledIndex(tilesPerRow, a0 + 1, t0);
+        taps.index[2] = tiledIndex(tilesPerRow, a0, t0 + 1);
+        taps.index[3] = tiledIndex(tilesPerRow, a0 + 1, t0 + 1);
+        break;
+    }
+    case TableLayout::Morton: {
+        const uint32_t sa0 = spreadBits(uint32_t(a0)), sa1 = spreadBits(uint32_t(a0 + 1));
+        const uint32_t st0 = spreadBits(uint32_t(t0)) << 1, st1 = spreadBits(uint32_t(t0 + 1)) << 1;
+        taps.index[0] = int(sa0 | st0);
+        taps.index[1] = int(sa1 | st0);
+        taps.index[2] = int(sa0 | st1);
+        taps.index[3] = int(sa1 | st1);
+        break;
+    }
+    default:
+        taps.index[0] = a0 + t0 * N;
+        taps.index[1] = taps.index[0] + 1;
+        taps.index[2] = taps.index[0] + N;
+        taps.index[3] = taps.index[2] + 1;
+    }
+    taps.weight[0] = (1.0f - fa) * (1.0f - ft);
+    taps.weight[1] = fa * (1.0f - ft);
+    taps.weight[2] = (1.0f - fa) * ft;
+    taps.weight[3] = fa * ft;
+    return taps;
+}
+
+static glm::vec4 bilinear(const glm::vec4* tex, const BilinearTaps& taps)
+{
+    return taps.weight[0] * tex[taps.index[0]] + taps.weight[1] * tex[taps.index[1]]
+        + taps.weight[2] * tex[taps.index[2]] + taps.weight[3] * tex[taps.index[3]];
+}
+
+ShadingLTC lookupLTC(const PackedTable& table, float roughness, float cosThetaV)
+{
+    const BilinearTaps taps = bilinearTaps(table, roughness, std::sqrt(1.0f - std::clamp(cosThetaV, 0.0f, 1.0f)));
+    const glm::vec4 t1 = bilinear(table.tex1, taps);
+
+    ShadingLTC ltc;
+    ltc.invM = glm::mat3(
+        glm::vec3(t1.x, 0, t1.y),
+        glm::vec3(0, 1, 0),
+        glm::vec3(t1.z, 0, t1.w));
+    ltc.terms = bilinear(table.tex2, taps);
+    return ltc;
+}
+
+glm::mat3 ltcWorldToCosine(const glm::mat3& invM, const glm::vec3& N, const glm::vec3& V)
+{
+    // orthonormal basis around N
+    const glm::vec3 T1 = glm::normalize(V - N * glm::dot(V, N));
+    const glm::vec3 T2 = glm::cross(N, T1);
+    return invM * glm::transpose(glm::mat3(T1, T2, N));
+}
+
+// integral of the edge v1 -> v2 (normalized), acos instead of the fitted approximation of the shaders
+static float integrateEdge(const glm::vec3& v1, const glm::vec3& v2)
+{
+    const float x = std::clamp(glm::dot(v1, v2), -1.0f, 1.0f);
+    const float theta = std::acos(x);
+    const float sinTheta = std::sqrt(std::max(1.0f - x * x, 1e-12f));
+    const float z = v1.x * v2.y - v1.y * v2.x;
+    return z * (theta > 1e-4f ? theta / sinTheta : 1.0f);
+}
+
+float integratePolygon(const glm::vec3* L, int n, bool twoSided)
+{
+    glm::vec3 clipped[MaxPolygonVertices + 1];
+    const int m = clipPolygonToHorizon(L, n, clipped);
+    if (m < 3)
+        return 0.0f;
+
+    // project onto the sphere and integrate
+    for (int i = 0; i < m; ++i)
+        clipped[i] = glm::normalize(clipped[i]);
+    float sum = 0.0f;
+    for (int i = 0; i < m; ++i)
+        sum += integrateEdge(clipped[i], clipped[(i + 1) % m]);
+    sum /= 2.0f * 3.14159265f;
+
+    return twoSided ? std::abs(sum) : std::max(0.0f, sum);
+}
+
+// roots of x^3 + c2 x^2 + c1 x + c0 with three real roots (the eigenvalues of a symmetric matrix), ascending
+static void solveCubic(double c0, double c1, double c2, double roots[3])
+{
+    // depressed cubic t^3 + p t + q with x = t - c2 / 3, trigonometric solution
+    const double p = c1 - c2 * c2 / 3.0;
+    const double q = 2.0 * c2 * c2 * c2 / 27.0 - c2 * c1 / 3.0 + c0;
+    const double m = 2.0 * std::sqrt(std::max(-p / 3.0, 0.0));
+    const double c = m > 0.0 ? std::clamp(3.0 * q / (p * m), -1.0, 1.0) : 0.0;
+    const double theta = std::acos(c) / 3.0;
+    for (int k = 0; k < 3; ++k)
+        roots[k] = m * std::cos(theta - 2.0 * 3.14159265358979 * k / 3.0) - c2 / 3.0;
+    std::sort(roots, roots + 3);
+}
+
+float integrateDisk(const glm::vec3& C, const glm::vec3& V1, const glm::vec3& V2, bool twoSided, const PackedTable& table)
+{
+    if (!twoSided && glm::dot(glm::cross(V1, V2), C) < 0.0f)
+        return 0.0f;
+
+    // principal axes of the ellipse, as the shaders (the scalars in double precision)
+    const double d11 = glm::dot(V1, V1);
+    const double d22 = glm::dot(V2, V2);
+    const double d12 = glm::dot(V1, V2);
+    double a, b;
+    glm::vec3 axis1, axis2;
+    if (std::abs(d12) / std::sqrt(d11 * d22) > 1e-4) {
+        const double tr = d11 + d22;
+        const double det = std::sqrt(std::max(d11 * d22 - d12 * d12, 0.0));
+        const double u = 0.5 * std::sqrt(std::max(tr - 2.0 * det, 0.0));
+        const double v = 0.5 * std::sqrt(tr + 2.0 * det);
+        const double eMax = (u + v) * (u + v);
+        const double eMin = (u - v) * (u - v);
+        if (d11 > d22) {
+            axis1 = float(d12) * V1 + float(eMax - d11) * V2;
+            axis2 = float(d12) * V1 + float(eMin - d11) * V2;
+        } else {
+            axis1 = float(d12) * V2 + float(eMax - d22) * V1;
+            axis2 = float(d12) * V2 + float(eMin - d22) * V1;
+        }
+        a = 1.0 / eMax;
+        b = 1.0 / eMin;
+        axis1 = glm::normalize(axis1);
+        axis2 = glm::normalize(axis2);
+    } else {
+        a = 1.0 / d11;
+        b = 1.0 / d22;
+        axis1 = V1 * float(std::sqrt(a));
+        axis2 = V2 * float(std::sqrt(b));
+    }
+
+    glm::vec3 axis3 = glm::cross(axis1, axis2);
+    if (glm::dot(C, axis3) < 0.0f)
+        axis3 = -axis3;
+
+    const double L = glm::dot(axis3, C);
+    if (L <= 0.0)
+        return 0.0f;
+    const double x0 = glm::dot(axis1, C) / L;
+    const double y0 = glm::dot(axis2, C) / L;
+    a *= L * L;
+    b *= L * L;
+
+    // eigenvalues of the cone through the ellipse, e2 is the negative one
+    double roots[3];
+    solveCubic(a * b, a * b * (1.0 + x0 * x0 + y0 * y0) - a - b, 1.0 - a * (1.0 + x0 * x0) - b * (1.0 + y0 * y0), roots);
+    const double e1 = roots[1];
+    const double e2 = roots[0];
+    const double e3 = roots[2];
+    // degenerate cone (ellipse seen edge-on)
+    if (!(e2 < 0.0 && e1 > 0.0))
+        return 0.0f;
+
+    const glm::vec3 avgDir = glm::normalize(float(a * x0 / (a - e2)) * axis1 + float(b * y0 / (b - e2)) * axis2 + axis3);
+    const double L1 = std::sqrt(-e2 / e3);
+    const double L2 = std::sqrt(-e2 / e1);
+    const float formFactor = float(L1 * L2 / std::sqrt((1.0 + L1 * L1) * (1.0 + L2 * L2)));
+
+    // horizon-clipped sphere of the same form factor (see genSphereTab)
+    const float scale = bilinear(table.tex2, bilinearTaps(table, avgDir.z * 0.5f + 0.5f, formFactor)).w;
+    return formFactor * scale;
+}
+
+// integral of the clamped cosine over the line p1 -> p2 (clipped to the horizon), per unit width
+static float integrateDiffuseLine(glm::vec3 p1, glm::vec3 p2)
+{
+    if (p1.z <= 0.0f && p2.z <= 0.0f)
+        return 0.0f;
+    const glm::vec3 wt = glm::normalize(p2 - p1);
+    if (p1.z < 0.0f)
+        p1 = (p1 * p2.z - p2 * p1.z) / (p2.z - p1.z);
+    if (p2.z < 0.0f)
+        p2 = (-p1 * p2.z + p2 * p1.z) / (-p2.z + p1.z);
+
+    // shading point orthogonally projected on the line
+    const float l1 = glm::dot(p1, wt);
+    const float l2 = glm::dot(p2, wt);
+    const glm::vec3 po = p1 - l1 * wt;
+    const float d = std::max(glm::length(po), 1e-6f);
+
+    const auto Fpo = [d](float l) { return l / (d * (d * d + l * l)) + std::atan(l / d) / (d * d); };
+    const auto Fwt = [d](float l) { return l * l / (d * (d * d + l * l)); };
+    return ((Fpo(l2) - Fpo(l1)) * po.z + (Fwt(l2) - Fwt(l1)) * wt.z) / 3.14159265f;
+}
+
+float integrateLine(const glm::mat3& invM, const glm::vec3& p1, const glm::vec3& p2, float radius)
+{
+    const glm::vec3 normal = glm::cross(p1, p2);
+    const float normalLength = glm::length(normal);
+    if (normalLength == 0.0f)
+        return 0.0f;
+
+    // width of the line in the space of the cosine
+    const float width = 1.0f / glm::length(glm::inverse(glm::transpose(invM)) * (normal / normalLength));
+    return radius * width * integrateDiffuseLine(invM * p1, invM * p2);
+}
+
+}
@@ -0,0 +1,198 @@
+#include "ltc/sampling.h"
+#include "polygon_clip.h"
+#include <algorithm>
+#include <cmath>
+#include <glm/geometric.hpp>
+#include <glm/matrix.hpp>
+
+namespace ltc {
+
+constexpr float pi = 3.14159265f;
+// relative rounding of the directions of samplePolygonLTC, see pdfPolygonLTC
+constexpr float DirectionRounding = 1e-5f;
+
+// Jacobian of the transformation to the space of the cosine, for a unit direction L
+static float jacobian(const glm::mat3& invM, float detInvM, const glm::vec3& L, glm::vec3& Lcosine)
+{
+    const glm::vec3 Ltransformed = invM * L;
+    const float length = glm::length(Ltransformed);
+    Lcosine = Ltransformed / length;
+    return detInvM / (length * length * length);
+}
+
+void sampleLTC(const glm::mat3& invM, int count, const float* U1, const float* U2, glm::vec3* directions, float* pdfs)
+{
+    const glm::mat3 M = glm::inverse(invM);
+    const float detInvM = std::abs(glm::determinant(invM));
+
+    for (int i = 0; i < count; ++i) {
+        // cosine distribution, as LTC::sample
+        const float cosTheta = std::sqrt(U1[i]);
+        const float sinTheta = std::sqrt(1.0f - U1[i]);
+        const float phi = 2.0f * pi * U2[i];
+        const glm::vec3 Lcosine(sinTheta * std::cos(phi), sinTheta * std::sin(phi), cosTheta);
+
+        const glm::vec3 L = glm::normalize(M * Lcosine);
+        const glm::vec3 Ltransformed = invM * L;
+        const float length = glm::length(Ltransformed);
+
+        directions[i] = L;
+        pdfs[i] = cosTheta / pi * detInvM / (length * length * length);
+    }
+}
+
+void pdfLTC(const glm::mat3& invM, int count, const glm::vec3* directions, float* pdfs)
+{
+    const float detInvM = std::abs(glm::determinant(invM));
+
+    for (int i = 0; i < count; ++i) {
+        glm::vec3 Lcosine;
+        const float J = jacobian(invM, detInvM, glm::normalize(directions[i]), Lcosine);
+        pdfs[i] = std::max(Lcosine.z, 0.0f) / pi * J;
+    }
+}
+
+void sampleLTC(const PackedTable& table, int count, const float* roughness, const float* cosThetaV,
+    const float* U1, const float* U2, glm::vec3* directions, float* pdfs)
+{
+    for (int i = 0; i < count; ++i) {
+        const ShadingLTC ltc = lookupLTC(table, roughness[i], cosThetaV[i]);
+        sampleLTC(ltc.invM, 1, &U1[i], &U2[i], &directions[i], &pdfs[i]);
+    }
+}
+
+// solid angle of the spherical triangle a, b, c (unit vectors), Van Oosterom and Strackee
+// in double precision as sampleSphericalTriangle, which only stays within the triangle with a consistent area
+static float solidAngle(const glm::vec3& a_, const glm::vec3& b_, const glm::vec3& c_)
+{
+    const glm::dvec3 a = glm::normalize(glm::dvec3(a_)), b = glm::normalize(glm::dvec3(b_)), c = glm::normalize(glm::dvec3(c_));
+    const double numerator = std::abs(glm::dot(a, glm::cross(b, c)));
+    const double denominator = 1.0 + glm::dot(a, b) + glm::dot(b, c) + glm::dot(c, a);
+    return float(2.0 * std::atan2(numerator, denominator));
+}
+
+// uniform direction in the spherical triangle a, b, c (unit vectors) of the given solid angle, Arvo 1995
+// in double precision and renormalized: the cosines of the short edges of the small triangles of clipped polygons are
+// lost in the rounding of the single precision unit vectors, and the samples leave the triangle
+static glm::vec3 sampleSphericalTriangle(const glm::vec3& a_, const glm::vec3& b_, const glm::vec3& c_, float area, float U1, float U2)
+{
+    const glm::dvec3 a = glm::normalize(glm::dvec3(a_)), b = glm::normalize(glm::dvec3(b_)), c = glm::normalize(glm::dvec3(c_));
+
+    // angle at a, between the great circles through (a, b) and (a, c)
+    const glm::dvec3 nab = glm::normalize(glm::cross(a, b));
+    const glm::dvec3 nac = glm::normalize(glm::cross(a, c));
+    const double alpha = std::acos(std::clamp(glm::dot(nab, nac), -1.0, 1.0));
+
+    // the sub-triangle a, b, c' has area U1 * area
+    const double areaSub = double(U1) * area;
+    const double s = std::sin(areaSub - alpha);
+    const double t = std::cos(areaSub - alpha);
+    const double u = t - std::cos(alpha);
+    const double v = s + std::sin(alpha) * glm::dot(a, b);
+    const double q = std::clamp(((v * t - u * s) * std::cos(alpha) - v) / ((v * s + u * t) * std::sin(alpha)), -1.0, 1.0);
+
+    const glm::dvec3 cPerp = c - glm::dot(c, a) * a;
+    const double cPerpLength = glm::length(cPerp);
+    const glm::dvec3 cSub = q * a + std::sqrt(std::max(1.0 - q * q, 0.0)) * (cPerpLength > 0.0 ? cPerp / cPerpLength : glm::dvec3(0.0));
+
+    // uniform along the arc from b to c'
+    const double z = 1.0 - double(U2) * (1.0 - glm::dot(cSub, b));
+    const glm::dvec3 cSubPerp = cSub - glm::dot(cSub, b) * b;
+    const double cSubPerpLength = glm::length(cSubPerp);
+    return glm::vec3(z * b + std::sqrt(std::max(1.0 - z * z, 0.0)) * (cSubPerpLength > 0.0 ? cSubPerp / cSubPerpLength : glm::dvec3(0.0)));
+}
+
+// the polygon in the space of the cosine, clipped and projected to the sphere, with the solid angles of its fan
+static int projectPolygon(const glm::mat3& invM, const glm::vec3* points, int n, glm::vec3* L, float* areas, float& totalArea)
+{
+    glm::vec3 transformed[MaxPolygonVertices];
+    for (int i = 0; i < n; ++i)
+        transformed[i] = invM * points[i];
+
+    const int m = clipPolygonToHorizon(transformed, n, L);
+    totalArea = 0.0f;
+    if (m < 3)
+        return 0;
+
+    for (int i = 0; i < m; ++i)
+        L[i] = glm::normalize(L[i]);
+    for (int i = 1; i + 1 < m; ++i) {
+        areas[i - 1] = solidAngle(L[0], L[i], L[i + 1]);
+        totalArea += areas[i - 1];
+    }
+    return totalArea > 0.0f ? m : 0;
+}
+
+bool samplePolygonLTC(const glm::mat3& invM, const glm::vec3* points, int n, int count,
+    const float* U1, const float* U2, glm::vec3* directions, float* pdfs)
+{
+    glm::vec3 L[MaxPolygonVertices + 1];
+    float areas[MaxPolygonVertices - 1];
+    float totalArea;
+    const int m = projectPolygon(invM, points, n, L, areas, totalArea);
+    if (m == 0) {
+        std::fill(pdfs, pdfs + count, 0.0f);
+        return false;
+    }
+
+    const glm::mat3 M = glm::inverse(invM);
+    const float detInvM = std::abs(glm::determinant(invM));
+
+    for (int i = 0; i < count; ++i) {
+        // pick a triangle of the fan proportionally to its solid angle, reuse U1 within it
+        float u = U1[i] * totalArea;
+        int k = 0;
+        while (k < m - 3 && u >= areas[k]) {
+            u -= areas[k];
+            ++k;
+        }
+        const float U1k = std::clamp(u / areas[k], 0.0f, 1.0f);
+
+        const glm::vec3 Lcosine = sampleSphericalTriangle(L[0], L[k + 1], L[k + 2], areas[k], U1k, U2[i]);
+        const glm::vec3 direction = glm::normalize(M * Lcosine);
+
+        glm::vec3 unused;
+        directions[i] = direction;
+        pdfs[i] = jacobian(invM, detInvM, direction, unused) / totalArea;
+    }
+    return true;
+}
+
+void pdfPolygonLTC(const glm::mat3& invM, const glm::vec3* points, int n, int count,
+    const glm::vec3* directions, float* pdfs)
+{
+    glm::vec3 L[MaxPolygonVertices + 1];
+    float areas[MaxPolygonVertices - 1];
+    float totalArea;
+    const int m = projectPolygon(invM, points, n, L, areas, totalArea);
+    const float detInvM = std::abs(glm::determinant(invM));
+
+    // the directions of samplePolygonLTC on the edges of the polygon are transformed back and forth, so they may lie
+    // outside by the rounding amplified by the condition number of invM (Frobenius)
+    const glm::mat3 M = glm::inverse(invM);
+    const auto norm = [](const glm::mat3& A) { return std::sqrt(glm::dot(A[0], A[0]) + glm::dot(A[1], A[1]) + glm::dot(A[2], A[2])); };
+    const float tolerance = DirectionRounding * norm(invM) * norm(M);
+
+    for (int i = 0; i < count; ++i) {
+        if (m == 0) {
+            pdfs[i] = 0.0f;
+            continue;
+        }
+
+        glm::vec3 Lcosine;
+        const float J = jacobian(invM, detInvM, glm::normalize(directions[i]), Lcosine);
+
+        // inside the (convex) spherical polygon if on the same side of all of its edges
+        bool positive = true, negative = true;
+        for (int k = 0; k < m; ++k) {
+            const glm::vec3 edge = glm::cross(L[k], L[(k + 1) % m]);
+            const float side = glm::dot(Lcosine, edge);
+            const float edgeTolerance = tolerance * glm::length(edge);
+            positive = positive && side >= -edgeTolerance;
+            negative = negative && side <= edgeTolerance;
+        }
+        pdfs[i] = (positive || negative) && Lcosine.z > -tolerance ? J / totalArea : 0.0f;
+    }
+}
+
+}
@@ -0,0 +1,92 @@
+#include "ltc/trace.h"
+#ifdef LTC_ENABLE_TRACING
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ltc::trace {
+
+// number of zones kept per thread, the oldest are overwritten
+constexpr size_t RingSize = 1 << 16;
+
+struct Event {
+    const char* name;
+    int64_t start;
+    int64_t end;
+};
+
+struct ThreadBuffer {
+    std::vector<Event> events = std::vector<Event>(RingSize);
+    // total number of recorded zones, only written by the owning thread
+    std::atomic<uint64_t> count { 0 };
+    int threadIndex;
+};
+
+static std::mutex buffersMutex;
+static std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+static const auto epoch = std::chrono::steady_clock::now();
+
+static int64_t now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count();
+}
+
+// registered on first use by each thread, kept alive until exit so they can be dumped after the thread ended
+static ThreadBuffer& threadBuffer()
+{
+    thread_local ThreadBuffer* buffer = []() {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        buffers.push_back(std::make_unique<ThreadBuffer>());
+        buffers.back()->threadIndex = (int)buffers.size() - 1;
+        return buffers.back().get();
+    }();
+    return *buffer;
+}
+
+Zone::Zone(const char* name_)
+    : name(name_)
+    , start(now())
+{
+}
+
+Zone::~Zone()
+{
+    ThreadBuffer& buffer = threadBuffer();
+    const uint64_t i = buffer.count.load(std::memory_order_relaxed);
+    buffer.events[i % RingSize] = { name, start, now() };
+    buffer.count.store(i + 1, std::memory_order_release);
+}
+
+bool dump(const char* path)
+{
+    std::ofstream file(path);
+    if (!file)
+        return false;
+
+    // complete events ("X"), timestamps in microseconds
+    file << std::fixed << std::setprecision(3);
+    file << "{\"traceEvents\":[" << std::endl;
+    bool first = true;
+    std::lock_guard<std::mutex> lock(buffersMutex);
+    for (const auto& buffer : buffers) {
+        const uint64_t count = buffer->count.load(std::memory_order_acquire);
+        const uint64_t begin = count > RingSize ? count - RingSize : 0;
+        for (uint64_t i = begin; i < count; ++i) {
+            const Event& event = buffer->events[i % RingSize];
+            file << (first ? "" : ",\n") << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->threadIndex
+                 << ",\"ts\":" << event.start / 1000.0 << ",\"dur\":" << (event.end - event.start) / 1000.0 << "}";
+            first = false;
+        }
+    }
+    file << std::endl
+         << "],\"displayTimeUnit\":\"ms\"}" << std::endl;
+
+    return true;
+}
+
+}
+#endif
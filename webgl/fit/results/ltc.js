@@ -1,8195 +0,0 @@
-var g_ltc_1 = [
-1, 0, 0, 0.0231481, 
-1, 0, 0, 0.000503905, 
-1, 0, 0, 0.00201562, 
-1, 0, 0, 0.00453515, 
-1, 0, 0, 0.00806253, 
-1, 0, 0, 0.0125978, 
-1, 0, 0, 0.018141, 
-1, 0, 0, 0.0246925, 
-1, 0, 0, 0.0322525, 
-1, 0, 0, 0.0408214, 
-1, 0, 0, 0.0504001, 
-1, 0, 0, 0.0609894, 
-1, 0, 0, 0.0725909, 
-1, 0, 0, 0.0852059, 
-1, 0, 0, 0.0988366, 
-1, 0, 0, 0.113485, 
-1, 0, 0, 0.129151, 
-1, 0, 0, 0.145839, 
-1, 0, 0, 0.163548, 
-1, 0, 0, 0.182265, 
-1, 0, 0, 0.201943, 
-1, 0, 0, 0.222322, 
-1, 0, 0, 0.241905, 
-1, 0, 0, 0.262314, 
-1, 0, 0, 0.285754, 
-1, 0, 0, 0.310157, 
-1, 0, 0, 0.335429, 
-1, 0, 0, 0.361351, 
-1, 0, 0, 0.387428, 
-1, 0, 0, 0.412769, 
-1, 0, 0, 0.438193, 
-1, 0, 0, 0.466956, 
-1, 0, 0, 0.495582, 
-1, 0, 0, 0.523468, 
-1, 0, 0, 0.549933, 
-1, 0, 0, 0.579812, 
-1, 0, 0, 0.608699, 
-1, 0, 0, 0.636175, 
-1, 0, 0, 0.664734, 
-1, 0, 0, 0.69313, 
-1, 0, 0, 0.719621, 
-1, 0, 0, 0.747658, 
-1, 0, 0, 0.774022, 
-1, 0, 0, 0.799777, 
-1, 0, 0, 0.82527, 
-1, 0, 0, 0.849211, 
-1, 0, 0, 0.87325, 
-1, 0, 0, 0.895364, 
-1, 0, 0, 0.917558, 
-1, 0, 0, 0.937905, 
-1, 0, 0, 0.958086, 
-1, 0, 0, 0.976507, 
-1, 0, 0, 0.994598, 
-1, 0, 0, 1.01124, 
-1, 0, 0, 1.0271, 
-1, 0, 0, 1.04189, 
-1, 0, 0, 1.05569, 
-1, 0, 0, 1.0687, 
-1, 0, 0, 1.08059, 
-1, 0, 0, 1.09188, 
-1, 0, 0, 1.10181, 
-1, 0, 0, 1.11161, 
-1, 0, 0, 1.1199, 
-1, 0, 0, 1.12823, 
-0.999748, -0.0224461, 0.0224461, 0.999748, 
-0.999748, -0.0224462, 0.0224462, 0.999748, 
-0.999748, -0.0224462, 0.0224462, 0.999748, 
-0.999748, -0.0224462, 0.0224462, 0.999748, 
-1.60996, -0.000222299, 0.0352125, 0.00990114, 
-1.30475, -0.000304564, 0.0286661, 0.0135652, 
-1.34951, -0.000460566, 0.0311517, 0.0205135, 
-4.11306, -0.000928492, 0.10378, 0.0413547, 
-0.990362, -0.000731548, 0.0227556, 0.0325829, 
-3.08989, -0.00152541, 0.0510906, 0.067941, 
-1.22792, -0.00120851, 0.032016, 0.0538268, 
-0.986805, -0.00136276, 0.022155, 0.0606971, 
-0.999632, -0.00162884, 0.0224378, 0.0725488, 
-0.764831, -0.00164939, 0.0164874, 0.0734645, 
-0.0983245, -0.0013012, -0.0176174, 0.0579574, 
-0.463392, -0.00179403, 0.0107731, 0.079912, 
-0.999506, -0.00289774, 0.0224413, 0.129086, 
-0.996854, -0.00326474, 0.0223106, 0.145461, 
-1.01908, -0.003745, 0.0225201, 0.166936, 
-0.999531, -0.00408161, 0.0224389, 0.182179, 
-0.999753, -0.00450145, 0.022549, 0.201883, 
-0.999558, -0.00483658, 0.0224257, 0.222197, 
-0.999539, -0.00452927, 0.0223145, 0.241714, 
-0.999511, -0.00587401, 0.0224312, 0.262184, 
-0.999502, -0.00638801, 0.0224275, 0.285607, 
-0.999515, -0.00691039, 0.0224159, 0.310003, 
-0.999548, -0.00741983, 0.0224024, 0.335264, 
-0.999538, -0.00786245, 0.022355, 0.361137, 
-0.999579, -0.0081195, 0.0222836, 0.387235, 
-0.999522, -0.00799955, 0.0221027, 0.412528, 
-0.999547, -0.00952688, 0.0223054, 0.437976, 
-0.999573, -0.00991334, 0.0222239, 0.466732, 
-0.999597, -0.010094, 0.0220592, 0.495357, 
-0.999639, -0.00996809, 0.0218028, 0.52319, 
-0.999599, -0.0105025, 0.0216959, 0.550193, 
-0.999592, -0.0114193, 0.0217093, 0.579508, 
-0.999601, -0.0111816, 0.0213607, 0.608403, 
-0.99959, -0.0107717, 0.0208892, 0.635921, 
-0.999606, -0.0121673, 0.0210037, 0.664482, 
-0.999649, -0.0116016, 0.0204299, 0.692849, 
-0.999635, -0.0115613, 0.0199948, 0.719765, 
-0.999573, -0.0121107, 0.019743, 0.747308, 
-0.999573, -0.0110766, 0.0188755, 0.773672, 
-0.999667, -0.0122369, 0.0188242, 0.799544, 
-0.999682, -0.0110315, 0.0177973, 0.824975, 
-0.999634, -0.0114929, 0.0173854, 0.849119, 
-0.999662, -0.0105923, 0.0164601, 0.872997, 
-0.999591, -0.0105991, 0.015779, 0.895396, 
-0.999709, -0.00979888, 0.0148375, 0.917389, 
-0.999682, -0.00967178, 0.0140684, 0.937943, 
-0.999761, -0.00869183, 0.0129539, 0.957926, 
-0.999778, -0.00866903, 0.0122743, 0.976592, 
-0.999831, -0.00731971, 0.0109266, 0.994477, 
-0.999802, -0.00756046, 0.0103406, 1.0112, 
-0.999854, -0.00583729, 0.00884918, 1.027, 
-0.999818, -0.00631431, 0.00829982, 1.04185, 
-0.999904, -0.00450806, 0.00674396, 1.05574, 
-0.999936, -0.00486093, 0.00619057, 1.06864, 
-0.999946, -0.00322059, 0.00478134, 1.0806, 
-0.999999, -0.00318199, 0.00403337, 1.09181, 
-1, -0.00193343, 0.0027989, 1.10205, 
-0.999977, -0.00153735, 0.00199562, 1.11158, 
-1.00002, -0.000623707, 0.000912756, 1.12016, 
-1.00005, -1.03327e-06, 8.18798e-06, 1.12814, 
-0.998992, -0.0448841, 0.0448841, 0.998992, 
-0.998992, -0.044884, 0.044884, 0.998992, 
-0.998992, -0.044884, 0.044884, 0.998992, 
-0.998992, -0.044884, 0.044884, 0.998992, 
-1.60876, -0.000444515, 0.0713458, 0.00989365, 
-1.30378, -0.000609014, 0.0579493, 0.0135549, 
-1.34847, -0.000920959, 0.061439, 0.020498, 
-4.1097, -0.00185663, 0.196089, 0.0413235, 
-0.989602, -0.00146282, 0.0449825, 0.0325582, 
-3.08796, -0.00305022, 0.120442, 0.0678896, 
-0.86158, -0.00205439, 0.0391456, 0.0457251, 
-0.48028, -0.00180695, 0.0244358, 0.0402181, 
-0.998607, -0.00325594, 0.0448749, 0.0724696, 
-0.764268, -0.0032981, 0.0336522, 0.073409, 
-1.48825, -0.00558672, 0.0577571, 0.124352, 
-0.622604, -0.0036983, 0.0269424, 0.0823224, 
-0.997966, -0.00578981, 0.0448382, 0.12889, 
-0.996341, -0.00653028, 0.0446801, 0.145402, 
-1.06113, -0.00764148, 0.0448396, 0.170224, 
-0.997981, -0.00815451, 0.0448341, 0.181898, 
-0.998105, -0.00898987, 0.044847, 0.201533, 
-0.997966, -0.00964383, 0.0447884, 0.221816, 
-0.998048, -0.00922667, 0.0446107, 0.24128, 
-0.998043, -0.0117361, 0.044825, 0.261792, 
-0.998088, -0.012763, 0.0448147, 0.285186, 
-0.998026, -0.0138052, 0.0447955, 0.309531, 
-0.998061, -0.0148205, 0.0447587, 0.33475, 
-0.998069, -0.0156995, 0.0446937, 0.360603, 
-0.998121, -0.0161972, 0.0445178, 0.386594, 
-0.998159, -0.0159451, 0.0441714, 0.411846, 
-0.998131, -0.0183948, 0.044418, 0.437732, 
-0.998163, -0.0197917, 0.0443885, 0.466021, 
-0.998234, -0.0201425, 0.0440832, 0.494573, 
-0.998207, -0.0198832, 0.0435479, 0.522367, 
-0.998281, -0.0210559, 0.043412, 0.54992, 
-0.99834, -0.0227913, 0.0433944, 0.578686, 
-0.998332, -0.0223104, 0.0426589, 0.60757, 
-0.998446, -0.0223079, 0.0419992, 0.635498, 
-0.998462, -0.0241151, 0.041898, 0.663648, 
-0.99846, -0.0231438, 0.0408195, 0.691884, 
-0.998571, -0.0233688, 0.0400361, 0.719354, 
-0.998412, -0.0241651, 0.0394497, 0.746427, 
-0.998469, -0.0228714, 0.038012, 0.773082, 
-0.998565, -0.0235205, 0.0372245, 0.799039, 
-0.998659, -0.0223122, 0.0356921, 0.824301, 
-0.9986, -0.0223085, 0.0345158, 0.848732, 
-0.998597, -0.021342, 0.0329409, 0.872248, 
-0.998667, -0.02079, 0.0314378, 0.895104, 
-0.998795, -0.0198422, 0.0297332, 0.916792, 
-0.998766, -0.0189161, 0.0279827, 0.937738, 
-0.998884, -0.0178817, 0.0261727, 0.957465, 
-0.999041, -0.0166841, 0.0242144, 0.97647, 
-0.999163, -0.0155484, 0.022221, 0.994298, 
-0.999237, -0.0141348, 0.0201635, 1.01111, 
-0.999336, -0.0129324, 0.0181759, 1.02692, 
-0.999433, -0.0113191, 0.0160065, 1.04172, 
-0.999503, -0.0101251, 0.0140505, 1.05566, 
-0.999789, -0.00837554, 0.011734, 1.06864, 
-0.999737, -0.00721801, 0.00986507, 1.08074, 
-0.999803, -0.00554059, 0.00770651, 1.09175, 
-0.999889, -0.00426955, 0.0057814, 1.10209, 
-0.999893, -0.00273892, 0.00380519, 1.11147, 
-0.999926, -0.00136728, 0.00183302, 1.12023, 
-0.999973, 3.93508e-05, -4.22836e-05, 1.12803, 
-0.997733, -0.0673053, 0.0673053, 0.997733, 
-0.997732, -0.0673056, 0.0673056, 0.997732, 
-0.997732, -0.0673057, 0.0673057, 0.997732, 
-0.997732, -0.0673057, 0.0673057, 0.997732, 
-1.38612, -0.000587632, 0.0923199, 0.00871101, 
-1.30215, -0.000913243, 0.0872116, 0.0135378, 
-1.27683, -0.00134249, 0.0877927, 0.0199009, 
-4.10426, -0.0027841, 0.288325, 0.0412714, 
-0.988342, -0.00219355, 0.0671929, 0.0325172, 
-3.08448, -0.00457393, 0.189753, 0.067804, 
-1.00825, -0.00341235, 0.0679262, 0.0505849, 
-0.479611, -0.00270958, 0.0352142, 0.0401674, 
-0.995013, -0.00487197, 0.0671415, 0.0722241, 
-0.987641, -0.00568371, 0.066718, 0.0842591, 
-0.470713, -0.00372793, 0.0300893, 0.0552672, 
-1.71874, -0.0109867, 0.117359, 0.162888, 
-0.995509, -0.00867101, 0.0671535, 0.128569, 
-0.994541, -0.00978391, 0.0671008, 0.1451, 
-1.0931, -0.0117525, 0.0722366, 0.174382, 
-0.995481, -0.0122107, 0.067143, 0.181437, 
-0.99545, -0.0134606, 0.0670765, 0.201076, 
-0.995308, -0.0143887, 0.067071, 0.22117, 
-0.995595, -0.0143514, 0.0668883, 0.240818, 
-0.995581, -0.0173997, 0.0671059, 0.261257, 
-0.995624, -0.0191113, 0.0671205, 0.28447, 
-0.995622, -0.0206701, 0.0670955, 0.308759, 
-0.995664, -0.0221848, 0.0670412, 0.333916, 
-0.995703, -0.0234835, 0.0669334, 0.359681, 
-0.995725, -0.0241924, 0.0666598, 0.385539, 
-0.995753, -0.024353, 0.066261, 0.410935, 
-0.995917, -0.0271862, 0.0664338, 0.437156, 
-0.995938, -0.0296026, 0.0664847, 0.464864, 
-0.995945, -0.0301032, 0.0660045, 0.493298, 
-0.99602, -0.0298289, 0.0652426, 0.521093, 
-0.996139, -0.0316402, 0.0650634, 0.549125, 
-0.996165, -0.0339029, 0.064935, 0.577346, 
-0.996338, -0.03333, 0.063852, 0.606092, 
-0.996264, -0.0338902, 0.0630786, 0.634466, 
-0.99641, -0.035312, 0.0625118, 0.66259, 
-0.996449, -0.0348948, 0.061256, 0.690528, 
-0.996611, -0.0351638, 0.0600883, 0.718364, 
-0.996613, -0.0354297, 0.0587845, 0.745239, 
-0.99671, -0.0349519, 0.0572423, 0.772073, 
-0.996873, -0.0345597, 0.0555452, 0.798031, 
-0.996744, -0.0342561, 0.0537764, 0.823167, 
-0.996901, -0.0330843, 0.0515926, 0.8479, 
-0.99691, -0.0324665, 0.0495572, 0.87143, 
-0.997148, -0.030957, 0.0470154, 0.894432, 
-0.997254, -0.0299385, 0.0446035, 0.91618, 
-0.997502, -0.0281385, 0.0418232, 0.93718, 
-0.997598, -0.0268732, 0.039207, 0.957104, 
-0.997863, -0.024718, 0.0361555, 0.975991, 
-0.998018, -0.0233536, 0.0333791, 0.993955, 
-0.998252, -0.0209852, 0.0301758, 1.01082, 
-0.998439, -0.0194309, 0.0273116, 1.02669, 
-0.998777, -0.0169709, 0.023948, 1.04161, 
-0.999023, -0.0152332, 0.0210544, 1.05558, 
-0.999212, -0.0127499, 0.017808, 1.06857, 
-0.999411, -0.010829, 0.0147916, 1.08062, 
-0.99962, -0.00845905, 0.0116308, 1.09187, 
-0.999778, -0.00639379, 0.00867207, 1.10208, 
-0.999852, -0.00414574, 0.0056775, 1.11167, 
-0.999961, -0.00207445, 0.00271849, 1.12025, 
-0.999996, 8.70425e-05, -3.48744e-05, 1.12829, 
-0.995969, -0.0897006, 0.0897006, 0.995969, 
-0.995969, -0.0897008, 0.0897008, 0.995969, 
-0.995969, -0.0897008, 0.0897008, 0.995969, 
-0.995969, -0.0897008, 0.0897008, 0.995969, 
-1.3837, -0.00078316, 0.123433, 0.00869561, 
-1.40738, -0.0012318, 0.126163, 0.0136769, 
-1.24276, -0.00174999, 0.113573, 0.0194306, 
-4.09675, -0.00371047, 0.380445, 0.0411984, 
-0.986584, -0.00292342, 0.0893767, 0.0324597, 
-0.0130948, -0.00123949, 0.00113916, 0.0137626, 
-1.008, -0.00454759, 0.0907778, 0.0504941, 
-0.590547, -0.003955, 0.0538717, 0.0439149, 
-0.992362, -0.00649588, 0.0893452, 0.0721292, 
-1.00226, -0.00761855, 0.089894, 0.0845973, 
-0.10216, -0.00526452, -0.0112995, 0.0584603, 
-0.142566, -0.00520205, 0.0160236, 0.0577703, 
-0.992017, -0.0115351, 0.0893413, 0.128115, 
-0.99189, -0.0130235, 0.0893443, 0.144679, 
-0.992752, -0.0146009, 0.0893233, 0.162288, 
-0.992061, -0.0162422, 0.0893341, 0.180804, 
-0.991705, -0.0178804, 0.0892121, 0.200208, 
-0.992392, -0.0190411, 0.0893468, 0.220382, 
-0.992175, -0.0195582, 0.0890536, 0.240142, 
-0.992181, -0.0227257, 0.0892174, 0.260728, 
-0.992199, -0.0254196, 0.0892992, 0.283474, 
-0.992236, -0.0274886, 0.0892707, 0.307676, 
-0.992336, -0.0294906, 0.0892028, 0.33273, 
-0.992361, -0.0311858, 0.0890433, 0.358383, 
-0.992454, -0.0320652, 0.0886939, 0.384097, 
-0.992538, -0.0329699, 0.0883075, 0.409746, 
-0.992679, -0.0360056, 0.0883621, 0.436141, 
-0.992724, -0.0392902, 0.0884559, 0.463223, 
-0.99291, -0.0399326, 0.0878219, 0.491544, 
-0.99294, -0.0402321, 0.0870075, 0.51953, 
-0.993207, -0.0422042, 0.0865919, 0.547778, 
-0.993247, -0.0443514, 0.0861919, 0.575808, 
-0.993396, -0.0446362, 0.0851018, 0.604224, 
-0.993504, -0.0454326, 0.0840695, 0.632963, 
-0.993792, -0.0463298, 0.0829775, 0.660988, 
-0.993711, -0.0470602, 0.0816732, 0.688689, 
-0.994034, -0.0468886, 0.0799989, 0.716815, 
-0.994163, -0.0467059, 0.0781379, 0.743785, 
-0.994143, -0.0469711, 0.0763535, 0.770443, 
-0.994543, -0.0456784, 0.0737866, 0.796603, 
-0.994467, -0.0455563, 0.0715932, 0.82195, 
-0.994684, -0.0439464, 0.0686476, 0.846524, 
-0.994974, -0.043007, 0.0658803, 0.870465, 
-0.995147, -0.0413408, 0.0626661, 0.893258, 
-0.99547, -0.0396512, 0.0593347, 0.915356, 
-0.995544, -0.0378467, 0.0558068, 0.93623, 
-0.995903, -0.0355239, 0.0520363, 0.956429, 
-0.996185, -0.0335169, 0.0484126, 0.975397, 
-0.996682, -0.0306802, 0.044228, 0.993413, 
-0.996918, -0.0285466, 0.0404585, 1.01039, 
-0.997386, -0.0253394, 0.0360918, 1.02635, 
-0.997757, -0.0231659, 0.0322502, 1.04143, 
-0.998172, -0.0198127, 0.0278123, 1.05536, 
-0.998613, -0.017434, 0.0238761, 1.06848, 
-0.99903, -0.0141365, 0.0196219, 1.08068, 
-0.999153, -0.0115596, 0.0156054, 1.09174, 
-0.999539, -0.00839106, 0.0115141, 1.10219, 
-0.999701, -0.00566577, 0.0075969, 1.11165, 
-0.999898, -0.00269909, 0.00372149, 1.12046, 
-0.999956, 6.2402e-05, -5.96112e-05, 1.12833, 
-0.993701, -0.112062, 0.112062, 0.993701, 
-0.993701, -0.112062, 0.112062, 0.993701, 
-0.993701, -0.112062, 0.112062, 0.993701, 
-0.993701, -0.112062, 0.112062, 0.993701, 
-1.38057, -0.000978395, 0.1545, 0.00867581, 
-1.40419, -0.00153887, 0.157762, 0.0136458, 
-1.2231, -0.00228731, 0.137177, 0.0202826, 
-3.51519, -0.00487921, 0.387534, 0.0432662, 
-1.06272, -0.00371526, 0.120183, 0.0329452, 
-2.72168, -0.00707995, 0.291239, 0.062782, 
-1.00287, -0.00567623, 0.112996, 0.0503352, 
-0.589188, -0.00494086, 0.0671289, 0.0438149, 
-0.989895, -0.00808697, 0.111823, 0.0717161, 
-0.914375, -0.00919342, 0.102955, 0.0815311, 
-0.102212, -0.00656474, -0.00898883, 0.058222, 
-0.861601, -0.0113595, 0.0961572, 0.100754, 
-0.987741, -0.0143828, 0.111405, 0.127587, 
-0.987792, -0.016232, 0.111376, 0.144027, 
-0.982957, -0.0181485, 0.110831, 0.161123, 
-0.987596, -0.0202393, 0.111355, 0.17998, 
-1.00083, -0.0224034, 0.112376, 0.200553, 
-0.987735, -0.0235313, 0.111204, 0.219188, 
-0.987725, -0.0247626, 0.111057, 0.239199, 
-0.987785, -0.0280666, 0.11117, 0.259956, 
-0.987826, -0.0316747, 0.111322, 0.282194, 
-0.987871, -0.034246, 0.111274, 0.306286, 
-0.988015, -0.0367207, 0.111203, 0.33122, 
-0.988097, -0.0387771, 0.111003, 0.356713, 
-0.988295, -0.039776, 0.11055, 0.38227, 
-0.98838, -0.0416053, 0.110207, 0.408204, 
-0.988548, -0.0448195, 0.110134, 0.434665, 
-0.988683, -0.0483791, 0.110133, 0.46144, 
-0.988849, -0.0495868, 0.109445, 0.489291, 
-0.989056, -0.0506824, 0.108631, 0.517543, 
-0.98935, -0.0526987, 0.108019, 0.54588, 
-0.989592, -0.0545795, 0.107257, 0.573838, 
-0.989757, -0.056156, 0.106293, 0.602005, 
-0.99002, -0.0568652, 0.104916, 0.630845, 
-0.990484, -0.0572919, 0.103328, 0.65893, 
-0.990266, -0.0586198, 0.101882, 0.686631, 
-0.990822, -0.0584815, 0.0998101, 0.714611, 
-0.991057, -0.0582701, 0.0974891, 0.74191, 
-0.991272, -0.0584133, 0.0951624, 0.768443, 
-0.991584, -0.0573025, 0.092215, 0.794775, 
-0.991822, -0.0564172, 0.089111, 0.820236, 
-0.992064, -0.0553567, 0.0857953, 0.844867, 
-0.992814, -0.0533871, 0.0820421, 0.869049, 
-0.992859, -0.0518665, 0.0782324, 0.891937, 
-0.99354, -0.0492489, 0.0738907, 0.914181, 
-0.993634, -0.0471966, 0.0696558, 0.935339, 
-0.99423, -0.0442203, 0.0649408, 0.955524, 
-0.99461, -0.0416665, 0.060281, 0.974709, 
-0.995028, -0.0384301, 0.0552923, 0.992774, 
-0.995562, -0.0353505, 0.0503655, 1.01, 
-0.996013, -0.0319772, 0.0452687, 1.02602, 
-0.996719, -0.0284721, 0.0400232, 1.04114, 
-0.997146, -0.02508, 0.0349127, 1.05522, 
-0.997824, -0.021332, 0.0296225, 1.06827, 
-0.998339, -0.0178506, 0.024564, 1.08049, 
-0.998878, -0.0141125, 0.0193926, 1.09183, 
-0.999194, -0.0105915, 0.0144063, 1.10222, 
-0.999514, -0.00693458, 0.00943318, 1.11172, 
-0.99977, -0.00340478, 0.00465102, 1.12055, 
-0.999949, 0.000109168, -9.23634e-05, 1.12853, 
-0.99093, -0.134382, 0.134382, 0.99093, 
-0.99093, -0.134381, 0.134381, 0.99093, 
-0.99093, -0.134381, 0.134381, 0.99093, 
-0.99093, -0.134381, 0.134381, 0.99093, 
-3.92624, -0.00203862, 0.528783, 0.0150329, 
-1.40029, -0.00184536, 0.1893, 0.0136077, 
-1.17289, -0.00246387, 0.158803, 0.0181687, 
-3.50558, -0.00585094, 0.466486, 0.0431455, 
-1.0221, -0.0043136, 0.138043, 0.0318093, 
-0.0130182, -0.00185539, 0.0017259, 0.0136822, 
-1.0007, -0.00680015, 0.13562, 0.0501471, 
-1.04702, -0.00834723, 0.142294, 0.0615576, 
-1.04248, -0.00988533, 0.141345, 0.0729029, 
-0.918158, -0.011272, 0.12711, 0.0831335, 
-0.305523, -0.00744799, 0.0253418, 0.0549342, 
-1.00809, -0.0152368, 0.131719, 0.112393, 
-0.983438, -0.0172012, 0.133302, 0.126903, 
-0.982074, -0.0194077, 0.13319, 0.143222, 
-0.979281, -0.0216963, 0.132852, 0.160211, 
-0.982175, -0.0241948, 0.133169, 0.178983, 
-0.974027, -0.0264613, 0.132066, 0.197284, 
-0.9824, -0.0279166, 0.133008, 0.2178, 
-0.982407, -0.0299659, 0.132869, 0.238038, 
-0.982465, -0.0334557, 0.132925, 0.258911, 
-0.982513, -0.0378636, 0.13314, 0.280638, 
-0.982592, -0.0409268, 0.133092, 0.304599, 
-0.982765, -0.0438522, 0.132991, 0.329376, 
-0.982921, -0.046228, 0.132745, 0.354691, 
-0.983046, -0.0475985, 0.132231, 0.380094, 
-0.983227, -0.0501859, 0.131917, 0.406223, 
-0.983504, -0.0535887, 0.131734, 0.432724, 
-0.983703, -0.0571835, 0.131574, 0.459341, 
-0.983996, -0.0592356, 0.130933, 0.486639, 
-0.984187, -0.0610435, 0.130083, 0.515046, 
-0.984607, -0.0630688, 0.129239, 0.543401, 
-0.985078, -0.0647348, 0.128169, 0.571332, 
-0.985235, -0.0671973, 0.127177, 0.599443, 
-0.98571, -0.0681331, 0.125577, 0.628122, 
-0.986275, -0.0686061, 0.123675, 0.656373, 
-0.986412, -0.0698544, 0.121786, 0.68429, 
-0.98705, -0.0700993, 0.11946, 0.711882, 
-0.987521, -0.0698314, 0.116707, 0.739503, 
-0.98807, -0.0693905, 0.113725, 0.76619, 
-0.988402, -0.0689652, 0.110485, 0.792536, 
-0.98921, -0.0672455, 0.106599, 0.818255, 
-0.989378, -0.0662145, 0.102688, 0.843031, 
-0.990227, -0.0638895, 0.0981929, 0.867146, 
-0.99072, -0.0618608, 0.0935658, 0.890487, 
-0.991183, -0.0593179, 0.0885586, 0.912672, 
-0.991802, -0.0562638, 0.083197, 0.934055, 
-0.992162, -0.0534131, 0.0778254, 0.954337, 
-0.993024, -0.0495458, 0.071985, 0.97372, 
-0.993295, -0.0463728, 0.0663612, 0.991993, 
-0.994238, -0.0421238, 0.0601778, 1.00934, 
-0.994681, -0.0384945, 0.0542523, 1.0255, 
-0.995497, -0.0340958, 0.0479679, 1.04084, 
-0.996096, -0.0301047, 0.0418864, 1.05496, 
-0.996966, -0.0256101, 0.0355971, 1.06826, 
-0.997747, -0.0213925, 0.0294082, 1.08052, 
-0.9983, -0.0169612, 0.0232647, 1.09182, 
-0.998882, -0.0126755, 0.0173295, 1.10219, 
-0.999421, -0.00832496, 0.0113438, 1.11194, 
-0.999761, -0.00410827, 0.00554559, 1.12074, 
-0.999982, 0.000150991, -0.000158672, 1.12883, 
-0.987654, -0.156648, 0.156648, 0.987654, 
-0.987654, -0.156649, 0.156649, 0.987654, 
-0.987654, -0.156649, 0.156649, 0.987654, 
-0.987654, -0.156649, 0.156649, 0.987654, 
-3.91334, -0.00237644, 0.617013, 0.0149832, 
-1.39567, -0.00215114, 0.220767, 0.0135628, 
-1.31237, -0.00317653, 0.207939, 0.0200279, 
-2.59134, -0.00599145, 0.42062, 0.037776, 
-0.246619, -0.00266521, 0.0381247, 0.0168043, 
-0.0128673, -0.00214428, 0.00200029, 0.0135201, 
-0.997369, -0.00791975, 0.158041, 0.0499367, 
-0.985567, -0.00945812, 0.156125, 0.0596386, 
-0.965261, -0.0111622, 0.152953, 0.0703873, 
-0.984079, -0.0131869, 0.15649, 0.0831597, 
-0.10179, -0.00912256, -0.00434067, 0.0575339, 
-1.0056, -0.0180333, 0.159164, 0.113745, 
-0.978941, -0.0199858, 0.155527, 0.126084, 
-0.973317, -0.0225081, 0.154421, 0.142041, 
-0.973397, -0.0252541, 0.154519, 0.15948, 
-0.975808, -0.0280981, 0.154742, 0.177802, 
-0.97598, -0.0308262, 0.154707, 0.19693, 
-0.975872, -0.032481, 0.154521, 0.216303, 
-0.976033, -0.0351284, 0.154413, 0.23663, 
-0.976145, -0.0388619, 0.154456, 0.257539, 
-0.976222, -0.0437704, 0.154666, 0.278975, 
-0.976385, -0.0475146, 0.154657, 0.302609, 
-0.976559, -0.0508624, 0.154534, 0.327196, 
-0.9768, -0.0535011, 0.154234, 0.352286, 
-0.977076, -0.0555569, 0.153755, 0.377711, 
-0.977271, -0.0586726, 0.153398, 0.403854, 
-0.977561, -0.0622689, 0.153112, 0.430315, 
-0.977879, -0.0658131, 0.15275, 0.456831, 
-0.978267, -0.0689876, 0.152226, 0.483667, 
-0.978622, -0.0712842, 0.151336, 0.512124, 
-0.979193, -0.0732793, 0.15025, 0.540468, 
-0.979735, -0.0751619, 0.148972, 0.568478, 
-0.980069, -0.0778096, 0.147768, 0.596578, 
-0.980743, -0.0791819, 0.146032, 0.624798, 
-0.981577, -0.0799634, 0.143902, 0.653377, 
-0.982046, -0.0808511, 0.14159, 0.681427, 
-0.982729, -0.0816, 0.138971, 0.708897, 
-0.98372, -0.0812503, 0.135782, 0.736586, 
-0.984285, -0.0806105, 0.132227, 0.763486, 
-0.985036, -0.0801577, 0.128504, 0.78977, 
-0.98608, -0.078414, 0.124051, 0.815733, 
-0.986675, -0.0766559, 0.119303, 0.840777, 
-0.987527, -0.0747698, 0.114341, 0.864899, 
-0.988642, -0.0716805, 0.108693, 0.88856, 
-0.988852, -0.0691534, 0.102981, 0.910863, 
-0.990122, -0.0654026, 0.0967947, 0.932597, 
-0.990471, -0.0619723, 0.0904307, 0.953066, 
-0.991177, -0.0579292, 0.0838636, 0.972581, 
-0.991864, -0.0536566, 0.0770491, 0.991166, 
-0.992446, -0.0493611, 0.0700707, 1.00841, 
-0.993367, -0.0444815, 0.0629299, 1.02494, 
-0.994037, -0.0400148, 0.0559769, 1.04034, 
-0.995058, -0.0348005, 0.0486421, 1.0547, 
-0.995911, -0.0301008, 0.0415104, 1.06804, 
-0.99687, -0.0248228, 0.0342734, 1.0804, 
-0.997813, -0.0199238, 0.0272226, 1.09181, 
-0.998495, -0.0147422, 0.0201047, 1.10235, 
-0.999183, -0.0098014, 0.0132453, 1.11202, 
-0.999719, -0.00474263, 0.00646941, 1.12105, 
-0.999962, 8.91692e-05, -5.75168e-05, 1.12909, 
-0.983875, -0.178856, 0.178856, 0.983875, 
-0.983875, -0.178857, 0.178857, 0.983875, 
-0.983875, -0.178857, 0.178857, 0.983875, 
-0.983875, -0.178857, 0.178857, 0.983875, 
-3.89845, -0.00271335, 0.705008, 0.0149259, 
-1.39035, -0.00245611, 0.25215, 0.0135109, 
-1.27328, -0.00352189, 0.2313, 0.0193737, 
-1.43603, -0.00487503, 0.253734, 0.0268176, 
-0.36809, -0.00292422, 0.0666133, 0.0160864, 
-0.0127936, -0.00244339, 0.00228511, 0.0134417, 
-0.972176, -0.0089037, 0.176373, 0.0489829, 
-1.47415, -0.0148014, 0.263753, 0.0814321, 
-0.976685, -0.0128166, 0.177543, 0.0705165, 
-0.525745, -0.0120897, 0.0745714, 0.0665226, 
-0.103989, -0.010465, -0.00196559, 0.0575885, 
-0.903898, -0.0190846, 0.16146, 0.105038, 
-0.966, -0.0226818, 0.175638, 0.124863, 
-1.11101, -0.0280711, 0.198371, 0.154586, 
-0.968229, -0.0287294, 0.175974, 0.158333, 
-0.96842, -0.031941, 0.176006, 0.176447, 
-0.968547, -0.0349417, 0.175964, 0.195363, 
-0.968653, -0.0370816, 0.175798, 0.214688, 
-0.968805, -0.0402331, 0.175709, 0.234974, 
-0.968884, -0.0442603, 0.175707, 0.255872, 
-0.969033, -0.0493987, 0.175881, 0.277242, 
-0.969184, -0.0539906, 0.175925, 0.300312, 
-0.969439, -0.0577301, 0.175788, 0.324703, 
-0.969787, -0.0605657, 0.175432, 0.349535, 
-0.970092, -0.0634477, 0.174982, 0.37497, 
-0.97035, -0.0670564, 0.174605, 0.401082, 
-0.970708, -0.0708198, 0.174214, 0.427467, 
-0.971253, -0.0742872, 0.173693, 0.453859, 
-0.971689, -0.0782612, 0.173182, 0.48064, 
-0.972163, -0.0813147, 0.172299, 0.508653, 
-0.973034, -0.0832709, 0.171007, 0.536993, 
-0.973703, -0.0856043, 0.169623, 0.56519, 
-0.974261, -0.0882225, 0.168169, 0.593264, 
-0.975377, -0.0901738, 0.166368, 0.621247, 
-0.976233, -0.0912075, 0.163975, 0.649894, 
-0.977355, -0.0917036, 0.161136, 0.678068, 
-0.978117, -0.0927036, 0.158242, 0.705697, 
-0.979645, -0.0925577, 0.154772, 0.733239, 
-0.980435, -0.0918166, 0.150626, 0.760461, 
-0.981818, -0.0908565, 0.146202, 0.786967, 
-0.982978, -0.0896034, 0.141407, 0.812828, 
-0.984119, -0.0871687, 0.135864, 0.838375, 
-0.984887, -0.0850519, 0.130109, 0.862488, 
-0.986294, -0.0818629, 0.123863, 0.886426, 
-0.987088, -0.0784594, 0.117122, 0.909034, 
-0.988, -0.0749627, 0.110337, 0.930776, 
-0.988832, -0.0703417, 0.102758, 0.95155, 
-0.989566, -0.0662917, 0.0955262, 0.97134, 
-0.990371, -0.0610862, 0.0876089, 0.990029, 
-0.990899, -0.0562887, 0.0798681, 1.00756, 
-0.991848, -0.0508125, 0.0717589, 1.02428, 
-0.992834, -0.0454039, 0.0636384, 1.03974, 
-0.993701, -0.0398262, 0.055628, 1.05436, 
-0.994869, -0.0341494, 0.0473045, 1.06775, 
-0.995936, -0.0284287, 0.0390671, 1.0803, 
-0.997084, -0.0226411, 0.0310332, 1.09181, 
-0.998053, -0.0168746, 0.0229605, 1.10252, 
-0.998965, -0.0111273, 0.0150707, 1.11228, 
-0.999578, -0.00543886, 0.00737492, 1.12132, 
-1.00003, 0.000162274, -0.000127403, 1.12947, 
-0.979592, -0.200996, 0.200996, 0.979592, 
-0.979592, -0.200997, 0.200997, 0.979592, 
-0.979592, -0.200997, 0.200997, 0.979592, 
-0.979592, -0.200997, 0.200997, 0.979592, 
-3.88156, -0.00304922, 0.792735, 0.0148609, 
-1.23667, -0.00273455, 0.253062, 0.0133274, 
-0.00445264, -0.000955738, 0.000918677, 0.00465802, 
-0.814987, -0.00467023, 0.180683, 0.0227618, 
-1.00361, -0.00649311, 0.20571, 0.0316468, 
-0.0126437, -0.00272451, 0.00255196, 0.0132794, 
-0.967346, -0.00999779, 0.198335, 0.0487317, 
-0.37155, -0.00722059, 0.0715488, 0.0351968, 
-0.394484, -0.00884835, 0.0852346, 0.0431346, 
-0.769715, -0.0165426, 0.139417, 0.0806509, 
-0.978008, -0.0195967, 0.199563, 0.0955528, 
-1.24713, -0.0244784, 0.251886, 0.119377, 
-0.956269, -0.0253486, 0.196283, 0.123652, 
-0.963402, -0.0286728, 0.197687, 0.139925, 
-0.959885, -0.0320451, 0.19679, 0.156518, 
-0.960067, -0.035712, 0.196934, 0.174914, 
-0.960245, -0.0389038, 0.196898, 0.193584, 
-0.960505, -0.0416154, 0.196816, 0.212811, 
-0.96057, -0.0452658, 0.196657, 0.233077, 
-0.960702, -0.0496205, 0.196638, 0.25394, 
-0.960889, -0.0549388, 0.196766, 0.275282, 
-0.961097, -0.0603406, 0.196884, 0.297729, 
-0.961402, -0.064425, 0.196713, 0.32188, 
-0.96185, -0.0675547, 0.196316, 0.346469, 
-0.962214, -0.0712721, 0.19593, 0.371913, 
-0.962545, -0.075288, 0.195501, 0.397933, 
-0.963141, -0.0792079, 0.195034, 0.424232, 
-0.963742, -0.0828093, 0.194375, 0.450566, 
-0.964267, -0.0873106, 0.193832, 0.477281, 
-0.964954, -0.0911101, 0.192954, 0.504744, 
-0.966054, -0.0932489, 0.191544, 0.533042, 
-0.966947, -0.0958929, 0.190033, 0.561334, 
-0.967976, -0.0983522, 0.188235, 0.589477, 
-0.969127, -0.100755, 0.186305, 0.617437, 
-0.970566, -0.10224, 0.1838, 0.645808, 
-0.972073, -0.102765, 0.180649, 0.674268, 
-0.973569, -0.103522, 0.177264, 0.702208, 
-0.975138, -0.103788, 0.173521, 0.729493, 
-0.976701, -0.10288, 0.168935, 0.757011, 
-0.978002, -0.10167, 0.163811, 0.783669, 
-0.9797, -0.100293, 0.158355, 0.8095, 
-0.981275, -0.0978272, 0.152377, 0.835326, 
-0.982657, -0.0949898, 0.145723, 0.859984, 
-0.984152, -0.0920988, 0.138752, 0.883751, 
-0.984879, -0.0878594, 0.131128, 0.906801, 
-0.985859, -0.0839258, 0.123381, 0.92864, 
-0.987221, -0.0791301, 0.115352, 0.949911, 
-0.987932, -0.0739544, 0.106908, 0.969898, 
-0.989064, -0.0688215, 0.0984257, 0.988792, 
-0.989556, -0.062892, 0.0894, 1.0066, 
-0.990424, -0.0573108, 0.0806193, 1.02337, 
-0.991502, -0.0509393, 0.0713852, 1.03925, 
-0.99251, -0.044873, 0.0623162, 1.05379, 
-0.993714, -0.0383528, 0.0530732, 1.06756, 
-0.994988, -0.03196, 0.0438893, 1.08009, 
-0.996404, -0.0254024, 0.0348131, 1.09188, 
-0.997623, -0.0189695, 0.0258426, 1.10254, 
-0.998655, -0.0124436, 0.0169379, 1.11243, 
-0.999391, -0.00613992, 0.00833113, 1.12149, 
-1.00003, 0.000216604, -0.000131922, 1.12993, 
-0.974805, -0.223061, 0.223061, 0.974805, 
-0.974805, -0.22306, 0.22306, 0.974805, 
-0.974805, -0.22306, 0.22306, 0.974805, 
-0.974805, -0.22306, 0.22306, 0.974805, 
-2.47267, -0.00250532, 0.566556, 0.0109487, 
-3.39062, -0.00479798, 0.762812, 0.0209681, 
-2.8422, -0.00656406, 0.660206, 0.0286865, 
-4.81876, -0.0110108, 1.10469, 0.0481207, 
-0.998708, -0.00720577, 0.228311, 0.0314922, 
-0.0125301, -0.00301302, 0.00283018, 0.0131686, 
-0.953892, -0.0109815, 0.218379, 0.0479978, 
-0.77225, -0.0117679, 0.170343, 0.0514386, 
-0.953367, -0.0158015, 0.218295, 0.0690761, 
-0.994323, -0.0190079, 0.229394, 0.0831024, 
-0.910439, -0.021123, 0.209259, 0.0923642, 
-0.947579, -0.0244311, 0.218067, 0.106851, 
-0.948662, -0.0280057, 0.216915, 0.122521, 
-0.958191, -0.0317656, 0.219692, 0.139036, 
-0.933383, -0.035102, 0.21385, 0.153791, 
-0.950855, -0.0394006, 0.217507, 0.17321, 
-0.951018, -0.0426823, 0.21742, 0.19161, 
-0.951231, -0.04613, 0.217315, 0.210839, 
-0.951017, -0.0502015, 0.217141, 0.230892, 
-0.9516, -0.0549187, 0.217212, 0.251746, 
-0.951858, -0.060449, 0.217303, 0.273, 
-0.952118, -0.066522, 0.217471, 0.294887, 
-0.95247, -0.0709174, 0.217274, 0.318729, 
-0.952936, -0.0746092, 0.216884, 0.343171, 
-0.953362, -0.0789194, 0.216503, 0.368463, 
-0.953913, -0.0833302, 0.216064, 0.394378, 
-0.95461, -0.0873723, 0.215474, 0.420512, 
-0.955376, -0.0913992, 0.214782, 0.446877, 
-0.95617, -0.0961713, 0.21415, 0.473543, 
-0.957069, -0.100475, 0.213274, 0.500493, 
-0.958417, -0.103258, 0.211856, 0.528765, 
-0.959599, -0.106032, 0.210124, 0.557056, 
-0.961277, -0.108379, 0.208139, 0.58526, 
-0.96269, -0.111125, 0.205957, 0.613352, 
-0.964823, -0.112986, 0.203377, 0.641366, 
-0.966596, -0.11372, 0.199945, 0.669976, 
-0.968594, -0.114123, 0.196124, 0.698108, 
-0.970519, -0.114515, 0.191976, 0.725585, 
-0.973038, -0.113809, 0.18702, 0.752963, 
-0.974583, -0.112419, 0.181332, 0.780106, 
-0.976885, -0.110708, 0.175217, 0.806437, 
-0.978554, -0.108447, 0.168487, 0.831914, 
-0.980083, -0.105051, 0.161204, 0.857069, 
-0.981815, -0.101645, 0.153403, 0.880888, 
-0.982947, -0.0974468, 0.145121, 0.904233, 
-0.984308, -0.0925756, 0.136461, 0.926628, 
-0.985481, -0.0877935, 0.127491, 0.947849, 
-0.98616, -0.0818804, 0.118154, 0.968068, 
-0.987284, -0.0761229, 0.108741, 0.987217, 
-0.988183, -0.069813, 0.0989092, 1.0055, 
-0.988965, -0.0632732, 0.0890573, 1.02244, 
-0.990177, -0.0565253, 0.0791237, 1.03847, 
-0.991292, -0.049526, 0.0689656, 1.05345, 
-0.992561, -0.0425338, 0.0588465, 1.06715, 
-0.993922, -0.0353172, 0.048729, 1.08001, 
-0.995574, -0.0282369, 0.0386063, 1.09184, 
-0.997061, -0.0209513, 0.0285804, 1.10275, 
-0.998261, -0.0139296, 0.0188417, 1.11267, 
-0.999287, -0.00673617, 0.00922882, 1.12195, 
-1.00003, 0.000141878, -8.47915e-05, 1.1303, 
-0.969514, -0.245037, 0.245037, 0.969514, 
-0.969514, -0.245037, 0.245037, 0.969514, 
-0.969514, -0.245037, 0.245037, 0.969514, 
-0.969514, -0.245037, 0.245037, 0.969514, 
-3.57645, -0.00348245, 0.90598, 0.0137787, 
-3.37251, -0.0052707, 0.839255, 0.0208543, 
-0.00438312, -0.00115927, 0.00111051, 0.0045869, 
-4.80307, -0.0121266, 1.2154, 0.0479822, 
-0.905003, -0.00755301, 0.228361, 0.0298864, 
-0.0124707, -0.00331141, 0.00311263, 0.0131035, 
-0.922371, -0.0115939, 0.232764, 0.0458806, 
-0.314618, -0.00839644, 0.0787259, 0.0332301, 
-0.933121, -0.0171561, 0.235574, 0.0679052, 
-0.944614, -0.0203388, 0.239585, 0.080514, 
-0.955153, -0.02367, 0.244034, 0.0937182, 
-1.03159, -0.0287967, 0.273882, 0.114045, 
-0.941507, -0.0307239, 0.237913, 0.121718, 
-0.93846, -0.0346022, 0.236908, 0.137156, 
-0.939007, -0.0386756, 0.237223, 0.153479, 
-0.9407, -0.0429906, 0.237662, 0.17133, 
-0.940892, -0.0465082, 0.237567, 0.189499, 
-0.941123, -0.0505326, 0.237482, 0.208623, 
-0.941381, -0.0550666, 0.237426, 0.228599, 
-0.941637, -0.0601341, 0.237394, 0.249289, 
-0.941952, -0.0658815, 0.237455, 0.270471, 
-0.94219, -0.072266, 0.237589, 0.292018, 
-0.942626, -0.0771783, 0.237413, 0.31527, 
-0.943159, -0.0815609, 0.237065, 0.339573, 
-0.943688, -0.0863953, 0.236683, 0.364708, 
-0.944364, -0.0911545, 0.236208, 0.390439, 
-0.945426, -0.0953002, 0.235575, 0.41644, 
-0.946225, -0.0998982, 0.234836, 0.442787, 
-0.947224, -0.104799, 0.234121, 0.469358, 
-0.948695, -0.109278, 0.233181, 0.496153, 
-0.950077, -0.113072, 0.231815, 0.523931, 
-0.951825, -0.115883, 0.229991, 0.55225, 
-0.953926, -0.11846, 0.227816, 0.580572, 
-0.95576, -0.121162, 0.225425, 0.608761, 
-0.958294, -0.123388, 0.222625, 0.636772, 
-0.960579, -0.124519, 0.219003, 0.665207, 
-0.963331, -0.124756, 0.214762, 0.69367, 
-0.965781, -0.12501, 0.210086, 0.721328, 
-0.968885, -0.124674, 0.204787, 0.748693, 
-0.971209, -0.122986, 0.198514, 0.776165, 
-0.973532, -0.121, 0.191698, 0.802476, 
-0.97662, -0.118588, 0.184462, 0.828436, 
-0.978087, -0.115095, 0.176344, 0.853642, 
-0.979623, -0.111082, 0.167728, 0.878004, 
-0.981707, -0.106868, 0.158837, 0.901466, 
-0.982376, -0.1015, 0.149128, 0.924347, 
-0.983865, -0.0959931, 0.139392, 0.945671, 
-0.985096, -0.089974, 0.129348, 0.966395, 
-0.985654, -0.0832963, 0.118965, 0.985728, 
-0.987003, -0.076716, 0.108269, 1.00417, 
-0.987653, -0.0693562, 0.0974753, 1.02146, 
-0.98892, -0.0621192, 0.0866366, 1.03772, 
-0.990102, -0.0544149, 0.0756835, 1.05297, 
-0.991293, -0.0467471, 0.0645918, 1.0669, 
-0.992868, -0.0387912, 0.0534882, 1.07975, 
-0.994655, -0.030973, 0.0423856, 1.09181, 
-0.99647, -0.0230309, 0.0313777, 1.10285, 
-0.997968, -0.0152064, 0.0206577, 1.1129, 
-0.999156, -0.00744736, 0.0101683, 1.12222, 
-1.00005, 0.000240202, -9.77279e-05, 1.13082, 
-0.963719, -0.26692, 0.26692, 0.963719, 
-0.963719, -0.266919, 0.266919, 0.963719, 
-0.963719, -0.266919, 0.266919, 0.963719, 
-0.963719, -0.266919, 0.266919, 0.963719, 
-3.16315, -0.00337925, 0.878063, 0.0122009, 
-3.35265, -0.00574138, 0.915376, 0.0207297, 
-1.90711, -0.00654622, 0.522232, 0.023636, 
-4.77433, -0.0132094, 1.32379, 0.0476955, 
-0.0540409, -0.00247683, 0.0170711, 0.00894345, 
-0.012304, -0.00357652, 0.00336117, 0.0129149, 
-0.928567, -0.0129596, 0.25718, 0.046801, 
-0.807878, -0.014766, 0.224977, 0.0533295, 
-0.93021, -0.0186609, 0.257514, 0.0674057, 
-0.922878, -0.0218856, 0.255663, 0.079067, 
-0.939177, -0.0256035, 0.260218, 0.0925191, 
-0.912914, -0.0290703, 0.253064, 0.105076, 
-1.00452, -0.0348998, 0.278548, 0.126197, 
-0.925741, -0.037378, 0.256172, 0.135241, 
-0.882953, -0.0404509, 0.244503, 0.146556, 
-0.92967, -0.0464639, 0.257371, 0.169285, 
-0.929855, -0.050343, 0.257269, 0.187258, 
-0.930119, -0.0548416, 0.257206, 0.206207, 
-0.930118, -0.0598054, 0.257087, 0.226007, 
-0.930689, -0.065241, 0.257114, 0.24655, 
-0.931064, -0.0712368, 0.257142, 0.267615, 
-0.931439, -0.0777516, 0.257249, 0.288997, 
-0.93199, -0.0832401, 0.257137, 0.311537, 
-0.932575, -0.088395, 0.256831, 0.335696, 
-0.933191, -0.0937019, 0.256445, 0.360628, 
-0.934104, -0.0987307, 0.255964, 0.386132, 
-0.935382, -0.103215, 0.255317, 0.412018, 
-0.936399, -0.108232, 0.254558, 0.438285, 
-0.937715, -0.113235, 0.253724, 0.464807, 
-0.939632, -0.118015, 0.252792, 0.491473, 
-0.941134, -0.122668, 0.251472, 0.518781, 
-0.943384, -0.125487, 0.249457, 0.547176, 
-0.945366, -0.128386, 0.247152, 0.575509, 
-0.948054, -0.130996, 0.244523, 0.603721, 
-0.950914, -0.133466, 0.241516, 0.631869, 
-0.954365, -0.135002, 0.237913, 0.659963, 
-0.957019, -0.135337, 0.233107, 0.6886, 
-0.960717, -0.135217, 0.22794, 0.716803, 
-0.963977, -0.134977, 0.222189, 0.744181, 
-0.967372, -0.133525, 0.215466, 0.771799, 
-0.969928, -0.131156, 0.207958, 0.798643, 
-0.973313, -0.128489, 0.200197, 0.824758, 
-0.976143, -0.125096, 0.191279, 0.850234, 
-0.97774, -0.120587, 0.182026, 0.874828, 
-0.980281, -0.1159, 0.172364, 0.898635, 
-0.981283, -0.110357, 0.16188, 0.921514, 
-0.981922, -0.104107, 0.151121, 0.943079, 
-0.983981, -0.0978431, 0.14026, 0.964344, 
-0.984451, -0.0906258, 0.129054, 0.984074, 
-0.98525, -0.0832894, 0.117579, 1.00273, 
-0.986407, -0.0754227, 0.105858, 1.02022, 
-0.987463, -0.0673996, 0.0939976, 1.03695, 
-0.988682, -0.0592499, 0.0822206, 1.05206, 
-0.99032, -0.050724, 0.0701195, 1.06667, 
-0.991953, -0.0423452, 0.058202, 1.07956, 
-0.993768, -0.0336097, 0.0460367, 1.09181, 
-0.995759, -0.0252148, 0.0343058, 1.10294, 
-0.997629, -0.0164897, 0.0225678, 1.11327, 
-0.999003, -0.00817136, 0.0110999, 1.12265, 
-1.00004, 0.000291697, -0.000149217, 1.13142, 
-0.95742, -0.288699, 0.288699, 0.95742, 
-0.95742, -0.288699, 0.288699, 0.95742, 
-0.95742, -0.288699, 0.288699, 0.95742, 
-0.95742, -0.288698, 0.288698, 0.95742, 
-0.673003, -0.00188715, 0.203361, 0.00625844, 
-3.33104, -0.00620984, 0.991143, 0.0205942, 
-1.89478, -0.00708034, 0.565331, 0.0234815, 
-3.18072, -0.0114419, 0.95047, 0.0379474, 
-0.0413301, -0.00278486, 0.010312, 0.00923647, 
-0.0121937, -0.00386109, 0.00363609, 0.0128068, 
-0.916829, -0.0139292, 0.276453, 0.0462057, 
-0.477724, -0.0120558, 0.147156, 0.0399957, 
-0.915571, -0.020029, 0.275952, 0.0664578, 
-1.30669, -0.0303861, 0.37214, 0.100843, 
-0.918568, -0.0274086, 0.27974, 0.090985, 
-0.890666, -0.0313203, 0.268525, 0.104004, 
-0.890336, -0.0352896, 0.267866, 0.117238, 
-0.917271, -0.0402268, 0.276537, 0.133735, 
-0.914586, -0.0449438, 0.275317, 0.149655, 
-0.917639, -0.0497908, 0.276549, 0.16707, 
-0.917945, -0.0540933, 0.276491, 0.184845, 
-0.918227, -0.0590689, 0.276443, 0.203607, 
-0.918538, -0.0644232, 0.276391, 0.223197, 
-0.918938, -0.0702334, 0.276371, 0.243587, 
-0.919336, -0.0764816, 0.276377, 0.264456, 
-0.919785, -0.0830782, 0.276423, 0.285692, 
-0.920453, -0.0892973, 0.276402, 0.30756, 
-0.921098, -0.095016, 0.276124, 0.331501, 
-0.921908, -0.100773, 0.275757, 0.356217, 
-0.923013, -0.106028, 0.275243, 0.381475, 
-0.924508, -0.111033, 0.274622, 0.407236, 
-0.92585, -0.116344, 0.273866, 0.43338, 
-0.927382, -0.121413, 0.272901, 0.459804, 
-0.929066, -0.126559, 0.271811, 0.486453, 
-0.931382, -0.131582, 0.270533, 0.513433, 
-0.933931, -0.135037, 0.268567, 0.541496, 
-0.93665, -0.138129, 0.266182, 0.570031, 
-0.939818, -0.140669, 0.263223, 0.598296, 
-0.943413, -0.143227, 0.260027, 0.626479, 
-0.947864, -0.14512, 0.256137, 0.654645, 
-0.951467, -0.145759, 0.251314, 0.683408, 
-0.955217, -0.145535, 0.245529, 0.711738, 
-0.959493, -0.145013, 0.239199, 0.739599, 
-0.963105, -0.143975, 0.23218, 0.766876, 
-0.96669, -0.141282, 0.223963, 0.794315, 
-0.969889, -0.138266, 0.21528, 0.820474, 
-0.972967, -0.13473, 0.205808, 0.846197, 
-0.97564, -0.129973, 0.195895, 0.871588, 
-0.978119, -0.124753, 0.185385, 0.895617, 
-0.980376, -0.119097, 0.174195, 0.918487, 
-0.980984, -0.112323, 0.162839, 0.940899, 
-0.982119, -0.105359, 0.151122, 0.961871, 
-0.983291, -0.0978415, 0.139002, 0.98212, 
-0.984078, -0.089749, 0.126501, 1.00137, 
-0.985162, -0.0816054, 0.114222, 1.01912, 
-0.986174, -0.0727674, 0.101466, 1.03597, 
-0.987221, -0.0639281, 0.0886399, 1.05142, 
-0.989057, -0.0548042, 0.0757617, 1.06606, 
-0.990691, -0.045688, 0.0628492, 1.0795, 
-0.992878, -0.0364345, 0.0498167, 1.0918, 
-0.995089, -0.0271726, 0.0370712, 1.10316, 
-0.997142, -0.0179604, 0.0243364, 1.1135, 
-0.998763, -0.00877989, 0.0119735, 1.12309, 
-0.999974, 0.000259058, -9.57369e-05, 1.13188, 
-0.950618, -0.310365, 0.310365, 0.950618, 
-0.950617, -0.310366, 0.310366, 0.950617, 
-0.950617, -0.310365, 0.310365, 0.950617, 
-0.950617, -0.310365, 0.310365, 0.950617, 
-0.668211, -0.00202877, 0.21859, 0.00621398, 
-3.30767, -0.00667588, 1.06653, 0.0204479, 
-1.88146, -0.00761167, 0.608206, 0.0233147, 
-2.21998, -0.0102628, 0.721628, 0.031436, 
-0.329477, -0.009658, 0.090666, 0.0295851, 
-0.0119424, -0.00409291, 0.00385578, 0.0125386, 
-0.868209, -0.0145414, 0.283847, 0.0445519, 
-0.0171289, -0.00723628, 0.00558523, 0.0221736, 
-0.641613, -0.0161002, 0.207351, 0.0493435, 
-1.66555, -0.0384188, 0.543105, 0.117772, 
-0.915238, -0.0295311, 0.298565, 0.090554, 
-0.811463, -0.0309936, 0.266049, 0.095075, 
-0.877002, -0.0366884, 0.286982, 0.112602, 
-0.90445, -0.0429264, 0.295218, 0.131855, 
-0.90621, -0.0480116, 0.295812, 0.147761, 
-0.906476, -0.0529655, 0.295779, 0.164797, 
-0.905151, -0.0577753, 0.29518, 0.182276, 
-0.905609, -0.0631851, 0.295181, 0.200856, 
-0.905832, -0.0689163, 0.295102, 0.220198, 
-0.906305, -0.0750867, 0.295097, 0.240373, 
-0.90677, -0.0815869, 0.295085, 0.261086, 
-0.907351, -0.0882142, 0.295096, 0.282124, 
-0.908045, -0.0950799, 0.295124, 0.303556, 
-0.908883, -0.101488, 0.294936, 0.327031, 
-0.909847, -0.107579, 0.294582, 0.35147, 
-0.911394, -0.113035, 0.294103, 0.376501, 
-0.912762, -0.118626, 0.293436, 0.402105, 
-0.914161, -0.124239, 0.292584, 0.428137, 
-0.916383, -0.129408, 0.291658, 0.454474, 
-0.918151, -0.134891, 0.290413, 0.48102, 
-0.921185, -0.140071, 0.289168, 0.507933, 
-0.924542, -0.144426, 0.287408, 0.535542, 
-0.927976, -0.147499, 0.284879, 0.56399, 
-0.931866, -0.150248, 0.281801, 0.5925, 
-0.935955, -0.152726, 0.27829, 0.62089, 
-0.941034, -0.154838, 0.274179, 0.649075, 
-0.946064, -0.155939, 0.269003, 0.677862, 
-0.949813, -0.155674, 0.262877, 0.706443, 
-0.954787, -0.154791, 0.256084, 0.73419, 
-0.959349, -0.153697, 0.248589, 0.761846, 
-0.962573, -0.151244, 0.239908, 0.788988, 
-0.966309, -0.147757, 0.230467, 0.816146, 
-0.970144, -0.144019, 0.220568, 0.842107, 
-0.972548, -0.139458, 0.209826, 0.867412, 
-0.97518, -0.133417, 0.19814, 0.891727, 
-0.978403, -0.127432, 0.186462, 0.915517, 
-0.980049, -0.120518, 0.174249, 0.938037, 
-0.980641, -0.112794, 0.161443, 0.959513, 
-0.982113, -0.104931, 0.148785, 0.98003, 
-0.983018, -0.0963133, 0.135544, 0.9997, 
-0.983573, -0.0873746, 0.122052, 1.0177, 
-0.984952, -0.0783368, 0.10864, 1.03481, 
-0.986144, -0.068484, 0.0948795, 1.05094, 
-0.987549, -0.0590838, 0.0813354, 1.06555, 
-0.989758, -0.0489168, 0.0673884, 1.07946, 
-0.991784, -0.0391004, 0.0534872, 1.09175, 
-0.994399, -0.0290862, 0.0397064, 1.10338, 
-0.996771, -0.0191145, 0.0260796, 1.11387, 
-0.998659, -0.00947009, 0.0128405, 1.1237, 
-0.999949, 0.000446284, -0.000209916, 1.13249, 
-0.94331, -0.331912, 0.331912, 0.94331, 
-0.943311, -0.331911, 0.331911, 0.943311, 
-0.943311, -0.331911, 0.331911, 0.943311, 
-0.943311, -0.331911, 0.331911, 0.943311, 
-0.663066, -0.00216961, 0.233735, 0.00616622, 
-2.92312, -0.00636198, 1.02204, 0.0180815, 
-2.15842, -0.00775174, 0.753608, 0.0220319, 
-2.88699, -0.0129403, 1.02621, 0.0367801, 
-0.00892016, -0.00327575, 0.00315537, 0.00931121, 
-0.0118146, -0.00436069, 0.00410947, 0.0123961, 
-0.848249, -0.0154132, 0.298281, 0.0438203, 
-0.359296, -0.0111399, 0.129218, 0.0316761, 
-0.786033, -0.0202245, 0.27489, 0.05752, 
-0.731955, -0.0237506, 0.260672, 0.0675668, 
-0.877478, -0.0307328, 0.3081, 0.0874596, 
-0.333306, -0.0190914, 0.101548, 0.0543542, 
-0.887825, -0.0404171, 0.312901, 0.115137, 
-0.890674, -0.0455358, 0.313272, 0.129841, 
-0.893188, -0.0510389, 0.314076, 0.145886, 
-0.891145, -0.0559645, 0.31331, 0.162119, 
-0.891494, -0.0613127, 0.313298, 0.179525, 
-0.891921, -0.0671506, 0.313297, 0.197861, 
-0.892286, -0.0732714, 0.313261, 0.216986, 
-0.892819, -0.0797858, 0.313262, 0.236922, 
-0.893417, -0.0865291, 0.313262, 0.25744, 
-0.894074, -0.0931607, 0.313212, 0.27822, 
-0.894904, -0.100533, 0.313281, 0.29947, 
-0.895832, -0.107715, 0.313203, 0.322272, 
-0.897027, -0.114099, 0.312862, 0.34642, 
-0.898422, -0.119933, 0.312324, 0.371162, 
-0.900022, -0.126032, 0.311671, 0.396616, 
-0.901904, -0.131812, 0.310869, 0.422501, 
-0.904331, -0.137284, 0.309889, 0.448726, 
-0.906892, -0.14298, 0.308728, 0.475205, 
-0.910751, -0.14828, 0.307509, 0.502075, 
-0.914496, -0.15333, 0.305761, 0.529244, 
-0.91894, -0.156631, 0.303182, 0.557655, 
-0.923338, -0.159633, 0.299935, 0.586342, 
-0.928893, -0.162024, 0.296247, 0.614915, 
-0.934285, -0.164198, 0.291898, 0.643167, 
-0.939836, -0.165628, 0.286663, 0.671706, 
-0.944603, -0.165445, 0.280131, 0.700472, 
-0.949286, -0.164449, 0.272777, 0.728475, 
-0.954448, -0.162963, 0.264934, 0.756129, 
-0.958182, -0.160965, 0.255654, 0.783482, 
-0.96204, -0.157227, 0.245584, 0.810686, 
-0.967143, -0.152888, 0.235118, 0.837087, 
-0.969713, -0.148222, 0.223444, 0.862758, 
-0.972007, -0.142179, 0.211193, 0.887651, 
-0.976095, -0.135464, 0.198714, 0.911884, 
-0.978213, -0.12841, 0.185459, 0.934881, 
-0.979739, -0.120319, 0.171921, 0.956832, 
-0.980986, -0.111639, 0.158192, 0.977859, 
-0.981269, -0.103008, 0.144153, 0.997428, 
-0.982431, -0.0930397, 0.129992, 1.01649, 
-0.983291, -0.0834514, 0.115785, 1.03352, 
-0.985101, -0.0732218, 0.101199, 1.05009, 
-0.986335, -0.062812, 0.0865507, 1.06503, 
-0.988408, -0.0526557, 0.0719811, 1.07907, 
-0.991028, -0.0415707, 0.0571147, 1.0918, 
-0.993548, -0.0314249, 0.0426611, 1.1036, 
-0.99629, -0.0203605, 0.0279317, 1.11424, 
-0.998482, -0.0102455, 0.0138548, 1.12431, 
-1.00001, 0.000426133, -0.00021695, 1.1333, 
-0.9355, -0.353327, 0.353327, 0.9355, 
-0.9355, -0.353327, 0.353327, 0.9355, 
-0.9355, -0.353327, 0.353327, 0.9355, 
-0.9355, -0.353325, 0.353325, 0.9355, 
-0.606989, -0.00220823, 0.228674, 0.00584679, 
-2.89907, -0.00677245, 1.0884, 0.0179318, 
-1.41346, -0.00709712, 0.531684, 0.018792, 
-0.00607631, -0.00239346, 0.00230491, 0.00633774, 
-0.866003, -0.0105639, 0.327431, 0.0279746, 
-0.01165, -0.00461917, 0.00435885, 0.0122334, 
-0.875323, -0.0166551, 0.330572, 0.0441152, 
-0.100578, -0.0104817, 0.0279064, 0.0277685, 
-0.858355, -0.0237337, 0.323982, 0.0628908, 
-1.0388, -0.032073, 0.39732, 0.0850149, 
-0.754689, -0.0313175, 0.301004, 0.0830447, 
-0.654988, -0.0316329, 0.239931, 0.0839228, 
-0.739331, -0.0370768, 0.278597, 0.0984317, 
-0.878726, -0.0481243, 0.3318, 0.127899, 
-0.861004, -0.0530522, 0.325139, 0.141442, 
-0.876665, -0.0589819, 0.330817, 0.159466, 
-0.87701, -0.0647857, 0.330813, 0.17664, 
-0.877444, -0.0709788, 0.330817, 0.194702, 
-0.877935, -0.0774798, 0.330821, 0.213581, 
-0.878487, -0.0843161, 0.33082, 0.233242, 
-0.879149, -0.0912705, 0.330811, 0.253509, 
-0.879979, -0.0980828, 0.330762, 0.274138, 
-0.880933, -0.105822, 0.330844, 0.295207, 
-0.882053, -0.113674, 0.330896, 0.317235, 
-0.883348, -0.120299, 0.330543, 0.341057, 
-0.88497, -0.126659, 0.330041, 0.365581, 
-0.886696, -0.133112, 0.329405, 0.390789, 
-0.889339, -0.139033, 0.328706, 0.416519, 
-0.891895, -0.14497, 0.327687, 0.442616, 
-0.895439, -0.150772, 0.326648, 0.469209, 
-0.89956, -0.156287, 0.32529, 0.495933, 
-0.904696, -0.161677, 0.323683, 0.523065, 
-0.910267, -0.165739, 0.321276, 0.55118, 
-0.915455, -0.168707, 0.317912, 0.579764, 
-0.921165, -0.171159, 0.313911, 0.608419, 
-0.9274, -0.17322, 0.309589, 0.636965, 
-0.93293, -0.174803, 0.30401, 0.665167, 
-0.938558, -0.175003, 0.297532, 0.693613, 
-0.943528, -0.173924, 0.289643, 0.722068, 
-0.949197, -0.172198, 0.281267, 0.749921, 
-0.954117, -0.169885, 0.271796, 0.777539, 
-0.957878, -0.166542, 0.261052, 0.804683, 
-0.962344, -0.161795, 0.249507, 0.831746, 
-0.966534, -0.156643, 0.237287, 0.857819, 
-0.969522, -0.150767, 0.224196, 0.882952, 
-0.972342, -0.143655, 0.210739, 0.907759, 
-0.975906, -0.135795, 0.196682, 0.93138, 
-0.977818, -0.127928, 0.182371, 0.953959, 
-0.979404, -0.118359, 0.167524, 0.975407, 
-0.980757, -0.109128, 0.153013, 0.995816, 
-0.981191, -0.0991906, 0.137897, 1.01487, 
-0.982179, -0.0883679, 0.122838, 1.03268, 
-0.983708, -0.0780867, 0.107373, 1.04923, 
-0.985294, -0.0665591, 0.0918681, 1.06455, 
-0.987264, -0.0557673, 0.076476, 1.07888, 
-0.989909, -0.0442747, 0.060715, 1.09185, 
-0.99296, -0.033168, 0.0452531, 1.10394, 
-0.995714, -0.0219527, 0.0298029, 1.11466, 
-0.99816, -0.0107608, 0.0146974, 1.12479, 
-0.999944, 0.000248682, -8.9563e-05, 1.13399, 
-0.927185, -0.374602, 0.374602, 0.927185, 
-0.927186, -0.374602, 0.374602, 0.927186, 
-0.927185, -0.374602, 0.374602, 0.927185, 
-0.927186, -0.374601, 0.374601, 0.927186, 
-0.383193, -0.00200801, 0.154992, 0.00497013, 
-4.50866, -0.00914065, 1.83235, 0.0226249, 
-1.37746, -0.00742907, 0.554229, 0.018389, 
-10.032, -0.0315074, 4.06068, 0.0779932, 
-0.118893, -0.00735268, 0.057599, 0.0182022, 
-0.0113687, -0.00482058, 0.00455099, 0.0119351, 
-0.858974, -0.0174864, 0.347058, 0.0433006, 
-0.0163023, -0.00851885, 0.0065671, 0.0210991, 
-0.864961, -0.0252916, 0.349363, 0.0626585, 
-0.655274, -0.0240216, 0.263101, 0.0595328, 
-0.733784, -0.0322341, 0.311851, 0.0799212, 
-0.497969, -0.0272827, 0.199166, 0.0676829, 
-0.859138, -0.0446926, 0.346881, 0.110958, 
-0.861601, -0.0505082, 0.347988, 0.125555, 
-0.860975, -0.056358, 0.347658, 0.140703, 
-0.861252, -0.0619627, 0.347587, 0.15672, 
-0.861752, -0.068129, 0.347695, 0.1736, 
-0.862207, -0.0746556, 0.347712, 0.191368, 
-0.862722, -0.0815204, 0.347718, 0.209968, 
-0.863408, -0.0886667, 0.34776, 0.229357, 
-0.864156, -0.0957921, 0.34774, 0.249344, 
-0.86516, -0.102914, 0.347733, 0.269802, 
-0.86619, -0.110924, 0.347801, 0.290656, 
-0.867434, -0.119222, 0.347909, 0.312071, 
-0.869083, -0.126195, 0.347672, 0.335432, 
-0.870793, -0.133136, 0.347196, 0.359708, 
-0.873037, -0.139861, 0.346664, 0.384646, 
-0.876016, -0.146103, 0.345972, 0.41023, 
-0.879067, -0.152343, 0.344992, 0.436243, 
-0.883509, -0.158228, 0.343991, 0.462693, 
-0.888504, -0.164104, 0.342776, 0.489472, 
-0.894845, -0.169526, 0.341233, 0.516623, 
-0.9008, -0.174429, 0.339105, 0.544172, 
-0.907077, -0.177525, 0.335796, 0.572906, 
-0.912771, -0.180118, 0.331568, 0.60161, 
-0.91959, -0.182127, 0.326946, 0.630237, 
-0.924931, -0.183403, 0.320979, 0.65808, 
-0.932057, -0.184187, 0.3146, 0.686727, 
-0.937874, -0.183081, 0.30656, 0.715469, 
-0.943578, -0.181208, 0.297642, 0.743801, 
-0.948669, -0.178682, 0.287337, 0.77146, 
-0.953435, -0.175385, 0.276175, 0.798621, 
-0.957797, -0.170415, 0.263995, 0.825699, 
-0.962409, -0.165001, 0.251124, 0.852366, 
-0.96601, -0.158638, 0.237115, 0.878224, 
-0.969218, -0.151728, 0.222594, 0.903416, 
-0.972663, -0.143249, 0.207689, 0.927603, 
-0.975464, -0.134797, 0.192442, 0.950665, 
-0.97746, -0.125445, 0.176782, 0.972948, 
-0.979314, -0.114997, 0.160984, 0.993674, 
-0.980293, -0.104916, 0.145544, 1.01317, 
-0.980577, -0.0935416, 0.129644, 1.0311, 
-0.982043, -0.0822954, 0.113499, 1.04824, 
-0.98382, -0.0710004, 0.0973829, 1.06394, 
-0.986335, -0.0588047, 0.0807591, 1.07872, 
-0.988737, -0.0472685, 0.0644333, 1.09188, 
-0.992146, -0.0349115, 0.047846, 1.10409, 
-0.995182, -0.0232394, 0.0316518, 1.11521, 
-0.997974, -0.0112698, 0.0155128, 1.12537, 
-1.00005, 0.000339742, -0.000118495, 1.13506, 
-0.918367, -0.395729, 0.395729, 0.918367, 
-0.918367, -0.395729, 0.395729, 0.918367, 
-0.918368, -0.395728, 0.395728, 0.918368, 
-0.918368, -0.395728, 0.395728, 0.918368, 
-0.716069, -0.00243652, 0.307484, 0.00565451, 
-2.15924, -0.0064502, 0.932872, 0.0149695, 
-0.773343, -0.00640735, 0.33492, 0.0148705, 
-0.00582952, -0.0026211, 0.00252248, 0.00608355, 
-0.00832465, -0.00373424, 0.00360352, 0.00866788, 
-0.0111661, -0.00505055, 0.00477123, 0.0117248, 
-0.832308, -0.0182318, 0.358785, 0.0423323, 
-0.0937447, -0.0110038, 0.0487883, 0.0255557, 
-0.690905, -0.0245191, 0.308594, 0.056962, 
-0.347183, -0.0242171, 0.154831, 0.0562827, 
-0.855274, -0.0359969, 0.367457, 0.0837018, 
-0.859805, -0.0418053, 0.371439, 0.0972699, 
-0.858226, -0.047501, 0.369987, 0.110618, 
-0.844491, -0.0527909, 0.363738, 0.123121, 
-0.844831, -0.0588204, 0.363805, 0.138044, 
-0.787638, -0.0629692, 0.329658, 0.14951, 
-0.84565, -0.0713172, 0.363873, 0.170392, 
-0.846164, -0.0781703, 0.363913, 0.187862, 
-0.846624, -0.0853815, 0.363894, 0.206153, 
-0.847513, -0.0928081, 0.364004, 0.225243, 
-0.848424, -0.100052, 0.364012, 0.244931, 
-0.849482, -0.107614, 0.364019, 0.265185, 
-0.850647, -0.11582, 0.364095, 0.285886, 
-0.852035, -0.12434, 0.3642, 0.306941, 
-0.85434, -0.131998, 0.364246, 0.329612, 
-0.856212, -0.139325, 0.363815, 0.353556, 
-0.858798, -0.146343, 0.363298, 0.378301, 
-0.862297, -0.152966, 0.362787, 0.403647, 
-0.866182, -0.159452, 0.361943, 0.429506, 
-0.871625, -0.165635, 0.361133, 0.456034, 
-0.877064, -0.17155, 0.359728, 0.482493, 
-0.88395, -0.177178, 0.358487, 0.509782, 
-0.890741, -0.182363, 0.356539, 0.537162, 
-0.897134, -0.18606, 0.35332, 0.565446, 
-0.903889, -0.188611, 0.349139, 0.594322, 
-0.910863, -0.190722, 0.344106, 0.623058, 
-0.918254, -0.192168, 0.338476, 0.65193, 
-0.924621, -0.192767, 0.331461, 0.679901, 
-0.930768, -0.192158, 0.323058, 0.708373, 
-0.937048, -0.189994, 0.31358, 0.737041, 
-0.943031, -0.187134, 0.303151, 0.764865, 
-0.948662, -0.183905, 0.291387, 0.792811, 
-0.953035, -0.178974, 0.278286, 0.819564, 
-0.958362, -0.173222, 0.264672, 0.846799, 
-0.962333, -0.166407, 0.250049, 0.872736, 
-0.966016, -0.159434, 0.234614, 0.898626, 
-0.969673, -0.150761, 0.218774, 0.923259, 
-0.973137, -0.141525, 0.202502, 0.947294, 
-0.975461, -0.132068, 0.186123, 0.969889, 
-0.977394, -0.121196, 0.169283, 0.990828, 
-0.978728, -0.110184, 0.152789, 1.01124, 
-0.979684, -0.0989641, 0.136447, 1.02991, 
-0.980938, -0.0866019, 0.119491, 1.04743, 
-0.982639, -0.0746388, 0.102546, 1.0638, 
-0.985025, -0.0621833, 0.0851906, 1.07836, 
-0.987822, -0.0495694, 0.0678991, 1.092, 
-0.991034, -0.0372398, 0.0507144, 1.10434, 
-0.994747, -0.0244381, 0.0333536, 1.11589, 
-0.99784, -0.012145, 0.016506, 1.12619, 
-0.999992, 0.000317725, -0.000120328, 1.13588, 
-0.909045, -0.416698, 0.416698, 0.909045, 
-0.909045, -0.416698, 0.416698, 0.909045, 
-0.909045, -0.416697, 0.416697, 0.909045, 
-0.909046, -0.416695, 0.416695, 0.909046, 
-0.848874, -0.00317584, 0.389103, 0.00692835, 
-1.25502, -0.00584062, 0.577392, 0.0127421, 
-1.32768, -0.00816917, 0.607401, 0.0178228, 
-6.21513, -0.025316, 2.83472, 0.0552359, 
-0.0760558, -0.00554992, 0.0305524, 0.0121103, 
-0.0109777, -0.00528269, 0.00499327, 0.0115289, 
-0.826058, -0.0190638, 0.378631, 0.0416128, 
-0.0156665, -0.00927723, 0.00716408, 0.020256, 
-0.327845, -0.0171411, 0.149595, 0.0374391, 
-1.03548, -0.0387371, 0.472669, 0.0846461, 
-0.835303, -0.0375847, 0.382875, 0.0821744, 
-0.790086, -0.0413431, 0.363323, 0.090457, 
-0.825981, -0.0486897, 0.378887, 0.106635, 
-0.82758, -0.0549915, 0.379172, 0.120655, 
-0.827947, -0.0611064, 0.379235, 0.135261, 
-0.828354, -0.067506, 0.379285, 0.150715, 
-0.828817, -0.0743465, 0.379336, 0.167036, 
-0.829391, -0.0815523, 0.379411, 0.184209, 
-0.830189, -0.0890741, 0.379527, 0.202195, 
-0.830888, -0.096734, 0.379552, 0.22094, 
-0.832002, -0.104139, 0.379596, 0.240315, 
-0.833031, -0.112104, 0.379596, 0.260314, 
-0.834285, -0.120556, 0.379663, 0.280806, 
-0.836187, -0.12913, 0.379896, 0.30166, 
-0.838723, -0.137549, 0.380131, 0.323521, 
-0.840916, -0.145225, 0.379775, 0.347164, 
-0.844548, -0.152481, 0.379565, 0.371708, 
-0.84846, -0.159598, 0.379136, 0.396857, 
-0.853595, -0.16626, 0.378627, 0.422682, 
-0.858837, -0.172691, 0.377749, 0.4489, 
-0.86535, -0.178825, 0.376677, 0.475666, 
-0.872376, -0.184561, 0.375305, 0.50265, 
-0.880066, -0.18986, 0.373619, 0.529981, 
-0.88753, -0.194391, 0.370905, 0.557962, 
-0.894904, -0.197033, 0.366613, 0.586879, 
-0.902486, -0.19913, 0.361524, 0.615902, 
-0.910071, -0.200408, 0.355511, 0.644511, 
-0.917269, -0.201005, 0.348171, 0.673123, 
-0.924125, -0.200731, 0.339716, 0.701538, 
-0.930659, -0.198767, 0.329583, 0.730079, 
-0.937294, -0.195419, 0.318544, 0.758481, 
-0.943133, -0.191982, 0.306053, 0.786647, 
-0.948815, -0.187273, 0.292866, 0.813836, 
-0.953619, -0.181177, 0.278191, 0.840851, 
-0.958607, -0.174057, 0.262809, 0.867407, 
-0.962359, -0.166558, 0.246582, 0.893601, 
-0.966091, -0.158142, 0.229957, 0.918806, 
-0.970113, -0.148287, 0.21281, 0.943487, 
-0.973612, -0.138185, 0.19534, 0.966826, 
-0.975784, -0.127583, 0.177918, 0.988884, 
-0.977148, -0.115536, 0.160096, 1.0092, 
-0.97836, -0.103642, 0.142972, 1.02847, 
-0.979851, -0.0913163, 0.12556, 1.04653, 
-0.981411, -0.0782695, 0.107519, 1.06303, 
-0.983472, -0.0655951, 0.0896683, 1.07797, 
-0.986697, -0.0520421, 0.071344, 1.09203, 
-0.99033, -0.0389707, 0.0531849, 1.10479, 
-0.994188, -0.0258066, 0.0351054, 1.11635, 
-0.99745, -0.0126068, 0.0172799, 1.127, 
-0.999991, 0.000275591, -0.000126573, 1.13673, 
-0.899219, -0.437499, 0.437499, 0.899219, 
-0.899219, -0.437499, 0.437499, 0.899219, 
-0.899219, -0.437499, 0.437499, 0.899219, 
-0.89922, -0.437497, 0.437497, 0.89922, 
-0.748265, -0.00308783, 0.364431, 0.00634672, 
-0.960393, -0.00534878, 0.46493, 0.0109941, 
-2.25539, -0.0111048, 1.09268, 0.0228264, 
-2.834, -0.0165011, 1.39868, 0.0339211, 
-0.306968, -0.00733445, 0.147345, 0.0150791, 
-0.0107839, -0.00550751, 0.00520781, 0.0113248, 
-0.453768, -0.0140681, 0.218381, 0.0289341, 
-0.0153801, -0.00966691, 0.00747608, 0.0198881, 
-0.826294, -0.0294265, 0.401334, 0.060564, 
-0.845974, -0.033918, 0.411997, 0.0698431, 
-0.782664, -0.0386848, 0.382146, 0.0797095, 
-0.795984, -0.0440276, 0.387221, 0.0907915, 
-0.822123, -0.0512102, 0.398445, 0.105721, 
-0.809946, -0.0570709, 0.39385, 0.118086, 
-0.81025, -0.0633536, 0.393882, 0.132379, 
-0.810682, -0.0700966, 0.393956, 0.147537, 
-0.81125, -0.0772277, 0.394055, 0.163544, 
-0.811875, -0.0847651, 0.394152, 0.180399, 
-0.812634, -0.0925668, 0.394255, 0.198052, 
-0.8136, -0.100415, 0.394372, 0.21644, 
-0.814635, -0.108113, 0.394382, 0.235489, 
-0.815917, -0.116435, 0.39447, 0.255232, 
-0.817298, -0.125038, 0.394547, 0.275446, 
-0.819633, -0.133656, 0.394863, 0.296096, 
-0.822267, -0.142686, 0.395259, 0.317319, 
-0.825454, -0.150774, 0.3953, 0.340555, 
-0.829486, -0.158377, 0.39521, 0.364784, 
-0.833916, -0.165791, 0.394915, 0.389713, 
-0.839771, -0.172658, 0.394701, 0.415364, 
-0.845643, -0.179445, 0.393977, 0.441541, 
-0.852984, -0.185718, 0.393264, 0.468249, 
-0.859266, -0.191622, 0.391467, 0.495142, 
-0.867633, -0.197108, 0.390019, 0.52252, 
-0.875769, -0.201854, 0.387264, 0.5502, 
-0.882762, -0.205033, 0.382765, 0.578855, 
-0.891093, -0.207113, 0.377537, 0.608149, 
-0.90051, -0.208427, 0.371704, 0.637088, 
-0.908286, -0.209106, 0.364284, 0.665889, 
-0.916032, -0.20864, 0.355496, 0.694377, 
-0.923499, -0.207295, 0.345392, 0.72324, 
-0.931256, -0.203757, 0.33391, 0.75169, 
-0.937965, -0.199841, 0.320815, 0.780172, 
-0.943279, -0.194997, 0.306893, 0.807716, 
-0.948949, -0.189146, 0.291806, 0.835033, 
-0.954505, -0.181667, 0.275431, 0.862119, 
-0.959076, -0.173609, 0.258579, 0.888633, 
-0.962771, -0.164843, 0.240795, 0.913943, 
-0.966936, -0.155125, 0.222682, 0.939121, 
-0.970796, -0.144235, 0.204688, 0.96335, 
-0.973489, -0.133217, 0.185995, 0.986194, 
-0.976275, -0.121187, 0.167593, 1.00738, 
-0.976321, -0.108338, 0.149226, 1.02689, 
-0.978523, -0.0956734, 0.13124, 1.04549, 
-0.980094, -0.0820761, 0.112635, 1.06225, 
-0.982398, -0.0684098, 0.0937583, 1.07788, 
-0.985525, -0.0549513, 0.0748916, 1.09201, 
-0.989521, -0.0407934, 0.0557776, 1.10529, 
-0.993644, -0.0271979, 0.0368721, 1.11684, 
-0.997168, -0.0132707, 0.0181642, 1.12781, 
-0.999958, 0.000431775, -0.000191423, 1.13787, 
-0.888889, -0.458123, 0.458123, 0.888889, 
-0.888889, -0.458123, 0.458123, 0.888889, 
-0.888889, -0.458122, 0.458122, 0.888889, 
-0.88889, -0.458121, 0.458121, 0.88889, 
-0.668721, -0.00315409, 0.344359, 0.00611996, 
-0.949416, -0.00560091, 0.486955, 0.0108679, 
-1.1922, -0.00832594, 0.610065, 0.0161562, 
-1.23357, -0.0120169, 0.643072, 0.0233204, 
-0.160591, -0.00910209, 0.0931311, 0.017666, 
-0.0105178, -0.005687, 0.00537897, 0.0110398, 
-0.622697, -0.017178, 0.317208, 0.0333548, 
-0.0151135, -0.0100611, 0.00777633, 0.0195424, 
-0.79432, -0.0295979, 0.409186, 0.0575156, 
-1.08997, -0.0420753, 0.56282, 0.081808, 
-0.791639, -0.0402278, 0.407833, 0.0782714, 
-0.918246, -0.0527977, 0.475943, 0.102822, 
-0.806967, -0.0547048, 0.418131, 0.106671, 
-0.791548, -0.059013, 0.407704, 0.115411, 
-0.79189, -0.0654917, 0.407749, 0.129398, 
-0.792378, -0.072522, 0.407849, 0.144239, 
-0.792954, -0.0799847, 0.40797, 0.159924, 
-0.793625, -0.0877925, 0.408088, 0.176431, 
-0.794312, -0.0958248, 0.408144, 0.193692, 
-0.795528, -0.103827, 0.408369, 0.211756, 
-0.796743, -0.111935, 0.408464, 0.230521, 
-0.797995, -0.120517, 0.408531, 0.249959, 
-0.799818, -0.129247, 0.408736, 0.269937, 
-0.802308, -0.13804, 0.409095, 0.290322, 
-0.805323, -0.147306, 0.40966, 0.311203, 
-0.809223, -0.155898, 0.410141, 0.333616, 
-0.813665, -0.163938, 0.410256, 0.357607, 
-0.819063, -0.171675, 0.410341, 0.38236, 
-0.825337, -0.178889, 0.410291, 0.407792, 
-0.831464, -0.185749, 0.409611, 0.433885, 
-0.838832, -0.192319, 0.408831, 0.460496, 
-0.846012, -0.19827, 0.407289, 0.487399, 
-0.85465, -0.203988, 0.405673, 0.514718, 
-0.86338, -0.208898, 0.403222, 0.542373, 
-0.871947, -0.212756, 0.399267, 0.570659, 
-0.880758, -0.214967, 0.393818, 0.600104, 
-0.89009, -0.216211, 0.387661, 0.629312, 
-0.898625, -0.216775, 0.379902, 0.65841, 
-0.906625, -0.216397, 0.370531, 0.687172, 
-0.914917, -0.21503, 0.360222, 0.715932, 
-0.923475, -0.211939, 0.348462, 0.744885, 
-0.932191, -0.207542, 0.335878, 0.773591, 
-0.938415, -0.20245, 0.320808, 0.801763, 
-0.944146, -0.196526, 0.305064, 0.829134, 
-0.949298, -0.189002, 0.28798, 0.856067, 
-0.955096, -0.180524, 0.270298, 0.882935, 
-0.960123, -0.171539, 0.251807, 0.909834, 
-0.96322, -0.161642, 0.232589, 0.93476, 
-0.967432, -0.150396, 0.213402, 0.959479, 
-0.971785, -0.138663, 0.193938, 0.98305, 
-0.974369, -0.126634, 0.174898, 1.00548, 
-0.975605, -0.113192, 0.155619, 1.02554, 
-0.976608, -0.0996238, 0.136804, 1.04432, 
-0.97861, -0.0860788, 0.117596, 1.0615, 
-0.981175, -0.0714359, 0.0978998, 1.07765, 
-0.984448, -0.0572355, 0.0782711, 1.09224, 
-0.988457, -0.0428885, 0.058449, 1.10555, 
-0.992988, -0.0282465, 0.0385326, 1.11767, 
-0.997038, -0.0140186, 0.0190418, 1.12867, 
-1.00011, 0.000369574, -0.000171745, 1.13916, 
-0.878055, -0.47856, 0.47856, 0.878055, 
-0.878055, -0.47856, 0.47856, 0.878055, 
-0.878055, -0.478559, 0.478559, 0.878055, 
-0.878056, -0.478557, 0.478557, 0.878056, 
-0.478919, -0.00254449, 0.26065, 0.0046687, 
-0.66055, -0.00513248, 0.356573, 0.00941749, 
-1.34738, -0.00926457, 0.731063, 0.0170004, 
-0.00538958, -0.00306631, 0.00294423, 0.00562715, 
-0.155461, -0.00573683, 0.0851784, 0.0105294, 
-0.010262, -0.00586775, 0.00555207, 0.0107719, 
-0.815086, -0.0225804, 0.443387, 0.0414644, 
-0.0146823, -0.0103438, 0.00798935, 0.0190015, 
-0.704218, -0.0293402, 0.383771, 0.0539244, 
-0.360578, -0.022413, 0.19642, 0.0412188, 
-0.769358, -0.0424643, 0.412269, 0.0781561, 
-0.63244, -0.0445358, 0.340601, 0.0820521, 
-0.77211, -0.0540503, 0.420611, 0.0997263, 
-0.77251, -0.0607975, 0.420747, 0.112638, 
-0.77282, -0.0675355, 0.420781, 0.126306, 
-0.773331, -0.0748333, 0.420899, 0.140826, 
-0.773967, -0.0825676, 0.42105, 0.156169, 
-0.774733, -0.0906299, 0.42122, 0.17232, 
-0.775682, -0.0989033, 0.421401, 0.189263, 
-0.776722, -0.106986, 0.421508, 0.206897, 
-0.778075, -0.115526, 0.421693, 0.225356, 
-0.779628, -0.124318, 0.421865, 0.244473, 
-0.781554, -0.133135, 0.422084, 0.264146, 
-0.784392, -0.142186, 0.422601, 0.284332, 
-0.787646, -0.151652, 0.423259, 0.304906, 
-0.792387, -0.160764, 0.424379, 0.326486, 
-0.797396, -0.169181, 0.424793, 0.350171, 
-0.803952, -0.177158, 0.425444, 0.374786, 
-0.809427, -0.184742, 0.424955, 0.399921, 
-0.81579, -0.191723, 0.42421, 0.425781, 
-0.823693, -0.198522, 0.42365, 0.452281, 
-0.832525, -0.204719, 0.422856, 0.479344, 
-0.841928, -0.210466, 0.421394, 0.506764, 
-0.850261, -0.215516, 0.418342, 0.534356, 
-0.860031, -0.219791, 0.414918, 0.56252, 
-0.869243, -0.222333, 0.409493, 0.591633, 
-0.878859, -0.223739, 0.402822, 0.621059, 
-0.888892, -0.224145, 0.395188, 0.650769, 
-0.898466, -0.223803, 0.385984, 0.679723, 
-0.907039, -0.22229, 0.375312, 0.708614, 
-0.915707, -0.219876, 0.363212, 0.737844, 
-0.924106, -0.21523, 0.349275, 0.767005, 
-0.931772, -0.209664, 0.334363, 0.795405, 
-0.938707, -0.203597, 0.317934, 0.823037, 
-0.945201, -0.19635, 0.300416, 0.850827, 
-0.951208, -0.187456, 0.281983, 0.877763, 
-0.956105, -0.177878, 0.26237, 0.904557, 
-0.960301, -0.167615, 0.24264, 0.930586, 
-0.964702, -0.156631, 0.22237, 0.955622, 
-0.968638, -0.144193, 0.202123, 0.980342, 
-0.972231, -0.13131, 0.181655, 1.00294, 
-0.974683, -0.11834, 0.161893, 1.02396, 
-0.975746, -0.103736, 0.142341, 1.04352, 
-0.977026, -0.0894242, 0.122391, 1.06099, 
-0.980033, -0.0749038, 0.102263, 1.07739, 
-0.983285, -0.0596176, 0.0816099, 1.09234, 
-0.987631, -0.0447761, 0.0609677, 1.10607, 
-0.992256, -0.029522, 0.0402843, 1.11831, 
-0.996675, -0.014391, 0.0197886, 1.12961, 
-1.00006, 0.000321389, -0.00018434, 1.1403, 
-0.866717, -0.4988, 0.4988, 0.866717, 
-0.866717, -0.4988, 0.4988, 0.866717, 
-0.866717, -0.498799, 0.498799, 0.866717, 
-0.866719, -0.498797, 0.498797, 0.866719, 
-0.210037, -0.00172641, 0.120583, 0.00299988, 
-2.41665, -0.00939411, 1.37863, 0.0163242, 
-1.7317, -0.0113404, 0.994207, 0.0197074, 
-0.898619, -0.0114091, 0.519862, 0.019829, 
-0.0502637, -0.00441404, 0.0288849, 0.00767277, 
-0.00991787, -0.00598805, 0.00566831, 0.0104111, 
-0.763703, -0.0221204, 0.439326, 0.0384718, 
-0.0989334, -0.0164444, 0.048719, 0.0286123, 
-0.676111, -0.0295713, 0.390985, 0.0514804, 
-0.817807, -0.0388321, 0.471224, 0.0676499, 
-0.756507, -0.0452043, 0.408263, 0.0788203, 
-0.757994, -0.0491393, 0.435445, 0.085779, 
-0.752395, -0.0555832, 0.432771, 0.0971919, 
-0.752674, -0.0623851, 0.432837, 0.109766, 
-0.753136, -0.0694157, 0.432958, 0.123128, 
-0.753731, -0.0770064, 0.433131, 0.137312, 
-0.754331, -0.0849704, 0.433267, 0.152289, 
-0.75523, -0.0932682, 0.433507, 0.168075, 
-0.756334, -0.101707, 0.433722, 0.18462, 
-0.757303, -0.110021, 0.433837, 0.201901, 
-0.758815, -0.118863, 0.434098, 0.220001, 
-0.760435, -0.127881, 0.434305, 0.238778, 
-0.76215, -0.136686, 0.434405, 0.258021, 
-0.765786, -0.146112, 0.435272, 0.278048, 
-0.769698, -0.155663, 0.436247, 0.298443, 
-0.774867, -0.165163, 0.437732, 0.319503, 
-0.779932, -0.17401, 0.438297, 0.342485, 
-0.785649, -0.182197, 0.438562, 0.366685, 
-0.792526, -0.190106, 0.438768, 0.391672, 
-0.800483, -0.197463, 0.438847, 0.417547, 
-0.808675, -0.204392, 0.438271, 0.443991, 
-0.817822, -0.21074, 0.437461, 0.470988, 
-0.827804, -0.216607, 0.436138, 0.498468, 
-0.837947, -0.221778, 0.4337, 0.526104, 
-0.848027, -0.226343, 0.430176, 0.554217, 
-0.858298, -0.229334, 0.425283, 0.582916, 
-0.868939, -0.231052, 0.418706, 0.612988, 
-0.878886, -0.231154, 0.410314, 0.642442, 
-0.889222, -0.230999, 0.401044, 0.672212, 
-0.898514, -0.229388, 0.389681, 0.701504, 
-0.907791, -0.226799, 0.377155, 0.730483, 
-0.916912, -0.222761, 0.363361, 0.759933, 
-0.925086, -0.216853, 0.347382, 0.788839, 
-0.933218, -0.210364, 0.330435, 0.817598, 
-0.939907, -0.202943, 0.312353, 0.84471, 
-0.946208, -0.194424, 0.293241, 0.872448, 
-0.95289, -0.184177, 0.273371, 0.8997, 
-0.957309, -0.173648, 0.252468, 0.926344, 
-0.961557, -0.162217, 0.231472, 0.952024, 
-0.965316, -0.149794, 0.20983, 0.976779, 
-0.969613, -0.136354, 0.18876, 1.00057, 
-0.973851, -0.122538, 0.168239, 1.02238, 
-0.974342, -0.108213, 0.147442, 1.04198, 
-0.976118, -0.0927594, 0.127268, 1.06041, 
-0.978205, -0.0778036, 0.106147, 1.07687, 
-0.98209, -0.0621253, 0.0848725, 1.09252, 
-0.986686, -0.0463816, 0.063388, 1.10644, 
-0.991678, -0.0309345, 0.0420002, 1.119, 
-0.996392, -0.0150904, 0.0206039, 1.13066, 
-0.99995, 0.000442399, -0.000255114, 1.14136, 
-0.854875, -0.518834, 0.518834, 0.854875, 
-0.854875, -0.518834, 0.518834, 0.854875, 
-0.854876, -0.518833, 0.518833, 0.854876, 
-0.854877, -0.51883, 0.51883, 0.854877, 
-0.379831, -0.00217509, 0.230656, 0.00358396, 
-1.10991, -0.00636286, 0.669768, 0.0104847, 
-0.0199684, -0.002728, 0.0144126, 0.00449549, 
-65.2747, -0.172428, 39.6731, 0.284178, 
-0.0610328, -0.00625502, 0.033585, 0.0103107, 
-0.00969093, -0.00616911, 0.00584129, 0.0101716, 
-0.734258, -0.0224515, 0.445702, 0.0370309, 
-0.013835, -0.0108615, 0.00839004, 0.017923, 
-0.733112, -0.0322072, 0.444884, 0.053179, 
-0.616139, -0.0348619, 0.379022, 0.057607, 
-0.747489, -0.0442538, 0.453546, 0.0731984, 
-0.716299, -0.0502786, 0.433634, 0.0832695, 
-0.732028, -0.0569942, 0.444009, 0.0945809, 
-0.732345, -0.0638741, 0.444089, 0.106823, 
-0.732871, -0.0712044, 0.444257, 0.119862, 
-0.733408, -0.079003, 0.444401, 0.133682, 
-0.734184, -0.0871928, 0.444638, 0.148303, 
-0.735081, -0.0956951, 0.444882, 0.1637, 
-0.736172, -0.10426, 0.445137, 0.179861, 
-0.737517, -0.11285, 0.445407, 0.196773, 
-0.738986, -0.121992, 0.445648, 0.2145, 
-0.740883, -0.131149, 0.445968, 0.232907, 
-0.743586, -0.140237, 0.446523, 0.251963, 
-0.746746, -0.149719, 0.447215, 0.271546, 
-0.751456, -0.159335, 0.448603, 0.291763, 
-0.756083, -0.169098, 0.449818, 0.31244, 
-0.761615, -0.178449, 0.450994, 0.334575, 
-0.768485, -0.186908, 0.451876, 0.358499, 
-0.776656, -0.195124, 0.45284, 0.383459, 
-0.784017, -0.202722, 0.452501, 0.409001, 
-0.793693, -0.209898, 0.452659, 0.435464, 
-0.803251, -0.216437, 0.451862, 0.462408, 
-0.814146, -0.222521, 0.450908, 0.489896, 
-0.825187, -0.227737, 0.44874, 0.517836, 
-0.836269, -0.232496, 0.44546, 0.5461, 
-0.846977, -0.235747, 0.440446, 0.574414, 
-0.858226, -0.237937, 0.433741, 0.604348, 
-0.869318, -0.23816, 0.425512, 0.634329, 
-0.879253, -0.237655, 0.415172, 0.664184, 
-0.889443, -0.236115, 0.403829, 0.693707, 
-0.899249, -0.233533, 0.39086, 0.723276, 
-0.908652, -0.229717, 0.376725, 0.752516, 
-0.918505, -0.223905, 0.360703, 0.782004, 
-0.926684, -0.217127, 0.342827, 0.811363, 
-0.934531, -0.209291, 0.323959, 0.839513, 
-0.941405, -0.200716, 0.304354, 0.867067, 
-0.947566, -0.190568, 0.283682, 0.894422, 
-0.953854, -0.179115, 0.262399, 0.92103, 
-0.958613, -0.167709, 0.24033, 0.948378, 
-0.962955, -0.155105, 0.217873, 0.973498, 
-0.966442, -0.141377, 0.195764, 0.99779, 
-0.970992, -0.126883, 0.17429, 1.02048, 
-0.973248, -0.112301, 0.152917, 1.04089, 
-0.974539, -0.0965141, 0.131762, 1.05965, 
-0.976954, -0.0804853, 0.11007, 1.07688, 
-0.980743, -0.0648481, 0.0883339, 1.09261, 
-0.985451, -0.0481904, 0.0658799, 1.10689, 
-0.991095, -0.0319131, 0.0435426, 1.11985, 
-0.996086, -0.0158101, 0.0215043, 1.13182, 
-1.00002, 0.000372488, -0.000238626, 1.1429, 
-0.84253, -0.53865, 0.53865, 0.84253, 
-0.84253, -0.53865, 0.53865, 0.84253, 
-0.84253, -0.538649, 0.538649, 0.84253, 
-0.842532, -0.538646, 0.538646, 0.842532, 
-0.556326, -0.00307101, 0.355497, 0.00480367, 
-0.687163, -0.00612521, 0.434513, 0.00958145, 
-1.62714, -0.0117442, 1.03655, 0.0183724, 
-2.62825, -0.0214953, 1.71283, 0.0336311, 
-1.01343, -0.0203495, 0.649599, 0.0318446, 
-0.00939705, -0.00630052, 0.00596743, 0.00986233, 
-0.591878, -0.0199799, 0.376595, 0.0312871, 
-0.804364, -0.030225, 0.522746, 0.0473548, 
-0.706042, -0.0328493, 0.45124, 0.0515011, 
-0.72584, -0.0389091, 0.464213, 0.0610543, 
-0.69381, -0.0446369, 0.442534, 0.0701183, 
-0.438639, -0.0372782, 0.282597, 0.0586421, 
-0.711071, -0.0582735, 0.454307, 0.0918963, 
-0.711524, -0.0652908, 0.454466, 0.103821, 
-0.712072, -0.0728436, 0.454656, 0.11651, 
-0.71283, -0.0808382, 0.454935, 0.12998, 
-0.713377, -0.0892093, 0.455051, 0.144187, 
-0.714385, -0.0979044, 0.455351, 0.159212, 
-0.715529, -0.106528, 0.455618, 0.174967, 
-0.717071, -0.115504, 0.456016, 0.191523, 
-0.718594, -0.124823, 0.456293, 0.208838, 
-0.720882, -0.134089, 0.456825, 0.226886, 
-0.723809, -0.143429, 0.457532, 0.245586, 
-0.727411, -0.15306, 0.458452, 0.264957, 
-0.732776, -0.162778, 0.460253, 0.284965, 
-0.736636, -0.172629, 0.461006, 0.305223, 
-0.743396, -0.182468, 0.463132, 0.326683, 
-0.75003, -0.191273, 0.463997, 0.350073, 
-0.75851, -0.199718, 0.465135, 0.37473, 
-0.767836, -0.20762, 0.466012, 0.400294, 
-0.777946, -0.215066, 0.466263, 0.426627, 
-0.788881, -0.221766, 0.466087, 0.453628, 
-0.800204, -0.228003, 0.465028, 0.481172, 
-0.811444, -0.233371, 0.462775, 0.509142, 
-0.823267, -0.238141, 0.459647, 0.53749, 
-0.834969, -0.241711, 0.454747, 0.565984, 
-0.846382, -0.244288, 0.448183, 0.59524, 
-0.858701, -0.244774, 0.440127, 0.62567, 
-0.870299, -0.244272, 0.429817, 0.656154, 
-0.88118, -0.242583, 0.418112, 0.686122, 
-0.89116, -0.239897, 0.40415, 0.715991, 
-0.900917, -0.236107, 0.389407, 0.745437, 
-0.911454, -0.230756, 0.373632, 0.775308, 
-0.920013, -0.223595, 0.354927, 0.804647, 
-0.928296, -0.215483, 0.335267, 0.833628, 
-0.937306, -0.206504, 0.31543, 0.861618, 
-0.943244, -0.196673, 0.293785, 0.889083, 
-0.949436, -0.185014, 0.27131, 0.916347, 
-0.955498, -0.172739, 0.248585, 0.943738, 
-0.960038, -0.159986, 0.225447, 0.970183, 
-0.964671, -0.146414, 0.202619, 0.994972, 
-0.968021, -0.131302, 0.179936, 1.01885, 
-0.97142, -0.115704, 0.157898, 1.0394, 
-0.973206, -0.100286, 0.136292, 1.05872, 
-0.975675, -0.0833317, 0.11403, 1.07647, 
-0.97963, -0.0669013, 0.0912268, 1.09302, 
-0.984545, -0.0501004, 0.0682998, 1.10757, 
-0.990272, -0.0332373, 0.0452506, 1.12083, 
-0.995874, -0.0161478, 0.0221702, 1.13287, 
-1, 0.000234021, -0.00013204, 1.14433, 
-0.82968, -0.55824, 0.55824, 0.82968, 
-0.82968, -0.558239, 0.558239, 0.82968, 
-0.82968, -0.558239, 0.558239, 0.82968, 
-0.829683, -0.558235, 0.558235, 0.829683, 
-0.681127, -0.00371396, 0.458211, 0.00552004, 
-6.70054, -0.0194317, 4.51867, 0.0288826, 
-0.718584, -0.00859082, 0.483301, 0.0127702, 
-7.30665, -0.042307, 4.92303, 0.0628977, 
-0.175868, -0.00750175, 0.114832, 0.0111552, 
-0.00919871, -0.00648968, 0.00614766, 0.00965324, 
-0.70857, -0.0237811, 0.476149, 0.0353889, 
-0.691955, -0.0291466, 0.46422, 0.0433985, 
-0.593146, -0.0313568, 0.397541, 0.0467243, 
-0.687721, -0.0392514, 0.462747, 0.0585438, 
-0.436147, -0.0342818, 0.290188, 0.0511932, 
-0.69146, -0.0524481, 0.464878, 0.0784465, 
-0.689677, -0.0594121, 0.463699, 0.0891502, 
-0.690151, -0.0665722, 0.463877, 0.100733, 
-0.690747, -0.0743108, 0.464103, 0.113074, 
-0.691458, -0.0824755, 0.464361, 0.126166, 
-0.692254, -0.0910513, 0.464621, 0.140012, 
-0.693172, -0.0998786, 0.464877, 0.154613, 
-0.694534, -0.108652, 0.465275, 0.169985, 
-0.695994, -0.11786, 0.465643, 0.186115, 
-0.697786, -0.127344, 0.466076, 0.203039, 
-0.700311, -0.136706, 0.466742, 0.220689, 
-0.703326, -0.146378, 0.467533, 0.239049, 
-0.707797, -0.156085, 0.468978, 0.25817, 
-0.711727, -0.165913, 0.469924, 0.277774, 
-0.717634, -0.175823, 0.471898, 0.297954, 
-0.72394, -0.185916, 0.473846, 0.318892, 
-0.732081, -0.195246, 0.475964, 0.341606, 
-0.740957, -0.203967, 0.477368, 0.365966, 
-0.751377, -0.212119, 0.47879, 0.391407, 
-0.761834, -0.219818, 0.479317, 0.417652, 
-0.771833, -0.22671, 0.478444, 0.444421, 
-0.783948, -0.232972, 0.477634, 0.472045, 
-0.7961, -0.238643, 0.475431, 0.500189, 
-0.808645, -0.243295, 0.472459, 0.528431, 
-0.821141, -0.247181, 0.467716, 0.557263, 
-0.833901, -0.250018, 0.461595, 0.586571, 
-0.846522, -0.250989, 0.453416, 0.616922, 
-0.860058, -0.25061, 0.443903, 0.647675, 
-0.871907, -0.248807, 0.431507, 0.678185, 
-0.882566, -0.245791, 0.417531, 0.708214, 
-0.893521, -0.242183, 0.402197, 0.738301, 
-0.903127, -0.236991, 0.385527, 0.767771, 
-0.913592, -0.229976, 0.367109, 0.79821, 
-0.922635, -0.221595, 0.346793, 0.827413, 
-0.9315, -0.212343, 0.325896, 0.856415, 
-0.939449, -0.202125, 0.304045, 0.884584, 
-0.945034, -0.190969, 0.280512, 0.91197, 
-0.95159, -0.17798, 0.257015, 0.939218, 
-0.957249, -0.164582, 0.233302, 0.966245, 
-0.961981, -0.150872, 0.209477, 0.992427, 
-0.966196, -0.135761, 0.185989, 1.01627, 
-0.969313, -0.119561, 0.163086, 1.03816, 
-0.971336, -0.103181, 0.140519, 1.05818, 
-0.974342, -0.0865874, 0.117863, 1.0763, 
-0.978661, -0.0690708, 0.0943945, 1.09307, 
-0.983602, -0.0516633, 0.0706173, 1.10809, 
-0.989679, -0.0345607, 0.0469195, 1.12191, 
-0.995547, -0.0167806, 0.0229768, 1.13418, 
-1.00006, 0.000372996, -0.000224307, 1.14589, 
-0.816326, -0.577591, 0.577591, 0.816326, 
-0.816327, -0.57759, 0.57759, 0.816327, 
-0.816327, -0.57759, 0.57759, 0.816327, 
-0.81633, -0.577586, 0.577586, 0.81633, 
-0.487506, -0.00335988, 0.346754, 0.00474878, 
-2.84421, -0.0124526, 2.00784, 0.0176012, 
-0.00306475, -0.00227031, 0.00217361, 0.00320928, 
-0.0160844, -0.00396161, 0.0132717, 0.00560095, 
-0.14214, -0.0111058, 0.11096, 0.0157051, 
-0.00889897, -0.00660236, 0.00625618, 0.00933985, 
-0.656835, -0.0236804, 0.464957, 0.0335147, 
-1.02642, -0.0381595, 0.724367, 0.0540413, 
-0.146861, -0.0159156, 0.104477, 0.0225582, 
-0.660413, -0.0399187, 0.467223, 0.0566391, 
-0.76493, -0.0493621, 0.539568, 0.070132, 
-0.667231, -0.053264, 0.47186, 0.0758126, 
-0.667779, -0.0603812, 0.472101, 0.0863434, 
-0.668366, -0.0677398, 0.47236, 0.0975926, 
-0.66898, -0.0756021, 0.472604, 0.109566, 
-0.669742, -0.0839331, 0.472901, 0.122278, 
-0.670466, -0.0926618, 0.473126, 0.135709, 
-0.671568, -0.101605, 0.473495, 0.149922, 
-0.672923, -0.110566, 0.473902, 0.164882, 
-0.674307, -0.119987, 0.474227, 0.180606, 
-0.676493, -0.129571, 0.474897, 0.197106, 
-0.679214, -0.139103, 0.475719, 0.214366, 
-0.682834, -0.148995, 0.476931, 0.232409, 
-0.687017, -0.158739, 0.478194, 0.251157, 
-0.691502, -0.168756, 0.479493, 0.270438, 
-0.69758, -0.178722, 0.481573, 0.290405, 
-0.704713, -0.188945, 0.484128, 0.311028, 
-0.71358, -0.198792, 0.487034, 0.332966, 
-0.723229, -0.207849, 0.489001, 0.357109, 
-0.732591, -0.216169, 0.48984, 0.382135, 
-0.743954, -0.223951, 0.490614, 0.408175, 
-0.754908, -0.23116, 0.490307, 0.434936, 
-0.767686, -0.237496, 0.489601, 0.462649, 
-0.780391, -0.243446, 0.487666, 0.490794, 
-0.794195, -0.248177, 0.484968, 0.519554, 
-0.806948, -0.252126, 0.480013, 0.548358, 
-0.820294, -0.255263, 0.474093, 0.577766, 
-0.833756, -0.25673, 0.466146, 0.607755, 
-0.848775, -0.256487, 0.456826, 0.639097, 
-0.860631, -0.254761, 0.444049, 0.669944, 
-0.873771, -0.251761, 0.430429, 0.700546, 
-0.885712, -0.247832, 0.414731, 0.731344, 
-0.895908, -0.242638, 0.397157, 0.761204, 
-0.90563, -0.236004, 0.377792, 0.790754, 
-0.917254, -0.227556, 0.358141, 0.821345, 
-0.92525, -0.217808, 0.335857, 0.850663, 
-0.934626, -0.207562, 0.31346, 0.879378, 
-0.941021, -0.195924, 0.289722, 0.907459, 
-0.94741, -0.183593, 0.265322, 0.935338, 
-0.953697, -0.169356, 0.24067, 0.962803, 
-0.95982, -0.154908, 0.21606, 0.989223, 
-0.964199, -0.140122, 0.191917, 1.01436, 
-0.96794, -0.123384, 0.167847, 1.03715, 
-0.969851, -0.106521, 0.144955, 1.05763, 
-0.972669, -0.0890965, 0.121537, 1.07603, 
-0.976973, -0.0718086, 0.0977114, 1.09335, 
-0.982489, -0.0534184, 0.0729644, 1.10872, 
-0.989119, -0.0355579, 0.048337, 1.12285, 
-0.995139, -0.0176391, 0.0239821, 1.13553, 
-1.00007, 0.000368833, -0.000238069, 1.14748, 
-0.802469, -0.596694, 0.596694, 0.802469, 
-0.802469, -0.596694, 0.596694, 0.802469, 
-0.80247, -0.596693, 0.596693, 0.80247, 
-0.802473, -0.596689, 0.596689, 0.802473, 
-0.634858, -0.00371673, 0.47242, 0.00499869, 
-215.465, -0.464976, 160.128, 0.625388, 
-1.20996, -0.0107902, 0.901845, 0.0145142, 
-0.949256, -0.0140942, 0.685894, 0.0189617, 
-0.00638729, -0.00494809, 0.0047674, 0.00665871, 
-0.00860353, -0.0067028, 0.00635288, 0.00902344, 
-0.711962, -0.026535, 0.531179, 0.0357407, 
-0.810809, -0.0333475, 0.604474, 0.0449481, 
-0.626844, -0.034253, 0.46524, 0.0462107, 
-0.436001, -0.0338971, 0.323663, 0.0457838, 
-0.878958, -0.0603875, 0.628632, 0.0816849, 
-0.64464, -0.0540605, 0.479042, 0.0732781, 
-0.645522, -0.0612, 0.479555, 0.0834896, 
-0.646105, -0.0687296, 0.47982, 0.0943863, 
-0.646701, -0.0767834, 0.480059, 0.105989, 
-0.64748, -0.0852471, 0.480382, 0.11831, 
-0.648049, -0.0940459, 0.480526, 0.131311, 
-0.64953, -0.103058, 0.481118, 0.145143, 
-0.650903, -0.112266, 0.481561, 0.159683, 
-0.652595, -0.121855, 0.482082, 0.174983, 
-0.654861, -0.131508, 0.482821, 0.191083, 
-0.657914, -0.14119, 0.483897, 0.207928, 
-0.661323, -0.151243, 0.484993, 0.225592, 
-0.665582, -0.161099, 0.486344, 0.24396, 
-0.670501, -0.171235, 0.487921, 0.262956, 
-0.677343, -0.181344, 0.490555, 0.282775, 
-0.685618, -0.191655, 0.493847, 0.303273, 
-0.694726, -0.20182, 0.497078, 0.324669, 
-0.703896, -0.211178, 0.498988, 0.347939, 
-0.713693, -0.219671, 0.500098, 0.372622, 
-0.726052, -0.227866, 0.501701, 0.398747, 
-0.738402, -0.235288, 0.501989, 0.425453, 
-0.751874, -0.241725, 0.501566, 0.453094, 
-0.766099, -0.247953, 0.500411, 0.481552, 
-0.779544, -0.252699, 0.497079, 0.510118, 
-0.793941, -0.256798, 0.49284, 0.539313, 
-0.807882, -0.259861, 0.486561, 0.568899, 
-0.822156, -0.261766, 0.478709, 0.598961, 
-0.835838, -0.262026, 0.468456, 0.629812, 
-0.850339, -0.260481, 0.456691, 0.661742, 
-0.8635, -0.257316, 0.44228, 0.692728, 
-0.876744, -0.253346, 0.426691, 0.723841, 
-0.888326, -0.248023, 0.408613, 0.75437, 
-0.8993, -0.241472, 0.389626, 0.784712, 
-0.909671, -0.233499, 0.368495, 0.814812, 
-0.919524, -0.223312, 0.346187, 0.844686, 
-0.929197, -0.212521, 0.322844, 0.874313, 
-0.937006, -0.200841, 0.298378, 0.902798, 
-0.943882, -0.188351, 0.273989, 0.931178, 
-0.94967, -0.174323, 0.247869, 0.958752, 
-0.956063, -0.159055, 0.222562, 0.986476, 
-0.961542, -0.143634, 0.197593, 1.01207, 
-0.96609, -0.127422, 0.172966, 1.03579, 
-0.96871, -0.109785, 0.149024, 1.05687, 
-0.971168, -0.0917, 0.124965, 1.07612, 
-0.975423, -0.0739481, 0.10056, 1.09349, 
-0.981282, -0.0553204, 0.0753867, 1.10945, 
-0.988317, -0.0366821, 0.0499237, 1.12392, 
-0.994845, -0.0180398, 0.0246883, 1.137, 
-1.0001, 0.000229807, -0.00016149, 1.14927, 
-0.788108, -0.615537, 0.615537, 0.788108, 
-0.788108, -0.615537, 0.615537, 0.788108, 
-0.788109, -0.615535, 0.615535, 0.788109, 
-0.788111, -0.615533, 0.615533, 0.788111, 
-0.157817, -0.00262884, 0.120797, 0.003366, 
-2.42083, -0.0130975, 1.89532, 0.0167713, 
-1.12148, -0.0114817, 0.876699, 0.014704, 
-0.00428997, -0.00350213, 0.00335765, 0.00448582, 
-0.00613368, -0.00499033, 0.00480963, 0.00639388, 
-0.0081832, -0.00670099, 0.00635222, 0.00858924, 
-0.618189, -0.0243773, 0.482794, 0.0312645, 
-0.0117881, -0.0118771, 0.00919551, 0.0152445, 
-0.627199, -0.035227, 0.489714, 0.04526, 
-0.53751, -0.0394785, 0.418071, 0.0507876, 
-0.639769, -0.0484648, 0.500315, 0.0624509, 
-0.597322, -0.0546293, 0.453516, 0.070566, 
-0.622823, -0.0619416, 0.485952, 0.0805881, 
-0.623409, -0.0696248, 0.486233, 0.0911265, 
-0.624032, -0.0777934, 0.486497, 0.102351, 
-0.624818, -0.086371, 0.486827, 0.114276, 
-0.562256, -0.0883563, 0.411525, 0.117716, 
-0.627028, -0.104301, 0.487685, 0.140287, 
-0.628519, -0.113728, 0.488226, 0.154402, 
-0.630293, -0.123413, 0.488832, 0.169261, 
-0.632927, -0.133157, 0.489857, 0.184968, 
-0.635788, -0.143046, 0.490817, 0.201353, 
-0.639427, -0.153135, 0.49207, 0.218648, 
-0.643801, -0.163145, 0.493556, 0.236617, 
-0.649824, -0.173321, 0.495913, 0.255436, 
-0.657189, -0.183615, 0.498958, 0.274996, 
-0.666064, -0.193993, 0.502763, 0.295313, 
-0.674479, -0.204164, 0.505484, 0.316201, 
-0.683765, -0.214055, 0.507827, 0.338483, 
-0.695656, -0.222896, 0.510407, 0.363234, 
-0.708249, -0.23124, 0.512047, 0.388944, 
-0.721091, -0.238878, 0.512726, 0.415681, 
-0.73512, -0.245648, 0.51255, 0.443314, 
-0.750047, -0.251833, 0.511503, 0.471804, 
-0.764985, -0.2569, 0.509067, 0.50087, 
-0.779518, -0.261035, 0.504237, 0.530073, 
-0.794872, -0.264378, 0.49846, 0.560274, 
-0.81013, -0.266278, 0.490761, 0.590217, 
-0.824765, -0.266983, 0.480999, 0.620868, 
-0.83951, -0.265804, 0.468848, 0.652752, 
-0.852813, -0.262636, 0.453629, 0.684468, 
-0.866588, -0.258326, 0.437302, 0.715798, 
-0.880345, -0.253203, 0.419677, 0.747554, 
-0.891881, -0.246439, 0.399981, 0.777853, 
-0.902712, -0.238709, 0.37888, 0.808496, 
-0.913761, -0.228836, 0.356269, 0.838789, 
-0.92358, -0.217758, 0.332008, 0.869419, 
-0.932867, -0.205454, 0.307139, 0.898143, 
-0.939769, -0.192584, 0.281427, 0.92685, 
-0.946884, -0.178937, 0.255328, 0.955252, 
-0.952271, -0.163603, 0.22871, 0.983328, 
-0.958449, -0.147225, 0.202805, 1.00979, 
-0.963621, -0.130619, 0.177874, 1.03421, 
-0.967984, -0.113107, 0.153011, 1.05613, 
-0.969864, -0.0945728, 0.128694, 1.07587, 
-0.974479, -0.0755622, 0.103254, 1.09396, 
-0.980068, -0.0571952, 0.0776326, 1.11032, 
-0.987337, -0.0378018, 0.0514924, 1.12498, 
-0.994451, -0.0186423, 0.025402, 1.13854, 
-1.00009, 0.000542673, -0.000296109, 1.151, 
-0.773242, -0.634111, 0.634111, 0.773242, 
-0.773243, -0.63411, 0.63411, 0.773243, 
-0.773244, -0.634109, 0.634109, 0.773244, 
-0.773247, -0.634105, 0.634105, 0.773247, 
-0.622257, -0.00488321, 0.511208, 0.00595495, 
-1.46699, -0.00776821, 1.20958, 0.00947378, 
-3.18934, -0.0189308, 2.61622, 0.0230901, 
-1.08747, -0.0152428, 0.897637, 0.0185957, 
-0.238555, -0.00914472, 0.194555, 0.0111598, 
-0.00796322, -0.00683761, 0.00648353, 0.00834813, 
-0.503939, -0.0218359, 0.413823, 0.0266767, 
-0.0114024, -0.0120856, 0.00933797, 0.0147774, 
-0.618894, -0.0367055, 0.507044, 0.0449309, 
-0.696229, -0.0462978, 0.572509, 0.0567531, 
-0.409136, -0.0426241, 0.310767, 0.0523455, 
-0.590396, -0.0548477, 0.484338, 0.0675592, 
-0.599775, -0.0625411, 0.491308, 0.0776456, 
-0.600349, -0.0703621, 0.491585, 0.0878164, 
-0.601024, -0.0786279, 0.4919, 0.0986603, 
-0.601838, -0.0872975, 0.492253, 0.110181, 
-0.603542, -0.0963024, 0.493219, 0.122494, 
-0.604227, -0.105387, 0.493274, 0.135364, 
-0.605718, -0.114898, 0.493813, 0.149036, 
-0.607695, -0.124657, 0.494576, 0.163473, 
-0.61061, -0.134556, 0.495855, 0.178742, 
-0.613234, -0.144572, 0.496661, 0.194712, 
-0.617506, -0.154691, 0.498422, 0.211601, 
-0.622162, -0.164893, 0.50018, 0.229186, 
-0.629041, -0.175174, 0.503229, 0.2478, 
-0.636925, -0.185553, 0.506734, 0.267099, 
-0.644807, -0.195905, 0.509732, 0.287011, 
-0.653759, -0.206117, 0.512884, 0.307781, 
-0.664914, -0.216443, 0.516786, 0.329624, 
-0.676393, -0.225521, 0.519254, 0.353516, 
-0.6902, -0.234377, 0.521942, 0.379325, 
-0.704417, -0.242085, 0.523246, 0.40599, 
-0.719087, -0.249105, 0.523471, 0.433468, 
-0.734784, -0.25557, 0.522669, 0.462134, 
-0.75052, -0.26075, 0.520444, 0.491333, 
-0.766494, -0.265034, 0.516091, 0.52114, 
-0.78179, -0.268479, 0.509973, 0.551158, 
-0.79696, -0.270449, 0.5015, 0.581569, 
-0.812751, -0.271276, 0.491953, 0.612466, 
-0.828628, -0.270766, 0.480403, 0.643938, 
-0.843346, -0.267808, 0.46566, 0.67612, 
-0.856941, -0.263426, 0.44826, 0.708407, 
-0.871471, -0.258149, 0.430391, 0.740457, 
-0.88519, -0.251263, 0.410801, 0.771865, 
-0.895165, -0.243267, 0.388137, 0.802107, 
-0.907091, -0.23404, 0.365715, 0.833192, 
-0.917842, -0.222776, 0.341226, 0.863768, 
-0.927913, -0.210191, 0.3158, 0.893628, 
-0.936085, -0.196889, 0.289059, 0.922811, 
-0.943195, -0.182755, 0.262231, 0.951433, 
-0.949812, -0.167974, 0.23494, 0.980012, 
-0.955778, -0.151134, 0.208531, 1.00782, 
-0.961389, -0.133846, 0.182299, 1.03338, 
-0.965319, -0.115956, 0.156861, 1.05541, 
-0.968676, -0.0974561, 0.13223, 1.07578, 
-0.973228, -0.0778568, 0.106344, 1.09458, 
-0.979366, -0.0585034, 0.0798516, 1.11131, 
-0.986669, -0.039038, 0.0529794, 1.12634, 
-0.994102, -0.0194064, 0.0262442, 1.14007, 
-0.999998, 0.000540107, -0.000230577, 1.15301, 
-0.757873, -0.652402, 0.652402, 0.757873, 
-0.757873, -0.652402, 0.652402, 0.757873, 
-0.757874, -0.652401, 0.652401, 0.757874, 
-0.757879, -0.652394, 0.652394, 0.757879, 
-0.573135, -0.00390952, 0.493623, 0.00454181, 
-273.897, -0.697428, 235.731, 0.810286, 
-1.11385, -0.0118252, 0.952836, 0.0137407, 
-3.5824, -0.0290461, 3.09218, 0.0337588, 
-0.400705, -0.0122544, 0.347261, 0.0142476, 
-0.00768137, -0.00691978, 0.00656293, 0.00804937, 
-0.57619, -0.0249734, 0.495979, 0.0290705, 
-0.084041, -0.017102, 0.0594908, 0.0199264, 
-0.575547, -0.0358261, 0.495268, 0.0417939, 
-0.911247, -0.0573267, 0.769906, 0.0669807, 
-0.559591, -0.0475879, 0.485515, 0.0557156, 
-0.575721, -0.0557146, 0.495161, 0.0654953, 
-0.576384, -0.0630494, 0.495559, 0.0746618, 
-0.576982, -0.0709308, 0.49587, 0.0844643, 
-0.577646, -0.0792708, 0.496175, 0.0949124, 
-0.578504, -0.0880184, 0.496573, 0.106032, 
-0.566524, -0.0956877, 0.490184, 0.116311, 
-0.581022, -0.106221, 0.497709, 0.130368, 
-0.582627, -0.115861, 0.498371, 0.143609, 
-0.584839, -0.12559, 0.499328, 0.157607, 
-0.587594, -0.135609, 0.50051, 0.172414, 
-0.590841, -0.145754, 0.501835, 0.188015, 
-0.594881, -0.155922, 0.503448, 0.204434, 
-0.600539, -0.166284, 0.506037, 0.221739, 
-0.607649, -0.176663, 0.509395, 0.239996, 
-0.615397, -0.187063, 0.51282, 0.258981, 
-0.623425, -0.197436, 0.515778, 0.278732, 
-0.634178, -0.207836, 0.52045, 0.299406, 
-0.645248, -0.218239, 0.524343, 0.320885, 
-0.657994, -0.227818, 0.528106, 0.343868, 
-0.670913, -0.236806, 0.530123, 0.369252, 
-0.685451, -0.24476, 0.531611, 0.395738, 
-0.701108, -0.25203, 0.532548, 0.423418, 
-0.717652, -0.258736, 0.532015, 0.452239, 
-0.733983, -0.264115, 0.529826, 0.481403, 
-0.750166, -0.268462, 0.525538, 0.511314, 
-0.767353, -0.272028, 0.520122, 0.542006, 
-0.7851, -0.274257, 0.513031, 0.572865, 
-0.800628, -0.275059, 0.502872, 0.603532, 
-0.81679, -0.274859, 0.490718, 0.635259, 
-0.833246, -0.27273, 0.476819, 0.667686, 
-0.847935, -0.268178, 0.459577, 0.700395, 
-0.862023, -0.262794, 0.440397, 0.732974, 
-0.876726, -0.255805, 0.420274, 0.764882, 
-0.889601, -0.24774, 0.398176, 0.796512, 
-0.900496, -0.238387, 0.374476, 0.827353, 
-0.911786, -0.227744, 0.349805, 0.858235, 
-0.922019, -0.21482, 0.323321, 0.888601, 
-0.932254, -0.201133, 0.296804, 0.918605, 
-0.939958, -0.186528, 0.2692, 0.94783, 
-0.94707, -0.171611, 0.241327, 0.977435, 
-0.953452, -0.155295, 0.213984, 1.00528, 
-0.958552, -0.137177, 0.186806, 1.03196, 
-0.963463, -0.118692, 0.160905, 1.05496, 
-0.96658, -0.0998378, 0.135493, 1.07571, 
-0.971366, -0.08052, 0.109231, 1.09481, 
-0.978227, -0.0599359, 0.0818665, 1.11232, 
-0.98593, -0.0399642, 0.0544884, 1.12765, 
-0.993834, -0.0198686, 0.0269773, 1.14189, 
-1.00006, 0.000270995, -0.000153742, 1.15507, 
-0.741999, -0.670401, 0.670401, 0.741999, 
-0.742001, -0.670399, 0.670399, 0.742001, 
-0.742001, -0.670398, 0.670398, 0.742001, 
-0.742007, -0.670392, 0.670392, 0.742007, 
-0.0426034, -0.00220176, 0.0383711, 0.00243706, 
-39.2529, -0.0822249, 35.3664, 0.0910198, 
-4.68026, -0.029497, 4.17496, 0.0326571, 
-0.00392932, -0.00370582, 0.00356075, 0.00410386, 
-0.413635, -0.017988, 0.386835, 0.0199278, 
-0.00730099, -0.00690568, 0.00655056, 0.00765465, 
-0.539646, -0.0247727, 0.487382, 0.0274807, 
-0.010513, -0.0122753, 0.00949301, 0.0136313, 
-0.554733, -0.0361402, 0.500483, 0.0401864, 
-0.0718467, -0.0228911, 0.0483373, 0.0254979, 
-0.352798, -0.0366947, 0.320617, 0.0409675, 
-0.552063, -0.0559586, 0.498302, 0.0628357, 
-0.55269, -0.0633979, 0.498689, 0.0716462, 
-0.553337, -0.0713187, 0.499043, 0.0810758, 
-0.554003, -0.0797268, 0.499355, 0.0911289, 
-0.554932, -0.0885284, 0.499821, 0.101843, 
-0.556199, -0.0974582, 0.500566, 0.113258, 
-0.557532, -0.106844, 0.501052, 0.125319, 
-0.559411, -0.116531, 0.501925, 0.138126, 
-0.561644, -0.126301, 0.502961, 0.1517, 
-0.564265, -0.136381, 0.50405, 0.166032, 
-0.567802, -0.146565, 0.505657, 0.181193, 
-0.572541, -0.156821, 0.507919, 0.197246, 
-0.578938, -0.167325, 0.51124, 0.21426, 
-0.585442, -0.177737, 0.514126, 0.23207, 
-0.593084, -0.188211, 0.517502, 0.250768, 
-0.603412, -0.198765, 0.522429, 0.27052, 
-0.613713, -0.209133, 0.526644, 0.290746, 
-0.626105, -0.219618, 0.531646, 0.312164, 
-0.637897, -0.229536, 0.534906, 0.334497, 
-0.652784, -0.238793, 0.538602, 0.359297, 
-0.66702, -0.247088, 0.539866, 0.385678, 
-0.683157, -0.254659, 0.540767, 0.413292, 
-0.699857, -0.261373, 0.540487, 0.441899, 
-0.717511, -0.267006, 0.5389, 0.47147, 
-0.735023, -0.271588, 0.535181, 0.501673, 
-0.753632, -0.275366, 0.530204, 0.532737, 
-0.77112, -0.277767, 0.522531, 0.563947, 
-0.787461, -0.278592, 0.512009, 0.595209, 
-0.8059, -0.278478, 0.501241, 0.627148, 
-0.822087, -0.276985, 0.486922, 0.659312, 
-0.838646, -0.272929, 0.47026, 0.692251, 
-0.853344, -0.267199, 0.450659, 0.725598, 
-0.868129, -0.260282, 0.429873, 0.758189, 
-0.882008, -0.251874, 0.407128, 0.789962, 
-0.894491, -0.24245, 0.38333, 0.821685, 
-0.905039, -0.231933, 0.357289, 0.853118, 
-0.91653, -0.219585, 0.331364, 0.883934, 
-0.9272, -0.205334, 0.304047, 0.914239, 
-0.936102, -0.190337, 0.27571, 0.944245, 
-0.944427, -0.174859, 0.247396, 0.97421, 
-0.951052, -0.158648, 0.219309, 1.00324, 
-0.956498, -0.140972, 0.191629, 1.03, 
-0.962417, -0.121501, 0.164709, 1.05461, 
-0.965071, -0.102058, 0.138884, 1.07599, 
-0.969847, -0.0822457, 0.111853, 1.09522, 
-0.976933, -0.0620342, 0.0841879, 1.11319, 
-0.985127, -0.0409904, 0.0558913, 1.12931, 
-0.993362, -0.0201423, 0.0276162, 1.14358, 
-1.00002, 0.000273242, -0.000163613, 1.15734, 
-0.725623, -0.688092, 0.688092, 0.725623, 
-0.725624, -0.688091, 0.688091, 0.725624, 
-0.725625, -0.68809, 0.68809, 0.725625, 
-0.72563, -0.688085, 0.688085, 0.72563, 
-0.373612, -0.00299978, 0.354006, 0.0031636, 
-1.74081, -0.010787, 1.66004, 0.0113771, 
-4.49119, -0.0281143, 4.2078, 0.0296575, 
-0.838429, -0.0144193, 0.797503, 0.015215, 
-0.00516417, -0.00510406, 0.00491661, 0.00538799, 
-0.00698076, -0.00692953, 0.0065742, 0.00731952, 
-0.528477, -0.0251602, 0.501107, 0.0265989, 
-0.00994899, -0.012172, 0.00941681, 0.0128826, 
-0.52859, -0.0362837, 0.501962, 0.0384591, 
-0.0166319, -0.0195047, 0.0152036, 0.0207137, 
-0.326667, -0.0357509, 0.312149, 0.0380669, 
-0.528195, -0.0561144, 0.500332, 0.0601546, 
-0.528809, -0.0635992, 0.500722, 0.0686063, 
-0.529364, -0.0715804, 0.500997, 0.0776512, 
-0.530175, -0.0799849, 0.50145, 0.0873142, 
-0.531105, -0.0888058, 0.50192, 0.0976112, 
-0.532598, -0.0978045, 0.50281, 0.108632, 
-0.533841, -0.107196, 0.503302, 0.120234, 
-0.535823, -0.116889, 0.50432, 0.132604, 
-0.538003, -0.126744, 0.505299, 0.145709, 
-0.540932, -0.136821, 0.506704, 0.15962, 
-0.544822, -0.147111, 0.508653, 0.174362, 
-0.55026, -0.157449, 0.511636, 0.190031, 
-0.556029, -0.16799, 0.514415, 0.20659, 
-0.562902, -0.178339, 0.517729, 0.224015, 
-0.571661, -0.189042, 0.522103, 0.242548, 
-0.582229, -0.199548, 0.527328, 0.261979, 
-0.592786, -0.210116, 0.531732, 0.282205, 
-0.605499, -0.220421, 0.536874, 0.303389, 
-0.618013, -0.230633, 0.540888, 0.325381, 
-0.632432, -0.240301, 0.544651, 0.349085, 
-0.648839, -0.248841, 0.547683, 0.375419, 
-0.665718, -0.256664, 0.549306, 0.403035, 
-0.683459, -0.263721, 0.549495, 0.431788, 
-0.701215, -0.269567, 0.547553, 0.461324, 
-0.719344, -0.274283, 0.54402, 0.491828, 
-0.738128, -0.278193, 0.538857, 0.523122, 
-0.756556, -0.280563, 0.53095, 0.554638, 
-0.775325, -0.281794, 0.521752, 0.586551, 
-0.792397, -0.281668, 0.509289, 0.618631, 
-0.811967, -0.28036, 0.496294, 0.651496, 
-0.828143, -0.277256, 0.479638, 0.684339, 
-0.84414, -0.271556, 0.460277, 0.717787, 
-0.859326, -0.264479, 0.43867, 0.751439, 
-0.873529, -0.255949, 0.415425, 0.783634, 
-0.887139, -0.246312, 0.391244, 0.816193, 
-0.899705, -0.235555, 0.365395, 0.848036, 
-0.910665, -0.223525, 0.338496, 0.878922, 
-0.921748, -0.209836, 0.310668, 0.910158, 
-0.931573, -0.194325, 0.281818, 0.940988, 
-0.940078, -0.178134, 0.252806, 0.97101, 
-0.947665, -0.161475, 0.224216, 1.00075, 
-0.954938, -0.143963, 0.19597, 1.02826, 
-0.960579, -0.124954, 0.168669, 1.05404, 
-0.963988, -0.104311, 0.141651, 1.07623, 
-0.968805, -0.083865, 0.114236, 1.09617, 
-0.975569, -0.0635555, 0.0863166, 1.11444, 
-0.984278, -0.0422905, 0.0573971, 1.13068, 
-0.992882, -0.0209123, 0.0283957, 1.14564, 
-1.00001, 0.000743105, -0.00035842, 1.1596, 
-0.708742, -0.705467, 0.705467, 0.708742, 
-0.708743, -0.705467, 0.705467, 0.708743, 
-0.708744, -0.705465, 0.705465, 0.708744, 
-0.70875, -0.705459, 0.705459, 0.70875, 
-0.364564, -0.00346248, 0.363251, 0.00347881, 
-0.630693, -0.00549452, 0.626033, 0.005521, 
-0.659942, -0.00887902, 0.657077, 0.00892346, 
-0.104957, -0.00618081, 0.10497, 0.00621364, 
-0.50759, -0.0187149, 0.511526, 0.0188232, 
-0.00664484, -0.00692822, 0.00657325, 0.00697302, 
-0.516211, -0.0252115, 0.514605, 0.0253983, 
-0.00964036, -0.0123809, 0.00958106, 0.0124882, 
-0.529401, -0.0371406, 0.527778, 0.0375241, 
-1.60203, -0.0964236, 1.5779, 0.0976254, 
-0.168183, -0.0357142, 0.141427, 0.0362725, 
-0.50411, -0.0561473, 0.501183, 0.0574538, 
-0.504678, -0.063685, 0.501537, 0.0655411, 
-0.505285, -0.0716821, 0.501872, 0.0742058, 
-0.506067, -0.0800931, 0.502302, 0.0834706, 
-0.507134, -0.088844, 0.502911, 0.0933619, 
-0.508494, -0.0978621, 0.503695, 0.103918, 
-0.509982, -0.107309, 0.504448, 0.115119, 
-0.512119, -0.116926, 0.50562, 0.12706, 
-0.514447, -0.126895, 0.506776, 0.139715, 
-0.517592, -0.13694, 0.508393, 0.15318, 
-0.52204, -0.147323, 0.510939, 0.167524, 
-0.527006, -0.157615, 0.513566, 0.182712, 
-0.533029, -0.168191, 0.516631, 0.198855, 
-0.540842, -0.178714, 0.520906, 0.216018, 
-0.55076, -0.189495, 0.52641, 0.234316, 
-0.560407, -0.199975, 0.530862, 0.253345, 
-0.571607, -0.210628, 0.535794, 0.273468, 
-0.584637, -0.220993, 0.541306, 0.294457, 
-0.598955, -0.231363, 0.546762, 0.316516, 
-0.614488, -0.241299, 0.551608, 0.339802, 
-0.630962, -0.250295, 0.555141, 0.365188, 
-0.647774, -0.258341, 0.556458, 0.392681, 
-0.666242, -0.26558, 0.557165, 0.42148, 
-0.68568, -0.271757, 0.555993, 0.451316, 
-0.705107, -0.276735, 0.553246, 0.482123, 
-0.723979, -0.280755, 0.547872, 0.513498, 
-0.743058, -0.283426, 0.539992, 0.545575, 
-0.761924, -0.28447, 0.530324, 0.577607, 
-0.781221, -0.284491, 0.518724, 0.610399, 
-0.799198, -0.283321, 0.504378, 0.643205, 
-0.817767, -0.280413, 0.488215, 0.676332, 
-0.834254, -0.275566, 0.469377, 0.709562, 
-0.85088, -0.268449, 0.447639, 0.743935, 
-0.866664, -0.260139, 0.425022, 0.777829, 
-0.88161, -0.249968, 0.400097, 0.810518, 
-0.893258, -0.239082, 0.373138, 0.842678, 
-0.906032, -0.226812, 0.345789, 0.874652, 
-0.916146, -0.213681, 0.31706, 0.906176, 
-0.927372, -0.198423, 0.28824, 0.936854, 
-0.93595, -0.181695, 0.258502, 0.968225, 
-0.943988, -0.164478, 0.228829, 0.998773, 
-0.951503, -0.146386, 0.199882, 1.02722, 
-0.958522, -0.127691, 0.172303, 1.05334, 
-0.963152, -0.107237, 0.144954, 1.07638, 
-0.967583, -0.0858007, 0.116985, 1.09706, 
-0.974845, -0.06454, 0.0882332, 1.1158, 
-0.983497, -0.0431812, 0.0587137, 1.13248, 
-0.992585, -0.021836, 0.0293895, 1.14782, 
-0.999981, 0.000605164, -0.000277081, 1.16202, 
-0.691359, -0.722512, 0.722512, 0.691359, 
-0.691359, -0.722512, 0.722512, 0.691359, 
-0.691359, -0.722511, 0.722511, 0.691359, 
-0.691367, -0.722503, 0.722503, 0.691367, 
-0.0168936, -0.00158595, 0.0176631, 0.00151768, 
-0.477826, -0.00629179, 0.499352, 0.00602165, 
-1.95379, -0.0187161, 2.0429, 0.0179161, 
-0.00328379, -0.00358904, 0.00344141, 0.00343681, 
-0.0047399, -0.00516479, 0.00497376, 0.00494827, 
-0.00635016, -0.00694549, 0.00659061, 0.00665928, 
-0.492891, -0.0253398, 0.514953, 0.0243207, 
-0.00906303, -0.0122225, 0.00945104, 0.0117472, 
-0.483723, -0.0363806, 0.505522, 0.0350291, 
-0.0521831, -0.024023, 0.0370088, 0.023185, 
-0.362087, -0.0434704, 0.372906, 0.0421236, 
-0.479841, -0.0560723, 0.500808, 0.0547378, 
-0.480365, -0.0636103, 0.501121, 0.0624586, 
-0.481171, -0.0716179, 0.501658, 0.0707518, 
-0.481939, -0.0800091, 0.502098, 0.0796147, 
-0.483064, -0.0886587, 0.502775, 0.0890993, 
-0.484346, -0.0977599, 0.503486, 0.0992146, 
-0.486073, -0.10717, 0.504503, 0.109987, 
-0.488604, -0.116791, 0.506172, 0.121498, 
-0.490589, -0.126733, 0.506933, 0.13368, 
-0.494155, -0.136778, 0.509035, 0.146715, 
-0.498391, -0.147123, 0.511424, 0.160585, 
-0.503614, -0.157453, 0.514376, 0.175342, 
-0.510884, -0.168122, 0.518767, 0.191207, 
-0.51919, -0.178781, 0.523597, 0.208037, 
-0.52842, -0.189465, 0.528556, 0.225943, 
-0.538915, -0.200165, 0.533712, 0.244807, 
-0.551513, -0.210776, 0.540088, 0.264848, 
-0.565008, -0.22127, 0.545959, 0.285702, 
-0.579571, -0.231754, 0.551594, 0.30768, 
-0.595578, -0.241776, 0.557027, 0.330662, 
-0.610933, -0.251004, 0.559798, 0.355012, 
-0.629005, -0.259436, 0.562221, 0.382227, 
-0.64832, -0.266974, 0.563477, 0.411028, 
-0.667911, -0.273439, 0.562537, 0.441007, 
-0.689141, -0.278794, 0.560766, 0.472129, 
-0.709156, -0.282761, 0.555637, 0.503734, 
-0.729948, -0.285899, 0.548884, 0.536482, 
-0.748698, -0.287014, 0.538243, 0.568823, 
-0.768339, -0.287088, 0.526666, 0.601895, 
-0.788313, -0.28585, 0.512498, 0.635425, 
-0.807058, -0.28321, 0.496263, 0.66873, 
-0.824814, -0.279023, 0.477694, 0.70249, 
-0.842164, -0.272282, 0.456403, 0.736381, 
-0.857905, -0.263896, 0.432207, 0.771081, 
-0.874044, -0.253811, 0.407381, 0.804473, 
-0.887781, -0.242358, 0.380364, 0.83767, 
-0.899388, -0.230165, 0.352417, 0.869947, 
-0.912361, -0.21659, 0.323567, 0.9028, 
-0.923212, -0.202065, 0.29463, 0.933277, 
-0.932738, -0.18557, 0.263914, 0.96544, 
-0.940613, -0.167687, 0.233586, 0.996794, 
-0.948853, -0.149132, 0.203944, 1.02653, 
-0.955028, -0.129504, 0.175344, 1.05275, 
-0.960446, -0.109939, 0.147945, 1.07624, 
-0.965844, -0.0880639, 0.119591, 1.09751, 
-0.973305, -0.0660455, 0.0902845, 1.11705, 
-0.982768, -0.0439218, 0.0599423, 1.13433, 
-0.992167, -0.0219569, 0.0298117, 1.14996, 
-0.999996, 0.000119422, -2.86294e-05, 1.1648, 
-0.673471, -0.739214, 0.739214, 0.673471, 
-0.673469, -0.739215, 0.739215, 0.673469, 
-0.673471, -0.739214, 0.739214, 0.673471, 
-0.673479, -0.739206, 0.739206, 0.673479, 
-0.0159001, -0.00156108, 0.0174603, 0.00142236, 
-0.452962, -0.00626677, 0.497173, 0.00571062, 
-3.46106, -0.0260667, 3.81719, 0.0237587, 
-0.00310912, -0.00357022, 0.00341995, 0.00325532, 
-0.328783, -0.0142962, 0.361825, 0.0130427, 
-0.00604387, -0.00694876, 0.00659294, 0.0063447, 
-0.452091, -0.0249541, 0.496273, 0.0228108, 
-0.00852708, -0.0120809, 0.0093496, 0.0110601, 
-0.457025, -0.0362557, 0.501547, 0.0332585, 
-0.0168301, -0.0202293, 0.0165886, 0.0186059, 
-0.374265, -0.0415722, 0.410282, 0.0384546, 
-0.455519, -0.0558667, 0.499267, 0.0520166, 
-0.456093, -0.0633773, 0.499647, 0.0593754, 
-0.456736, -0.0713589, 0.50003, 0.0672735, 
-0.457675, -0.0797115, 0.500643, 0.075746, 
-0.458873, -0.0883062, 0.501418, 0.084826, 
-0.460806, -0.0974494, 0.502762, 0.0945523, 
-0.461996, -0.106724, 0.503306, 0.104844, 
-0.464044, -0.116346, 0.504465, 0.115877, 
-0.466897, -0.126215, 0.506203, 0.127653, 
-0.470755, -0.136327, 0.508676, 0.140242, 
-0.474817, -0.146582, 0.510947, 0.153659, 
-0.480852, -0.157024, 0.514803, 0.16805, 
-0.488309, -0.167669, 0.519533, 0.183519, 
-0.496576, -0.178353, 0.524424, 0.199958, 
-0.506227, -0.188915, 0.529805, 0.217502, 
-0.517915, -0.199989, 0.536328, 0.236289, 
-0.53131, -0.210625, 0.543513, 0.256098, 
-0.545578, -0.221173, 0.550079, 0.277018, 
-0.559623, -0.231583, 0.555001, 0.298635, 
-0.576175, -0.241865, 0.561017, 0.321768, 
-0.591746, -0.251178, 0.563917, 0.34561, 
-0.610444, -0.260128, 0.567438, 0.37178, 
-0.630427, -0.268025, 0.569315, 0.400657, 
-0.65163, -0.274554, 0.569414, 0.430632, 
-0.672271, -0.280248, 0.566824, 0.461802, 
-0.693013, -0.284568, 0.561909, 0.49397, 
-0.715029, -0.287702, 0.555654, 0.526718, 
-0.736225, -0.289279, 0.546204, 0.56008, 
-0.755875, -0.289463, 0.533992, 0.593663, 
-0.776092, -0.288271, 0.519761, 0.627628, 
-0.795601, -0.285528, 0.503077, 0.661386, 
-0.815244, -0.281515, 0.484975, 0.695449, 
-0.83237, -0.275666, 0.463898, 0.729423, 
-0.849431, -0.267502, 0.440079, 0.764028, 
-0.866275, -0.257571, 0.414635, 0.799047, 
-0.881435, -0.245973, 0.387755, 0.832476, 
-0.894453, -0.233218, 0.359025, 0.865864, 
-0.906535, -0.219535, 0.329557, 0.898, 
-0.919558, -0.204463, 0.300197, 0.929886, 
-0.928697, -0.188976, 0.269174, 0.962134, 
-0.938188, -0.171102, 0.238209, 0.99435, 
-0.946129, -0.151939, 0.208107, 1.02498, 
-0.953135, -0.131944, 0.178897, 1.05283, 
-0.958702, -0.111219, 0.150372, 1.07697, 
-0.963937, -0.0903051, 0.122136, 1.09849, 
-0.971715, -0.0680261, 0.0923131, 1.11834, 
-0.981792, -0.0448534, 0.0613822, 1.1364, 
-0.991809, -0.0221931, 0.0303947, 1.15238, 
-0.999947, 0.000393362, -3.94289e-05, 1.16761, 
-0.655079, -0.75556, 0.75556, 0.655079, 
-0.655077, -0.755562, 0.755562, 0.655077, 
-0.655079, -0.75556, 0.75556, 0.655079, 
-0.655088, -0.755552, 0.755552, 0.655088, 
-0.0155628, -0.00159127, 0.0179632, 0.00137977, 
-0.428288, -0.00623411, 0.493972, 0.00540627, 
-0.291609, -0.00791306, 0.332944, 0.00686399, 
-0.00297556, -0.00359076, 0.00343842, 0.003116, 
-0.0380399, -0.00788998, 0.039649, 0.00685108, 
-0.118032, -0.00949363, 0.134164, 0.00825107, 
-0.424888, -0.0251411, 0.48971, 0.0218781, 
-0.00816624, -0.0121537, 0.00940781, 0.0105941, 
-0.394718, -0.0323309, 0.454065, 0.0282445, 
-0.0723278, -0.0320567, 0.0578931, 0.0280884, 
-0.436473, -0.0489116, 0.50249, 0.0431484, 
-0.431121, -0.0555027, 0.496464, 0.0492913, 
-0.431735, -0.0629817, 0.496865, 0.0562875, 
-0.432422, -0.0709245, 0.497336, 0.0638046, 
-0.433391, -0.0791927, 0.498002, 0.0718837, 
-0.434641, -0.0877348, 0.498856, 0.0805519, 
-0.436076, -0.0968037, 0.499781, 0.0898029, 
-0.437856, -0.106, 0.500898, 0.0997129, 
-0.440033, -0.115646, 0.502212, 0.110287, 
-0.443324, -0.12543, 0.504473, 0.121647, 
-0.447056, -0.135504, 0.5069, 0.133782, 
-0.451761, -0.145752, 0.509923, 0.146793, 
-0.458024, -0.156207, 0.514149, 0.16078, 
-0.465338, -0.166826, 0.51885, 0.175783, 
-0.473995, -0.177527, 0.524252, 0.191885, 
-0.484762, -0.188254, 0.530975, 0.20919, 
-0.497143, -0.199305, 0.538215, 0.227778, 
-0.509642, -0.209967, 0.544507, 0.247287, 
-0.524491, -0.220563, 0.551668, 0.268015, 
-0.539248, -0.231085, 0.557299, 0.289676, 
-0.556397, -0.241274, 0.563803, 0.312592, 
-0.574382, -0.250995, 0.569069, 0.336553, 
-0.593481, -0.260312, 0.573097, 0.362227, 
-0.613424, -0.268632, 0.575014, 0.390271, 
-0.63426, -0.2755, 0.574815, 0.42034, 
-0.655938, -0.281439, 0.572904, 0.451792, 
-0.678173, -0.285922, 0.56868, 0.484068, 
-0.700173, -0.289426, 0.56201, 0.51738, 
-0.722562, -0.29121, 0.55327, 0.551132, 
-0.743705, -0.291389, 0.541139, 0.585051, 
-0.763789, -0.290155, 0.52647, 0.61928, 
-0.784588, -0.287789, 0.510056, 0.654361, 
-0.804377, -0.283775, 0.491191, 0.688632, 
-0.823265, -0.277982, 0.470402, 0.722913, 
-0.841008, -0.270648, 0.447022, 0.757332, 
-0.857218, -0.261043, 0.420892, 0.792375, 
-0.874225, -0.249189, 0.394252, 0.826834, 
-0.88897, -0.236562, 0.365578, 0.861329, 
-0.902695, -0.222175, 0.336051, 0.894374, 
-0.914547, -0.207313, 0.305527, 0.926821, 
-0.925731, -0.191116, 0.274608, 0.959347, 
-0.935203, -0.174174, 0.243023, 0.991801, 
-0.944081, -0.155278, 0.212244, 1.02387, 
-0.951564, -0.134423, 0.18201, 1.05255, 
-0.957268, -0.113015, 0.153218, 1.07747, 
-0.962543, -0.0914516, 0.124415, 1.09986, 
-0.970666, -0.0694229, 0.0941072, 1.12008, 
-0.980786, -0.046616, 0.0629798, 1.1384, 
-0.991255, -0.0227044, 0.0311152, 1.155, 
-1, 0.00063246, -0.00025811, 1.17077, 
-0.636178, -0.771542, 0.771542, 0.636178, 
-0.63618, -0.77154, 0.77154, 0.63618, 
-0.636183, -0.771538, 0.771538, 0.636183, 
-0.636193, -0.77153, 0.77153, 0.636193, 
-0.0152717, -0.00161793, 0.0185338, 0.00133422, 
-0.404736, -0.0061834, 0.490838, 0.00509989, 
-137.288, -0.708429, 166.491, 0.584453, 
-1.05097, -0.0230247, 1.27065, 0.019004, 
-0.00398357, -0.00504018, 0.00485336, 0.00416293, 
-0.0870745, -0.0130396, 0.114747, 0.0107809, 
-0.418931, -0.0250808, 0.508268, 0.0207651, 
-0.00765626, -0.0119851, 0.00927958, 0.00994134, 
-0.392809, -0.035219, 0.475775, 0.0292848, 
-0.0153389, -0.0201644, 0.0166239, 0.0168255, 
-0.459764, -0.0504397, 0.553689, 0.0424089, 
-0.406807, -0.0550449, 0.4925, 0.0465725, 
-0.407408, -0.0624652, 0.492929, 0.0532058, 
-0.408159, -0.0702986, 0.493456, 0.0603466, 
-0.409115, -0.0784601, 0.494123, 0.0680278, 
-0.300025, -0.073766, 0.371197, 0.0646703, 
-0.410888, -0.0958858, 0.495004, 0.0850353, 
-0.414099, -0.105101, 0.497732, 0.0946107, 
-0.416146, -0.114642, 0.49889, 0.104722, 
-0.41931, -0.124387, 0.501072, 0.115623, 
-0.423249, -0.134314, 0.503807, 0.127313, 
-0.428515, -0.144592, 0.507558, 0.139922, 
-0.434899, -0.155002, 0.512058, 0.153504, 
-0.44257, -0.165633, 0.517272, 0.168119, 
-0.452501, -0.176368, 0.524196, 0.183998, 
-0.463478, -0.18727, 0.53133, 0.200923, 
-0.475348, -0.198215, 0.538151, 0.219143, 
-0.48869, -0.208955, 0.545267, 0.238534, 
-0.504125, -0.219594, 0.55322, 0.259123, 
-0.52077, -0.23039, 0.560616, 0.281011, 
-0.538374, -0.240656, 0.567385, 0.303761, 
-0.556915, -0.250495, 0.5731, 0.327878, 
-0.576523, -0.259906, 0.577441, 0.353283, 
-0.597244, -0.268776, 0.580733, 0.380413, 
-0.618588, -0.276277, 0.580813, 0.410431, 
-0.640238, -0.282213, 0.57862, 0.441669, 
-0.662312, -0.286831, 0.57407, 0.47394, 
-0.684655, -0.290527, 0.5674, 0.50756, 
-0.707718, -0.29261, 0.558644, 0.541738, 
-0.731384, -0.293313, 0.547818, 0.576825, 
-0.752292, -0.292014, 0.532853, 0.611332, 
-0.77333, -0.289539, 0.516273, 0.646408, 
-0.794282, -0.285549, 0.497673, 0.681733, 
-0.814732, -0.280288, 0.476993, 0.717003, 
-0.83301, -0.27287, 0.453298, 0.751496, 
-0.84957, -0.263979, 0.427698, 0.786075, 
-0.867111, -0.252769, 0.40041, 0.821432, 
-0.881939, -0.239665, 0.370784, 0.856494, 
-0.895305, -0.225296, 0.340636, 0.890472, 
-0.910001, -0.209714, 0.310515, 0.924095, 
-0.922115, -0.193534, 0.279287, 0.956917, 
-0.932562, -0.176255, 0.247263, 0.99012, 
-0.941703, -0.157815, 0.216429, 1.02184, 
-0.949966, -0.137624, 0.185609, 1.05231, 
-0.956362, -0.115297, 0.155724, 1.07833, 
-0.961796, -0.0928388, 0.126478, 1.10145, 
-0.969608, -0.070053, 0.0956413, 1.12197, 
-0.980008, -0.0474633, 0.0642244, 1.14071, 
-0.990913, -0.0238141, 0.0320379, 1.15784, 
-0.999929, 0.000381548, -9.18937e-05, 1.17396, 
-0.616782, -0.787134, 0.787134, 0.616782, 
-0.61678, -0.787135, 0.787135, 0.61678, 
-0.616783, -0.787133, 0.787133, 0.616783, 
-0.616794, -0.787124, 0.787124, 0.616794, 
-0.0143169, -0.00147938, 0.0182594, 0.00115934, 
-0.380157, -0.00611272, 0.485151, 0.00479115, 
-0.494021, -0.00880583, 0.632124, 0.00690411, 
-90.9508, -0.722243, 116.017, 0.566552, 
-0.00378211, -0.00503565, 0.00484596, 0.00395318, 
-0.0937226, -0.0102001, 0.123167, 0.00801636, 
-0.378885, -0.0242986, 0.483408, 0.0191259, 
-0.00723815, -0.0119098, 0.00921599, 0.00939388, 
-0.245293, -0.0279591, 0.313693, 0.022113, 
-0.0358123, -0.0226596, 0.0297925, 0.0180016, 
-0.383737, -0.0476849, 0.489319, 0.0381719, 
-0.382523, -0.0544408, 0.48723, 0.0438626, 
-0.38314, -0.0617862, 0.487695, 0.050135, 
-0.383974, -0.0695129, 0.488334, 0.0569032, 
-0.291871, -0.0644936, 0.372414, 0.0533653, 
-0.542741, -0.109746, 0.692781, 0.0918743, 
-0.387805, -0.0948472, 0.491122, 0.0804435, 
-0.389641, -0.103878, 0.492341, 0.0894713, 
-0.392609, -0.113324, 0.494723, 0.0992193, 
-0.395482, -0.123006, 0.496619, 0.109641, 
-0.399888, -0.132868, 0.499969, 0.120927, 
-0.405299, -0.14307, 0.504047, 0.133101, 
-0.411893, -0.153455, 0.508901, 0.146254, 
-0.420327, -0.164081, 0.515148, 0.160518, 
-0.430969, -0.17489, 0.523138, 0.176121, 
-0.4417, -0.185787, 0.529954, 0.192703, 
-0.454161, -0.196701, 0.537667, 0.210608, 
-0.468838, -0.207675, 0.546315, 0.229958, 
-0.484885, -0.218432, 0.554881, 0.250446, 
-0.502207, -0.22932, 0.563033, 0.272294, 
-0.517828, -0.239417, 0.567506, 0.294814, 
-0.536708, -0.249364, 0.573534, 0.318947, 
-0.556724, -0.258981, 0.578503, 0.344322, 
-0.57764, -0.26798, 0.581792, 0.371091, 
-0.599252, -0.275963, 0.582954, 0.399614, 
-0.625216, -0.28268, 0.584415, 0.431654, 
-0.647615, -0.28759, 0.579884, 0.464183, 
-0.670056, -0.291243, 0.572524, 0.49762, 
-0.693425, -0.293713, 0.563621, 0.532429, 
-0.717468, -0.294659, 0.553021, 0.567882, 
-0.741785, -0.293787, 0.539934, 0.603646, 
-0.761947, -0.291099, 0.521746, 0.638947, 
-0.783627, -0.287354, 0.503134, 0.674825, 
-0.804891, -0.281709, 0.482121, 0.710335, 
-0.823817, -0.274689, 0.45869, 0.74562, 
-0.841676, -0.266059, 0.43292, 0.780717, 
-0.859653, -0.255665, 0.406462, 0.815948, 
-0.875855, -0.242937, 0.376803, 0.851382, 
-0.890075, -0.2284, 0.346058, 0.886748, 
-0.903342, -0.212585, 0.314338, 0.921158, 
-0.916661, -0.19577, 0.282715, 0.954968, 
-0.928119, -0.178304, 0.251105, 0.988605, 
-0.937506, -0.159511, 0.219338, 1.02116, 
-0.946927, -0.139999, 0.188781, 1.0515, 
-0.954508, -0.118185, 0.158744, 1.07847, 
-0.960338, -0.094667, 0.128637, 1.10254, 
-0.9686, -0.071193, 0.097403, 1.12413, 
-0.979572, -0.0475126, 0.0649864, 1.14341, 
-0.990468, -0.0240584, 0.0325569, 1.16074, 
-0.999844, -5.12139e-05, 9.26698e-05, 1.1774, 
-0.596879, -0.802331, 0.802331, 0.596879, 
-0.596876, -0.802334, 0.802334, 0.596876, 
-0.596879, -0.802331, 0.802331, 0.596879, 
-0.596891, -0.802322, 0.802322, 0.596891, 
-0.013226, -0.0015939, 0.017776, 0.0011859, 
-0.356367, -0.00603192, 0.479028, 0.00448872, 
-0.00159223, -0.0022466, 0.00191586, 0.0016724, 
-89.0975, -0.735935, 119.727, 0.548146, 
-0.00353526, -0.00495574, 0.00477066, 0.00369432, 
-0.0812174, -0.0108947, 0.106078, 0.00813163, 
-0.359194, -0.0242089, 0.482278, 0.0181001, 
-0.00674405, -0.0116958, 0.00905278, 0.00876457, 
-0.356714, -0.0346209, 0.479109, 0.0260236, 
-0.0335719, -0.0222043, 0.0293314, 0.0167934, 
-0.350292, -0.0456584, 0.469588, 0.034773, 
-0.358404, -0.0536866, 0.480742, 0.0411712, 
-0.359023, -0.060941, 0.481218, 0.0470836, 
-0.35992, -0.0685224, 0.481958, 0.0534819, 
-0.0338984, -0.0479739, 0.061623, 0.0378704, 
-0.419534, -0.0963967, 0.565577, 0.0770421, 
-0.364361, -0.0935453, 0.485567, 0.0758452, 
-0.366012, -0.102474, 0.486642, 0.0844197, 
-0.368757, -0.111744, 0.488786, 0.0937144, 
-0.372166, -0.121326, 0.491414, 0.103725, 
-0.376995, -0.131147, 0.495462, 0.114607, 
-0.382201, -0.141198, 0.499322, 0.126331, 
-0.389692, -0.151665, 0.505458, 0.139147, 
-0.397862, -0.162058, 0.511591, 0.15298, 
-0.40773, -0.172807, 0.518681, 0.168059, 
-0.42015, -0.183982, 0.527906, 0.184548, 
-0.434093, -0.195002, 0.537407, 0.202289, 
-0.447324, -0.205762, 0.544365, 0.221156, 
-0.463734, -0.216715, 0.553453, 0.241628, 
-0.481072, -0.227449, 0.561618, 0.263204, 
-0.498872, -0.238077, 0.568302, 0.286188, 
-0.517968, -0.247913, 0.574266, 0.310071, 
-0.53842, -0.257549, 0.579506, 0.335547, 
-0.56114, -0.266906, 0.584718, 0.36235, 
-0.583692, -0.275419, 0.587017, 0.390736, 
-0.605757, -0.282264, 0.585316, 0.420884, 
-0.63232, -0.287873, 0.58443, 0.454276, 
-0.656052, -0.291986, 0.577659, 0.488256, 
-0.679915, -0.294639, 0.56902, 0.52339, 
-0.704988, -0.295811, 0.558643, 0.559159, 
-0.728786, -0.295054, 0.544894, 0.595117, 
-0.752109, -0.292784, 0.528263, 0.631876, 
-0.773195, -0.288731, 0.508624, 0.667909, 
-0.794775, -0.283306, 0.487348, 0.703904, 
-0.815773, -0.276272, 0.464172, 0.740439, 
-0.83415, -0.267624, 0.438146, 0.775404, 
-0.852116, -0.257408, 0.410898, 0.810931, 
-0.869607, -0.245568, 0.382287, 0.846057, 
-0.884879, -0.231589, 0.351492, 0.882311, 
-0.898582, -0.215578, 0.318921, 0.917508, 
-0.912786, -0.198176, 0.287374, 0.952267, 
-0.923892, -0.180363, 0.254215, 0.987208, 
-0.934343, -0.161453, 0.222357, 1.02097, 
-0.943642, -0.141242, 0.191153, 1.05252, 
-0.951931, -0.120071, 0.160961, 1.07924, 
-0.95743, -0.0975284, 0.131211, 1.10336, 
-0.966903, -0.0726885, 0.0993766, 1.12623, 
-0.97821, -0.0483731, 0.0661013, 1.14625, 
-0.990041, -0.0239054, 0.032978, 1.16404, 
-0.999682, 0.000461908, -0.000101272, 1.18093, 
-0.576466, -0.817121, 0.817121, 0.576466, 
-0.576466, -0.817121, 0.817121, 0.576466, 
-0.576471, -0.817118, 0.817118, 0.576471, 
-0.576486, -0.817107, 0.817107, 0.576486, 
-0.0112448, -0.00145908, 0.0159463, 0.00102951, 
-0.331179, -0.00592159, 0.469433, 0.00417908, 
-0.535474, -0.00925823, 0.757254, 0.00653633, 
-0.00232254, -0.00344538, 0.00329756, 0.00243396, 
-0.00328627, -0.004864, 0.00467769, 0.0034394, 
-0.00443587, -0.00657678, 0.00623918, 0.0046569, 
-0.336029, -0.0239553, 0.476055, 0.0169946, 
-0.00631651, -0.0115388, 0.0089303, 0.00820687, 
-0.33296, -0.0340673, 0.471536, 0.0243146, 
-0.0319181, -0.0218458, 0.0292064, 0.0157044, 
-0.334005, -0.0460935, 0.472612, 0.0333777, 
-0.334527, -0.0527891, 0.473053, 0.0385079, 
-0.335133, -0.0599267, 0.473526, 0.0440626, 
-0.305792, -0.0646657, 0.43725, 0.0480986, 
-0.336869, -0.0751422, 0.474829, 0.0565409, 
-0.338457, -0.0834237, 0.476271, 0.0636316, 
-0.340165, -0.0919465, 0.477652, 0.0712218, 
-0.342441, -0.100858, 0.479523, 0.0795091, 
-0.345116, -0.10991, 0.481657, 0.0882677, 
-0.350414, -0.11934, 0.488506, 0.0978619, 
-0.353895, -0.129021, 0.489249, 0.108326, 
-0.359812, -0.139016, 0.494194, 0.119679, 
-0.366963, -0.149416, 0.500023, 0.132028, 
-0.37579, -0.159835, 0.507201, 0.14555, 
-0.387119, -0.170664, 0.51642, 0.160434, 
-0.39997, -0.181843, 0.526233, 0.176596, 
-0.412468, -0.192765, 0.534017, 0.193902, 
-0.426976, -0.203683, 0.542638, 0.212683, 
-0.443793, -0.214731, 0.552302, 0.232984, 
-0.461558, -0.225568, 0.560869, 0.254504, 
-0.480799, -0.236183, 0.569138, 0.277445, 
-0.501104, -0.246425, 0.576294, 0.301768, 
-0.521686, -0.256063, 0.581595, 0.327063, 
-0.543599, -0.265303, 0.585335, 0.353935, 
-0.566345, -0.274092, 0.587901, 0.382156, 
-0.589375, -0.281661, 0.587645, 0.411695, 
-0.614644, -0.287652, 0.585833, 0.444143, 
-0.641486, -0.292219, 0.581947, 0.478602, 
-0.666159, -0.295195, 0.573541, 0.51401, 
-0.690581, -0.296539, 0.562006, 0.550227, 
-0.716083, -0.296255, 0.549253, 0.587035, 
-0.740924, -0.294089, 0.53323, 0.624031, 
-0.762804, -0.290079, 0.513421, 0.660949, 
-0.78594, -0.28476, 0.492563, 0.69802, 
-0.807386, -0.277654, 0.469123, 0.73465, 
-0.826333, -0.268896, 0.44269, 0.77079, 
-0.844504, -0.258992, 0.415216, 0.806813, 
-0.863767, -0.247205, 0.387153, 0.842463, 
-0.879128, -0.234134, 0.356234, 0.877991, 
-0.894537, -0.218721, 0.324403, 0.914068, 
-0.908969, -0.201268, 0.291828, 0.949807, 
-0.920425, -0.182629, 0.258118, 0.985114, 
-0.932106, -0.163275, 0.225629, 1.02089, 
-0.94148, -0.14277, 0.193961, 1.05272, 
-0.949597, -0.120987, 0.163318, 1.08102, 
-0.956581, -0.0986056, 0.132893, 1.10594, 
-0.965596, -0.0751299, 0.101194, 1.12841, 
-0.977317, -0.0497929, 0.0676916, 1.14902, 
-0.989557, -0.0241544, 0.0334756, 1.16751, 
-0.999697, 0.000576073, -0.000214695, 1.18496, 
-0.555555, -0.83148, 0.83148, 0.555555, 
-0.555555, -0.83148, 0.83148, 0.555555, 
-0.55556, -0.831477, 0.831477, 0.55556, 
-0.555575, -0.831466, 0.831466, 0.555575, 
-0.0185331, -0.00219533, 0.0285993, 0.00146706, 
-0.309705, -0.00581379, 0.463491, 0.00388602, 
-0.0013044, -0.00226208, 0.00194758, 0.00151264, 
-1.28629, -0.0209619, 1.90799, 0.0140269, 
-0.00304789, -0.00476585, 0.00457853, 0.00319249, 
-0.00409853, -0.00640711, 0.00608528, 0.00429848, 
-0.270726, -0.0217772, 0.407082, 0.0146412, 
-0.00589114, -0.011371, 0.00880301, 0.00766679, 
-0.309108, -0.0329002, 0.46208, 0.0222739, 
-0.126267, -0.0265256, 0.18928, 0.0181062, 
-0.310331, -0.0452028, 0.463553, 0.0310705, 
-0.31085, -0.0517716, 0.464001, 0.0358686, 
-0.311518, -0.0587302, 0.464577, 0.0410809, 
-0.342417, -0.0703176, 0.510332, 0.0497744, 
-0.312629, -0.0735902, 0.46512, 0.052774, 
-0.300569, -0.0796428, 0.445688, 0.0579649, 
-0.313539, -0.0897422, 0.466377, 0.0663746, 
-0.319012, -0.0987739, 0.471036, 0.0744797, 
-0.322125, -0.107798, 0.473833, 0.0829166, 
-0.325849, -0.117057, 0.47719, 0.0920518, 
-0.330942, -0.126582, 0.481738, 0.102121, 
-0.337935, -0.136624, 0.488385, 0.113139, 
-0.345048, -0.146833, 0.494337, 0.125106, 
-0.355022, -0.157339, 0.503204, 0.138341, 
-0.36528, -0.168011, 0.511224, 0.152737, 
-0.378358, -0.179199, 0.521492, 0.168599, 
-0.391907, -0.190221, 0.530825, 0.185686, 
-0.4078, -0.201203, 0.541227, 0.20428, 
-0.424984, -0.212324, 0.551219, 0.224484, 
-0.443642, -0.223466, 0.560962, 0.24606, 
-0.463539, -0.234204, 0.569963, 0.269036, 
-0.483717, -0.244426, 0.576806, 0.293267, 
-0.505591, -0.254398, 0.583163, 0.319057, 
-0.527655, -0.263599, 0.587148, 0.345902, 
-0.550952, -0.272363, 0.589632, 0.374096, 
-0.574619, -0.280388, 0.59037, 0.403819, 
-0.59861, -0.287003, 0.587603, 0.434859, 
-0.624428, -0.291898, 0.583419, 0.468613, 
-0.652575, -0.295233, 0.577127, 0.504537, 
-0.677067, -0.296798, 0.565161, 0.540855, 
-0.703321, -0.296956, 0.552769, 0.578314, 
-0.728135, -0.294968, 0.53647, 0.615749, 
-0.752333, -0.291212, 0.517649, 0.653745, 
-0.775394, -0.286034, 0.496257, 0.69185, 
-0.799113, -0.279031, 0.473776, 0.729166, 
-0.819707, -0.270264, 0.44802, 0.766184, 
-0.837784, -0.26005, 0.419636, 0.802671, 
-0.856818, -0.248491, 0.39076, 0.838563, 
-0.873673, -0.235259, 0.360739, 0.874735, 
-0.88916, -0.221019, 0.329017, 0.910328, 
-0.904981, -0.204375, 0.296259, 0.946862, 
-0.917679, -0.185509, 0.262311, 0.983545, 
-0.928802, -0.16561, 0.228798, 1.01939, 
-0.939482, -0.144432, 0.196774, 1.05326, 
-0.948391, -0.122178, 0.165371, 1.08257, 
-0.955103, -0.0991088, 0.134583, 1.10803, 
-0.964568, -0.0755371, 0.102584, 1.13126, 
-0.976601, -0.0513762, 0.0690562, 1.15206, 
-0.989104, -0.0258481, 0.0346116, 1.1712, 
-0.999917, 0.000617761, -0.000193733, 1.18954, 
-0.534139, -0.845397, 0.845397, 0.534139, 
-0.53414, -0.845396, 0.845396, 0.53414, 
-0.534143, -0.845394, 0.845394, 0.534143, 
-0.534161, -0.845383, 0.845383, 0.534161, 
-0.00965971, -0.00136986, 0.0152826, 0.000865664, 
-0.292839, -0.00571525, 0.463641, 0.00361261, 
-1.512, -0.018394, 2.37302, 0.0116323, 
-0.00193774, -0.00321086, 0.00307796, 0.00203211, 
-0.00282459, -0.00466765, 0.00448647, 0.00295758, 
-0.00380157, -0.00629392, 0.00597082, 0.00399487, 
-0.278492, -0.022178, 0.440596, 0.0141102, 
-0.00540873, -0.0110377, 0.00854552, 0.00704504, 
-0.288873, -0.0326775, 0.45675, 0.0209725, 
-0.79372, -0.0772625, 1.22822, 0.0499778, 
-0.287029, -0.0441881, 0.453297, 0.0287998, 
-0.287599, -0.0506206, 0.453843, 0.0332753, 
-0.288279, -0.0573616, 0.454456, 0.0381492, 
-0.289986, -0.064621, 0.456368, 0.0434953, 
-0.290252, -0.0720398, 0.456286, 0.0491968, 
-0.29169, -0.0798945, 0.457522, 0.0554383, 
-0.265122, -0.0874403, 0.425111, 0.0617532, 
-0.251659, -0.086494, 0.386859, 0.0623613, 
-0.29958, -0.105409, 0.46513, 0.0776582, 
-0.303456, -0.114568, 0.468669, 0.0864293, 
-0.30909, -0.123904, 0.474261, 0.0960978, 
-0.315214, -0.13378, 0.479797, 0.10662, 
-0.324112, -0.144022, 0.488459, 0.118323, 
-0.333177, -0.154363, 0.496305, 0.131117, 
-0.344367, -0.165021, 0.505799, 0.145214, 
-0.357843, -0.176207, 0.516902, 0.160766, 
-0.372826, -0.18744, 0.528258, 0.17778, 
-0.387919, -0.198488, 0.53772, 0.196072, 
-0.404957, -0.20949, 0.547727, 0.215993, 
-0.424022, -0.220797, 0.557921, 0.237563, 
-0.443806, -0.231572, 0.566629, 0.260451, 
-0.464839, -0.242001, 0.574361, 0.284795, 
-0.487377, -0.252151, 0.581102, 0.31083, 
-0.510273, -0.261349, 0.585961, 0.337736, 
-0.53588, -0.270612, 0.590988, 0.366551, 
-0.559297, -0.27839, 0.590501, 0.395844, 
-0.583653, -0.285273, 0.588545, 0.426778, 
-0.609029, -0.291161, 0.584701, 0.459552, 
-0.635851, -0.294979, 0.578041, 0.494897, 
-0.664038, -0.297044, 0.568979, 0.531945, 
-0.689785, -0.297436, 0.55527, 0.569767, 
-0.715649, -0.295822, 0.539464, 0.607863, 
-0.740932, -0.29214, 0.521117, 0.645968, 
-0.765223, -0.287137, 0.499849, 0.685114, 
-0.788599, -0.280124, 0.476745, 0.723556, 
-0.810214, -0.27148, 0.451148, 0.760994, 
-0.830981, -0.261236, 0.423962, 0.798755, 
-0.85032, -0.249488, 0.394723, 0.835713, 
-0.868188, -0.236467, 0.364347, 0.872046, 
-0.884671, -0.221517, 0.332422, 0.90763, 
-0.900527, -0.206215, 0.300479, 0.944347, 
-0.914445, -0.188655, 0.266546, 0.980766, 
-0.926772, -0.168365, 0.232636, 1.01842, 
-0.938059, -0.146803, 0.199573, 1.05338, 
-0.947138, -0.123796, 0.167292, 1.08375, 
-0.954436, -0.0999684, 0.136351, 1.11029, 
-0.964036, -0.075933, 0.103609, 1.13422, 
-0.976154, -0.0511394, 0.06971, 1.15581, 
-0.988893, -0.0267407, 0.0353692, 1.17528, 
-1.00001, -0.000520729, 0.000174626, 1.1939, 
-0.51222, -0.858854, 0.858854, 0.51222, 
-0.51222, -0.858854, 0.858854, 0.51222, 
-0.512225, -0.858852, 0.858852, 0.512225, 
-0.512245, -0.85884, 0.85884, 0.512245, 
-0.262455, -0.00354626, 0.440061, 0.00211541, 
-0.262258, -0.00554027, 0.43972, 0.00330584, 
-1.33223, -0.0161735, 2.23432, 0.00965572, 
-0.204352, -0.0103216, 0.330696, 0.00616742, 
-0.0894952, -0.00775941, 0.151109, 0.00464262, 
-0.00351552, -0.00616247, 0.00584895, 0.00369422, 
-0.0809791, -0.0126392, 0.135959, 0.00759706, 
-0.00496547, -0.0107299, 0.00830657, 0.00647297, 
-0.263286, -0.031745, 0.440937, 0.0192899, 
-0.511336, -0.0597703, 0.825678, 0.0366016, 
-0.264099, -0.0430356, 0.441747, 0.0265689, 
-0.26462, -0.0493029, 0.442222, 0.0307175, 
-0.249602, -0.0549387, 0.416589, 0.0346758, 
-0.266704, -0.0628816, 0.444494, 0.040203, 
-0.315407, -0.0774433, 0.524717, 0.0503249, 
-0.269171, -0.0778377, 0.44677, 0.0514491, 
-0.193834, -0.0679377, 0.32273, 0.0458003, 
-0.285476, -0.0990067, 0.469879, 0.0682335, 
-0.276073, -0.102604, 0.453134, 0.0723686, 
-0.281531, -0.11171, 0.459246, 0.0808569, 
-0.287367, -0.121, 0.465339, 0.0901524, 
-0.294459, -0.130732, 0.472597, 0.10037, 
-0.302795, -0.140814, 0.480624, 0.111673, 
-0.31259, -0.151138, 0.489659, 0.124134, 
-0.324931, -0.16191, 0.500996, 0.137996, 
-0.337873, -0.172961, 0.511622, 0.153176, 
-0.35266, -0.18421, 0.522807, 0.169871, 
-0.367533, -0.195102, 0.532022, 0.187773, 
-0.385627, -0.206398, 0.543713, 0.207713, 
-0.404747, -0.217647, 0.553922, 0.229063, 
-0.424996, -0.228601, 0.563124, 0.251969, 
-0.446413, -0.239251, 0.571158, 0.276416, 
-0.469025, -0.249389, 0.5781, 0.302372, 
-0.49308, -0.25884, 0.583921, 0.329764, 
-0.517623, -0.267929, 0.587625, 0.358417, 
-0.543034, -0.276063, 0.589125, 0.388339, 
-0.569865, -0.283537, 0.589275, 0.419752, 
-0.595348, -0.289624, 0.585604, 0.452313, 
-0.622368, -0.294421, 0.580121, 0.486415, 
-0.651252, -0.296898, 0.572085, 0.523043, 
-0.677088, -0.297548, 0.558089, 0.560913, 
-0.704155, -0.29646, 0.542882, 0.599873, 
-0.729199, -0.293026, 0.523484, 0.638455, 
-0.753855, -0.287871, 0.50227, 0.67759, 
-0.77806, -0.280988, 0.478903, 0.71646, 
-0.801676, -0.272464, 0.454109, 0.755999, 
-0.822396, -0.26229, 0.425877, 0.794087, 
-0.843011, -0.25068, 0.397545, 0.832591, 
-0.862664, -0.237354, 0.366875, 0.870205, 
-0.87979, -0.22284, 0.335279, 0.907475, 
-0.895918, -0.206736, 0.302809, 0.943144, 
-0.91105, -0.189781, 0.269799, 0.98039, 
-0.924073, -0.171102, 0.236294, 1.01714, 
-0.935403, -0.149566, 0.202344, 1.0528, 
-0.94472, -0.126335, 0.169828, 1.0853, 
-0.952292, -0.101508, 0.137841, 1.11253, 
-0.962086, -0.0766448, 0.104984, 1.13758, 
-0.975168, -0.0511896, 0.0702738, 1.15966, 
-0.988607, -0.0254639, 0.0349484, 1.17991, 
-1.00002, 2.87013e-05, -3.03667e-05, 1.19893, 
-0.489798, -0.871836, 0.871836, 0.489798, 
-0.489796, -0.871837, 0.871837, 0.489796, 
-0.489801, -0.871834, 0.871834, 0.489801, 
-0.489823, -0.871822, 0.871822, 0.489823, 
-0.239678, -0.00344123, 0.426623, 0.00193371, 
-0.239017, -0.00537868, 0.425436, 0.00302341, 
-4.0686, -0.0371646, 7.28063, 0.0209031, 
-0.00163658, -0.00304981, 0.00292162, 0.00171703, 
-0.0189497, -0.00564786, 0.0372447, 0.00318448, 
-0.00325559, -0.00605953, 0.00574998, 0.00342399, 
-0.241893, -0.0216388, 0.429487, 0.012264, 
-0.00459063, -0.0105308, 0.00815303, 0.00599366, 
-0.240613, -0.0308659, 0.427684, 0.0177139, 
-0.0239823, -0.0196779, 0.0268187, 0.0113835, 
-0.24163, -0.0417743, 0.428908, 0.0243832, 
-0.242203, -0.0478326, 0.429507, 0.0282221, 
-0.229508, -0.0586845, 0.39221, 0.0351039, 
-0.242524, -0.0604872, 0.43017, 0.036713, 
-0.242145, -0.068127, 0.426677, 0.042078, 
-0.246665, -0.07553, 0.434056, 0.04753, 
-0.248654, -0.0833303, 0.4361, 0.0535818, 
-0.251633, -0.0913487, 0.439462, 0.0601677, 
-0.255238, -0.0998277, 0.443364, 0.0674139, 
-0.259331, -0.108648, 0.447696, 0.0755172, 
-0.266231, -0.117778, 0.455607, 0.0843561, 
-0.273158, -0.127299, 0.462699, 0.0941721, 
-0.282216, -0.13734, 0.472226, 0.105171, 
-0.293344, -0.147728, 0.483552, 0.117396, 
-0.304665, -0.158385, 0.49363, 0.130847, 
-0.31755, -0.169229, 0.50423, 0.145685, 
-0.333208, -0.180608, 0.517049, 0.162161, 
-0.35006, -0.191945, 0.529208, 0.180198, 
-0.36807, -0.203204, 0.540531, 0.199782, 
-0.387623, -0.214499, 0.551359, 0.221105, 
-0.408912, -0.225849, 0.562167, 0.244223, 
-0.43021, -0.236418, 0.569435, 0.268508, 
-0.452921, -0.246684, 0.576471, 0.294581, 
-0.476324, -0.256174, 0.58118, 0.322023, 
-0.500888, -0.265229, 0.584831, 0.350973, 
-0.527345, -0.273572, 0.587039, 0.381063, 
-0.555624, -0.28118, 0.588853, 0.412886, 
-0.581346, -0.287386, 0.584644, 0.445402, 
-0.60783, -0.292523, 0.579162, 0.479355, 
-0.634826, -0.295835, 0.570383, 0.514239, 
-0.664648, -0.297359, 0.560607, 0.552146, 
-0.690811, -0.296596, 0.543875, 0.591266, 
-0.717808, -0.293834, 0.526419, 0.630988, 
-0.744186, -0.289009, 0.505736, 0.670746, 
-0.768382, -0.28216, 0.482195, 0.710705, 
-0.792352, -0.273533, 0.456646, 0.749834, 
-0.814793, -0.26336, 0.429061, 0.789721, 
-0.835064, -0.251428, 0.399253, 0.828272, 
-0.85487, -0.238212, 0.369055, 0.86643, 
-0.872395, -0.223475, 0.336366, 0.905093, 
-0.889071, -0.207452, 0.303867, 0.943146, 
-0.90512, -0.190311, 0.270876, 0.980665, 
-0.91898, -0.17204, 0.237134, 1.01939, 
-0.930573, -0.152064, 0.204811, 1.05501, 
-0.941215, -0.129493, 0.172151, 1.08698, 
-0.949802, -0.104261, 0.140153, 1.11549, 
-0.960454, -0.0781849, 0.106544, 1.14085, 
-0.974368, -0.0516857, 0.0711159, 1.16412, 
-0.988036, -0.0253941, 0.0354568, 1.18471, 
-0.999915, 0.000804296, -0.000416698, 1.20452, 
-0.466866, -0.884328, 0.884328, 0.466866, 
-0.466869, -0.884326, 0.884326, 0.466869, 
-0.466874, -0.884324, 0.884324, 0.466874, 
-0.466898, -0.884311, 0.884311, 0.466898, 
-0.466962, -0.884277, 0.884277, 0.466962, 
-0.249707, -0.00834517, 0.476242, 0.00440849, 
-123.964, -0.957096, 234.656, 0.505944, 
-0.00400827, -0.00245014, 0.00900232, 0.00129664, 
-0.0394017, -0.00801399, 0.0820344, 0.00424828, 
-0.00292322, -0.00578947, 0.00549207, 0.00307658, 
-0.237933, -0.0217217, 0.448592, 0.0115825, 
-0.00950581, -0.00906068, 0.0258016, 0.00485702, 
-0.00619112, -0.012394, 0.0115731, 0.00670261, 
-0.0423297, -0.0230915, 0.062937, 0.0125932, 
-0.219677, -0.040389, 0.414807, 0.0222448, 
-0.220336, -0.0462008, 0.415586, 0.0257922, 
-0.245811, -0.0564845, 0.465561, 0.0319632, 
-0.0470978, -0.0290195, 0.0892865, 0.0167045, 
-0.224885, -0.0659801, 0.422047, 0.0386989, 
-0.225439, -0.0731776, 0.421644, 0.0438211, 
-0.230357, -0.0813431, 0.429159, 0.0498846, 
-0.230066, -0.0883832, 0.42645, 0.055606, 
-0.234115, -0.0966617, 0.431343, 0.0625095, 
-0.234807, -0.104007, 0.439151, 0.0693522, 
-0.24534, -0.114224, 0.444255, 0.0786838, 
-0.253094, -0.123655, 0.453163, 0.0882207, 
-0.262404, -0.133594, 0.463279, 0.0988871, 
-0.273057, -0.143808, 0.474107, 0.110705, 
-0.285173, -0.154473, 0.485631, 0.123861, 
-0.299576, -0.165517, 0.49887, 0.138594, 
-0.314188, -0.176673, 0.510063, 0.154654, 
-0.331282, -0.188132, 0.52287, 0.172519, 
-0.349547, -0.199576, 0.534822, 0.191959, 
-0.369345, -0.210875, 0.546194, 0.213123, 
-0.39018, -0.222044, 0.555768, 0.235972, 
-0.412264, -0.233026, 0.56455, 0.260482, 
-0.435806, -0.243552, 0.572241, 0.286774, 
-0.461149, -0.253317, 0.579152, 0.314511, 
-0.485763, -0.262453, 0.58254, 0.3437, 
-0.511039, -0.27074, 0.583085, 0.374152, 
-0.540044, -0.278495, 0.58549, 0.406078, 
-0.5681, -0.284964, 0.583371, 0.439303, 
-0.594687, -0.290229, 0.577504, 0.473177, 
-0.623303, -0.294201, 0.570949, 0.508566, 
-0.652118, -0.296396, 0.561309, 0.544777, 
-0.679714, -0.296722, 0.546994, 0.583158, 
-0.706443, -0.294263, 0.528723, 0.623036, 
-0.734365, -0.289745, 0.508774, 0.663487, 
-0.758056, -0.283137, 0.484451, 0.70353, 
-0.784163, -0.274722, 0.459978, 0.744309, 
-0.806423, -0.264518, 0.431538, 0.784203, 
-0.827263, -0.252603, 0.401769, 0.824262, 
-0.848965, -0.239094, 0.371498, 0.86359, 
-0.867279, -0.22453, 0.339451, 0.90338, 
-0.884469, -0.208171, 0.306093, 0.94199, 
-0.901552, -0.1907, 0.27288, 0.981642, 
-0.916034, -0.172097, 0.238818, 1.02043, 
-0.928289, -0.15218, 0.206311, 1.05741, 
-0.939574, -0.130225, 0.173728, 1.0898, 
-0.948979, -0.106763, 0.142118, 1.11874, 
-0.959193, -0.0808648, 0.108349, 1.14461, 
-0.973018, -0.0539196, 0.0728208, 1.1685, 
-0.987593, -0.0262897, 0.0360517, 1.18981, 
-1.00001, 0.00132749, -0.000665835, 1.21051, 
-0.443438, -0.896305, 0.896305, 0.443438, 
-0.443437, -0.896306, 0.896306, 0.443437, 
-0.443443, -0.896302, 0.896302, 0.443443, 
-0.44347, -0.896289, 0.896289, 0.44347, 
-0.443541, -0.896254, 0.896254, 0.443541, 
-0.0132212, -0.00237289, 0.0267892, 0.0011748, 
-0.196709, -0.00720851, 0.397562, 0.00357162, 
-2.68785, -0.0408445, 5.47187, 0.0202629, 
-0.0498309, -0.0128457, 0.115781, 0.00638502, 
-0.00257249, -0.00543404, 0.00515542, 0.00270857, 
-0.19892, -0.0203532, 0.401428, 0.0101847, 
-0.00373828, -0.00973107, 0.00752959, 0.0049057, 
-0.0168912, -0.0147182, 0.020857, 0.00748331, 
-0.0200933, -0.0181343, 0.0249102, 0.00930613, 
-0.198388, -0.0388781, 0.399595, 0.0201705, 
-0.199096, -0.0445055, 0.400484, 0.0234362, 
-0.0624587, -0.0296315, 0.144256, 0.0158463, 
-0.0652426, -0.0374033, 0.133372, 0.0203877, 
-0.201805, -0.0633636, 0.402998, 0.0352492, 
-0.20359, -0.0703022, 0.405283, 0.0400185, 
-0.206213, -0.0775484, 0.408892, 0.0453234, 
-0.209224, -0.0851884, 0.412523, 0.051182, 
-0.185624, -0.084799, 0.366131, 0.052541, 
-0.218913, -0.10162, 0.424853, 0.0650527, 
-0.225444, -0.110391, 0.432129, 0.0731903, 
-0.233815, -0.11981, 0.442992, 0.0824944, 
-0.242928, -0.129541, 0.453093, 0.092774, 
-0.25446, -0.139838, 0.465791, 0.104367, 
-0.266559, -0.150378, 0.477449, 0.117192, 
-0.280736, -0.16143, 0.490591, 0.131626, 
-0.295542, -0.172448, 0.502332, 0.147392, 
-0.312771, -0.18396, 0.515277, 0.165011, 
-0.331257, -0.195485, 0.527833, 0.184293, 
-0.351089, -0.206996, 0.53914, 0.205385, 
-0.372184, -0.218118, 0.549519, 0.228045, 
-0.394691, -0.229388, 0.558621, 0.252738, 
-0.419846, -0.240224, 0.568212, 0.279272, 
-0.444034, -0.250007, 0.573542, 0.306968, 
-0.470731, -0.259256, 0.578893, 0.336414, 
-0.496791, -0.267687, 0.580531, 0.367244, 
-0.524983, -0.27557, 0.581854, 0.399819, 
-0.552873, -0.281958, 0.579373, 0.432843, 
-0.581643, -0.287492, 0.575641, 0.467467, 
-0.609404, -0.291616, 0.567799, 0.50295, 
-0.638278, -0.294249, 0.55827, 0.53933, 
-0.667896, -0.295198, 0.5468, 0.576767, 
-0.695052, -0.29437, 0.53026, 0.615551, 
-0.723492, -0.290546, 0.510951, 0.656271, 
-0.749599, -0.284487, 0.487802, 0.697678, 
-0.775115, -0.276256, 0.46239, 0.738699, 
-0.798092, -0.265908, 0.433999, 0.7789, 
-0.820752, -0.254244, 0.404995, 0.820459, 
-0.843695, -0.240558, 0.374782, 0.860884, 
-0.861775, -0.225418, 0.341793, 0.900623, 
-0.880477, -0.209238, 0.308485, 0.94108, 
-0.898503, -0.191689, 0.274974, 0.981626, 
-0.913217, -0.172278, 0.240761, 1.02122, 
-0.926268, -0.151794, 0.207498, 1.05967, 
-0.938753, -0.130006, 0.175014, 1.09322, 
-0.947954, -0.106533, 0.142963, 1.12272, 
-0.95851, -0.0824152, 0.109891, 1.14908, 
-0.972357, -0.0565319, 0.074449, 1.17346, 
-0.987163, -0.0284312, 0.0373463, 1.19556, 
-1.00003, 3.85819e-05, 4.37315e-05, 1.21673, 
-0.419501, -0.907755, 0.907755, 0.419501, 
-0.419501, -0.907754, 0.907754, 0.419501, 
-0.419509, -0.907751, 0.907751, 0.419509, 
-0.419538, -0.907738, 0.907738, 0.419538, 
-0.419618, -0.907701, 0.907701, 0.419618, 
-0.0121476, -0.00233648, 0.0263202, 0.00108065, 
-0.176278, -0.0069084, 0.3814, 0.00319803, 
-81.5472, -0.99164, 176.334, 0.459712, 
-0.00173848, -0.0039362, 0.00378043, 0.00182881, 
-0.00232826, -0.00527115, 0.00499832, 0.00245689, 
-0.111444, -0.0139862, 0.241267, 0.00654881, 
-0.0033413, -0.00930435, 0.00719966, 0.00439497, 
-0.143903, -0.034134, 0.311229, 0.0162699, 
-0.00660382, -0.0142075, 0.0135681, 0.0068425, 
-0.177754, -0.0372251, 0.383069, 0.0181684, 
-0.238739, -0.0551205, 0.520741, 0.02732, 
-0.0645853, -0.0476966, 0.179808, 0.0240698, 
-0.179242, -0.0539095, 0.384343, 0.0277819, 
-0.181572, -0.0607062, 0.387867, 0.0320008, 
-0.182959, -0.0672705, 0.389395, 0.0363908, 
-0.184603, -0.0740309, 0.390565, 0.0412113, 
-0.188941, -0.0817095, 0.397224, 0.0469029, 
-0.193792, -0.0894871, 0.4043, 0.0531089, 
-0.198651, -0.0976171, 0.409738, 0.0600088, 
-0.207354, -0.106828, 0.42322, 0.068218, 
-0.21487, -0.115653, 0.431454, 0.076918, 
-0.224524, -0.12532, 0.442797, 0.0869192, 
-0.236254, -0.135597, 0.456277, 0.0982759, 
-0.248045, -0.14594, 0.467592, 0.110696, 
-0.263012, -0.157066, 0.482276, 0.124924, 
-0.278769, -0.168203, 0.495821, 0.14061, 
-0.295007, -0.179565, 0.507344, 0.157824, 
-0.313839, -0.191249, 0.520336, 0.176971, 
-0.333458, -0.202702, 0.531457, 0.197801, 
-0.356107, -0.214307, 0.543925, 0.220665, 
-0.378402, -0.225334, 0.552987, 0.245134, 
-0.402484, -0.236215, 0.56089, 0.271569, 
-0.428467, -0.246629, 0.568512, 0.29985, 
-0.454567, -0.255883, 0.573105, 0.329358, 
-0.482423, -0.264501, 0.576255, 0.360584, 
-0.509511, -0.272068, 0.576134, 0.393116, 
-0.538629, -0.279015, 0.575041, 0.427282, 
-0.569003, -0.284488, 0.572406, 0.462092, 
-0.596417, -0.288722, 0.564276, 0.497861, 
-0.626295, -0.291455, 0.555885, 0.534691, 
-0.656865, -0.292971, 0.545325, 0.572223, 
-0.683914, -0.292333, 0.528931, 0.610469, 
-0.711687, -0.290248, 0.511527, 0.64952, 
-0.739538, -0.285294, 0.489983, 0.690199, 
-0.767188, -0.277694, 0.46598, 0.732678, 
-0.791294, -0.267645, 0.437891, 0.774103, 
-0.814289, -0.256038, 0.408489, 0.815865, 
-0.837564, -0.242348, 0.378145, 0.857087, 
-0.857167, -0.22708, 0.344894, 0.898068, 
-0.876495, -0.210466, 0.31126, 0.93979, 
-0.89474, -0.19263, 0.277297, 0.980889, 
-0.910684, -0.173242, 0.243199, 1.02218, 
-0.923504, -0.152234, 0.209079, 1.06123, 
-0.936679, -0.129591, 0.1758, 1.09649, 
-0.946603, -0.105907, 0.143843, 1.12672, 
-0.95815, -0.081297, 0.110205, 1.15389, 
-0.972391, -0.0556135, 0.0745323, 1.17909, 
-0.986944, -0.0297917, 0.0383311, 1.2017, 
-0.999961, -0.00197163, 0.000833072, 1.22335, 
-0.395062, -0.918654, 0.918654, 0.395062, 
-0.395063, -0.918654, 0.918654, 0.395063, 
-0.39507, -0.918651, 0.918651, 0.39507, 
-0.395103, -0.918637, 0.918637, 0.395103, 
-0.395191, -0.918599, 0.918599, 0.395191, 
-0.0101949, -0.00213511, 0.0237472, 0.000919065, 
-0.155934, -0.0065962, 0.3626, 0.00284223, 
-0.00107238, -0.00261451, 0.00249918, 0.00112845, 
-0.00721551, -0.00362156, 0.0143296, 0.00156709, 
-0.00209029, -0.00507829, 0.00481583, 0.0022056, 
-0.183205, -0.020642, 0.427646, 0.00901646, 
-0.00295987, -0.008861, 0.00685777, 0.00390814, 
-0.0692011, -0.0181211, 0.161153, 0.00807027, 
-0.00586891, -0.0135954, 0.0129392, 0.00612642, 
-0.157983, -0.0354687, 0.365637, 0.0162399, 
-0.153498, -0.0400848, 0.354335, 0.0186628, 
-0.120813, -0.0386623, 0.284457, 0.0183732, 
-0.0971237, -0.0375858, 0.226898, 0.0182819, 
-0.162395, -0.0579909, 0.371474, 0.0289326, 
-0.164531, -0.0644285, 0.375111, 0.0330895, 
-0.185625, -0.0795031, 0.434022, 0.0421308, 
-0.170105, -0.0781283, 0.382486, 0.0428362, 
-0.17503, -0.0857352, 0.389811, 0.0487426, 
-0.181178, -0.0938244, 0.398693, 0.0554343, 
-0.18842, -0.102329, 0.408608, 0.0629976, 
-0.197049, -0.111317, 0.419974, 0.0716172, 
-0.206755, -0.12088, 0.431732, 0.0813256, 
-0.218771, -0.131035, 0.445837, 0.0923666, 
-0.230842, -0.141428, 0.457813, 0.104585, 
-0.245726, -0.152441, 0.47281, 0.11849, 
-0.261697, -0.163665, 0.486991, 0.133953, 
-0.277641, -0.174882, 0.498037, 0.150908, 
-0.296571, -0.186647, 0.511403, 0.169864, 
-0.317898, -0.198485, 0.525285, 0.190821, 
-0.339267, -0.209952, 0.5359, 0.213335, 
-0.361958, -0.221271, 0.545527, 0.237858, 
-0.387081, -0.232223, 0.554861, 0.264408, 
-0.412308, -0.242589, 0.561206, 0.292543, 
-0.439294, -0.25234, 0.566974, 0.322633, 
-0.466756, -0.261002, 0.569532, 0.353923, 
-0.495388, -0.268679, 0.571036, 0.38683, 
-0.524959, -0.275367, 0.57022, 0.421157, 
-0.555844, -0.281258, 0.567682, 0.457004, 
-0.584867, -0.285573, 0.560707, 0.49328, 
-0.61412, -0.288329, 0.551724, 0.530073, 
-0.646042, -0.289923, 0.54262, 0.568836, 
-0.673342, -0.289727, 0.526773, 0.606936, 
-0.701133, -0.287554, 0.509144, 0.645411, 
-0.730189, -0.284131, 0.490389, 0.68512, 
-0.756955, -0.278683, 0.467367, 0.726196, 
-0.783307, -0.269396, 0.440952, 0.768181, 
-0.807644, -0.257994, 0.411715, 0.810936, 
-0.830643, -0.244693, 0.381037, 0.853373, 
-0.852539, -0.229487, 0.34838, 0.895604, 
-0.87287, -0.212601, 0.314867, 0.938085, 
-0.891381, -0.194075, 0.280337, 0.980124, 
-0.907921, -0.174846, 0.245173, 1.02332, 
-0.921982, -0.153486, 0.210888, 1.06355, 
-0.935558, -0.130445, 0.177638, 1.09995, 
-0.94625, -0.105561, 0.144336, 1.13127, 
-0.9573, -0.0800652, 0.110342, 1.15982, 
-0.971493, -0.0539756, 0.0742682, 1.18512, 
-0.98655, -0.0277141, 0.0376326, 1.20875, 
-1.0001, -0.000515501, 0.000266441, 1.23134, 
-0.370118, -0.928985, 0.928985, 0.370118, 
-0.370119, -0.928984, 0.928984, 0.370119, 
-0.370128, -0.928981, 0.928981, 0.370128, 
-0.370164, -0.928966, 0.928966, 0.370164, 
-0.370263, -0.928927, 0.928927, 0.370263, 
-0.136956, -0.00433082, 0.343732, 0.00172736, 
-0.137112, -0.00622735, 0.344107, 0.00248674, 
-72.7852, -1.00494, 182.533, 0.402081, 
-0.00339868, -0.00261949, 0.00847925, 0.00105118, 
-0.00181231, -0.0047515, 0.00450451, 0.00191503, 
-0.00200846, -0.00649501, 0.00499833, 0.00263943, 
-0.00258609, -0.00834723, 0.0064584, 0.00342541, 
-0.0749867, -0.0186169, 0.171283, 0.00772421, 
-0.137634, -0.0289053, 0.344093, 0.0121593, 
-0.138744, -0.0335949, 0.346317, 0.0143767, 
-0.137355, -0.0375512, 0.3421, 0.0163897, 
-0.145495, -0.0441868, 0.362048, 0.0197439, 
-0.13754, -0.045716, 0.33774, 0.0209526, 
-0.141815, -0.0550049, 0.34831, 0.0259569, 
-0.0576533, -0.0345808, 0.143001, 0.0168438, 
-0.150186, -0.0679422, 0.36486, 0.0342906, 
-0.152225, -0.0743559, 0.367156, 0.0389591, 
-0.157328, -0.0817538, 0.375153, 0.0445593, 
-0.165242, -0.0902917, 0.389508, 0.0513277, 
-0.17137, -0.0980007, 0.396062, 0.0582585, 
-0.179909, -0.106817, 0.407429, 0.0665404, 
-0.189966, -0.116254, 0.420127, 0.0760042, 
-0.20187, -0.126287, 0.434442, 0.0867356, 
-0.214257, -0.136702, 0.447471, 0.0987529, 
-0.228763, -0.147578, 0.461743, 0.112324, 
-0.244894, -0.158825, 0.476419, 0.127568, 
-0.262377, -0.170368, 0.490594, 0.14456, 
-0.281017, -0.181951, 0.503472, 0.163223, 
-0.300698, -0.193508, 0.515016, 0.183664, 
-0.322756, -0.205411, 0.526629, 0.206365, 
-0.347122, -0.217057, 0.538681, 0.231027, 
-0.371551, -0.228191, 0.54745, 0.257542, 
-0.397282, -0.23842, 0.554322, 0.285627, 
-0.423365, -0.248097, 0.558645, 0.315516, 
-0.453129, -0.257528, 0.564368, 0.347868, 
-0.482268, -0.265462, 0.565601, 0.381146, 
-0.510431, -0.271988, 0.563411, 0.415555, 
-0.541582, -0.277532, 0.561202, 0.451569, 
-0.571771, -0.281926, 0.554999, 0.488449, 
-0.60271, -0.285021, 0.546746, 0.526453, 
-0.63398, -0.286503, 0.537248, 0.564879, 
-0.663236, -0.286421, 0.522997, 0.604107, 
-0.691869, -0.284553, 0.506003, 0.643387, 
-0.721152, -0.281371, 0.488586, 0.68316, 
-0.748243, -0.276252, 0.467016, 0.723442, 
-0.777061, -0.269857, 0.444285, 0.764222, 
-0.80192, -0.260429, 0.415954, 0.806221, 
-0.825937, -0.247428, 0.3849, 0.849994, 
-0.848129, -0.232381, 0.35229, 0.892959, 
-0.869026, -0.21589, 0.318369, 0.93693, 
-0.8881, -0.197185, 0.282969, 0.979647, 
-0.905587, -0.177182, 0.248142, 1.02451, 
-0.919134, -0.155612, 0.212728, 1.06763, 
-0.932337, -0.132026, 0.177998, 1.10517, 
-0.941592, -0.106736, 0.14569, 1.13709, 
-0.954483, -0.0804719, 0.111138, 1.16628, 
-0.970167, -0.053421, 0.0745984, 1.19243, 
-0.986157, -0.0257472, 0.0369137, 1.21675, 
-1.00009, 0.00190653, -0.000954718, 1.23989, 
-0.344671, -0.938723, 0.938723, 0.344671, 
-0.344672, -0.938723, 0.938723, 0.344672, 
-0.344681, -0.93872, 0.93872, 0.344681, 
-0.344723, -0.938705, 0.938705, 0.344723, 
-0.344833, -0.938664, 0.938664, 0.344833, 
-0.118728, -0.00407499, 0.323328, 0.00149816, 
-0.000952447, -0.00175331, 0.00175819, 0.000645503, 
-0.00101439, -0.00239651, 0.00219861, 0.000884322, 
-0.00115805, -0.00330653, 0.00317345, 0.00122441, 
-0.00157915, -0.00449414, 0.00425702, 0.00167284, 
-0.152659, -0.0188054, 0.419043, 0.00707101, 
-0.00226612, -0.00792878, 0.0061362, 0.0030118, 
-0.0498324, -0.0177701, 0.138345, 0.00683616, 
-0.120115, -0.0273194, 0.325598, 0.0106901, 
-0.121689, -0.0314868, 0.329041, 0.0125564, 
-0.119238, -0.0355564, 0.32189, 0.0145053, 
-0.120699, -0.0409748, 0.324707, 0.0171682, 
-0.0686652, -0.0319392, 0.179593, 0.0137763, 
-0.127404, -0.0520197, 0.339159, 0.0231875, 
-0.127161, -0.0574725, 0.336886, 0.0265542, 
-0.130891, -0.0637385, 0.343628, 0.0306318, 
-0.131126, -0.0696398, 0.337907, 0.0348771, 
-0.140845, -0.077631, 0.360633, 0.040611, 
-0.146852, -0.0852406, 0.369741, 0.0466851, 
-0.155188, -0.0935511, 0.382953, 0.053772, 
-0.164081, -0.102265, 0.395386, 0.0618177, 
-0.173822, -0.111403, 0.407638, 0.0709304, 
-0.185067, -0.121294, 0.42086, 0.0813413, 
-0.198288, -0.131718, 0.435726, 0.0931792, 
-0.212797, -0.142561, 0.450576, 0.106508, 
-0.228994, -0.153884, 0.465706, 0.121575, 
-0.246214, -0.165357, 0.479678, 0.138266, 
-0.265048, -0.177011, 0.492775, 0.156841, 
-0.285055, -0.188729, 0.504883, 0.17722, 
-0.308322, -0.20086, 0.518951, 0.199977, 
-0.330813, -0.21235, 0.528248, 0.224251, 
-0.354936, -0.22353, 0.536677, 0.25055, 
-0.38155, -0.234109, 0.544693, 0.278831, 
-0.409647, -0.244165, 0.551897, 0.309338, 
-0.437174, -0.253192, 0.55437, 0.341196, 
-0.467099, -0.261488, 0.557219, 0.374934, 
-0.496734, -0.26816, 0.556182, 0.409554, 
-0.528275, -0.274126, 0.554613, 0.446619, 
-0.559199, -0.278096, 0.549005, 0.483651, 
-0.589202, -0.28135, 0.540162, 0.522474, 
-0.622746, -0.282922, 0.531912, 0.561795, 
-0.652759, -0.282928, 0.518506, 0.601784, 
-0.682201, -0.281399, 0.502811, 0.64192, 
-0.711813, -0.277852, 0.484216, 0.682304, 
-0.739663, -0.273023, 0.462878, 0.723441, 
-0.768872, -0.266827, 0.441359, 0.764133, 
-0.794159, -0.258296, 0.414649, 0.805371, 
-0.819263, -0.248831, 0.386774, 0.847336, 
-0.843374, -0.236134, 0.356658, 0.89079, 
-0.862193, -0.219786, 0.320562, 0.936142, 
-0.883078, -0.201782, 0.285599, 0.982633, 
-0.899948, -0.181737, 0.24973, 1.02899, 
-0.915249, -0.159256, 0.21479, 1.07147, 
-0.928511, -0.134726, 0.180293, 1.10996, 
-0.940587, -0.10913, 0.147039, 1.14353, 
-0.953414, -0.0821172, 0.112269, 1.17351, 
-0.969564, -0.054279, 0.075556, 1.20067, 
-0.985864, -0.0259146, 0.0372086, 1.22552, 
-0.999948, 0.00298173, -0.00145502, 1.24948, 
-0.31872, -0.947849, 0.947849, 0.31872, 
-0.318721, -0.947848, 0.947848, 0.318721, 
-0.318731, -0.947845, 0.947845, 0.318731, 
-0.318778, -0.947829, 0.947829, 0.318778, 
-0.318902, -0.947788, 0.947788, 0.318902, 
-0.104721, -0.00392711, 0.310823, 0.00132257, 
-0.100451, -0.00542809, 0.298628, 0.00183111, 
-0.00154576, -0.00233949, 0.0025247, 0.000791358, 
-0.0243816, -0.0058061, 0.0714218, 0.00197221, 
-0.00134578, -0.00417958, 0.00395657, 0.00142965, 
-0.00149013, -0.0056963, 0.00437933, 0.00196967, 
-0.0139615, -0.00707916, 0.0390945, 0.00247721, 
-0.00921099, -0.00892363, 0.0272534, 0.00317119, 
-0.0592571, -0.0179959, 0.165222, 0.00651902, 
-0.183056, -0.0439258, 0.548642, 0.016273, 
-0.110314, -0.0349162, 0.329104, 0.0132841, 
-0.101269, -0.0386366, 0.295749, 0.0151435, 
-0.308274, -0.0906748, 0.903188, 0.0367683, 
-0.111337, -0.0494793, 0.324764, 0.0208084, 
-0.0983588, -0.0503543, 0.278121, 0.022064, 
-0.114714, -0.0599098, 0.326142, 0.0274286, 
-0.119172, -0.0663515, 0.334305, 0.0317972, 
-0.124787, -0.073303, 0.344122, 0.0368511, 
-0.131495, -0.0807739, 0.355365, 0.0427101, 
-0.139317, -0.0888118, 0.367736, 0.049474, 
-0.148127, -0.097352, 0.380266, 0.057244, 
-0.15893, -0.106572, 0.395334, 0.0662221, 
-0.1699, -0.116267, 0.408222, 0.0763493, 
-0.182862, -0.126452, 0.4228, 0.087831, 
-0.197692, -0.137441, 0.438645, 0.101084, 
-0.21342, -0.148611, 0.452987, 0.115804, 
-0.230986, -0.160247, 0.467695, 0.132391, 
-0.24916, -0.171688, 0.480072, 0.150539, 
-0.270208, -0.183668, 0.494425, 0.171048, 
-0.2923, -0.195618, 0.506706, 0.193421, 
-0.315067, -0.207246, 0.51677, 0.217628, 
-0.340675, -0.218667, 0.52703, 0.243959, 
-0.367605, -0.22973, 0.53639, 0.272562, 
-0.394204, -0.239716, 0.541027, 0.302716, 
-0.422918, -0.248864, 0.545467, 0.334864, 
-0.453803, -0.257235, 0.549608, 0.368897, 
-0.484558, -0.26461, 0.549645, 0.404557, 
-0.51459, -0.270177, 0.546086, 0.440955, 
-0.547322, -0.274712, 0.542868, 0.47939, 
-0.577045, -0.277373, 0.53355, 0.518104, 
-0.610643, -0.278995, 0.525502, 0.558211, 
-0.640959, -0.278924, 0.511182, 0.598831, 
-0.671257, -0.277293, 0.495755, 0.639863, 
-0.701907, -0.274025, 0.478602, 0.681308, 
-0.7292, -0.268946, 0.457231, 0.72245, 
-0.758159, -0.262322, 0.434965, 0.764468, 
-0.784558, -0.254319, 0.409394, 0.806328, 
-0.809696, -0.24503, 0.382428, 0.848548, 
-0.834318, -0.23368, 0.353044, 0.891753, 
-0.856486, -0.221288, 0.321444, 0.936178, 
-0.878061, -0.205918, 0.288315, 0.982028, 
-0.897025, -0.186647, 0.253008, 1.02944, 
-0.913816, -0.164561, 0.218062, 1.07451, 
-0.927616, -0.140002, 0.183198, 1.1147, 
-0.940297, -0.113252, 0.149164, 1.14919, 
-0.952761, -0.0854, 0.11426, 1.18076, 
-0.969251, -0.0568671, 0.0770262, 1.20906, 
-0.98537, -0.0276475, 0.0381805, 1.23486, 
-0.999965, 0.00239049, -0.00131302, 1.25985, 
-0.292265, -0.956337, 0.956337, 0.292265, 
-0.292266, -0.956337, 0.956337, 0.292266, 
-0.292278, -0.956333, 0.956333, 0.292278, 
-0.29233, -0.956317, 0.956317, 0.29233, 
-0.292471, -0.956275, 0.956275, 0.292471, 
-0.0633115, -0.00321111, 0.206228, 0.000983189, 
-0.0836238, -0.00504177, 0.274754, 0.00154681, 
-0.0855774, -0.00689984, 0.279865, 0.00212388, 
-0.000834095, -0.00286408, 0.00274598, 0.000886111, 
-0.00114572, -0.00391017, 0.00369876, 0.00122154, 
-0.00125665, -0.00529867, 0.00406995, 0.00167459, 
-0.00359916, -0.00855665, 0.00678376, 0.00274226, 
-0.0158715, -0.0127171, 0.0534281, 0.00415329, 
-0.0487673, -0.017828, 0.142415, 0.00595258, 
-0.0872068, -0.0272935, 0.282645, 0.009356, 
-0.0745866, -0.0296255, 0.243001, 0.0104748, 
-0.186596, -0.059553, 0.595272, 0.0218001, 
-0.0906735, -0.0400021, 0.289111, 0.0152143, 
-0.063654, -0.0377981, 0.189553, 0.0150015, 
-0.0964271, -0.0503984, 0.302561, 0.0209563, 
-0.103835, -0.0560474, 0.319703, 0.0244666, 
-0.104527, -0.0622149, 0.317851, 0.028572, 
-0.110481, -0.0689854, 0.329126, 0.0334133, 
-0.117427, -0.0763123, 0.341339, 0.0390494, 
-0.125106, -0.0841206, 0.353528, 0.0455443, 
-0.133939, -0.0925085, 0.36649, 0.0530679, 
-0.143939, -0.101441, 0.379837, 0.0617139, 
-0.155855, -0.111183, 0.395458, 0.0717189, 
-0.168832, -0.121415, 0.410377, 0.0830794, 
-0.18329, -0.132182, 0.425619, 0.09599, 
-0.198901, -0.143309, 0.440186, 0.110466, 
-0.215987, -0.154813, 0.454091, 0.126746, 
-0.234689, -0.166526, 0.467996, 0.144896, 
-0.255946, -0.178634, 0.482709, 0.16524, 
-0.27698, -0.190231, 0.493797, 0.18723, 
-0.301116, -0.202135, 0.506144, 0.211562, 
-0.326079, -0.213848, 0.516374, 0.238015, 
-0.352839, -0.224952, 0.525208, 0.266418, 
-0.380707, -0.235177, 0.532124, 0.296604, 
-0.409769, -0.244732, 0.537279, 0.329024, 
-0.439784, -0.253132, 0.540507, 0.36315, 
-0.47146, -0.260292, 0.541398, 0.398878, 
-0.501326, -0.26634, 0.538276, 0.436059, 
-0.535053, -0.271023, 0.535221, 0.47471, 
-0.565312, -0.27401, 0.526593, 0.514333, 
-0.597283, -0.275371, 0.516925, 0.554929, 
-0.630095, -0.275105, 0.505297, 0.59614, 
-0.660863, -0.273313, 0.490334, 0.638095, 
-0.692048, -0.27002, 0.472981, 0.680486, 
-0.720913, -0.265074, 0.452283, 0.723206, 
-0.750168, -0.258109, 0.429995, 0.765352, 
-0.777377, -0.249856, 0.405443, 0.808398, 
-0.803938, -0.240085, 0.378866, 0.852323, 
-0.82809, -0.228699, 0.350042, 0.895197, 
-0.851529, -0.216582, 0.319142, 0.940477, 
-0.873121, -0.20257, 0.287427, 0.986207, 
-0.894372, -0.186894, 0.254331, 1.03257, 
-0.911775, -0.168716, 0.221057, 1.07746, 
-0.927773, -0.146456, 0.18697, 1.11898, 
-0.940227, -0.11997, 0.152493, 1.15571, 
-0.952328, -0.0917455, 0.117651, 1.1891, 
-0.968454, -0.0620305, 0.0794823, 1.21818, 
-0.985186, -0.031491, 0.0401345, 1.24509, 
-0.999964, -0.00057511, 8.50734e-05, 1.27121, 
-0.265306, -0.964164, 0.964164, 0.265306, 
-0.265307, -0.964164, 0.964164, 0.265307, 
-0.265321, -0.96416, 0.96416, 0.265321, 
-0.26538, -0.964144, 0.964144, 0.26538, 
-0.26554, -0.9641, 0.9641, 0.26554, 
-0.0702021, -0.00322204, 0.255029, 0.000888656, 
-0.0565601, -0.00507226, 0.200019, 0.00140243, 
-0.000933831, -0.00209365, 0.00212677, 0.000581239, 
-0.00144867, -0.00302174, 0.0034413, 0.000844376, 
-0.00094067, -0.00357076, 0.0033731, 0.00100974, 
-0.00103148, -0.00482863, 0.0037059, 0.00138361, 
-0.00129519, -0.00650278, 0.00463051, 0.0018967, 
-0.00815248, -0.00963071, 0.015557, 0.00287138, 
-0.0647749, -0.0205224, 0.230824, 0.00628249, 
-0.058086, -0.0260613, 0.173523, 0.00823803, 
-0.0542273, -0.023388, 0.194259, 0.00766233, 
-0.0115654, -0.0260144, 0.0778155, 0.00887558, 
-0.0760739, -0.0368179, 0.268224, 0.013136, 
-0.0786785, -0.0415648, 0.273887, 0.0155759, 
-0.0784698, -0.0450432, 0.271104, 0.0177915, 
-0.0797827, -0.0524635, 0.272682, 0.0218792, 
-0.0908328, -0.0579665, 0.300687, 0.025588, 
-0.0751845, -0.0567214, 0.241823, 0.0265487, 
-0.103753, -0.0716623, 0.325021, 0.0356076, 
-0.111685, -0.0793782, 0.338496, 0.0419251, 
-0.120951, -0.0876831, 0.352867, 0.0492662, 
-0.130802, -0.0965187, 0.366219, 0.0576908, 
-0.142345, -0.105995, 0.381083, 0.0674109, 
-0.155196, -0.116136, 0.396183, 0.0785588, 
-0.169442, -0.126758, 0.411164, 0.0911968, 
-0.185046, -0.137902, 0.426073, 0.105521, 
-0.201902, -0.149371, 0.439893, 0.121589, 
-0.221157, -0.161272, 0.455292, 0.139664, 
-0.241532, -0.173205, 0.469192, 0.159631, 
-0.262974, -0.185055, 0.481004, 0.181574, 
-0.28653, -0.196765, 0.492767, 0.205659, 
-0.311652, -0.20839, 0.503739, 0.231907, 
-0.338632, -0.219604, 0.513158, 0.260195, 
-0.365276, -0.230103, 0.51883, 0.290423, 
-0.395828, -0.240029, 0.526575, 0.323058, 
-0.426502, -0.248955, 0.530274, 0.357629, 
-0.457595, -0.256459, 0.532012, 0.393668, 
-0.488337, -0.262276, 0.529172, 0.430707, 
-0.522204, -0.26704, 0.52706, 0.470053, 
-0.553949, -0.270289, 0.519923, 0.510247, 
-0.585978, -0.271861, 0.509735, 0.55134, 
-0.619703, -0.271956, 0.499451, 0.593927, 
-0.651415, -0.269888, 0.484627, 0.636481, 
-0.682659, -0.266182, 0.467268, 0.679461, 
-0.713137, -0.260872, 0.447873, 0.723169, 
-0.742966, -0.254209, 0.425736, 0.767675, 
-0.770681, -0.245601, 0.400973, 0.811648, 
-0.797445, -0.235567, 0.374387, 0.856363, 
-0.823799, -0.223952, 0.346327, 0.901304, 
-0.847659, -0.210854, 0.316451, 0.946454, 
-0.870486, -0.196631, 0.28461, 0.993997, 
-0.891463, -0.180854, 0.251762, 1.04157, 
-0.909788, -0.163376, 0.21938, 1.0865, 
-0.925768, -0.143314, 0.186482, 1.1271, 
-0.94003, -0.12132, 0.153498, 1.16369, 
-0.9528, -0.0974132, 0.120309, 1.19744, 
-0.968019, -0.0699044, 0.0834775, 1.22837, 
-0.984895, -0.0390086, 0.0440623, 1.25689, 
-1.00022, -0.00700886, 0.00321484, 1.28431, 
-0.237844, -0.971303, 0.971303, 0.237844, 
-0.237844, -0.971303, 0.971303, 0.237844, 
-0.23786, -0.971299, 0.971299, 0.23786, 
-0.237929, -0.971283, 0.971283, 0.237929, 
-0.238112, -0.971238, 0.971238, 0.238112, 
-0.0592692, -0.0029807, 0.241688, 0.000732024, 
-0.0551072, -0.00415364, 0.224861, 0.00102328, 
-0.043193, -0.0047539, 0.177506, 0.00117722, 
-0.0111246, -0.00433371, 0.0492849, 0.00108402, 
-0.000750226, -0.00319341, 0.00301435, 0.000809185, 
-0.00214287, -0.00476524, 0.00530483, 0.00122714, 
-0.141347, -0.0248297, 0.582081, 0.00653916, 
-0.00686384, -0.00861354, 0.013978, 0.00232944, 
-0.0555631, -0.0193592, 0.225173, 0.00540732, 
-0.0498206, -0.0187683, 0.200569, 0.00544439, 
-0.0225977, -0.01427, 0.0923993, 0.00432213, 
-0.061109, -0.0295974, 0.242208, 0.00940123, 
-0.00392609, -0.0230409, 0.0372195, 0.00771395, 
-0.00605949, -0.022289, 0.0246543, 0.00789865, 
-0.0687993, -0.0426597, 0.262246, 0.0160395, 
-0.0736936, -0.0479909, 0.273694, 0.0191891, 
-0.0670286, -0.050609, 0.241736, 0.0215552, 
-0.0843966, -0.0600509, 0.295658, 0.027275, 
-0.0913387, -0.0669869, 0.308771, 0.032473, 
-0.0994616, -0.0745801, 0.322974, 0.0386033, 
-0.108049, -0.082623, 0.336021, 0.0456641, 
-0.118612, -0.0915184, 0.351774, 0.0539985, 
-0.130103, -0.100882, 0.366856, 0.0635339, 
-0.142867, -0.110929, 0.382191, 0.0745004, 
-0.156628, -0.121351, 0.39626, 0.0868462, 
-0.172142, -0.132475, 0.41143, 0.101009, 
-0.188703, -0.143764, 0.425067, 0.116758, 
-0.20793, -0.155674, 0.440928, 0.134636, 
-0.227774, -0.167513, 0.453975, 0.154308, 
-0.249498, -0.179505, 0.466878, 0.176107, 
-0.273431, -0.191448, 0.480325, 0.200152, 
-0.296936, -0.202913, 0.488571, 0.226103, 
-0.324477, -0.214216, 0.499993, 0.25451, 
-0.352623, -0.224931, 0.508498, 0.284723, 
-0.381895, -0.234878, 0.514417, 0.317051, 
-0.414507, -0.244477, 0.522064, 0.352267, 
-0.44508, -0.252066, 0.52276, 0.388157, 
-0.476388, -0.258299, 0.520847, 0.425606, 
-0.509121, -0.263427, 0.517881, 0.465131, 
-0.542309, -0.266707, 0.512172, 0.505693, 
-0.575216, -0.268345, 0.503146, 0.547777, 
-0.60908, -0.268536, 0.49306, 0.591057, 
-0.641282, -0.266835, 0.478121, 0.63463, 
-0.674173, -0.263133, 0.462466, 0.678649, 
-0.705048, -0.257742, 0.442788, 0.723836, 
-0.735115, -0.25063, 0.420991, 0.768725, 
-0.763192, -0.241659, 0.396676, 0.813934, 
-0.791851, -0.231121, 0.371084, 0.859928, 
-0.817713, -0.219157, 0.342424, 0.906457, 
-0.842863, -0.205574, 0.312489, 0.953554, 
-0.866763, -0.190635, 0.281082, 1.00223, 
-0.887593, -0.173817, 0.248535, 1.05008, 
-0.907122, -0.15549, 0.215649, 1.09707, 
-0.924145, -0.134811, 0.183018, 1.13882, 
-0.939022, -0.112522, 0.150445, 1.17572, 
-0.952568, -0.0890743, 0.116902, 1.20929, 
-0.968679, -0.0646612, 0.081339, 1.24072, 
-0.985106, -0.0386145, 0.0439734, 1.27046, 
-1.00043, -0.0123786, 0.00587385, 1.29858, 
-0.209877, -0.977728, 0.977728, 0.209877, 
-0.209878, -0.977728, 0.977728, 0.209878, 
-0.209896, -0.977724, 0.977724, 0.209896, 
-0.209976, -0.977707, 0.977707, 0.209976, 
-0.21019, -0.97766, 0.97766, 0.21019, 
-0.0358457, -0.00258511, 0.166156, 0.00055703, 
-0.0423074, -0.00366792, 0.196693, 0.000793578, 
-0.0286077, -0.00354179, 0.133024, 0.000771554, 
-0.00159346, -0.00242701, 0.00302608, 0.00053572, 
-0.00444813, -0.00319479, 0.0135522, 0.00071632, 
-0.00174523, -0.00419861, 0.0046868, 0.000961832, 
-0.000842873, -0.0050308, 0.00389424, 0.0011844, 
-0.00450254, -0.0056704, 0.0145057, 0.00138008, 
-0.0446381, -0.0173015, 0.20875, 0.00438372, 
-0.00107981, -0.0106575, 0.0131299, 0.00282848, 
-0.0186799, -0.0142072, 0.0740088, 0.00396938, 
-0.0343032, -0.0208186, 0.157496, 0.00615939, 
-0.0677365, -0.0375756, 0.308251, 0.0118287, 
-0.0510054, -0.0350601, 0.22409, 0.0117825, 
-0.0573798, -0.0387488, 0.244166, 0.0139309, 
-0.0621873, -0.0439124, 0.254674, 0.0169164, 
-0.0673145, -0.0495044, 0.266575, 0.0204531, 
-0.0731485, -0.0556265, 0.278679, 0.0246606, 
-0.0804308, -0.0624701, 0.293227, 0.0297181, 
-0.0879562, -0.0697605, 0.305984, 0.0355893, 
-0.0970557, -0.0778632, 0.320887, 0.0425679, 
-0.106456, -0.0863242, 0.333826, 0.0505425, 
-0.118027, -0.0956901, 0.349703, 0.0599577, 
-0.129952, -0.105294, 0.36325, 0.0705349, 
-0.144465, -0.115864, 0.380082, 0.0828574, 
-0.159428, -0.126782, 0.394271, 0.096727, 
-0.17601, -0.138022, 0.408652, 0.112268, 
-0.194718, -0.149911, 0.424109, 0.129958, 
-0.213782, -0.161579, 0.436394, 0.149245, 
-0.235491, -0.173699, 0.450236, 0.170931, 
-0.260227, -0.185827, 0.465446, 0.194842, 
-0.285246, -0.19766, 0.477716, 0.220892, 
-0.311523, -0.208944, 0.486985, 0.248988, 
-0.339133, -0.219655, 0.495358, 0.279188, 
-0.369368, -0.229645, 0.503509, 0.31156, 
-0.399723, -0.238987, 0.508038, 0.346001, 
-0.430751, -0.24709, 0.509976, 0.382194, 
-0.464545, -0.253935, 0.512418, 0.420269, 
-0.497222, -0.259438, 0.509345, 0.460167, 
-0.530515, -0.263355, 0.503626, 0.501467, 
-0.565956, -0.265605, 0.498401, 0.544224, 
-0.59874, -0.265647, 0.486934, 0.587424, 
-0.631838, -0.264163, 0.473169, 0.632412, 
-0.664355, -0.260543, 0.457184, 0.677763, 
-0.697759, -0.2553, 0.439508, 0.723578, 
-0.726616, -0.24788, 0.416659, 0.769326, 
-0.756552, -0.239125, 0.392407, 0.817165, 
-0.785414, -0.228153, 0.367103, 0.864269, 
-0.812198, -0.215707, 0.338898, 0.912808, 
-0.838928, -0.201408, 0.309726, 0.961393, 
-0.863499, -0.185611, 0.277974, 1.01213, 
-0.88525, -0.167958, 0.245099, 1.06178, 
-0.904906, -0.14841, 0.212662, 1.1099, 
-0.922623, -0.126411, 0.180093, 1.151, 
-0.93733, -0.102971, 0.147238, 1.18935, 
-0.952347, -0.0785698, 0.112576, 1.22419, 
-0.967122, -0.0530236, 0.0760671, 1.25701, 
-0.98451, -0.0264874, 0.0382957, 1.2875, 
-1.0006, 0.000700938, -0.000380904, 1.31747, 
-0.181406, -0.983408, 0.983408, 0.181406, 
-0.181407, -0.983408, 0.983408, 0.181407, 
-0.181429, -0.983404, 0.983404, 0.181429, 
-0.181523, -0.983387, 0.983387, 0.181523, 
-0.181777, -0.98334, 0.98334, 0.181777, 
-0.182312, -0.983241, 0.983241, 0.182312, 
-0.0166416, -0.00300437, 0.0893922, 0.000560158, 
-0.000850371, -0.00147187, 0.00154881, 0.000277534, 
-0.00122973, -0.00213265, 0.00222073, 0.000408313, 
-0.00177976, -0.00290095, 0.00361725, 0.000567217, 
-0.000638726, -0.00329617, 0.00344615, 0.000662664, 
-0.000630953, -0.00436877, 0.00333267, 0.000909591, 
-0.030067, -0.011891, 0.160255, 0.00258511, 
-0.0347395, -0.0151786, 0.184579, 0.00347118, 
-0.000648362, -0.0093037, 0.0114514, 0.00225171, 
-0.0465744, -0.0276861, 0.253584, 0.00714087, 
-0.00209695, -0.0125146, 0.00986915, 0.00345885, 
-0.0350594, -0.0238844, 0.183013, 0.00709943, 
-0.0430156, -0.0303719, 0.210506, 0.00973513, 
-0.0453229, -0.0348791, 0.217028, 0.01207, 
-0.0522861, -0.0396996, 0.238056, 0.0148446, 
-0.0574523, -0.0453655, 0.249486, 0.0183224, 
-0.0631353, -0.0512911, 0.26128, 0.0223665, 
-0.0701169, -0.0579151, 0.27555, 0.0272361, 
-0.0779369, -0.0651629, 0.289623, 0.0329953, 
-0.0863534, -0.0729366, 0.302758, 0.039712, 
-0.0961067, -0.0812926, 0.316953, 0.0475288, 
-0.10689, -0.090359, 0.331407, 0.0566465, 
-0.132927, -0.103097, 0.375173, 0.0692109, 
-0.132876, -0.110403, 0.362243, 0.0792789, 
-0.147593, -0.121091, 0.376355, 0.0928494, 
-0.163575, -0.132216, 0.39056, 0.108159, 
-0.182378, -0.143991, 0.406875, 0.125593, 
-0.202107, -0.155885, 0.421378, 0.144889, 
-0.224772, -0.168154, 0.438026, 0.166505, 
-0.24753, -0.179956, 0.450187, 0.18982, 
-0.271064, -0.191664, 0.460022, 0.215396, 
-0.296829, -0.203103, 0.470157, 0.243259, 
-0.325954, -0.214165, 0.481817, 0.273528, 
-0.354068, -0.223931, 0.487562, 0.305109, 
-0.384237, -0.233498, 0.492662, 0.339755, 
-0.4174, -0.241846, 0.498312, 0.376244, 
-0.450242, -0.248881, 0.499492, 0.414275, 
-0.482162, -0.254777, 0.496171, 0.454289, 
-0.518292, -0.259032, 0.495377, 0.495711, 
-0.552087, -0.262089, 0.488291, 0.539354, 
-0.587096, -0.262919, 0.480226, 0.583527, 
-0.621537, -0.262041, 0.467373, 0.629242, 
-0.654995, -0.259047, 0.452318, 0.675787, 
-0.686899, -0.254098, 0.433417, 0.72319, 
-0.719999, -0.247001, 0.414082, 0.771327, 
-0.750207, -0.237609, 0.390076, 0.819543, 
-0.781349, -0.226823, 0.364858, 0.869652, 
-0.808769, -0.214115, 0.336771, 0.919726, 
-0.836738, -0.199769, 0.306942, 0.972341, 
-0.862528, -0.183312, 0.275515, 1.02558, 
-0.88528, -0.165241, 0.243392, 1.07923, 
-0.904938, -0.1444, 0.210271, 1.12812, 
-0.916347, -0.121302, 0.176453, 1.17252, 
-0.930909, -0.0962195, 0.143141, 1.21022, 
-0.948474, -0.0699865, 0.108206, 1.24505, 
-0.966965, -0.0427515, 0.0709586, 1.27697, 
-0.984136, -0.0147001, 0.0324932, 1.30793, 
-0.99999, 0.0142234, -0.00705893, 1.33884, 
-0.152431, -0.988314, 0.988314, 0.152431, 
-0.152433, -0.988314, 0.988314, 0.152433, 
-0.152459, -0.98831, 0.98831, 0.152459, 
-0.152574, -0.988292, 0.988292, 0.152574, 
-0.152882, -0.988245, 0.988245, 0.152882, 
-0.153533, -0.988144, 0.988144, 0.153533, 
-0.0308903, -0.00316203, 0.20095, 0.000495299, 
-0.0157239, -0.00471796, 0.105541, 0.000751156, 
-0.000979429, -0.00180423, 0.00189408, 0.000293131, 
-0.00135601, -0.0024996, 0.00260239, 0.000418236, 
-0.00700483, -0.00376738, 0.0437173, 0.000654454, 
-0.00166891, -0.00392448, 0.00429127, 0.000714801, 
-0.0005722, -0.00467025, 0.00361491, 0.000900224, 
-0.0266193, -0.0133072, 0.170153, 0.00273568, 
-0.000282584, -0.00789739, 0.00973152, 0.00174551, 
-0.0280019, -0.0175869, 0.169748, 0.0042058, 
-0.000250243, -0.0140601, 0.0301997, 0.00365344, 
-0.0047138, -0.0163445, 0.0527078, 0.00462783, 
-0.0355971, -0.0273118, 0.196463, 0.00843079, 
-0.0393292, -0.0314682, 0.207619, 0.0105929, 
-0.0436819, -0.0361302, 0.219281, 0.0132511, 
-0.0485327, -0.0412859, 0.230757, 0.0164707, 
-0.0541838, -0.0470457, 0.243084, 0.0203766, 
-0.0610389, -0.0535348, 0.257211, 0.0251116, 
-0.0686155, -0.060585, 0.271374, 0.0307079, 
-0.0768636, -0.0681088, 0.284504, 0.0372222, 
-0.0863731, -0.0764187, 0.298822, 0.044931, 
-0.0969167, -0.0853275, 0.313333, 0.0538695, 
-0.108572, -0.0947364, 0.327262, 0.064117, 
-0.121548, -0.104735, 0.341769, 0.0758645, 
-0.136809, -0.115413, 0.358556, 0.0893646, 
-0.153091, -0.126615, 0.37419, 0.104627, 
-0.17019, -0.138016, 0.387705, 0.121593, 
-0.191287, -0.150136, 0.406623, 0.140933, 
-0.211853, -0.161969, 0.419419, 0.161914, 
-0.233989, -0.173665, 0.431302, 0.184832, 
-0.257468, -0.185196, 0.442165, 0.209865, 
-0.28546, -0.19705, 0.457078, 0.23783, 
-0.311896, -0.207951, 0.464968, 0.267396, 
-0.340152, -0.218284, 0.472098, 0.299248, 
-0.372946, -0.228255, 0.482428, 0.333914, 
-0.403256, -0.236725, 0.48453, 0.369814, 
-0.434662, -0.244213, 0.484926, 0.40803, 
-0.470746, -0.250717, 0.489094, 0.448769, 
-0.504732, -0.255107, 0.484908, 0.490256, 
-0.539684, -0.258254, 0.480285, 0.534102, 
-0.575767, -0.259772, 0.473099, 0.579159, 
-0.609114, -0.259841, 0.460586, 0.626252, 
-0.646044, -0.257772, 0.448937, 0.674154, 
-0.679354, -0.253407, 0.431464, 0.722541, 
-0.713751, -0.247166, 0.412373, 0.77247, 
-0.74626, -0.23923, 0.389572, 0.824551, 
-0.77712, -0.228626, 0.364865, 0.875827, 
-0.806881, -0.216235, 0.337179, 0.929611, 
-0.83527, -0.201926, 0.306777, 0.986014, 
-0.860544, -0.185327, 0.274515, 1.0432, 
-0.877845, -0.165932, 0.23989, 1.09898, 
-0.897484, -0.143852, 0.207367, 1.14658, 
-0.916434, -0.119544, 0.174812, 1.19039, 
-0.93153, -0.0932819, 0.141752, 1.22957, 
-0.949614, -0.0656718, 0.105533, 1.2659, 
-0.967523, -0.0370356, 0.067801, 1.3002, 
-0.983984, -0.0072995, 0.0282416, 1.33219, 
-0.999358, 0.0234627, -0.0122775, 1.36385, 
-0.122953, -0.992412, 0.992412, 0.122953, 
-0.122955, -0.992412, 0.992412, 0.122955, 
-0.122988, -0.992408, 0.992408, 0.122988, 
-0.123133, -0.99239, 0.99239, 0.123133, 
-0.123521, -0.992342, 0.992342, 0.123521, 
-0.124345, -0.992239, 0.992239, 0.124345, 
-0.00158736, -0.00124958, 0.00845642, 0.000158985, 
-0.000569072, -0.00107031, 0.00242855, 0.000139083, 
-0.00304158, -0.00224737, 0.0144901, 0.000301362, 
-0.00102204, -0.00200789, 0.00210157, 0.000280779, 
-0.00134832, -0.00265034, 0.00273704, 0.000391284, 
-0.00151418, -0.00328788, 0.00382713, 0.00051838, 
-0.00160073, -0.00405924, 0.0043786, 0.000690778, 
-0.0195063, -0.0117357, 0.161928, 0.0021756, 
--0.000160143, -0.00867579, 0.0121629, 0.00176465, 
-0.00095256, -0.00708069, 0.00671153, 0.00158747, 
-0.0261131, -0.0184411, 0.179833, 0.00456742, 
-0.0251566, -0.0204737, 0.166272, 0.00560217, 
-0.0290697, -0.0238771, 0.180867, 0.00720891, 
-0.190206, -0.0654841, 1.0857, 0.0217665, 
-0.0361014, -0.0324289, 0.199994, 0.0118341, 
-0.0410004, -0.0374382, 0.212469, 0.0149487, 
-0.0463265, -0.0429703, 0.223811, 0.0187067, 
-0.0526338, -0.0491918, 0.236836, 0.0232711, 
-0.0597919, -0.0559399, 0.249964, 0.0286636, 
-0.0679756, -0.0633713, 0.264027, 0.0350665, 
-0.0799535, -0.0734885, 0.290566, 0.043797, 
-0.0880776, -0.080307, 0.294802, 0.0514211, 
-0.0997939, -0.0897693, 0.310303, 0.0616309, 
-0.113529, -0.100538, 0.33754, 0.0738709, 
-0.126437, -0.109873, 0.339327, 0.0862671, 
-0.142497, -0.120731, 0.3552, 0.101167, 
-0.1591, -0.131674, 0.368417, 0.11764, 
-0.176961, -0.143075, 0.381198, 0.136138, 
-0.199922, -0.155393, 0.400729, 0.157354, 
-0.220576, -0.166889, 0.411467, 0.179775, 
-0.243814, -0.178429, 0.422782, 0.204456, 
-0.272012, -0.190509, 0.439631, 0.232234, 
-0.297413, -0.201292, 0.446602, 0.261144, 
-0.325113, -0.211805, 0.454052, 0.292587, 
-0.357197, -0.221988, 0.464854, 0.326815, 
-0.387512, -0.230854, 0.468557, 0.362621, 
-0.422887, -0.239135, 0.476017, 0.401357, 
-0.454842, -0.245784, 0.474577, 0.441393, 
-0.4939, -0.251819, 0.478708, 0.484744, 
-0.525959, -0.255304, 0.470906, 0.528033, 
-0.56049, -0.257716, 0.463034, 0.574266, 
-0.599298, -0.258053, 0.45683, 0.6216, 
-0.635136, -0.256725, 0.444262, 0.671156, 
-0.668085, -0.25325, 0.426506, 0.72185, 
-0.705952, -0.247576, 0.411059, 0.772522, 
-0.738607, -0.240514, 0.388708, 0.826013, 
-0.771935, -0.231848, 0.364878, 0.883056, 
-0.802626, -0.219916, 0.337455, 0.93761, 
-0.828271, -0.206658, 0.304866, 0.997497, 
-0.854653, -0.190633, 0.274293, 1.05675, 
-0.878575, -0.171478, 0.242191, 1.11284, 
-0.899715, -0.149462, 0.209042, 1.16575, 
-0.917594, -0.124374, 0.17667, 1.21038, 
-0.933118, -0.0972756, 0.142577, 1.25185, 
-0.950482, -0.0683469, 0.106436, 1.29003, 
-0.968057, -0.0378605, 0.0678375, 1.32662, 
-0.984946, -0.006057, 0.0275191, 1.36154, 
-0.999763, 0.0263421, -0.0140355, 1.39507, 
-0.0929704, -0.995669, 0.995669, 0.0929704, 
-0.0929734, -0.995668, 0.995668, 0.0929734, 
-0.093018, -0.995665, 0.995665, 0.093018, 
-0.0932113, -0.995646, 0.995646, 0.0932113, 
-0.0937332, -0.995597, 0.995597, 0.0937332, 
-0.0950439, -0.995473, 0.995473, 0.0950439, 
-0.0972447, -0.99526, 0.99526, 0.0972447, 
-0.000453162, -0.000841975, 0.00202627, 8.53012e-05, 
-0.00051785, -0.00109119, 0.00115777, 0.000116279, 
-0.00082394, -0.00155327, 0.00174618, 0.000176979, 
-0.00110585, -0.00208794, 0.0023052, 0.000258245, 
-0.00142373, -0.00270172, 0.00290993, 0.000367839, 
-0.00110859, -0.00308778, 0.00329062, 0.000467907, 
-0.00202106, -0.00428167, 0.00408156, 0.000727278, 
-0.0133182, -0.00975231, 0.112016, 0.00186434, 
-0.0015961, -0.0106028, 0.0463925, 0.00228167, 
-0.0227302, -0.0175233, 0.218537, 0.00423732, 
-0.00343918, -0.00943668, 0.00823873, 0.00255545, 
-0.0222198, -0.0208861, 0.157431, 0.00630664, 
-0.0256652, -0.0246693, 0.168311, 0.00826475, 
-0.0294815, -0.0288902, 0.178649, 0.0106827, 
-0.0340865, -0.0336661, 0.190451, 0.0136718, 
-0.0394188, -0.0390506, 0.203091, 0.017335, 
-0.0454219, -0.0450566, 0.215894, 0.0217679, 
-0.0522745, -0.0516155, 0.229124, 0.0270304, 
-0.0600328, -0.0587993, 0.242699, 0.033262, 
-0.0692734, -0.0667258, 0.258484, 0.0406476, 
-0.0794743, -0.0752863, 0.273825, 0.0492541, 
-0.0902135, -0.0842464, 0.287647, 0.0590534, 
-0.10203, -0.093685, 0.300973, 0.0702299, 
-0.115948, -0.103894, 0.31682, 0.083142, 
-0.131765, -0.114551, 0.334047, 0.0977347, 
-0.148482, -0.125513, 0.348825, 0.114041, 
-0.165682, -0.136447, 0.361072, 0.131921, 
-0.184908, -0.147919, 0.37439, 0.15209, 
-0.207448, -0.159618, 0.390386, 0.174488, 
-0.22962, -0.170894, 0.401368, 0.198536, 
-0.256397, -0.182682, 0.41675, 0.225519, 
-0.281408, -0.193717, 0.425632, 0.254174, 
-0.313546, -0.205399, 0.4418, 0.286589, 
-0.340538, -0.215072, 0.445675, 0.319321, 
-0.370577, -0.224616, 0.450533, 0.35522, 
-0.406625, -0.233361, 0.45967, 0.393578, 
-0.439429, -0.240985, 0.461108, 0.434079, 
-0.477598, -0.247575, 0.465808, 0.477149, 
-0.511694, -0.252248, 0.461676, 0.521317, 
-0.550609, -0.255624, 0.459422, 0.568013, 
-0.585608, -0.256993, 0.449644, 0.615841, 
-0.620945, -0.257761, 0.437999, 0.66828, 
-0.659757, -0.255044, 0.426182, 0.718413, 
-0.696104, -0.251164, 0.409517, 0.772575, 
-0.731995, -0.244809, 0.389758, 0.827331, 
-0.760979, -0.236838, 0.362753, 0.885859, 
-0.794392, -0.225992, 0.337802, 0.944047, 
-0.825098, -0.213966, 0.308842, 1.00927, 
-0.855244, -0.197716, 0.278547, 1.0676, 
-0.878523, -0.179212, 0.246196, 1.12839, 
-0.899495, -0.157474, 0.213428, 1.18247, 
-0.918639, -0.13319, 0.179992, 1.23147, 
-0.935291, -0.106531, 0.147225, 1.27627, 
-0.952204, -0.0780807, 0.111223, 1.31882, 
-0.96903, -0.0478462, 0.0727796, 1.35891, 
-0.985616, -0.0160055, 0.0325646, 1.39733, 
-1.00086, 0.0173217, -0.00923884, 1.43388, 
-0.0624843, -0.998046, 0.998046, 0.0624843, 
-0.0624887, -0.998046, 0.998046, 0.0624887, 
-0.0625557, -0.998042, 0.998042, 0.0625557, 
-0.0628465, -0.998023, 0.998023, 0.0628465, 
-0.063733, -0.997967, 0.997967, 0.063733, 
-0.0655819, -0.997847, 0.997847, 0.0655819, 
-0.0688018, -0.99763, 0.99763, 0.0688018, 
-0.00123045, -0.000866354, 0.020032, 6.41008e-05, 
-0.000775214, -0.00108838, 0.00581897, 8.85709e-05, 
-0.000517023, -0.00104586, 0.00117012, 9.56271e-05, 
-0.000695742, -0.00140944, 0.00153868, 0.000147315, 
-0.000913931, -0.00185818, 0.00196681, 0.000224412, 
-0.0011976, -0.00244989, 0.00249844, 0.000343424, 
-0.00138448, -0.00310521, 0.00288541, 0.000504727, 
-0.00879898, -0.00820481, 0.0999804, 0.00154002, 
-0.00127878, -0.00469822, 0.00678628, 0.00101202, 
-0.0143271, -0.0226974, 0.294028, 0.00557006, 
-0.0146506, -0.0150146, 0.126606, 0.00416405, 
-0.0149197, -0.0175724, 0.128097, 0.00546564, 
-0.0204428, -0.0215934, 0.146263, 0.00747704, 
-0.0241827, -0.0256195, 0.157518, 0.00980896, 
-0.0182764, -0.0276358, 0.114048, 0.0116271, 
-0.0334965, -0.035405, 0.182011, 0.0162782, 
-0.0390548, -0.0410503, 0.193924, 0.0205246, 
-0.045538, -0.0473766, 0.20729, 0.0256503, 
-0.0532062, -0.0543282, 0.222092, 0.0317284, 
-0.0615065, -0.0618294, 0.235956, 0.0388262, 
-0.0702689, -0.0696903, 0.248096, 0.046925, 
-0.0810221, -0.0784278, 0.263513, 0.05649, 
-0.0917108, -0.0872955, 0.275157, 0.0671314, 
-0.105367, -0.0972136, 0.292308, 0.0796863, 
-0.119413, -0.10733, 0.306433, 0.0936464, 
-0.134427, -0.117614, 0.31894, 0.109112, 
-0.153607, -0.12912, 0.337976, 0.127253, 
-0.171578, -0.13999, 0.349769, 0.146478, 
-0.190788, -0.151088, 0.360755, 0.167778, 
-0.215089, -0.163084, 0.378649, 0.19216, 
-0.237963, -0.174252, 0.388911, 0.21787, 
-0.267045, -0.186126, 0.406398, 0.247014, 
-0.292532, -0.196727, 0.413731, 0.277248, 
-0.324764, -0.207778, 0.427525, 0.311167, 
-0.353838, -0.217588, 0.433158, 0.346596, 
-0.389353, -0.226994, 0.443245, 0.384916, 
-0.421025, -0.23534, 0.445348, 0.425333, 
-0.459636, -0.242857, 0.451485, 0.468582, 
-0.494949, -0.248705, 0.450716, 0.513295, 
-0.534282, -0.253034, 0.450236, 0.559917, 
-0.572106, -0.256168, 0.445181, 0.609418, 
-0.612055, -0.25752, 0.438634, 0.660789, 
-0.644765, -0.257249, 0.422225, 0.714692, 
-0.686955, -0.254068, 0.411385, 0.767711, 
-0.72036, -0.250035, 0.389917, 0.826157, 
-0.754932, -0.244166, 0.368208, 0.887885, 
-0.791836, -0.234974, 0.345095, 0.947764, 
-0.822974, -0.225056, 0.316361, 1.01659, 
-0.853627, -0.211253, 0.286991, 1.08147, 
-0.879638, -0.194357, 0.255167, 1.14423, 
-0.901602, -0.174024, 0.222899, 1.20204, 
-0.920139, -0.150885, 0.18941, 1.25685, 
-0.938377, -0.12491, 0.155928, 1.30574, 
-0.953235, -0.0968301, 0.120879, 1.35312, 
-0.970363, -0.0667111, 0.0825589, 1.39812, 
-0.986258, -0.0347518, 0.0424271, 1.44222, 
-1.0006, -0.00102201, 0.000257191, 1.48365, 
-0.0314941, -0.999504, 0.999504, 0.0314941, 
-0.0315031, -0.999504, 0.999504, 0.0315031, 
-0.0316369, -0.999499, 0.999499, 0.0316369, 
-0.0323157, -0.999478, 0.999478, 0.0323157, 
-0.0340029, -0.999422, 0.999422, 0.0340029, 
-0.0373726, -0.999301, 0.999301, 0.0373726, 
-0.0430943, -0.999071, 0.999071, 0.0430943, 
-0.0517186, -0.998662, 0.998662, 0.0517186, 
-0.000181717, -0.000396026, 0.00044512, 2.52253e-05, 
-0.000262066, -0.000569998, 0.000623413, 4.5005e-05, 
-0.000379231, -0.000823147, 0.000871503, 8.01871e-05, 
-0.000603038, -0.00118393, 0.00128517, 0.000140747, 
-0.000830806, -0.00164624, 0.00170405, 0.000235573, 
-0.000902816, -0.00218571, 0.00191894, 0.000371031, 
-0.00155696, -0.00321408, 0.00702718, 0.000638373, 
--0.000339885, -0.00392796, 0.00434131, 0.00090116, 
-0.0320467, -0.0176534, 0.324484, 0.00462372, 
-0.00601617, -0.0107555, 0.057019, 0.00318304, 
-0.00596015, -0.0104347, 0.032919, 0.00345656, 
-0.0162257, -0.0187712, 0.124013, 0.0069031, 
-0.0196443, -0.0225235, 0.13521, 0.00912918, 
-0.0230991, -0.0266093, 0.144084, 0.0118126, 
-0.0274581, -0.0313286, 0.155249, 0.0151478, 
-0.0323093, -0.036579, 0.1663, 0.0191708, 
-0.0398446, -0.0448358, 0.198501, 0.0253629, 
-0.0385431, -0.0450887, 0.168413, 0.0274312, 
-0.051846, -0.0555984, 0.203154, 0.0362654, 
-0.0598718, -0.0630759, 0.21523, 0.0439967, 
-0.0703099, -0.0714675, 0.232384, 0.0531892, 
-0.0807438, -0.0801724, 0.245586, 0.063545, 
-0.0923338, -0.0893061, 0.258873, 0.0752688, 
-0.106881, -0.0993278, 0.27636, 0.0889073, 
-0.121178, -0.109473, 0.289991, 0.103958, 
-0.138761, -0.120419, 0.307135, 0.121224, 
-0.156249, -0.131397, 0.320646, 0.140145, 
-0.178576, -0.143096, 0.340151, 0.161644, 
-0.202667, -0.155174, 0.359003, 0.185618, 
-0.224328, -0.16631, 0.369419, 0.210672, 
-0.252344, -0.178191, 0.386437, 0.239082, 
-0.277849, -0.18915, 0.396097, 0.26892, 
-0.310137, -0.2007, 0.412075, 0.302534, 
-0.338686, -0.210697, 0.418416, 0.337009, 
-0.372657, -0.220767, 0.428902, 0.37507, 
-0.405416, -0.229917, 0.433747, 0.415412, 
-0.442501, -0.2381, 0.440289, 0.458188, 
-0.47757, -0.245214, 0.440676, 0.503481, 
-0.51556, -0.250604, 0.441313, 0.550163, 
-0.551067, -0.255522, 0.435798, 0.60125, 
-0.592681, -0.257587, 0.43226, 0.651509, 
-0.628961, -0.259859, 0.42085, 0.708865, 
-0.671644, -0.258535, 0.412169, 0.763639, 
-0.709456, -0.256511, 0.395378, 0.824204, 
-0.744742, -0.254467, 0.374763, 0.894361, 
-0.783642, -0.247844, 0.353665, 0.959131, 
-0.818194, -0.240037, 0.328224, 1.031, 
-0.848619, -0.22994, 0.299411, 1.10697, 
-0.879829, -0.213258, 0.269253, 1.16495, 
-0.903145, -0.195368, 0.236388, 1.22934, 
-0.923182, -0.174469, 0.203518, 1.2899, 
-0.94492, -0.150175, 0.169665, 1.34162, 
-0.959962, -0.124088, 0.135874, 1.39547, 
-0.972004, -0.0960442, 0.0993844, 1.451, 
-0.986604, -0.0657217, 0.0597637, 1.50339, 
-0.999521, -0.0333469, 0.0192085, 1.55323, 
-0.000796756, -1, 1, 0.000796756, 
-0.00114596, -0.999999, 0.999999, 0.00114596, 
-0.0040722, -0.999992, 0.999992, 0.0040722, 
-0.00990365, -0.999951, 0.999951, 0.00990365, 
-0.0182299, -0.999834, 0.999834, 0.0182299, 
-0.0289492, -0.999581, 0.999581, 0.0289492, 
-0.0420305, -0.999116, 0.999116, 0.0420305, 
-0.0574361, -0.998349, 0.998349, 0.0574361, 
-0.0751055, -0.997176, 0.997176, 0.0751055, 
-0.0949515, -0.995482, 0.995482, 0.0949515, 
-0.000196402, -0.000403088, 0.000426212, 4.74262e-05, 
-0.000355306, -0.000662574, 0.000713977, 9.41232e-05, 
-0.000543865, -0.0010128, 0.00104515, 0.000170629, 
-0.00241042, -0.00341307, 0.043037, 0.000671616, 
-0.00120918, -0.00354276, 0.022844, 0.000803579, 
--6.92166e-05, -0.00278808, 0.00304221, 0.000720595, 
-0.000754084, -0.00350565, 0.00534129, 0.00102195, 
-0.00561913, -0.0151627, 0.122606, 0.00494072, 
-0.00538962, -0.00825172, 0.0067785, 0.00298153, 
-0.0125223, -0.0165999, 0.0895761, 0.0066039, 
-0.0141474, -0.0184882, 0.102721, 0.00804765, 
-0.0151506, -0.0216752, 0.100825, 0.0102666, 
-0.0205232, -0.0262202, 0.120431, 0.0134492, 
-0.0277504, -0.0329201, 0.149721, 0.0182094, 
-0.00897141, -0.023997, 0.0240465, 0.0142622, 
-0.035129, -0.0421708, 0.15492, 0.0268461, 
-0.0428782, -0.0489686, 0.171876, 0.0333013, 
-0.0495222, -0.0557995, 0.181729, 0.0404441, 
-0.0593384, -0.0637185, 0.199306, 0.0491282, 
-0.0704673, -0.0724909, 0.217883, 0.0593585, 
-0.0805038, -0.0808882, 0.228543, 0.0702475, 
-0.0941605, -0.0905967, 0.246731, 0.0833533, 
-0.106548, -0.100042, 0.257838, 0.0974258, 
-0.119549, -0.11018, 0.267753, 0.113495, 
-0.138575, -0.121277, 0.287574, 0.132075, 
-0.15941, -0.13246, 0.306931, 0.152461, 
-0.182586, -0.144279, 0.3262, 0.175486, 
-0.201353, -0.155274, 0.33446, 0.199577, 
-0.230304, -0.167461, 0.356705, 0.227498, 
-0.256574, -0.178727, 0.369862, 0.256717, 
-0.282116, -0.189999, 0.378598, 0.288693, 
-0.313127, -0.2012, 0.391826, 0.323618, 
-0.341781, -0.21173, 0.398605, 0.360812, 
-0.377761, -0.221599, 0.410298, 0.400519, 
-0.4185, -0.230587, 0.424135, 0.442587, 
-0.457205, -0.23877, 0.430888, 0.487422, 
-0.489587, -0.246313, 0.428629, 0.535723, 
-0.530938, -0.251657, 0.430535, 0.584359, 
-0.568237, -0.256563, 0.426903, 0.637551, 
-0.599591, -0.263712, 0.415431, 0.703234, 
-0.651988, -0.263465, 0.41573, 0.75637, 
-0.68546, -0.269218, 0.399797, 0.835177, 
-0.728569, -0.272214, 0.386799, 0.916524, 
-0.770148, -0.267753, 0.369172, 0.983463, 
-0.806655, -0.263332, 0.346483, 1.06162, 
-0.859776, -0.246004, 0.324632, 1.09657, 
-0.872783, -0.242606, 0.292324, 1.20641, 
-0.908722, -0.227315, 0.262192, 1.27501, 
-0.937018, -0.207783, 0.228356, 1.33307, 
-0.950151, -0.187891, 0.195253, 1.40408, 
-0.964895, -0.165284, 0.162555, 1.47436, 
-0.979302, -0.139238, 0.127204, 1.53504, 
-0.983034, -0.111385, 0.090844, 1.60047, 
-0.996843, -0.0808748, 0.048481, 1.65898, 
-];
-var g_ltc_2 = [1, 0, 0, 0, 
-1, 7.91421e-31, 0, 0, 
-1, 1.04392e-24, 0, 0, 
-1, 3.49405e-21, 0, 0, 
-1, 1.09923e-18, 0, 0, 
-1, 9.47414e-17, 0, 0, 
-1, 3.59627e-15, 0, 0, 
-1, 7.72053e-14, 0, 0, 
-1, 1.08799e-12, 0, 0, 
-1, 1.10655e-11, 0, 0, 
-1, 8.65818e-11, 0, 0, 
-0.999998, 5.45037e-10, 0, 0, 
-0.999994, 2.85095e-09, 0, 0, 
-0.999989, 1.26931e-08, 0, 0, 
-0.999973, 4.89938e-08, 0, 0, 
-0.999947, 1.66347e-07, 0, 0, 
-0.999894, 5.02694e-07, 0, 0, 
-0.999798, 1.36532e-06, 0, 0, 
-0.999617, 3.35898e-06, 0, 0, 
-0.999234, 7.52126e-06, 0, 0, 
-0.998258, 1.52586e-05, 0, 0, 
-0.99504, 2.66207e-05, 0, 0, 
-0.980816, 2.36802e-05, 0, 0, 
-0.967553, 2.07684e-06, 0, 0, 
-0.966877, 4.03733e-06, 0, 0, 
-0.965752, 7.41174e-06, 0, 0, 
-0.96382, 1.27746e-05, 0, 0, 
-0.960306, 2.02792e-05, 0, 0, 
-0.953619, 2.80232e-05, 0, 0, 
-0.941103, 2.78816e-05, 0, 0, 
-0.926619, 1.60221e-05, 0, 0, 
-0.920983, 2.35164e-05, 0, 0, 
-0.912293, 3.11924e-05, 0, 0.0158731, 
-0.899277, 3.48118e-05, 0, 0.0476191, 
-0.880884, 2.6041e-05, 0, 0.0793651, 
-0.870399, 3.38726e-05, 0, 0.111111, 
-0.856138, 3.92906e-05, 0, 0.142857, 
-0.837436, 3.72874e-05, 0, 0.174603, 
-0.820973, 3.92558e-05, 0, 0.206349, 
-0.803583, 4.34658e-05, 0, 0.238095, 
-0.782168, 4.0256e-05, 0, 0.269841, 
-0.764107, 4.48159e-05, 0, 0.301587, 
-0.743092, 4.57627e-05, 0, 0.333333, 
-0.721626, 4.55314e-05, 0, 0.365079, 
-0.700375, 4.77335e-05, 0, 0.396825, 
-0.677334, 4.61072e-05, 0, 0.428571, 
-0.655702, 4.84393e-05, 0, 0.460317, 
-0.632059, 4.64583e-05, 0, 0.492064, 
-0.610125, 4.83923e-05, 0, 0.52381, 
-0.58653, 4.64342e-05, 0, 0.555556, 
-0.564508, 4.77033e-05, 0, 0.587302, 
-0.541405, 4.59263e-05, 0, 0.619048, 
-0.519556, 4.6412e-05, 0, 0.650794, 
-0.497292, 4.48913e-05, 0, 0.68254, 
-0.475898, 4.45789e-05, 0, 0.714286, 
-0.454722, 4.33496e-05, 0, 0.746032, 
-0.434042, 4.23054e-05, 0, 0.777778, 
-0.414126, 4.13737e-05, 0, 0.809524, 
-0.394387, 3.97265e-05, 0, 0.84127, 
-0.375841, 3.90709e-05, 0, 0.873016, 
-0.357218, 3.69938e-05, 0, 0.904762, 
-0.340084, 3.65618e-05, 0, 0.936508, 
-0.322714, 3.42533e-05, 0, 0.968254, 
-0.306974, 3.39596e-05, 0, 1, 
-1, 1.01524e-18, 0, 0, 
-1, 1.0292e-18, 0, 0, 
-1, 1.30908e-18, 0, 0, 
-1, 4.73331e-18, 0, 0, 
-1, 6.25319e-17, 0, 0, 
-1, 1.07932e-15, 0, 0, 
-1, 1.63779e-14, 0, 0, 
-1, 2.03198e-13, 0, 0, 
-1, 2.04717e-12, 0, 0, 
-0.999999, 1.68995e-11, 0, 0, 
-0.999998, 1.15855e-10, 0, 0, 
-0.999996, 6.6947e-10, 0, 0, 
-0.999991, 3.30863e-09, 0, 0, 
-0.999983, 1.41737e-08, 0, 0, 
-0.999968, 5.32626e-08, 0, 0, 
-0.99994, 1.77431e-07, 0, 0, 
-0.999891, 5.28835e-07, 0, 0, 
-0.999797, 1.42169e-06, 0, 0, 
-0.999617, 3.47057e-06, 0, 0, 
-0.999227, 7.7231e-06, 0, 0, 
-0.998239, 1.55753e-05, 0, 0, 
-0.994937, 2.68495e-05, 0, 0, 
-0.980225, 2.13742e-05, 0, 0, 
-0.967549, 2.1631e-06, 0, 0, 
-0.966865, 4.17989e-06, 0, 0, 
-0.965739, 7.63341e-06, 0, 0, 
-0.963794, 1.30892e-05, 0, 0, 
-0.960244, 2.06456e-05, 0, 0, 
-0.953495, 2.82016e-05, 0, 0.000148164, 
-0.940876, 2.71581e-05, 0, 0.002454, 
-0.926569, 1.64159e-05, 0, 0.00867492, 
-0.920905, 2.39521e-05, 0, 0.0195577, 
-0.912169, 3.15127e-05, 0, 0.0354308, 
-0.899095, 3.46626e-05, 0, 0.0562939, 
-0.882209, 2.90223e-05, 0, 0.0818191, 
-0.870272, 3.42992e-05, 0, 0.111259, 
-0.855977, 3.94164e-05, 0, 0.142857, 
-0.837431, 3.72343e-05, 0, 0.174603, 
-0.820826, 3.96691e-05, 0, 0.206349, 
-0.803408, 4.35395e-05, 0, 0.238095, 
-0.782838, 4.19579e-05, 0, 0.269841, 
-0.763941, 4.50952e-05, 0, 0.301587, 
-0.742904, 4.55847e-05, 0, 0.333333, 
-0.721463, 4.58833e-05, 0, 0.365079, 
-0.700197, 4.77159e-05, 0, 0.396825, 
-0.677501, 4.7064e-05, 0, 0.428571, 
-0.655527, 4.84732e-05, 0, 0.460317, 
-0.6324, 4.76834e-05, 0, 0.492063, 
-0.609964, 4.84213e-05, 0, 0.52381, 
-0.586839, 4.75541e-05, 0, 0.555556, 
-0.564353, 4.76951e-05, 0, 0.587302, 
-0.541589, 4.67611e-05, 0, 0.619048, 
-0.519413, 4.63493e-05, 0, 0.650794, 
-0.497337, 4.53993e-05, 0, 0.68254, 
-0.475797, 4.45308e-05, 0, 0.714286, 
-0.454659, 4.35787e-05, 0, 0.746032, 
-0.434065, 4.24839e-05, 0, 0.777778, 
-0.414018, 4.1436e-05, 0, 0.809524, 
-0.39455, 4.01902e-05, 0, 0.84127, 
-0.375742, 3.90813e-05, 0, 0.873016, 
-0.357501, 3.77116e-05, 0, 0.904762, 
-0.339996, 3.6535e-05, 0, 0.936508, 
-0.323069, 3.51265e-05, 0, 0.968254, 
-0.306897, 3.39112e-05, 0, 1, 
-1, 1.0396e-15, 0, 0, 
-1, 1.04326e-15, 0, 0, 
-1, 1.10153e-15, 0, 0, 
-1, 1.44668e-15, 0, 0, 
-1, 3.4528e-15, 0, 0, 
-1, 1.75958e-14, 0, 0, 
-1, 1.2627e-13, 0, 0, 
-1, 9.36074e-13, 0, 0, 
-1, 6.45742e-12, 0, 0, 
-0.999998, 4.01228e-11, 0, 0, 
-0.999997, 2.22338e-10, 0, 0, 
-0.999995, 1.0967e-09, 0, 0, 
-0.999991, 4.82132e-09, 0, 0, 
-0.999981, 1.89434e-08, 0, 0, 
-0.999967, 6.67716e-08, 0, 0, 
-0.999938, 2.12066e-07, 0, 0, 
-0.999886, 6.0977e-07, 0, 0, 
-0.999792, 1.59504e-06, 0, 0, 
-0.999608, 3.81191e-06, 0, 0, 
-0.999209, 8.33727e-06, 0, 0, 
-0.998179, 1.65288e-05, 0, 0, 
-0.994605, 2.74387e-05, 0, 0, 
-0.979468, 1.67316e-05, 0, 0, 
-0.967529, 2.42877e-06, 0, 0, 
-0.966836, 4.61696e-06, 0, 0, 
-0.96569, 8.30977e-06, 0, 0, 
-0.963706, 1.40427e-05, 0, 2.46294e-06, 
-0.960063, 2.17353e-05, 0, 0.000760774, 
-0.953113, 2.86606e-05, 0, 0.00367261, 
-0.940192, 2.47691e-05, 0, 0.00940265, 
-0.927731, 1.95814e-05, 0, 0.018332, 
-0.920669, 2.52531e-05, 0, 0.0306825, 
-0.9118, 3.24277e-05, 0, 0.0465556, 
-0.89857, 3.40982e-05, 0, 0.065951, 
-0.883283, 3.19622e-05, 0, 0.0887677, 
-0.86989, 3.5548e-05, 0, 0.114784, 
-0.855483, 3.97143e-05, 0, 0.143618, 
-0.837987, 3.91665e-05, 0, 0.174606, 
-0.820546, 4.11306e-05, 0, 0.206349, 
-0.802878, 4.36753e-05, 0, 0.238095, 
-0.783402, 4.44e-05, 0, 0.269841, 
-0.763439, 4.58726e-05, 0, 0.301587, 
-0.742925, 4.67097e-05, 0, 0.333333, 
-0.721633, 4.78887e-05, 0, 0.365079, 
-0.69985, 4.81251e-05, 0, 0.396825, 
-0.67783, 4.91811e-05, 0, 0.428571, 
-0.655126, 4.88199e-05, 0, 0.460317, 
-0.632697, 4.96025e-05, 0, 0.492064, 
-0.609613, 4.8829e-05, 0, 0.52381, 
-0.587098, 4.92754e-05, 0, 0.555556, 
-0.564119, 4.82625e-05, 0, 0.587302, 
-0.541813, 4.82807e-05, 0, 0.619048, 
-0.519342, 4.71552e-05, 0, 0.650794, 
-0.497514, 4.66765e-05, 0, 0.68254, 
-0.475879, 4.55582e-05, 0, 0.714286, 
-0.454789, 4.46007e-05, 0, 0.746032, 
-0.434217, 4.35382e-05, 0, 0.777778, 
-0.414086, 4.21753e-05, 0, 0.809524, 
-0.394744, 4.12092e-05, 0, 0.84127, 
-0.375782, 3.96634e-05, 0, 0.873016, 
-0.357707, 3.86419e-05, 0, 0.904762, 
-0.340038, 3.70345e-05, 0, 0.936508, 
-0.323284, 3.59725e-05, 0, 0.968254, 
-0.306954, 3.436e-05, 0, 1, 
-1, 5.99567e-14, 0, 0, 
-1, 6.00497e-14, 0, 0, 
-1, 6.14838e-14, 0, 0, 
-1, 6.86641e-14, 0, 0, 
-1, 9.72657e-14, 0, 0, 
-1, 2.21271e-13, 0, 0, 
-1, 8.33195e-13, 0, 0, 
-1, 4.03601e-12, 0, 0, 
-0.999999, 2.06001e-11, 0, 0, 
-0.999998, 1.01739e-10, 0, 0, 
-0.999997, 4.70132e-10, 0, 0, 
-0.999993, 2.00436e-09, 0, 0, 
-0.999988, 7.83682e-09, 0, 0, 
-0.999979, 2.80338e-08, 0, 0, 
-0.999962, 9.17033e-08, 0, 0, 
-0.999933, 2.74514e-07, 0, 0, 
-0.999881, 7.53201e-07, 0, 0, 
-0.999783, 1.89826e-06, 0, 0, 
-0.999594, 4.40279e-06, 0, 0, 
-0.999178, 9.3898e-06, 0, 0, 
-0.998073, 1.81265e-05, 0, 0, 
-0.993993, 2.80487e-05, 0, 0, 
-0.979982, 1.49422e-05, 0, 0, 
-0.968145, 3.78481e-06, 0, 0, 
-0.966786, 5.3771e-06, 0, 0, 
-0.965611, 9.47507e-06, 0, 3.8828e-05, 
-0.963557, 1.56616e-05, 0, 0.000969343, 
-0.959752, 2.35144e-05, 0, 0.00370329, 
-0.952461, 2.91568e-05, 0, 0.00868351, 
-0.940193, 2.40102e-05, 0, 0.0161889, 
-0.929042, 2.31235e-05, 0, 0.0263948, 
-0.920266, 2.73968e-05, 0, 0.0394088, 
-0.911178, 3.37915e-05, 0, 0.0552818, 
-0.897873, 3.33629e-05, 0, 0.0740138, 
-0.884053, 3.51405e-05, 0, 0.0955539, 
-0.869455, 3.78034e-05, 0, 0.119795, 
-0.854655, 3.99378e-05, 0, 0.14656, 
-0.838347, 4.19108e-05, 0, 0.175572, 
-0.820693, 4.40831e-05, 0, 0.206388, 
-0.802277, 4.45599e-05, 0, 0.238095, 
-0.783634, 4.72691e-05, 0, 0.269841, 
-0.763159, 4.76984e-05, 0, 0.301587, 
-0.742914, 4.91487e-05, 0, 0.333333, 
-0.721662, 5.02312e-05, 0, 0.365079, 
-0.699668, 5.02817e-05, 0, 0.396825, 
-0.677839, 5.1406e-05, 0, 0.428571, 
-0.655091, 5.11095e-05, 0, 0.460317, 
-0.632665, 5.16067e-05, 0, 0.492064, 
-0.609734, 5.12255e-05, 0, 0.52381, 
-0.587043, 5.10263e-05, 0, 0.555556, 
-0.564298, 5.0565e-05, 0, 0.587302, 
-0.541769, 4.97951e-05, 0, 0.619048, 
-0.519529, 4.92697e-05, 0, 0.650794, 
-0.497574, 4.82066e-05, 0, 0.68254, 
-0.476028, 4.73689e-05, 0, 0.714286, 
-0.454961, 4.61941e-05, 0, 0.746032, 
-0.434341, 4.50618e-05, 0, 0.777778, 
-0.414364, 4.38355e-05, 0, 0.809524, 
-0.394832, 4.24196e-05, 0, 0.84127, 
-0.376109, 4.12563e-05, 0, 0.873016, 
-0.35779, 3.96226e-05, 0, 0.904762, 
-0.340379, 3.84885e-05, 0, 0.936508, 
-0.323385, 3.68214e-05, 0, 0.968254, 
-0.307295, 3.56636e-05, 0, 1, 
-1, 1.06465e-12, 0, 0, 
-1, 1.06555e-12, 0, 0, 
-1, 1.07966e-12, 0, 0, 
-1, 1.14601e-12, 0, 0, 
-1, 1.37123e-12, 0, 0, 
-1, 2.1243e-12, 0, 0, 
-0.999999, 4.89653e-12, 0, 0, 
-0.999999, 1.60283e-11, 0, 0, 
-0.999998, 6.2269e-11, 0, 0, 
-0.999997, 2.51859e-10, 0, 0, 
-0.999996, 9.96192e-10, 0, 0, 
-0.999992, 3.74531e-09, 0, 0, 
-0.999986, 1.32022e-08, 0, 0, 
-0.999975, 4.33315e-08, 0, 0, 
-0.999959, 1.31956e-07, 0, 0, 
-0.999927, 3.72249e-07, 0, 0, 
-0.999871, 9.72461e-07, 0, 0, 
-0.999771, 2.35343e-06, 0, 0, 
-0.999572, 5.2768e-06, 0, 0, 
-0.999133, 1.09237e-05, 0, 0, 
-0.997912, 2.03675e-05, 0, 0, 
-0.993008, 2.79396e-05, 0, 0, 
-0.980645, 1.39604e-05, 0, 0, 
-0.970057, 6.46596e-06, 0, 0, 
-0.966717, 6.5089e-06, 0, 4.69989e-05, 
-0.965497, 1.11863e-05, 0, 0.00089544, 
-0.96334, 1.79857e-05, 0, 0.00326475, 
-0.959294, 2.59045e-05, 0, 0.00751442, 
-0.951519, 2.92327e-05, 0, 0.0138734, 
-0.940517, 2.49769e-05, 0, 0.0224952, 
-0.93014, 2.6803e-05, 0, 0.0334828, 
-0.91972, 3.03656e-05, 0, 0.0468973, 
-0.910294, 3.53323e-05, 0, 0.0627703, 
-0.897701, 3.51002e-05, 0, 0.0811018, 
-0.884522, 3.88104e-05, 0, 0.10186, 
-0.869489, 4.12931e-05, 0, 0.124985, 
-0.853983, 4.15781e-05, 0, 0.150372, 
-0.838425, 4.54066e-05, 0, 0.177868, 
-0.820656, 4.71623e-05, 0, 0.207245, 
-0.801875, 4.75243e-05, 0, 0.238142, 
-0.783521, 5.05621e-05, 0, 0.269841, 
-0.763131, 5.0721e-05, 0, 0.301587, 
-0.74261, 5.23293e-05, 0, 0.333333, 
-0.72148, 5.28699e-05, 0, 0.365079, 
-0.699696, 5.38676e-05, 0, 0.396825, 
-0.677592, 5.39255e-05, 0, 0.428571, 
-0.65525, 5.46367e-05, 0, 0.460317, 
-0.632452, 5.41348e-05, 0, 0.492063, 
-0.609903, 5.44976e-05, 0, 0.52381, 
-0.586928, 5.36201e-05, 0, 0.555556, 
-0.564464, 5.35185e-05, 0, 0.587302, 
-0.541801, 5.24949e-05, 0, 0.619048, 
-0.519681, 5.1812e-05, 0, 0.650794, 
-0.497685, 5.07687e-05, 0, 0.68254, 
-0.47622, 4.96243e-05, 0, 0.714286, 
-0.455135, 4.85714e-05, 0, 0.746032, 
-0.4346, 4.71847e-05, 0, 0.777778, 
-0.414564, 4.59294e-05, 0, 0.809524, 
-0.395165, 4.44704e-05, 0, 0.84127, 
-0.376333, 4.30772e-05, 0, 0.873016, 
-0.358197, 4.16229e-05, 0, 0.904762, 
-0.34064, 4.01019e-05, 0, 0.936508, 
-0.323816, 3.86623e-05, 0, 0.968254, 
-0.307581, 3.70933e-05, 0, 1, 
-1, 9.91541e-12, 0, 0, 
-1, 9.92077e-12, 0, 0, 
-1, 1.00041e-11, 0, 0, 
-1, 1.0385e-11, 0, 0, 
-1, 1.15777e-11, 0, 0, 
-1, 1.50215e-11, 0, 0, 
-0.999999, 2.54738e-11, 0, 0, 
-0.999999, 5.98822e-11, 0, 0, 
-0.999998, 1.79597e-10, 0, 0, 
-0.999997, 6.02367e-10, 0, 0, 
-0.999994, 2.06835e-09, 0, 0, 
-0.99999, 6.94952e-09, 0, 0, 
-0.999984, 2.23363e-08, 0, 0, 
-0.999972, 6.78578e-08, 0, 0, 
-0.999952, 1.93571e-07, 0, 0, 
-0.999919, 5.16594e-07, 0, 0, 
-0.99986, 1.28739e-06, 0, 0, 
-0.999753, 2.99298e-06, 0, 0, 
-0.999546, 6.48258e-06, 0, 0, 
-0.999074, 1.29985e-05, 0, 0, 
-0.997671, 2.32176e-05, 0, 0, 
-0.991504, 2.56701e-05, 0, 0, 
-0.981148, 1.31141e-05, 0, 0, 
-0.971965, 8.69048e-06, 0, 2.80182e-05, 
-0.966624, 8.08301e-06, 0, 0.000695289, 
-0.965344, 1.35235e-05, 0, 0.00265526, 
-0.963048, 2.10592e-05, 0, 0.00622981, 
-0.958673, 2.87473e-05, 0, 0.0116234, 
-0.950262, 2.81379e-05, 0, 0.018976, 
-0.940836, 2.71089e-05, 0, 0.0283844, 
-0.930996, 3.0926e-05, 0, 0.0399151, 
-0.919848, 3.48359e-05, 0, 0.0536063, 
-0.909136, 3.66092e-05, 0, 0.0694793, 
-0.897554, 3.84162e-05, 0, 0.0875341, 
-0.884691, 4.30971e-05, 0, 0.107749, 
-0.869414, 4.47803e-05, 0, 0.130087, 
-0.853462, 4.52858e-05, 0, 0.154481, 
-0.838187, 4.95769e-05, 0, 0.180833, 
-0.820381, 5.02709e-05, 0, 0.209004, 
-0.801844, 5.22713e-05, 0, 0.23879, 
-0.783061, 5.41505e-05, 0, 0.269869, 
-0.763205, 5.53712e-05, 0, 0.301587, 
-0.742362, 5.64909e-05, 0, 0.333333, 
-0.721393, 5.72646e-05, 0, 0.365079, 
-0.699676, 5.81012e-05, 0, 0.396825, 
-0.677395, 5.8096e-05, 0, 0.428571, 
-0.655208, 5.85766e-05, 0, 0.460317, 
-0.632451, 5.83602e-05, 0, 0.492063, 
-0.609839, 5.80234e-05, 0, 0.52381, 
-0.587093, 5.77161e-05, 0, 0.555556, 
-0.564468, 5.68447e-05, 0, 0.587302, 
-0.542043, 5.63166e-05, 0, 0.619048, 
-0.519826, 5.5156e-05, 0, 0.650794, 
-0.497952, 5.41682e-05, 0, 0.68254, 
-0.476477, 5.28971e-05, 0, 0.714286, 
-0.455412, 5.14952e-05, 0, 0.746032, 
-0.434926, 5.02222e-05, 0, 0.777778, 
-0.4149, 4.85779e-05, 0, 0.809524, 
-0.395552, 4.72242e-05, 0, 0.84127, 
-0.376712, 4.5489e-05, 0, 0.873016, 
-0.358622, 4.40924e-05, 0, 0.904762, 
-0.341048, 4.22984e-05, 0, 0.936508, 
-0.324262, 4.08582e-05, 0, 0.968254, 
-0.308013, 3.90839e-05, 0, 1, 
-1, 6.13913e-11, 0, 0, 
-1, 6.14145e-11, 0, 0, 
-1, 6.17708e-11, 0, 0, 
-1, 6.33717e-11, 0, 0, 
-1, 6.81648e-11, 0, 0, 
-1, 8.08291e-11, 0, 0, 
-1, 1.14608e-10, 0, 0, 
-0.999998, 2.10507e-10, 0, 0, 
-0.999997, 4.99595e-10, 0, 0, 
-0.999995, 1.39897e-09, 0, 0, 
-0.999994, 4.19818e-09, 0, 0, 
-0.999988, 1.27042e-08, 0, 0, 
-0.999979, 3.75153e-08, 0, 0, 
-0.999965, 1.06206e-07, 0, 0, 
-0.999945, 2.85381e-07, 0, 0, 
-0.999908, 7.23611e-07, 0, 0, 
-0.999846, 1.7255e-06, 0, 0, 
-0.999733, 3.86104e-06, 0, 0, 
-0.999511, 8.08493e-06, 0, 0, 
-0.998993, 1.56884e-05, 0, 0, 
-0.997326, 2.65538e-05, 0, 0, 
-0.989706, 2.06466e-05, 0, 0, 
-0.981713, 1.30756e-05, 0, 6.87288e-06, 
-0.973636, 1.06473e-05, 0, 0.000464971, 
-0.966509, 1.0194e-05, 0, 0.00201784, 
-0.965149, 1.65881e-05, 0, 0.00497532, 
-0.962669, 2.49147e-05, 0, 0.00953291, 
-0.95786, 3.17449e-05, 0, 0.0158214, 
-0.949334, 2.81045e-05, 0, 0.0239345, 
-0.941041, 3.03263e-05, 0, 0.0339371, 
-0.931575, 3.56754e-05, 0, 0.0458739, 
-0.920102, 3.97075e-05, 0, 0.0597721, 
-0.908002, 3.84886e-05, 0, 0.0756451, 
-0.897269, 4.3027e-05, 0, 0.0934929, 
-0.884559, 4.79925e-05, 0, 0.113302, 
-0.869161, 4.8246e-05, 0, 0.135046, 
-0.853342, 5.09505e-05, 0, 0.158679, 
-0.837633, 5.42846e-05, 0, 0.184136, 
-0.820252, 5.54139e-05, 0, 0.211325, 
-0.801872, 5.81412e-05, 0, 0.240113, 
-0.782418, 5.85535e-05, 0, 0.270306, 
-0.7631, 6.10923e-05, 0, 0.301594, 
-0.742183, 6.13678e-05, 0, 0.333333, 
-0.721098, 6.27275e-05, 0, 0.365079, 
-0.699512, 6.29413e-05, 0, 0.396826, 
-0.677372, 6.36351e-05, 0, 0.428572, 
-0.655059, 6.33555e-05, 0, 0.460317, 
-0.632566, 6.36513e-05, 0, 0.492064, 
-0.609784, 6.28965e-05, 0, 0.52381, 
-0.587237, 6.25546e-05, 0, 0.555556, 
-0.564525, 6.15825e-05, 0, 0.587302, 
-0.542181, 6.05048e-05, 0, 0.619048, 
-0.520017, 5.96329e-05, 0, 0.650794, 
-0.498204, 5.81516e-05, 0, 0.68254, 
-0.476742, 5.69186e-05, 0, 0.714286, 
-0.455803, 5.53833e-05, 0, 0.746032, 
-0.435251, 5.37807e-05, 0, 0.777778, 
-0.415374, 5.22025e-05, 0, 0.809524, 
-0.395921, 5.03421e-05, 0, 0.84127, 
-0.377253, 4.88211e-05, 0, 0.873016, 
-0.359021, 4.68233e-05, 0, 0.904762, 
-0.341637, 4.53269e-05, 0, 0.936508, 
-0.3247, 4.33013e-05, 0, 0.968254, 
-0.308625, 4.18007e-05, 0, 1, 
-1, 2.86798e-10, 0, 0, 
-1, 2.86877e-10, 0, 0, 
-1, 2.88094e-10, 0, 0, 
-1, 2.93506e-10, 0, 0, 
-1, 3.09262e-10, 0, 0, 
-0.999999, 3.48593e-10, 0, 0, 
-0.999999, 4.44582e-10, 0, 0, 
-0.999998, 6.88591e-10, 0, 0, 
-0.999996, 1.34391e-09, 0, 0, 
-0.999993, 3.17438e-09, 0, 0, 
-0.999989, 8.35609e-09, 0, 0, 
-0.999983, 2.28677e-08, 0, 0, 
-0.999974, 6.23361e-08, 0, 0, 
-0.999959, 1.65225e-07, 0, 0, 
-0.999936, 4.19983e-07, 0, 0, 
-0.999896, 1.01546e-06, 0, 0, 
-0.99983, 2.32376e-06, 0, 0, 
-0.999709, 5.0156e-06, 0, 0, 
-0.999469, 1.0167e-05, 0, 0, 
-0.998886, 1.90775e-05, 0, 0, 
-0.996819, 3.00511e-05, 0, 0, 
-0.988837, 1.85092e-05, 0, 2.44113e-07, 
-0.982178, 1.34622e-05, 0, 0.00025959, 
-0.975017, 1.25961e-05, 0, 0.00142595, 
-0.967101, 1.3507e-05, 0, 0.00382263, 
-0.964905, 2.05003e-05, 0, 0.00764167, 
-0.96218, 2.9546e-05, 0, 0.0130122, 
-0.956821, 3.43738e-05, 0, 0.0200253, 
-0.948829, 3.05063e-05, 0, 0.0287452, 
-0.941092, 3.46487e-05, 0, 0.039218, 
-0.931883, 4.12061e-05, 0, 0.0514748, 
-0.920211, 4.44651e-05, 0, 0.0655351, 
-0.907307, 4.31252e-05, 0, 0.0814082, 
-0.89684, 4.90382e-05, 0, 0.0990938, 
-0.884119, 5.3334e-05, 0, 0.118583, 
-0.869148, 5.4114e-05, 0, 0.139856, 
-0.853377, 5.78536e-05, 0, 0.162882, 
-0.836753, 5.92285e-05, 0, 0.187615, 
-0.820063, 6.22786e-05, 0, 0.213991, 
-0.801694, 6.45492e-05, 0, 0.241918, 
-0.782116, 6.5353e-05, 0, 0.271267, 
-0.762673, 6.74344e-05, 0, 0.301847, 
-0.742133, 6.82788e-05, 0, 0.333333, 
-0.720779, 6.91959e-05, 0, 0.365079, 
-0.699386, 6.96817e-05, 0, 0.396826, 
-0.67732, 6.99583e-05, 0, 0.428572, 
-0.654888, 6.98447e-05, 0, 0.460317, 
-0.632499, 6.94063e-05, 0, 0.492064, 
-0.609825, 6.91612e-05, 0, 0.52381, 
-0.587287, 6.81576e-05, 0, 0.555556, 
-0.564743, 6.74138e-05, 0, 0.587302, 
-0.542409, 6.61617e-05, 0, 0.619048, 
-0.520282, 6.47785e-05, 0, 0.650794, 
-0.498506, 6.33836e-05, 0, 0.68254, 
-0.477102, 6.15905e-05, 0, 0.714286, 
-0.456167, 6.01013e-05, 0, 0.746032, 
-0.435728, 5.81457e-05, 0, 0.777778, 
-0.415809, 5.64215e-05, 0, 0.809524, 
-0.396517, 5.44997e-05, 0, 0.84127, 
-0.377737, 5.25061e-05, 0, 0.873016, 
-0.359698, 5.06831e-05, 0, 0.904762, 
-0.342164, 4.8568e-05, 0, 0.936508, 
-0.325417, 4.67826e-05, 0, 0.968254, 
-0.309186, 4.46736e-05, 0, 1, 
-1, 1.09018e-09, 0, 0, 
-1, 1.0904e-09, 0, 0, 
-1, 1.09393e-09, 0, 0, 
-1, 1.1095e-09, 0, 0, 
-1, 1.154e-09, 0, 0, 
-1, 1.26089e-09, 0, 0, 
-0.999999, 1.5059e-09, 0, 0, 
-0.999997, 2.07899e-09, 0, 0, 
-0.999994, 3.48164e-09, 0, 0, 
-0.999993, 7.05728e-09, 0, 0, 
-0.999987, 1.63692e-08, 0, 0, 
-0.999981, 4.06033e-08, 0, 0, 
-0.999969, 1.0245e-07, 0, 0, 
-0.999953, 2.55023e-07, 0, 0, 
-0.999925, 6.1511e-07, 0, 0, 
-0.999881, 1.42218e-06, 0, 0, 
-0.99981, 3.13086e-06, 0, 0, 
-0.99968, 6.53119e-06, 0, 0, 
-0.999418, 1.2832e-05, 0, 0, 
-0.998748, 2.32497e-05, 0, 0, 
-0.996066, 3.29522e-05, 0, 0, 
-0.988379, 1.79613e-05, 0, 0.000108813, 
-0.982567, 1.43715e-05, 0, 0.000921292, 
-0.976097, 1.48096e-05, 0, 0.00280739, 
-0.968475, 1.78905e-05, 0, 0.00596638, 
-0.964606, 2.53921e-05, 0, 0.0105284, 
-0.961564, 3.48623e-05, 0, 0.0165849, 
-0.955517, 3.57612e-05, 0, 0.0242001, 
-0.948381, 3.43493e-05, 0, 0.0334201, 
-0.941095, 4.05849e-05, 0, 0.0442777, 
-0.931923, 4.75394e-05, 0, 0.0567959, 
-0.91996, 4.84328e-05, 0, 0.0709879, 
-0.907419, 5.02146e-05, 0, 0.0868609, 
-0.89618, 5.61654e-05, 0, 0.104415, 
-0.88337, 5.87612e-05, 0, 0.123643, 
-0.869046, 6.18057e-05, 0, 0.144531, 
-0.853278, 6.57392e-05, 0, 0.167057, 
-0.836091, 6.6303e-05, 0, 0.191188, 
-0.819644, 7.04445e-05, 0, 0.216878, 
-0.801246, 7.14071e-05, 0, 0.244062, 
-0.782031, 7.40093e-05, 0, 0.272649, 
-0.762066, 7.4685e-05, 0, 0.302509, 
-0.741964, 7.66647e-05, 0, 0.333442, 
-0.720554, 7.66328e-05, 0, 0.365079, 
-0.699098, 7.77857e-05, 0, 0.396825, 
-0.677189, 7.74633e-05, 0, 0.428571, 
-0.65484, 7.76235e-05, 0, 0.460317, 
-0.632496, 7.70316e-05, 0, 0.492064, 
-0.609908, 7.62669e-05, 0, 0.52381, 
-0.587312, 7.53972e-05, 0, 0.555556, 
-0.564938, 7.39994e-05, 0, 0.587302, 
-0.542577, 7.28382e-05, 0, 0.619048, 
-0.52062, 7.1112e-05, 0, 0.650794, 
-0.498819, 6.94004e-05, 0, 0.68254, 
-0.477555, 6.75574e-05, 0, 0.714286, 
-0.456568, 6.53449e-05, 0, 0.746032, 
-0.436278, 6.36067e-05, 0, 0.777778, 
-0.41637, 6.13466e-05, 0, 0.809524, 
-0.397144, 5.94176e-05, 0, 0.84127, 
-0.378412, 5.70987e-05, 0, 0.873016, 
-0.360376, 5.50419e-05, 0, 0.904762, 
-0.342906, 5.27422e-05, 0, 0.936508, 
-0.326136, 5.06544e-05, 0, 0.968254, 
-0.30997, 4.84307e-05, 0, 1, 
-1, 3.54014e-09, 0, 0, 
-1, 3.54073e-09, 0, 0, 
-1, 3.54972e-09, 0, 0, 
-1, 3.58929e-09, 0, 0, 
-1, 3.70093e-09, 0, 0, 
-0.999999, 3.96194e-09, 0, 0, 
-0.999998, 4.53352e-09, 0, 0, 
-0.999997, 5.78828e-09, 0, 0, 
-0.999994, 8.63812e-09, 0, 0, 
-0.999991, 1.53622e-08, 0, 0, 
-0.999985, 3.16356e-08, 0, 0, 
-0.999977, 7.12781e-08, 0, 0, 
-0.999964, 1.66725e-07, 0, 0, 
-0.999945, 3.90501e-07, 0, 0, 
-0.999912, 8.95622e-07, 0, 0, 
-0.999866, 1.98428e-06, 0, 0, 
-0.999786, 4.21038e-06, 0, 0, 
-0.999647, 8.50239e-06, 0, 0, 
-0.999356, 1.62059e-05, 0, 0, 
-0.998563, 2.82652e-05, 0, 0, 
-0.994928, 3.36309e-05, 0, 2.43539e-05, 
-0.987999, 1.78458e-05, 0, 0.000523957, 
-0.982893, 1.59162e-05, 0, 0.00194727, 
-0.977044, 1.78056e-05, 0, 0.004511, 
-0.969972, 2.30624e-05, 0, 0.00835127, 
-0.964237, 3.13922e-05, 0, 0.013561, 
-0.960791, 4.06145e-05, 0, 0.0202057, 
-0.954292, 3.72796e-05, 0, 0.0283321, 
-0.948052, 4.03199e-05, 0, 0.037974, 
-0.940938, 4.79537e-05, 0, 0.0491551, 
-0.931689, 5.45292e-05, 0, 0.0618918, 
-0.91987, 5.4038e-05, 0, 0.0761941, 
-0.907665, 5.89909e-05, 0, 0.0920672, 
-0.895281, 6.42651e-05, 0, 0.109511, 
-0.882621, 6.59707e-05, 0, 0.12852, 
-0.86873, 7.09973e-05, 0, 0.149085, 
-0.853008, 7.42221e-05, 0, 0.171189, 
-0.835944, 7.61754e-05, 0, 0.194809, 
-0.818949, 7.97052e-05, 0, 0.21991, 
-0.800951, 8.12434e-05, 0, 0.246446, 
-0.781847, 8.38075e-05, 0, 0.274352, 
-0.761649, 8.4501e-05, 0, 0.303535, 
-0.74152, 8.60258e-05, 0, 0.333857, 
-0.720495, 8.66233e-05, 0, 0.365104, 
-0.698742, 8.68326e-05, 0, 0.396825, 
-0.677096, 8.7133e-05, 0, 0.428571, 
-0.654782, 8.63497e-05, 0, 0.460317, 
-0.632335, 8.60206e-05, 0, 0.492063, 
-0.610031, 8.49337e-05, 0, 0.52381, 
-0.587457, 8.38279e-05, 0, 0.555556, 
-0.56513, 8.2309e-05, 0, 0.587302, 
-0.542877, 8.03542e-05, 0, 0.619048, 
-0.5209, 7.86928e-05, 0, 0.650794, 
-0.499291, 7.65171e-05, 0, 0.68254, 
-0.477971, 7.44753e-05, 0, 0.714286, 
-0.457221, 7.2209e-05, 0, 0.746032, 
-0.436803, 6.97448e-05, 0, 0.777778, 
-0.417083, 6.75333e-05, 0, 0.809524, 
-0.397749, 6.48058e-05, 0, 0.84127, 
-0.379177, 6.25759e-05, 0, 0.873016, 
-0.361061, 5.98584e-05, 0, 0.904762, 
-0.343713, 5.75797e-05, 0, 0.936508, 
-0.326894, 5.49999e-05, 0, 0.968254, 
-0.310816, 5.27482e-05, 0, 1, 
-1, 1.0153e-08, 0, 0, 
-1, 1.01544e-08, 0, 0, 
-1, 1.01751e-08, 0, 0, 
-1, 1.02662e-08, 0, 0, 
-1, 1.0521e-08, 0, 0, 
-0.999999, 1.11049e-08, 0, 0, 
-0.999999, 1.23408e-08, 0, 0, 
-0.999996, 1.4924e-08, 0, 0, 
-0.999992, 2.04471e-08, 0, 0, 
-0.999989, 3.26539e-08, 0, 0, 
-0.99998, 6.03559e-08, 0, 0, 
-0.999971, 1.23936e-07, 0, 0, 
-0.999955, 2.69058e-07, 0, 0, 
-0.999933, 5.93604e-07, 0, 0, 
-0.999901, 1.29633e-06, 0, 0, 
-0.999847, 2.75621e-06, 0, 0, 
-0.999761, 5.64494e-06, 0, 0, 
-0.999607, 1.10485e-05, 0, 0, 
-0.999282, 2.04388e-05, 0, 0, 
-0.99831, 3.41084e-05, 0, 2.1291e-07, 
-0.993288, 2.94949e-05, 0, 0.000242336, 
-0.987855, 1.92736e-05, 0, 0.0012503, 
-0.983167, 1.82383e-05, 0, 0.00327445, 
-0.977908, 2.18633e-05, 0, 0.00646321, 
-0.971194, 2.90662e-05, 0, 0.0109132, 
-0.963867, 3.86401e-05, 0, 0.0166927, 
-0.95982, 4.62827e-05, 0, 0.0238495, 
-0.953497, 4.20705e-05, 0, 0.0324178, 
-0.947621, 4.77743e-05, 0, 0.0424225, 
-0.940611, 5.68257e-05, 0, 0.0538808, 
-0.931174, 6.18061e-05, 0, 0.0668047, 
-0.919919, 6.27098e-05, 0, 0.0812014, 
-0.907856, 6.94714e-05, 0, 0.0970745, 
-0.894509, 7.35008e-05, 0, 0.114424, 
-0.881954, 7.63369e-05, 0, 0.133246, 
-0.868309, 8.21896e-05, 0, 0.153534, 
-0.852511, 8.3769e-05, 0, 0.175275, 
-0.835821, 8.81615e-05, 0, 0.198453, 
-0.817981, 8.96368e-05, 0, 0.223042, 
-0.800504, 9.30906e-05, 0, 0.249008, 
-0.78141, 9.45056e-05, 0, 0.276304, 
-0.761427, 9.63605e-05, 0, 0.304862, 
-0.74094, 9.68087e-05, 0, 0.334584, 
-0.720233, 9.81481e-05, 0, 0.365322, 
-0.698592, 9.79122e-05, 0, 0.396826, 
-0.676763, 9.81057e-05, 0, 0.428571, 
-0.654808, 9.73956e-05, 0, 0.460317, 
-0.632326, 9.62619e-05, 0, 0.492063, 
-0.610049, 9.52996e-05, 0, 0.52381, 
-0.58763, 9.33334e-05, 0, 0.555556, 
-0.565261, 9.17573e-05, 0, 0.587302, 
-0.543244, 8.96636e-05, 0, 0.619048, 
-0.521273, 8.73304e-05, 0, 0.650794, 
-0.499818, 8.52647e-05, 0, 0.68254, 
-0.478536, 8.23961e-05, 0, 0.714286, 
-0.457826, 7.9939e-05, 0, 0.746032, 
-0.437549, 7.7126e-05, 0, 0.777778, 
-0.41776, 7.43043e-05, 0, 0.809524, 
-0.39863, 7.16426e-05, 0, 0.84127, 
-0.379954, 6.86455e-05, 0, 0.873016, 
-0.362025, 6.60514e-05, 0, 0.904762, 
-0.344581, 6.30755e-05, 0, 0.936508, 
-0.327909, 6.05439e-05, 0, 0.968254, 
-0.311736, 5.76345e-05, 0, 1, 
-1, 2.63344e-08, 0, 0, 
-1, 2.63373e-08, 0, 0, 
-1, 2.63815e-08, 0, 0, 
-1, 2.65753e-08, 0, 0, 
-1, 2.71132e-08, 0, 0, 
-0.999999, 2.83279e-08, 0, 0, 
-0.999997, 3.0833e-08, 0, 0, 
-0.999995, 3.58711e-08, 0, 0, 
-0.999992, 4.61266e-08, 0, 0, 
-0.999985, 6.7574e-08, 0, 0, 
-0.999977, 1.1358e-07, 0, 0, 
-0.999966, 2.13657e-07, 0, 0, 
-0.999948, 4.31151e-07, 0, 0, 
-0.999923, 8.96656e-07, 0, 0, 
-0.999884, 1.86603e-06, 0, 0, 
-0.999826, 3.81115e-06, 0, 0, 
-0.999732, 7.54184e-06, 0, 0, 
-0.999561, 1.43192e-05, 0, 0, 
-0.999191, 2.57061e-05, 0, 0, 
-0.997955, 4.05724e-05, 0, 7.43928e-05, 
-0.992228, 2.76537e-05, 0, 0.000716599, 
-0.987638, 2.08885e-05, 0, 0.00225242, 
-0.983395, 2.15226e-05, 0, 0.00484811, 
-0.978614, 2.70795e-05, 0, 0.00860962, 
-0.972389, 3.65282e-05, 0, 0.0136083, 
-0.964392, 4.74747e-05, 0, 0.0198941, 
-0.95861, 5.09141e-05, 0, 0.0275024, 
-0.952806, 4.8963e-05, 0, 0.0364584, 
-0.94712, 5.71119e-05, 0, 0.04678, 
-0.940104, 6.71704e-05, 0, 0.0584799, 
-0.930398, 6.87586e-05, 0, 0.0715666, 
-0.919866, 7.38161e-05, 0, 0.086045, 
-0.907853, 8.13235e-05, 0, 0.101918, 
-0.894078, 8.34582e-05, 0, 0.119186, 
-0.881177, 8.92093e-05, 0, 0.137845, 
-0.867575, 9.44548e-05, 0, 0.157891, 
-0.852107, 9.69607e-05, 0, 0.179315, 
-0.835502, 0.000101456, 0, 0.202106, 
-0.81756, 0.000103256, 0, 0.226243, 
-0.79984, 0.000106954, 0, 0.251704, 
-0.780998, 0.000108066, 0, 0.278451, 
-0.761132, 0.000110111, 0, 0.306436, 
-0.740429, 0.000110459, 0, 0.335586, 
-0.719836, 0.000111219, 0, 0.365796, 
-0.698467, 0.00011145, 0, 0.3969, 
-0.676446, 0.000110393, 0, 0.428571, 
-0.654635, 0.000110035, 0, 0.460317, 
-0.632411, 0.000108548, 0, 0.492063, 
-0.609986, 0.000106963, 0, 0.52381, 
-0.587872, 0.000105238, 0, 0.555556, 
-0.565528, 0.000102665, 0, 0.587302, 
-0.543563, 0.000100543, 0, 0.619048, 
-0.52176, 9.76182e-05, 0, 0.650794, 
-0.500188, 9.47099e-05, 0, 0.68254, 
-0.479204, 9.19929e-05, 0, 0.714286, 
-0.458413, 8.86139e-05, 0, 0.746032, 
-0.438314, 8.57839e-05, 0, 0.777778, 
-0.418573, 8.2411e-05, 0, 0.809524, 
-0.39947, 7.92211e-05, 0, 0.84127, 
-0.380892, 7.59546e-05, 0, 0.873016, 
-0.362953, 7.27571e-05, 0, 0.904762, 
-0.345601, 6.95738e-05, 0, 0.936508, 
-0.328895, 6.64907e-05, 0, 0.968254, 
-0.312808, 6.34277e-05, 0, 1, 
-1, 6.28647e-08, 0, 0, 
-1, 6.28705e-08, 0, 0, 
-1, 6.29587e-08, 0, 0, 
-1, 6.33441e-08, 0, 0, 
-0.999999, 6.44087e-08, 0, 0, 
-0.999998, 6.67856e-08, 0, 0, 
-0.999997, 7.15889e-08, 0, 0, 
-0.999995, 8.09577e-08, 0, 0, 
-0.999989, 9.92764e-08, 0, 0, 
-0.999983, 1.35834e-07, 0, 0, 
-0.999974, 2.10482e-07, 0, 0, 
-0.999959, 3.65215e-07, 0, 0, 
-0.999939, 6.86693e-07, 0, 0, 
-0.999911, 1.3472e-06, 0, 0, 
-0.999868, 2.6731e-06, 0, 0, 
-0.999804, 5.24756e-06, 0, 0, 
-0.9997, 1.00403e-05, 0, 0, 
-0.99951, 1.85019e-05, 0, 0, 
-0.999078, 3.22036e-05, 0, 6.20676e-06, 
-0.997428, 4.70002e-05, 0, 0.00034139, 
-0.99162, 2.87123e-05, 0, 0.00143722, 
-0.987479, 2.34706e-05, 0, 0.00349201, 
-0.983582, 2.60083e-05, 0, 0.00662413, 
-0.979186, 3.37927e-05, 0, 0.0109113, 
-0.97325, 4.54689e-05, 0, 0.0164063, 
-0.965221, 5.73759e-05, 0, 0.0231463, 
-0.957262, 5.44114e-05, 0, 0.0311572, 
-0.952211, 5.87006e-05, 0, 0.0404572, 
-0.946631, 6.92256e-05, 0, 0.0510592, 
-0.939391, 7.87819e-05, 0, 0.0629723, 
-0.929795, 7.92368e-05, 0, 0.0762025, 
-0.91965, 8.75075e-05, 0, 0.090753, 
-0.907737, 9.50903e-05, 0, 0.106626, 
-0.893899, 9.72963e-05, 0, 0.123822, 
-0.880239, 0.00010459, 0, 0.142337, 
-0.866562, 0.000107689, 0, 0.16217, 
-0.85164, 0.000113081, 0, 0.183314, 
-0.835021, 0.000116636, 0, 0.20576, 
-0.817311, 0.000120074, 0, 0.229496, 
-0.798845, 0.000121921, 0, 0.254502, 
-0.780479, 0.00012475, 0, 0.280753, 
-0.760694, 0.000125255, 0, 0.308212, 
-0.740142, 0.000126719, 0, 0.336825, 
-0.719248, 0.00012636, 0, 0.366517, 
-0.698209, 0.000126712, 0, 0.397167, 
-0.676398, 0.000125769, 0, 0.428578, 
-0.654378, 0.000124432, 0, 0.460317, 
-0.632484, 0.000123272, 0, 0.492064, 
-0.610113, 0.00012085, 0, 0.52381, 
-0.587931, 0.000118411, 0, 0.555556, 
-0.565872, 0.00011569, 0, 0.587302, 
-0.543814, 0.000112521, 0, 0.619048, 
-0.522265, 0.000109737, 0, 0.650794, 
-0.500835, 0.000106228, 0, 0.68254, 
-0.479818, 0.000102591, 0, 0.714286, 
-0.459258, 9.91288e-05, 0, 0.746032, 
-0.439061, 9.52325e-05, 0, 0.777778, 
-0.419552, 9.1895e-05, 0, 0.809524, 
-0.400399, 8.79051e-05, 0, 0.84127, 
-0.381976, 8.44775e-05, 0, 0.873016, 
-0.364009, 8.06316e-05, 0, 0.904762, 
-0.346761, 7.71848e-05, 0, 0.936508, 
-0.330049, 7.35429e-05, 0, 0.968254, 
-0.314018, 7.02103e-05, 0, 1, 
-1, 1.39968e-07, 0, 0, 
-1, 1.39979e-07, 0, 0, 
-1, 1.40145e-07, 0, 0, 
-1, 1.4087e-07, 0, 0, 
-0.999999, 1.42865e-07, 0, 0, 
-0.999998, 1.47279e-07, 0, 0, 
-0.999997, 1.56057e-07, 0, 0, 
-0.999992, 1.7276e-07, 0, 0, 
-0.999989, 2.04352e-07, 0, 0, 
-0.99998, 2.6494e-07, 0, 0, 
-0.999969, 3.83435e-07, 0, 0, 
-0.999953, 6.18641e-07, 0, 0, 
-0.999929, 1.08755e-06, 0, 0, 
-0.999898, 2.01497e-06, 0, 0, 
-0.999849, 3.81346e-06, 0, 0, 
-0.999778, 7.19815e-06, 0, 0, 
-0.999661, 1.33215e-05, 0, 0, 
-0.999451, 2.38313e-05, 0, 0, 
-0.998936, 4.01343e-05, 0, 0.000113724, 
-0.99662, 5.17346e-05, 0, 0.000820137, 
-0.991094, 3.04323e-05, 0, 0.00238135, 
-0.987487, 2.81757e-05, 0, 0.00493527, 
-0.983731, 3.20048e-05, 0, 0.00856855, 
-0.979647, 4.23905e-05, 0, 0.0133393, 
-0.973837, 5.62935e-05, 0, 0.0192863, 
-0.96584, 6.77442e-05, 0, 0.026437, 
-0.956309, 6.23073e-05, 0, 0.03481, 
-0.951523, 7.04131e-05, 0, 0.0444184, 
-0.946003, 8.36594e-05, 0, 0.0552713, 
-0.938454, 9.11736e-05, 0, 0.0673749, 
-0.929279, 9.38264e-05, 0, 0.0807329, 
-0.919239, 0.000103754, 0, 0.0953479, 
-0.907293, 0.000109928, 0, 0.111221, 
-0.893936, 0.000115257, 0, 0.128352, 
-0.879674, 0.000122265, 0, 0.14674, 
-0.865668, 0.000125733, 0, 0.166382, 
-0.850998, 0.000132305, 0, 0.187276, 
-0.834498, 0.000134844, 0, 0.209413, 
-0.816903, 0.000139276, 0, 0.232786, 
-0.798235, 0.000140984, 0, 0.257381, 
-0.779724, 0.00014378, 0, 0.283181, 
-0.760251, 0.000144623, 0, 0.310156, 
-0.739808, 0.000145228, 0, 0.338269, 
-0.718762, 0.00014539, 0, 0.367461, 
-0.697815, 0.000144432, 0, 0.397646, 
-0.67631, 0.000143893, 0, 0.428685, 
-0.654278, 0.000141846, 0, 0.460317, 
-0.632347, 0.00013935, 0, 0.492063, 
-0.610296, 0.000137138, 0, 0.52381, 
-0.588039, 0.000133806, 0, 0.555556, 
-0.566218, 0.000130755, 0, 0.587302, 
-0.544346, 0.000127128, 0, 0.619048, 
-0.522701, 0.000123002, 0, 0.650794, 
-0.501542, 0.000119443, 0, 0.68254, 
-0.480508, 0.000115055, 0, 0.714286, 
-0.460092, 0.000111032, 0, 0.746032, 
-0.440021, 0.000106635, 0, 0.777778, 
-0.420446, 0.000102162, 0, 0.809524, 
-0.401512, 9.8184e-05, 0, 0.84127, 
-0.38299, 9.36497e-05, 0, 0.873016, 
-0.365232, 8.9813e-05, 0, 0.904762, 
-0.347865, 8.53073e-05, 0, 0.936508, 
-0.331342, 8.17068e-05, 0, 0.968254, 
-0.315201, 7.73818e-05, 0, 1, 
-1, 2.9368e-07, 0, 0, 
-1, 2.937e-07, 0, 0, 
-1, 2.93998e-07, 0, 0, 
-1, 2.95298e-07, 0, 0, 
-0.999999, 2.98865e-07, 0, 0, 
-0.999998, 3.067e-07, 0, 0, 
-0.999995, 3.22082e-07, 0, 0, 
-0.999992, 3.50767e-07, 0, 0, 
-0.999986, 4.03538e-07, 0, 0, 
-0.999976, 5.01372e-07, 0, 0, 
-0.999964, 6.8562e-07, 0, 0, 
-0.999945, 1.0374e-06, 0, 0, 
-0.999919, 1.71269e-06, 0, 0, 
-0.999882, 3.00175e-06, 0, 0, 
-0.999829, 5.42144e-06, 0, 0, 
-0.999749, 9.84182e-06, 0, 0, 
-0.99962, 1.76213e-05, 0, 0, 
-0.999382, 3.05995e-05, 0, 1.38418e-05, 
-0.998751, 4.96686e-05, 0, 0.000389844, 
-0.995344, 5.10733e-05, 0, 0.00150339, 
-0.990768, 3.45829e-05, 0, 0.00352459, 
-0.987464, 3.42841e-05, 0, 0.00655379, 
-0.983846, 3.99072e-05, 0, 0.0106554, 
-0.980007, 5.33219e-05, 0, 0.0158723, 
-0.974494, 6.96992e-05, 0, 0.0222332, 
-0.96622, 7.76754e-05, 0, 0.029758, 
-0.956273, 7.47718e-05, 0, 0.0384597, 
-0.950952, 8.64611e-05, 0, 0.0483473, 
-0.945215, 0.000100464, 0, 0.0594266, 
-0.937287, 0.000103729, 0, 0.0717019, 
-0.928649, 0.000111665, 0, 0.0851752, 
-0.918791, 0.00012353, 0, 0.0998479, 
-0.906685, 0.000127115, 0, 0.115721, 
-0.893706, 0.00013628, 0, 0.132794, 
-0.879248, 0.000142427, 0, 0.151067, 
-0.864685, 0.000148091, 0, 0.170538, 
-0.850032, 0.000153517, 0, 0.191204, 
-0.833853, 0.000157322, 0, 0.213063, 
-0.816353, 0.000161086, 0, 0.236107, 
-0.797834, 0.000164111, 0, 0.260328, 
-0.778831, 0.000165446, 0, 0.285714, 
-0.759756, 0.000167492, 0, 0.312243, 
-0.739419, 0.000166928, 0, 0.339887, 
-0.718491, 0.000167, 0, 0.368604, 
-0.697392, 0.000165674, 0, 0.398329, 
-0.676102, 0.000163815, 0, 0.428961, 
-0.654243, 0.000162003, 0, 0.460331, 
-0.632176, 0.000158831, 0, 0.492063, 
-0.610407, 0.000155463, 0, 0.52381, 
-0.588394, 0.000152062, 0, 0.555556, 
-0.56645, 0.000147665, 0, 0.587302, 
-0.5449, 0.00014375, 0, 0.619048, 
-0.523276, 0.000138905, 0, 0.650794, 
-0.502179, 0.000134189, 0, 0.68254, 
-0.481359, 0.000129392, 0, 0.714286, 
-0.46092, 0.000124556, 0, 0.746032, 
-0.441084, 0.00011957, 0, 0.777778, 
-0.421517, 0.000114652, 0, 0.809524, 
-0.402721, 0.000109688, 0, 0.84127, 
-0.384222, 0.000104667, 0, 0.873016, 
-0.366534, 9.99633e-05, 0, 0.904762, 
-0.349205, 9.50176e-05, 0, 0.936508, 
-0.332702, 9.07301e-05, 0, 0.968254, 
-0.316599, 8.59769e-05, 0, 1, 
-1, 5.85473e-07, 0, 0, 
-1, 5.85507e-07, 0, 0, 
-1, 5.8602e-07, 0, 0, 
-0.999999, 5.88259e-07, 0, 0, 
-0.999999, 5.94381e-07, 0, 0, 
-0.999998, 6.07754e-07, 0, 0, 
-0.999995, 6.33729e-07, 0, 0, 
-0.99999, 6.8137e-07, 0, 0, 
-0.999984, 7.67003e-07, 0, 0, 
-0.999973, 9.21212e-07, 0, 0, 
-0.999959, 1.20218e-06, 0, 0, 
-0.999936, 1.72024e-06, 0, 0, 
-0.999907, 2.68088e-06, 0, 0, 
-0.999866, 4.45512e-06, 0, 0, 
-0.999806, 7.68481e-06, 0, 0, 
-0.999716, 1.342e-05, 0, 0, 
-0.999576, 2.32473e-05, 0, 0, 
-0.9993, 3.91694e-05, 0, 0.000129897, 
-0.998498, 6.08429e-05, 0, 0.000845005, 
-0.994132, 4.89743e-05, 0, 0.0023761, 
-0.99031, 3.84644e-05, 0, 0.00484466, 
-0.987409, 4.21767e-05, 0, 0.00832469, 
-0.983981, 5.04854e-05, 0, 0.0128642, 
-0.980268, 6.71028e-05, 0, 0.0184947, 
-0.974875, 8.52749e-05, 0, 0.0252369, 
-0.966063, 8.5531e-05, 0, 0.0331045, 
-0.956779, 9.00588e-05, 0, 0.0421067, 
-0.950259, 0.00010577, 0, 0.0522488, 
-0.944239, 0.000119458, 0, 0.0635342, 
-0.936341, 0.000122164, 0, 0.0759654, 
-0.928047, 0.000134929, 0, 0.0895434, 
-0.918065, 0.000145544, 0, 0.104269, 
-0.906267, 0.000150531, 0, 0.120142, 
-0.893419, 0.000161652, 0, 0.137162, 
-0.878758, 0.00016593, 0, 0.15533, 
-0.863699, 0.000174014, 0, 0.174645, 
-0.848876, 0.000177877, 0, 0.195106, 
-0.833032, 0.000184049, 0, 0.21671, 
-0.815557, 0.000186088, 0, 0.239454, 
-0.797323, 0.00019054, 0, 0.263332, 
-0.778124, 0.000191765, 0, 0.288336, 
-0.758929, 0.000192535, 0, 0.314452, 
-0.738979, 0.000192688, 0, 0.341658, 
-0.718213, 0.000191522, 0, 0.369924, 
-0.696947, 0.000190491, 0, 0.399202, 
-0.675807, 0.000187913, 0, 0.429416, 
-0.654147, 0.000184451, 0, 0.460447, 
-0.63229, 0.000181442, 0, 0.492064, 
-0.610499, 0.000177139, 0, 0.52381, 
-0.588747, 0.000172596, 0, 0.555556, 
-0.566783, 0.000167456, 0, 0.587302, 
-0.545359, 0.000162518, 0, 0.619048, 
-0.523984, 0.000156818, 0, 0.650794, 
-0.502917, 0.000151884, 0, 0.68254, 
-0.482294, 0.000145514, 0, 0.714286, 
-0.461945, 0.000140199, 0, 0.746032, 
-0.442133, 0.000134101, 0, 0.777778, 
-0.422705, 0.000128374, 0, 0.809524, 
-0.403916, 0.000122996, 0, 0.84127, 
-0.38554, 0.000116808, 0, 0.873016, 
-0.367909, 0.000111973, 0, 0.904762, 
-0.350651, 0.000105938, 0, 0.936508, 
-0.334208, 0.000101355, 0, 0.968254, 
-0.318123, 9.57628e-05, 0, 1, 
-1, 1.11633e-06, 0, 0, 
-1, 1.11639e-06, 0, 0, 
-1, 1.11725e-06, 0, 0, 
-1, 1.12096e-06, 0, 0, 
-0.999999, 1.1311e-06, 0, 0, 
-0.999997, 1.15315e-06, 0, 0, 
-0.999995, 1.1956e-06, 0, 0, 
-0.999989, 1.27239e-06, 0, 0, 
-0.999981, 1.40772e-06, 0, 0, 
-0.999969, 1.64541e-06, 0, 0, 
-0.999952, 2.06607e-06, 0, 0, 
-0.999928, 2.81783e-06, 0, 0, 
-0.999895, 4.16835e-06, 0, 0, 
-0.999848, 6.58728e-06, 0, 0, 
-0.999781, 1.08648e-05, 0, 0, 
-0.999682, 1.82579e-05, 0, 0, 
-0.999523, 3.06003e-05, 0, 1.58515e-05, 
-0.999205, 4.99862e-05, 0, 0.00039111, 
-0.998131, 7.3306e-05, 0, 0.00147526, 
-0.993334, 5.13229e-05, 0, 0.00342266, 
-0.99016, 4.67783e-05, 0, 0.00632238, 
-0.987321, 5.23413e-05, 0, 0.0102295, 
-0.984099, 6.4267e-05, 0, 0.0151793, 
-0.980432, 8.43042e-05, 0, 0.0211947, 
-0.974976, 0.000102819, 0, 0.0282898, 
-0.966429, 9.96234e-05, 0, 0.0364739, 
-0.957633, 0.000111074, 0, 0.0457522, 
-0.949422, 0.000128644, 0, 0.0561278, 
-0.943045, 0.000140076, 0, 0.0676023, 
-0.935448, 0.000146349, 0, 0.0801762, 
-0.927225, 0.000161854, 0, 0.0938499, 
-0.917033, 0.000169135, 0, 0.108623, 
-0.905762, 0.000179987, 0, 0.124496, 
-0.892879, 0.000189832, 0, 0.141469, 
-0.878435, 0.000195881, 0, 0.159541, 
-0.863114, 0.00020466, 0, 0.178713, 
-0.84776, 0.000209473, 0, 0.198985, 
-0.832084, 0.000214861, 0, 0.220355, 
-0.814915, 0.000217695, 0, 0.242823, 
-0.796711, 0.000220313, 0, 0.266385, 
-0.777603, 0.00022313, 0, 0.291036, 
-0.757991, 0.000222471, 0, 0.316767, 
-0.738371, 0.000222869, 0, 0.343563, 
-0.717872, 0.000221243, 0, 0.371402, 
-0.696619, 0.000218089, 0, 0.400248, 
-0.675379, 0.00021562, 0, 0.430047, 
-0.65411, 0.00021169, 0, 0.460708, 
-0.63241, 0.000206947, 0, 0.492079, 
-0.61046, 0.000201709, 0, 0.52381, 
-0.58903, 0.000196753, 0, 0.555556, 
-0.567267, 0.000189637, 0, 0.587302, 
-0.545886, 0.000184735, 0, 0.619048, 
-0.524714, 0.000177257, 0, 0.650794, 
-0.503789, 0.000171424, 0, 0.68254, 
-0.483204, 0.000164688, 0, 0.714286, 
-0.462976, 0.000157172, 0, 0.746032, 
-0.443294, 0.000151341, 0, 0.777778, 
-0.423988, 0.000143737, 0, 0.809524, 
-0.405325, 0.000138098, 0, 0.84127, 
-0.386981, 0.000130698, 0, 0.873016, 
-0.369436, 0.000125276, 0, 0.904762, 
-0.35219, 0.000118349, 0, 0.936508, 
-0.335804, 0.00011312, 0, 0.968254, 
-0.319749, 0.000106687, 0, 1, 
-1, 2.04685e-06, 0, 0, 
-1, 2.04694e-06, 0, 0, 
-1, 2.04831e-06, 0, 0, 
-0.999999, 2.05428e-06, 0, 0, 
-0.999999, 2.07056e-06, 0, 0, 
-0.999997, 2.10581e-06, 0, 0, 
-0.999993, 2.1732e-06, 0, 0, 
-0.999987, 2.29365e-06, 0, 0, 
-0.999979, 2.50243e-06, 0, 0, 
-0.999965, 2.86127e-06, 0, 0, 
-0.999947, 3.48028e-06, 0, 0, 
-0.999918, 4.55588e-06, 0, 0, 
-0.999881, 6.43303e-06, 0, 0, 
-0.999828, 9.70064e-06, 0, 0, 
-0.999753, 1.53233e-05, 0, 0, 
-0.999642, 2.4793e-05, 0, 0, 
-0.999464, 4.02032e-05, 0, 0.000122912, 
-0.999089, 6.35852e-05, 0, 0.000807431, 
-0.997567, 8.57026e-05, 0, 0.00227206, 
-0.992903, 5.94912e-05, 0, 0.00462807, 
-0.990011, 5.78515e-05, 0, 0.00794164, 
-0.987192, 6.5399e-05, 0, 0.0122534, 
-0.98418, 8.19675e-05, 0, 0.0175887, 
-0.980491, 0.000105514, 0, 0.0239635, 
-0.974779, 0.000121532, 0, 0.031387, 
-0.96675, 0.000119144, 0, 0.0398644, 
-0.958248, 0.000136125, 0, 0.0493983, 
-0.948884, 0.000155408, 0, 0.0599895, 
-0.941673, 0.000162281, 0, 0.0716382, 
-0.934521, 0.000176754, 0, 0.0843437, 
-0.926205, 0.000192873, 0, 0.0981056, 
-0.916089, 0.000200038, 0, 0.112923, 
-0.904963, 0.000213624, 0, 0.128796, 
-0.892089, 0.000221834, 0, 0.145725, 
-0.878028, 0.000232619, 0, 0.163709, 
-0.86249, 0.000238632, 0, 0.182749, 
-0.846587, 0.000247002, 0, 0.202847, 
-0.830988, 0.000250702, 0, 0.224001, 
-0.814165, 0.000255562, 0, 0.246214, 
-0.796135, 0.000257505, 0, 0.269482, 
-0.777052, 0.000258625, 0, 0.293805, 
-0.757201, 0.000258398, 0, 0.319176, 
-0.737655, 0.000256714, 0, 0.345587, 
-0.717477, 0.000255187, 0, 0.373021, 
-0.696433, 0.000251792, 0, 0.401454, 
-0.675084, 0.000247223, 0, 0.430844, 
-0.653906, 0.000242213, 0, 0.461125, 
-0.632561, 0.000237397, 0, 0.492186, 
-0.610657, 0.000229313, 0, 0.52381, 
-0.589322, 0.000224402, 0, 0.555556, 
-0.567857, 0.000216116, 0, 0.587302, 
-0.54652, 0.000209124, 0, 0.619048, 
-0.525433, 0.000201601, 0, 0.650794, 
-0.504679, 0.000192957, 0, 0.68254, 
-0.484203, 0.000186052, 0, 0.714286, 
-0.464203, 0.000177672, 0, 0.746032, 
-0.444549, 0.000170005, 0, 0.777778, 
-0.425346, 0.000162401, 0, 0.809524, 
-0.406706, 0.0001544, 0, 0.84127, 
-0.388576, 0.000147437, 0, 0.873016, 
-0.37094, 0.000139493, 0, 0.904762, 
-0.353996, 0.000133219, 0, 0.936508, 
-0.337391, 0.000125573, 0, 0.968254, 
-0.321648, 0.000119867, 0, 1, 
-1, 3.62511e-06, 0, 0, 
-1, 3.62525e-06, 0, 0, 
-1, 3.62739e-06, 0, 0, 
-0.999999, 3.63673e-06, 0, 0, 
-0.999998, 3.66214e-06, 0, 0, 
-0.999996, 3.71698e-06, 0, 0, 
-0.999992, 3.82116e-06, 0, 0, 
-0.999986, 4.00554e-06, 0, 0, 
-0.999976, 4.32058e-06, 0, 0, 
-0.999961, 4.85194e-06, 0, 0, 
-0.999938, 5.74808e-06, 0, 0, 
-0.999908, 7.26643e-06, 0, 0, 
-0.999865, 9.84707e-06, 0, 0, 
-0.999807, 1.42217e-05, 0, 0, 
-0.999723, 2.15581e-05, 0, 0, 
-0.999602, 3.36114e-05, 0, 1.19611e-05, 
-0.999398, 5.27353e-05, 0, 0.000355887, 
-0.998946, 8.05809e-05, 0, 0.00137763, 
-0.996647, 9.42908e-05, 0, 0.00322469, 
-0.992298, 6.68733e-05, 0, 0.00597892, 
-0.989802, 7.16564e-05, 0, 0.00968905, 
-0.987019, 8.21355e-05, 0, 0.0143845, 
-0.984219, 0.000104555, 0, 0.0200831, 
-0.980425, 0.000131245, 0, 0.0267948, 
-0.974241, 0.000139613, 0, 0.034525, 
-0.967006, 0.000145931, 0, 0.0432757, 
-0.95893, 0.000167153, 0, 0.0530472, 
-0.949157, 0.000188146, 0, 0.0638386, 
-0.94062, 0.000194625, 0, 0.0756487, 
-0.933509, 0.000213721, 0, 0.0884762, 
-0.925088, 0.000229616, 0, 0.10232, 
-0.915178, 0.000239638, 0, 0.117178, 
-0.904093, 0.000254814, 0, 0.133051, 
-0.891337, 0.000263685, 0, 0.149939, 
-0.877326, 0.000274789, 0, 0.167841, 
-0.861794, 0.000280534, 0, 0.18676, 
-0.845758, 0.000289534, 0, 0.206696, 
-0.829792, 0.000294446, 0, 0.22765, 
-0.813037, 0.000296877, 0, 0.249625, 
-0.795285, 0.000300217, 0, 0.27262, 
-0.776323, 0.000299826, 0, 0.296636, 
-0.756673, 0.000299787, 0, 0.321671, 
-0.736856, 0.000297867, 0, 0.347718, 
-0.716883, 0.000294052, 0, 0.374768, 
-0.696089, 0.000289462, 0, 0.402805, 
-0.67505, 0.000285212, 0, 0.431796, 
-0.653509, 0.00027653, 0, 0.461695, 
-0.632581, 0.000271759, 0, 0.492419, 
-0.61104, 0.000262811, 0, 0.523822, 
-0.589567, 0.000255151, 0, 0.555556, 
-0.568322, 0.000246434, 0, 0.587302, 
-0.547235, 0.000237061, 0, 0.619048, 
-0.52616, 0.000228343, 0, 0.650794, 
-0.505716, 0.000219236, 0, 0.68254, 
-0.485274, 0.000209595, 0, 0.714286, 
-0.465411, 0.000201011, 0, 0.746032, 
-0.445853, 0.00019109, 0, 0.777778, 
-0.426911, 0.000182897, 0, 0.809524, 
-0.408222, 0.000173569, 0, 0.84127, 
-0.390307, 0.000165496, 0, 0.873016, 
-0.372624, 0.000156799, 0, 0.904762, 
-0.355804, 0.00014917, 0, 0.936508, 
-0.33924, 0.000140907, 0, 0.968254, 
-0.323534, 0.000134062, 0, 1, 
-1, 6.22487e-06, 0, 0, 
-1, 6.2251e-06, 0, 0, 
-1, 6.22837e-06, 0, 0, 
-0.999999, 6.24259e-06, 0, 0, 
-0.999998, 6.28127e-06, 0, 0, 
-0.999996, 6.36451e-06, 0, 0, 
-0.999991, 6.5218e-06, 0, 0, 
-0.999984, 6.79782e-06, 0, 0, 
-0.999973, 7.26361e-06, 0, 0, 
-0.999955, 8.03644e-06, 0, 0, 
-0.999931, 9.31397e-06, 0, 0, 
-0.999896, 1.14299e-05, 0, 0, 
-0.999847, 1.49402e-05, 0, 0, 
-0.999784, 2.07461e-05, 0, 0, 
-0.999692, 3.02493e-05, 0, 0, 
-0.999554, 4.54957e-05, 0, 9.97275e-05, 
-0.999326, 6.90762e-05, 0, 0.000724813, 
-0.998757, 0.000101605, 0, 0.0020972, 
-0.995367, 9.58745e-05, 0, 0.00432324, 
-0.99209, 8.32808e-05, 0, 0.00746343, 
-0.989517, 8.87601e-05, 0, 0.0115534, 
-0.987008, 0.00010564, 0, 0.0166134, 
-0.98421, 0.000133179, 0, 0.0226551, 
-0.98021, 0.000161746, 0, 0.0296838, 
-0.973676, 0.000161821, 0, 0.0377016, 
-0.967052, 0.000178635, 0, 0.0467079, 
-0.959385, 0.000206765, 0, 0.0567014, 
-0.949461, 0.00022476, 0, 0.0676796, 
-0.939578, 0.00023574, 0, 0.0796403, 
-0.932416, 0.00025893, 0, 0.0925812, 
-0.923759, 0.000271228, 0, 0.106501, 
-0.914223, 0.000289165, 0, 0.121397, 
-0.902942, 0.000301156, 0, 0.13727, 
-0.890419, 0.000313852, 0, 0.15412, 
-0.876639, 0.000324408, 0, 0.171946, 
-0.861316, 0.00033249, 0, 0.190751, 
-0.84496, 0.000338497, 0, 0.210537, 
-0.828427, 0.000345861, 0, 0.231305, 
-0.811871, 0.000347863, 0, 0.253057, 
-0.794397, 0.000350225, 0, 0.275797, 
-0.775726, 0.000349915, 0, 0.299525, 
-0.75617, 0.000347296, 0, 0.324242, 
-0.736091, 0.000344232, 0, 0.349947, 
-0.716213, 0.000340835, 0, 0.376633, 
-0.695736, 0.000332369, 0, 0.404289, 
-0.674961, 0.000327943, 0, 0.432895, 
-0.653518, 0.000318533, 0, 0.462415, 
-0.632574, 0.000310391, 0, 0.492788, 
-0.61134, 0.000300755, 0, 0.523909, 
-0.590017, 0.000290506, 0, 0.555556, 
-0.568752, 0.000280446, 0, 0.587302, 
-0.548061, 0.000269902, 0, 0.619048, 
-0.52711, 0.000258815, 0, 0.650794, 
-0.506682, 0.000248481, 0, 0.68254, 
-0.486524, 0.000237141, 0, 0.714286, 
-0.466812, 0.000226872, 0, 0.746032, 
-0.44732, 0.000216037, 0, 0.777778, 
-0.428473, 0.000205629, 0, 0.809524, 
-0.409921, 0.000195691, 0, 0.84127, 
-0.392028, 0.000185457, 0, 0.873016, 
-0.374606, 0.000176436, 0, 0.904762, 
-0.357601, 0.000166508, 0, 0.936508, 
-0.341348, 0.000158385, 0, 0.968254, 
-0.32542, 0.000149203, 0, 1, 
-1, 1.03967e-05, 0, 0, 
-1, 1.0397e-05, 0, 0, 
-1, 1.04019e-05, 0, 0, 
-0.999999, 1.04231e-05, 0, 0, 
-0.999998, 1.04806e-05, 0, 0, 
-0.999995, 1.06042e-05, 0, 0, 
-0.999991, 1.08366e-05, 0, 0, 
-0.999982, 1.12415e-05, 0, 0, 
-0.999968, 1.19174e-05, 0, 0, 
-0.99995, 1.30227e-05, 0, 0, 
-0.999922, 1.48176e-05, 0, 0, 
-0.999884, 1.77303e-05, 0, 0, 
-0.99983, 2.24564e-05, 0, 0, 
-0.999758, 3.00966e-05, 0, 0, 
-0.999654, 4.23193e-05, 0, 5.5506e-06, 
-0.999503, 6.14848e-05, 0, 0.000296042, 
-0.999237, 9.03576e-05, 0, 0.00123138, 
-0.998491, 0.0001271, 0, 0.00295954, 
-0.994594, 0.000107754, 0, 0.00555828, 
-0.99178, 0.000103025, 0, 0.00907203, 
-0.989265, 0.00011154, 0, 0.0135258, 
-0.986998, 0.000136296, 0, 0.0189327, 
-0.984137, 0.000169154, 0, 0.0252992, 
-0.979798, 0.000196671, 0, 0.0326272, 
-0.97337, 0.000196678, 0, 0.0409156, 
-0.967239, 0.000223121, 0, 0.0501623, 
-0.959543, 0.000253809, 0, 0.0603639, 
-0.949466, 0.000265972, 0, 0.0715171, 
-0.939074, 0.000288372, 0, 0.0836186, 
-0.931118, 0.000310983, 0, 0.0966657, 
-0.922525, 0.000325561, 0, 0.110656, 
-0.912983, 0.000345725, 0, 0.125588, 
-0.901617, 0.0003556, 0, 0.141461, 
-0.889487, 0.000374012, 0, 0.158275, 
-0.875787, 0.000383445, 0, 0.176031, 
-0.860654, 0.000393972, 0, 0.19473, 
-0.844417, 0.000400311, 0, 0.214374, 
-0.82741, 0.000405004, 0, 0.234967, 
-0.810545, 0.000407378, 0, 0.256511, 
-0.793312, 0.000407351, 0, 0.279011, 
-0.774847, 0.000406563, 0, 0.302468, 
-0.755621, 0.000404903, 0, 0.326887, 
-0.735511, 0.000397486, 0, 0.352266, 
-0.715435, 0.000393569, 0, 0.378605, 
-0.695403, 0.000384739, 0, 0.405897, 
-0.674681, 0.000376108, 0, 0.43413, 
-0.65359, 0.000365997, 0, 0.463277, 
-0.632471, 0.000354957, 0, 0.493295, 
-0.61151, 0.000343593, 0, 0.524106, 
-0.59064, 0.000331841, 0, 0.555561, 
-0.569386, 0.000318891, 0, 0.587302, 
-0.548785, 0.0003072, 0, 0.619048, 
-0.528146, 0.00029361, 0, 0.650794, 
-0.507872, 0.000281709, 0, 0.68254, 
-0.487805, 0.000268627, 0, 0.714286, 
-0.468196, 0.000255887, 0, 0.746032, 
-0.448922, 0.000243997, 0, 0.777778, 
-0.430093, 0.000231662, 0, 0.809524, 
-0.411845, 0.000220339, 0, 0.84127, 
-0.393808, 0.000208694, 0, 0.873016, 
-0.376615, 0.000198045, 0, 0.904762, 
-0.359655, 0.000187375, 0, 0.936508, 
-0.343452, 0.000177371, 0, 0.968254, 
-0.32765, 0.000167525, 0, 1, 
-1, 1.69351e-05, 0, 0, 
-1, 1.69356e-05, 0, 0, 
-1, 1.69427e-05, 0, 0, 
-0.999999, 1.69736e-05, 0, 0, 
-0.999998, 1.70575e-05, 0, 0, 
-0.999995, 1.72372e-05, 0, 0, 
-0.99999, 1.75739e-05, 0, 0, 
-0.999979, 1.81568e-05, 0, 0, 
-0.999966, 1.91206e-05, 0, 0, 
-0.999944, 2.0677e-05, 0, 0, 
-0.999912, 2.31644e-05, 0, 0, 
-0.999869, 2.71268e-05, 0, 0, 
-0.999811, 3.34272e-05, 0, 0, 
-0.99973, 4.33979e-05, 0, 0, 
-0.999617, 5.90083e-05, 0, 6.81027e-05, 
-0.999445, 8.29497e-05, 0, 0.000612796, 
-0.999138, 0.000118019, 0, 0.00187402, 
-0.998095, 0.000156712, 0, 0.00395791, 
-0.993919, 0.000125054, 0, 0.00692144, 
-0.991333, 0.000126091, 0, 0.0107962, 
-0.989226, 0.000144912, 0, 0.0155986, 
-0.986954, 0.000175737, 0, 0.0213364, 
-0.983982, 0.000213883, 0, 0.0280113, 
-0.979128, 0.000234526, 0, 0.0356226, 
-0.973327, 0.000243725, 0, 0.0441668, 
-0.967416, 0.0002773, 0, 0.0536399, 
-0.959729, 0.000308799, 0, 0.0640376, 
-0.949758, 0.000322447, 0, 0.0753554, 
-0.939173, 0.000350021, 0, 0.0875893, 
-0.9296, 0.000370089, 0, 0.100736, 
-0.921181, 0.000391365, 0, 0.114793, 
-0.91164, 0.000413636, 0, 0.129759, 
-0.900435, 0.000427068, 0, 0.145632, 
-0.888183, 0.000441046, 0, 0.162412, 
-0.874772, 0.000454968, 0, 0.180101, 
-0.859566, 0.000461882, 0, 0.1987, 
-0.843579, 0.000471556, 0, 0.218213, 
-0.826453, 0.000474335, 0, 0.238641, 
-0.809164, 0.000477078, 0, 0.259989, 
-0.792179, 0.00047755, 0, 0.282262, 
-0.773866, 0.000472573, 0, 0.305464, 
-0.754944, 0.000469765, 0, 0.329599, 
-0.735133, 0.00046237, 0, 0.35467, 
-0.714858, 0.000453674, 0, 0.380678, 
-0.694829, 0.000443888, 0, 0.407622, 
-0.674453, 0.000432052, 0, 0.435493, 
-0.653685, 0.000420315, 0, 0.464275, 
-0.632666, 0.000406829, 0, 0.493938, 
-0.611676, 0.000392234, 0, 0.524422, 
-0.591193, 0.000379207, 0, 0.555624, 
-0.570145, 0.00036319, 0, 0.587302, 
-0.549566, 0.000349111, 0, 0.619048, 
-0.529278, 0.000334166, 0, 0.650794, 
-0.509026, 0.000318456, 0, 0.68254, 
-0.489186, 0.00030449, 0, 0.714286, 
-0.469662, 0.000289051, 0, 0.746032, 
-0.450691, 0.000275494, 0, 0.777778, 
-0.431841, 0.000261437, 0, 0.809524, 
-0.413752, 0.000247846, 0, 0.84127, 
-0.395951, 0.000235085, 0, 0.873016, 
-0.378633, 0.000222245, 0, 0.904762, 
-0.36194, 0.000210533, 0, 0.936508, 
-0.345599, 0.000198493, 0, 0.968254, 
-0.329999, 0.000188133, 0, 1, 
-1, 2.69663e-05, 0, 0, 
-1, 2.6967e-05, 0, 0, 
-1, 2.69772e-05, 0, 0, 
-0.999999, 2.70214e-05, 0, 0, 
-0.999998, 2.71415e-05, 0, 0, 
-0.999994, 2.7398e-05, 0, 0, 
-0.999988, 2.78771e-05, 0, 0, 
-0.999977, 2.87019e-05, 0, 0, 
-0.999961, 3.00544e-05, 0, 0, 
-0.999937, 3.22138e-05, 0, 0, 
-0.999904, 3.56163e-05, 0, 0, 
-0.999854, 4.09465e-05, 0, 0, 
-0.99979, 4.92651e-05, 0, 0, 
-0.999699, 6.21722e-05, 0, 8.28548e-07, 
-0.999572, 8.19715e-05, 0, 0.000223396, 
-0.999381, 0.000111689, 0, 0.00105421, 
-0.999016, 0.000153862, 0, 0.00264939, 
-0.997437, 0.000187667, 0, 0.00508609, 
-0.993545, 0.000155672, 0, 0.00840553, 
-0.991135, 0.000161455, 0, 0.012629, 
-0.989157, 0.000188241, 0, 0.0177662, 
-0.986874, 0.000226229, 0, 0.0238199, 
-0.983714, 0.000268668, 0, 0.0307887, 
-0.978301, 0.000277109, 0, 0.0386688, 
-0.973227, 0.000303446, 0, 0.0474555, 
-0.967317, 0.000341851, 0, 0.0571428, 
-0.959477, 0.000370885, 0, 0.0677258, 
-0.950012, 0.000392753, 0, 0.0791989, 
-0.939484, 0.00042781, 0, 0.0915577, 
-0.928135, 0.000443866, 0, 0.104799, 
-0.919819, 0.000472959, 0, 0.118918, 
-0.910049, 0.000491551, 0, 0.133915, 
-0.89918, 0.000512616, 0, 0.149788, 
-0.886881, 0.000523562, 0, 0.166537, 
-0.87359, 0.000540183, 0, 0.184164, 
-0.858613, 0.000547386, 0, 0.202669, 
-0.842809, 0.000554809, 0, 0.222056, 
-0.825727, 0.000558316, 0, 0.242329, 
-0.808086, 0.000557824, 0, 0.263492, 
-0.790728, 0.000556346, 0, 0.285551, 
-0.772987, 0.000552672, 0, 0.30851, 
-0.7541, 0.000543738, 0, 0.332376, 
-0.734669, 0.000536107, 0, 0.357153, 
-0.714411, 0.000523342, 0, 0.382846, 
-0.694196, 0.000512238, 0, 0.409454, 
-0.674252, 0.000497465, 0, 0.436977, 
-0.65357, 0.000481096, 0, 0.465404, 
-0.632999, 0.000467054, 0, 0.494713, 
-0.611994, 0.000448771, 0, 0.524864, 
-0.591604, 0.000431889, 0, 0.555779, 
-0.571134, 0.000415238, 0, 0.587302, 
-0.550528, 0.000396369, 0, 0.619048, 
-0.530292, 0.000379477, 0, 0.650794, 
-0.510364, 0.000361488, 0, 0.68254, 
-0.490749, 0.000343787, 0, 0.714286, 
-0.471266, 0.000327822, 0, 0.746032, 
-0.452462, 0.000310626, 0, 0.777778, 
-0.433907, 0.000295352, 0, 0.809524, 
-0.415659, 0.000279179, 0, 0.84127, 
-0.398138, 0.000264685, 0, 0.873016, 
-0.380833, 0.000249905, 0, 0.904762, 
-0.364247, 0.000236282, 0, 0.936508, 
-0.348041, 0.000222905, 0, 0.968254, 
-0.332389, 0.000210522, 0, 1, 
-1, 4.20604e-05, 0, 0, 
-1, 4.20614e-05, 0, 0, 
-1, 4.20757e-05, 0, 0, 
-0.999999, 4.2138e-05, 0, 0, 
-0.999997, 4.23067e-05, 0, 0, 
-0.999993, 4.26668e-05, 0, 0, 
-0.999986, 4.33372e-05, 0, 0, 
-0.999974, 4.44857e-05, 0, 0, 
-0.999956, 4.63554e-05, 0, 0, 
-0.99993, 4.93105e-05, 0, 0, 
-0.999892, 5.39077e-05, 0, 0, 
-0.999838, 6.10005e-05, 0, 0, 
-0.999767, 7.18822e-05, 0, 0, 
-0.999666, 8.84581e-05, 0, 3.65471e-05, 
-0.999525, 0.000113398, 0, 0.00048561, 
-0.999311, 0.000150043, 0, 0.00162095, 
-0.998865, 0.000200063, 0, 0.00355316, 
-0.996278, 0.000211014, 0, 0.00633818, 
-0.992956, 0.000189672, 0, 0.0100043, 
-0.991017, 0.000210262, 0, 0.0145648, 
-0.989055, 0.000244292, 0, 0.0200237, 
-0.986741, 0.000290481, 0, 0.0263798, 
-0.983288, 0.000334303, 0, 0.0336289, 
-0.977784, 0.000340307, 0, 0.0417652, 
-0.973037, 0.000377864, 0, 0.0507821, 
-0.967181, 0.000423899, 0, 0.060673, 
-0.958971, 0.000443854, 0, 0.0714315, 
-0.950093, 0.000483039, 0, 0.0830518, 
-0.939552, 0.000517934, 0, 0.0955288, 
-0.927678, 0.000539449, 0, 0.108859, 
-0.918278, 0.000568604, 0, 0.123038, 
-0.908449, 0.000588505, 0, 0.138065, 
-0.897713, 0.000612473, 0, 0.153938, 
-0.885533, 0.000625575, 0, 0.170657, 
-0.872131, 0.00063854, 0, 0.188224, 
-0.857517, 0.000647034, 0, 0.20664, 
-0.841796, 0.00065209, 0, 0.225909, 
-0.824726, 0.0006544, 0, 0.246035, 
-0.807297, 0.000655744, 0, 0.267022, 
-0.789058, 0.000646716, 0, 0.288877, 
-0.77189, 0.000643897, 0, 0.311607, 
-0.753082, 0.000629973, 0, 0.335216, 
-0.7341, 0.000621564, 0, 0.359713, 
-0.714094, 0.000605171, 0, 0.385103, 
-0.693839, 0.000588752, 0, 0.41139, 
-0.673891, 0.000573294, 0, 0.438576, 
-0.653565, 0.000552682, 0, 0.466656, 
-0.633326, 0.000533446, 0, 0.495617, 
-0.612582, 0.000514635, 0, 0.525431, 
-0.59205, 0.00049303, 0, 0.556041, 
-0.571918, 0.000471842, 0, 0.587338, 
-0.551572, 0.000451713, 0, 0.619048, 
-0.531553, 0.000430049, 0, 0.650794, 
-0.51175, 0.000410445, 0, 0.68254, 
-0.49238, 0.000390098, 0, 0.714286, 
-0.473143, 0.000370033, 0, 0.746032, 
-0.45423, 0.000351205, 0, 0.777778, 
-0.435963, 0.000332049, 0, 0.809524, 
-0.41787, 0.000315021, 0, 0.84127, 
-0.400387, 0.000297315, 0, 0.873016, 
-0.383332, 0.000281385, 0, 0.904762, 
-0.366665, 0.000265397, 0, 0.936508, 
-0.350633, 0.000250601, 0, 0.968254, 
-0.334964, 0.00023589, 0, 1, 
-1, 6.43736e-05, 0, 0, 
-1, 6.4375e-05, 0, 0, 
-1, 6.43947e-05, 0, 0, 
-0.999999, 6.4481e-05, 0, 0, 
-0.999997, 6.47143e-05, 0, 0, 
-0.999994, 6.52119e-05, 0, 0, 
-0.999985, 6.61359e-05, 0, 0, 
-0.999972, 6.77116e-05, 0, 0, 
-0.999952, 7.02599e-05, 0, 0, 
-0.999922, 7.42517e-05, 0, 0, 
-0.99988, 8.03906e-05, 0, 0, 
-0.99982, 8.97315e-05, 0, 0, 
-0.999741, 0.000103838, 0, 0, 
-0.999629, 0.00012496, 0, 0.000149024, 
-0.999474, 0.000156161, 0, 0.000861015, 
-0.999229, 0.000201034, 0, 0.00231204, 
-0.998662, 0.000259069, 0, 0.0045815, 
-0.995299, 0.000245439, 0, 0.00770895, 
-0.992732, 0.00024498, 0, 0.0117126, 
-0.990847, 0.000273211, 0, 0.0165989, 
-0.988911, 0.000316492, 0, 0.0223674, 
-0.98654, 0.00037161, 0, 0.0290135, 
-0.982636, 0.000410352, 0, 0.0365308, 
-0.977346, 0.000421756, 0, 0.0449116, 
-0.972909, 0.000475578, 0, 0.0541481, 
-0.966821, 0.000522482, 0, 0.0642326, 
-0.958686, 0.000545008, 0, 0.0751581, 
-0.949754, 0.000589286, 0, 0.0869181, 
-0.939184, 0.000619995, 0, 0.0995074, 
-0.927505, 0.000654266, 0, 0.112922, 
-0.916606, 0.000682362, 0, 0.127157, 
-0.906707, 0.000704287, 0, 0.142212, 
-0.895937, 0.000725909, 0, 0.158085, 
-0.883913, 0.000743939, 0, 0.174776, 
-0.870642, 0.000755157, 0, 0.192287, 
-0.856241, 0.000764387, 0, 0.210619, 
-0.84069, 0.000771032, 0, 0.229775, 
-0.823728, 0.000765906, 0, 0.249761, 
-0.806481, 0.000767604, 0, 0.270582, 
-0.787924, 0.000754385, 0, 0.292243, 
-0.770588, 0.000749668, 0, 0.314753, 
-0.751991, 0.000731613, 0, 0.338118, 
-0.733407, 0.000717655, 0, 0.362347, 
-0.713688, 0.000700604, 0, 0.387447, 
-0.693595, 0.000678765, 0, 0.413424, 
-0.673426, 0.000657042, 0, 0.440284, 
-0.65359, 0.000635892, 0, 0.468026, 
-0.633575, 0.000611569, 0, 0.496645, 
-0.613144, 0.000586011, 0, 0.526122, 
-0.592711, 0.000563111, 0, 0.556417, 
-0.572722, 0.000537699, 0, 0.587451, 
-0.552762, 0.000512556, 0, 0.619048, 
-0.532985, 0.000489757, 0, 0.650794, 
-0.513219, 0.000464139, 0, 0.68254, 
-0.493992, 0.000442193, 0, 0.714286, 
-0.47509, 0.000418629, 0, 0.746032, 
-0.456287, 0.000397045, 0, 0.777778, 
-0.438152, 0.000375504, 0, 0.809524, 
-0.420294, 0.00035492, 0, 0.84127, 
-0.402749, 0.000335327, 0, 0.873016, 
-0.385879, 0.000316421, 0, 0.904762, 
-0.369352, 0.000298333, 0, 0.936508, 
-0.353301, 0.000281417, 0, 0.968254, 
-0.337781, 0.000265203, 0, 1, 
-1, 9.68267e-05, 0, 0, 
-1, 9.68284e-05, 0, 0, 
-1, 9.68556e-05, 0, 0, 
-0.999999, 9.69733e-05, 0, 0, 
-0.999997, 9.72913e-05, 0, 0, 
-0.999993, 9.79688e-05, 0, 0, 
-0.999984, 9.92239e-05, 0, 0, 
-0.999969, 0.000101356, 0, 0, 
-0.999946, 0.000104784, 0, 0, 
-0.999913, 0.000110111, 0, 0, 
-0.999868, 0.000118217, 0, 0, 
-0.999801, 0.000130396, 0, 0, 
-0.999712, 0.000148523, 0, 1.24907e-05, 
-0.999589, 0.000175233, 0, 0.000355417, 
-0.999416, 0.000213999, 0, 0.00135281, 
-0.999136, 0.000268529, 0, 0.00312557, 
-0.998367, 0.000333088, 0, 0.00573045, 
-0.994701, 0.000304757, 0, 0.00919397, 
-0.992497, 0.000318031, 0, 0.0135261, 
-0.990608, 0.000353863, 0, 0.0187278, 
-0.988715, 0.000409043, 0, 0.0247947, 
-0.986241, 0.000472967, 0, 0.0317196, 
-0.981696, 0.000495104, 0, 0.0394939, 
-0.977097, 0.000532873, 0, 0.0481087, 
-0.972583, 0.000594447, 0, 0.0575549, 
-0.966142, 0.000636866, 0, 0.0678242, 
-0.95823, 0.000669899, 0, 0.0789089, 
-0.949677, 0.000719499, 0, 0.0908023, 
-0.939226, 0.000750584, 0, 0.103499, 
-0.927501, 0.000793183, 0, 0.116993, 
-0.915199, 0.00081995, 0, 0.131282, 
-0.90498, 0.000847654, 0, 0.146364, 
-0.894243, 0.000868929, 0, 0.162237, 
-0.882154, 0.000884278, 0, 0.178901, 
-0.869161, 0.000898108, 0, 0.196358, 
-0.854751, 0.000901254, 0, 0.21461, 
-0.839368, 0.00090679, 0, 0.233659, 
-0.822874, 0.000901541, 0, 0.253512, 
-0.805514, 0.000897297, 0, 0.274173, 
-0.787161, 0.000881856, 0, 0.29565, 
-0.76906, 0.000870032, 0, 0.31795, 
-0.750999, 0.000851719, 0, 0.341081, 
-0.732614, 0.000830671, 0, 0.365053, 
-0.713171, 0.000806569, 0, 0.389874, 
-0.693472, 0.00078338, 0, 0.415553, 
-0.673528, 0.000756404, 0, 0.442098, 
-0.653397, 0.000726871, 0, 0.469511, 
-0.633781, 0.000700494, 0, 0.497794, 
-0.613877, 0.00067105, 0, 0.526935, 
-0.593506, 0.000640361, 0, 0.556908, 
-0.573667, 0.000613502, 0, 0.587657, 
-0.553932, 0.000583177, 0, 0.61906, 
-0.534345, 0.000554375, 0, 0.650794, 
-0.515042, 0.000527811, 0, 0.68254, 
-0.495674, 0.000499367, 0, 0.714286, 
-0.477132, 0.00047429, 0, 0.746032, 
-0.458609, 0.000447726, 0, 0.777778, 
-0.440354, 0.000424205, 0, 0.809524, 
-0.422765, 0.000399549, 0, 0.84127, 
-0.405472, 0.000378315, 0, 0.873016, 
-0.388482, 0.000355327, 0, 0.904762, 
-0.372191, 0.000336122, 0, 0.936508, 
-0.356099, 0.000315247, 0, 0.968254, 
-0.340737, 0.00029794, 0, 1, 
-1, 0.000143327, 0, 0, 
-1, 0.00014333, 0, 0, 
-1, 0.000143366, 0, 0, 
-0.999999, 0.000143524, 0, 0, 
-0.999996, 0.000143952, 0, 0, 
-0.999991, 0.000144862, 0, 0, 
-0.999981, 0.000146544, 0, 0, 
-0.999966, 0.000149391, 0, 0, 
-0.999941, 0.000153946, 0, 0, 
-0.999905, 0.000160971, 0, 0, 
-0.999852, 0.000171562, 0, 0, 
-0.99978, 0.00018729, 0, 0, 
-0.999681, 0.000210386, 0, 8.26239e-05, 
-0.999546, 0.000243906, 0, 0.000664807, 
-0.999352, 0.000291739, 0, 0.00196183, 
-0.999027, 0.000357419, 0, 0.00405941, 
-0.997886, 0.000422349, 0, 0.00699666, 
-0.99419, 0.000385008, 0, 0.0107896, 
-0.99214, 0.000409775, 0, 0.0154415, 
-0.990274, 0.000456418, 0, 0.0209487, 
-0.988455, 0.000527008, 0, 0.0273037, 
-0.985804, 0.000597685, 0, 0.0344969, 
-0.98103, 0.000613124, 0, 0.0425183, 
-0.976674, 0.000668321, 0, 0.0513575, 
-0.972021, 0.000736985, 0, 0.0610047, 
-0.965274, 0.000773789, 0, 0.0714508, 
-0.958046, 0.000830852, 0, 0.0826878, 
-0.949333, 0.000875766, 0, 0.0947085, 
-0.939135, 0.000917087, 0, 0.107507, 
-0.927119, 0.000952243, 0, 0.121078, 
-0.91469, 0.000990626, 0, 0.135419, 
-0.903006, 0.00101304, 0, 0.150526, 
-0.892368, 0.00103834, 0, 0.166399, 
-0.880231, 0.00105002, 0, 0.183038, 
-0.867432, 0.00106331, 0, 0.200443, 
-0.853208, 0.00106783, 0, 0.218618, 
-0.837956, 0.00106458, 0, 0.237566, 
-0.821772, 0.00105945, 0, 0.257291, 
-0.804328, 0.00104685, 0, 0.2778, 
-0.786465, 0.00103178, 0, 0.2991, 
-0.768004, 0.00101077, 0, 0.321199, 
-0.74972, 0.000985504, 0, 0.344106, 
-0.731682, 0.000962893, 0, 0.36783, 
-0.712813, 0.000932146, 0, 0.392383, 
-0.693139, 0.00089871, 0, 0.417774, 
-0.673566, 0.000869677, 0, 0.444013, 
-0.653483, 0.000835525, 0, 0.471107, 
-0.633891, 0.000799853, 0, 0.49906, 
-0.614433, 0.000766838, 0, 0.527869, 
-0.594586, 0.000732227, 0, 0.557517, 
-0.574769, 0.000696442, 0, 0.587966, 
-0.555149, 0.000663935, 0, 0.61913, 
-0.535898, 0.000629826, 0, 0.650794, 
-0.516753, 0.000596486, 0, 0.68254, 
-0.497816, 0.000567078, 0, 0.714286, 
-0.479034, 0.000534399, 0, 0.746032, 
-0.460975, 0.000507013, 0, 0.777778, 
-0.442935, 0.000477421, 0, 0.809524, 
-0.425263, 0.000451101, 0, 0.84127, 
-0.408248, 0.000424964, 0, 0.873016, 
-0.391339, 0.00039993, 0, 0.904762, 
-0.37513, 0.000377619, 0, 0.936508, 
-0.359172, 0.000354418, 0, 0.968254, 
-0.343876, 0.000334823, 0, 1, 
-1, 0.000209042, 0, 0, 
-1, 0.000209045, 0, 0, 
-1, 0.000209093, 0, 0, 
-0.999999, 0.000209304, 0, 0, 
-0.999996, 0.000209871, 0, 0, 
-0.999991, 0.000211078, 0, 0, 
-0.999979, 0.000213304, 0, 0, 
-0.999963, 0.000217061, 0, 0, 
-0.999933, 0.000223042, 0, 0, 
-0.999894, 0.000232206, 0, 0, 
-0.999837, 0.000245901, 0, 0, 
-0.999756, 0.000266023, 0, 1.02927e-06, 
-0.999648, 0.000295204, 0, 0.000233468, 
-0.999499, 0.000336958, 0, 0.00108237, 
-0.999283, 0.000395563, 0, 0.00268824, 
-0.998896, 0.000473785, 0, 0.00511138, 
-0.997006, 0.000520008, 0, 0.00837705, 
-0.993819, 0.000497261, 0, 0.0124928, 
-0.991632, 0.000523722, 0, 0.0174561, 
-0.989875, 0.000587258, 0, 0.0232596, 
-0.988109, 0.000676329, 0, 0.0298931, 
-0.985155, 0.000747701, 0, 0.0373453, 
-0.980479, 0.000768803, 0, 0.0456044, 
-0.976271, 0.000841054, 0, 0.0546593, 
-0.971347, 0.000911469, 0, 0.0644994, 
-0.964528, 0.000953057, 0, 0.0751152, 
-0.957632, 0.00102221, 0, 0.0864982, 
-0.948681, 0.00106122, 0, 0.0986407, 
-0.938716, 0.00111857, 0, 0.111537, 
-0.926629, 0.00114762, 0, 0.125182, 
-0.914025, 0.00118995, 0, 0.139571, 
-0.901026, 0.00121228, 0, 0.154703, 
-0.890358, 0.00123946, 0, 0.170576, 
-0.878283, 0.0012527, 0, 0.18719, 
-0.865459, 0.00125536, 0, 0.204547, 
-0.851407, 0.00126134, 0, 0.222648, 
-0.836276, 0.00124759, 0, 0.241498, 
-0.820436, 0.00124443, 0, 0.261101, 
-0.803253, 0.00122071, 0, 0.281464, 
-0.785562, 0.00120107, 0, 0.302595, 
-0.76718, 0.00117762, 0, 0.324501, 
-0.748551, 0.00114289, 0, 0.347192, 
-0.730564, 0.00110872, 0, 0.370679, 
-0.712253, 0.00107636, 0, 0.394972, 
-0.692867, 0.00103646, 0, 0.420085, 
-0.673695, 0.000996793, 0, 0.446027, 
-0.653912, 0.00095675, 0, 0.47281, 
-0.634129, 0.000916739, 0, 0.50044, 
-0.615004, 0.000874401, 0, 0.528921, 
-0.595587, 0.000833411, 0, 0.558244, 
-0.575965, 0.000794556, 0, 0.588384, 
-0.5566, 0.00075196, 0, 0.619281, 
-0.537428, 0.000716381, 0, 0.650795, 
-0.518623, 0.000676558, 0, 0.68254, 
-0.499964, 0.00064074, 0, 0.714286, 
-0.481356, 0.000605984, 0, 0.746032, 
-0.463279, 0.000570256, 0, 0.777778, 
-0.445673, 0.000540138, 0, 0.809524, 
-0.428032, 0.000507299, 0, 0.84127, 
-0.411112, 0.000479553, 0, 0.873016, 
-0.394444, 0.000450737, 0, 0.904762, 
-0.378247, 0.000424268, 0, 0.936508, 
-0.362415, 0.000399111, 0, 0.968254, 
-0.347103, 0.000375274, 0, 1, 
-1, 0.000300729, 0, 0, 
-1, 0.000300733, 0, 0, 
-1, 0.000300797, 0, 0, 
-0.999998, 0.000301072, 0, 0, 
-0.999996, 0.000301817, 0, 0, 
-0.999989, 0.000303398, 0, 0, 
-0.999977, 0.000306309, 0, 0, 
-0.999958, 0.000311209, 0, 0, 
-0.999927, 0.000318975, 0, 0, 
-0.999884, 0.000330804, 0, 0, 
-0.99982, 0.00034834, 0, 0, 
-0.999733, 0.000373854, 0, 3.26995e-05, 
-0.999613, 0.000410424, 0, 0.000477174, 
-0.999447, 0.000462047, 0, 0.00161099, 
-0.999204, 0.000533322, 0, 0.00353153, 
-0.998725, 0.000624964, 0, 0.00627968, 
-0.995871, 0.000631786, 0, 0.00986937, 
-0.993194, 0.000632017, 0, 0.0143011, 
-0.991541, 0.00068923, 0, 0.019568, 
-0.989773, 0.000766892, 0, 0.0256592, 
-0.987647, 0.000863668, 0, 0.0325625, 
-0.984193, 0.000922089, 0, 0.0402647, 
-0.980016, 0.000970749, 0, 0.0487532, 
-0.975859, 0.00106027, 0, 0.058016, 
-0.970514, 0.00112239, 0, 0.0680419, 
-0.963625, 0.00117212, 0, 0.0788208, 
-0.956959, 0.00125211, 0, 0.0903439, 
-0.947956, 0.00129411, 0, 0.102604, 
-0.93809, 0.00135879, 0, 0.115594, 
-0.92659, 0.00139309, 0, 0.129309, 
-0.913829, 0.00143253, 0, 0.143745, 
-0.90005, 0.00145809, 0, 0.158901, 
-0.888129, 0.0014748, 0, 0.174774, 
-0.87607, 0.00148756, 0, 0.191364, 
-0.863461, 0.00148714, 0, 0.208674, 
-0.849594, 0.00148892, 0, 0.226705, 
-0.834531, 0.00146496, 0, 0.245461, 
-0.81903, 0.0014579, 0, 0.264947, 
-0.802122, 0.00143039, 0, 0.28517, 
-0.78445, 0.00139717, 0, 0.306137, 
-0.766434, 0.00136312, 0, 0.327857, 
-0.747816, 0.00132597, 0, 0.350341, 
-0.729519, 0.00128323, 0, 0.373598, 
-0.711454, 0.00123803, 0, 0.397642, 
-0.692699, 0.00119097, 0, 0.422485, 
-0.673723, 0.00114565, 0, 0.448139, 
-0.654386, 0.00109552, 0, 0.474619, 
-0.634673, 0.00104553, 0, 0.501933, 
-0.615554, 0.00099985, 0, 0.530089, 
-0.596462, 0.000948207, 0, 0.559087, 
-0.577385, 0.000902299, 0, 0.588913, 
-0.558257, 0.000856447, 0, 0.619525, 
-0.5392, 0.000810395, 0, 0.650826, 
-0.520543, 0.000768557, 0, 0.68254, 
-0.502206, 0.0007239, 0, 0.714286, 
-0.48402, 0.000685794, 0, 0.746032, 
-0.465779, 0.00064471, 0, 0.777778, 
-0.448455, 0.000609583, 0, 0.809524, 
-0.431091, 0.00057227, 0, 0.84127, 
-0.414147, 0.00054042, 0, 0.873016, 
-0.39765, 0.000506545, 0, 0.904762, 
-0.381576, 0.000477635, 0, 0.936508, 
-0.365881, 0.000448446, 0, 0.968254, 
-0.350582, 0.000421424, 0, 1, 
-1, 0.000427144, 0, 0, 
-1, 0.000427151, 0, 0, 
-1, 0.000427232, 0, 0, 
-0.999998, 0.00042759, 0, 0, 
-0.999995, 0.000428555, 0, 0, 
-0.999988, 0.000430603, 0, 0, 
-0.999976, 0.000434368, 0, 0, 
-0.999952, 0.000440688, 0, 0, 
-0.999919, 0.000450667, 0, 0, 
-0.999871, 0.00046578, 0, 0, 
-0.999801, 0.000488024, 0, 0, 
-0.999704, 0.000520092, 0, 0.000129802, 
-0.999572, 0.000565553, 0, 0.000821056, 
-0.999389, 0.000628906, 0, 0.00225241, 
-0.999114, 0.000714911, 0, 0.00449111, 
-0.998488, 0.000819218, 0, 0.00756249, 
-0.995234, 0.00080415, 0, 0.0114716, 
-0.993021, 0.000830181, 0, 0.0162131, 
-0.991407, 0.000902645, 0, 0.021776, 
-0.989625, 0.000996934, 0, 0.028147, 
-0.987064, 0.00109707, 0, 0.0353118, 
-0.983265, 0.00114353, 0, 0.0432562, 
-0.979535, 0.0012272, 0, 0.0519664, 
-0.975224, 0.00132642, 0, 0.0614298, 
-0.969574, 0.00138092, 0, 0.0716348, 
-0.963021, 0.00145896, 0, 0.0825709, 
-0.956046, 0.00152834, 0, 0.0942291, 
-0.947136, 0.00158217, 0, 0.106602, 
-0.937313, 0.0016347, 0, 0.119682, 
-0.926073, 0.00168383, 0, 0.133465, 
-0.913121, 0.00171627, 0, 0.147947, 
-0.899165, 0.00174229, 0, 0.163125, 
-0.885891, 0.00176137, 0, 0.178998, 
-0.873783, 0.00176406, 0, 0.195566, 
-0.861331, 0.00176156, 0, 0.21283, 
-0.847569, 0.00175346, 0, 0.230793, 
-0.832785, 0.00172753, 0, 0.249459, 
-0.817442, 0.00170204, 0, 0.268832, 
-0.800613, 0.00166576, 0, 0.28892, 
-0.783597, 0.00162909, 0, 0.30973, 
-0.76571, 0.0015826, 0, 0.331271, 
-0.747021, 0.00153106, 0, 0.353554, 
-0.728593, 0.00148036, 0, 0.37659, 
-0.710661, 0.00142808, 0, 0.400391, 
-0.692425, 0.00136906, 0, 0.424973, 
-0.673623, 0.00131066, 0, 0.450347, 
-0.65494, 0.00125569, 0, 0.47653, 
-0.635448, 0.00119517, 0, 0.503535, 
-0.616221, 0.00113828, 0, 0.531372, 
-0.597531, 0.0010816, 0, 0.560047, 
-0.578795, 0.00102673, 0, 0.589554, 
-0.559892, 0.000970985, 0, 0.619869, 
-0.541307, 0.000919773, 0, 0.650923, 
-0.522608, 0.000868479, 0, 0.68254, 
-0.504484, 0.00082137, 0, 0.714286, 
-0.486603, 0.000772916, 0, 0.746032, 
-0.468802, 0.000730353, 0, 0.777778, 
-0.451172, 0.000684955, 0, 0.809524, 
-0.434348, 0.000647565, 0, 0.84127, 
-0.417445, 0.000605863, 0, 0.873016, 
-0.401077, 0.000571885, 0, 0.904762, 
-0.385039, 0.000536034, 0, 0.936508, 
-0.369483, 0.000504227, 0, 0.968254, 
-0.354272, 0.000473165, 0, 1, 
-1, 0.000599525, 0, 0, 
-1, 0.000599533, 0, 0, 
-1, 0.000599639, 0, 0, 
-0.999998, 0.000600097, 0, 0, 
-0.999994, 0.000601336, 0, 0, 
-0.999987, 0.000603958, 0, 0, 
-0.999972, 0.000608775, 0, 0, 
-0.999949, 0.000616842, 0, 0, 
-0.999912, 0.000629534, 0, 0, 
-0.999857, 0.000648658, 0, 0, 
-0.999781, 0.000676615, 0, 5.38873e-06, 
-0.999674, 0.000716574, 0, 0.000308602, 
-0.999528, 0.000772641, 0, 0.00127003, 
-0.999326, 0.000849806, 0, 0.00300775, 
-0.999009, 0.000952682, 0, 0.00556637, 
-0.998112, 0.00106394, 0, 0.00895889, 
-0.994496, 0.00102228, 0, 0.0131827, 
-0.992806, 0.00108586, 0, 0.0182277, 
-0.991211, 0.0011759, 0, 0.0240795, 
-0.989415, 0.00128955, 0, 0.0307229, 
-0.986499, 0.00139038, 0, 0.0381418, 
-0.982679, 0.00144539, 0, 0.046321, 
-0.978839, 0.00153954, 0, 0.0552459, 
-0.974295, 0.00164417, 0, 0.0649034, 
-0.968784, 0.00171517, 0, 0.0752814, 
-0.962324, 0.00180282, 0, 0.0863693, 
-0.954956, 0.00186387, 0, 0.0981578, 
-0.94624, 0.00193817, 0, 0.110639, 
-0.936517, 0.00198156, 0, 0.123806, 
-0.925186, 0.00203042, 0, 0.137655, 
-0.91252, 0.0020664, 0, 0.15218, 
-0.898441, 0.00207822, 0, 0.16738, 
-0.884394, 0.0020992, 0, 0.183253, 
-0.871273, 0.00208748, 0, 0.199799, 
-0.859057, 0.00208686, 0, 0.21702, 
-0.845243, 0.00205519, 0, 0.234918, 
-0.830723, 0.00202868, 0, 0.253496, 
-0.815801, 0.00199501, 0, 0.272761, 
-0.79914, 0.00194193, 0, 0.292718, 
-0.782372, 0.00188824, 0, 0.313377, 
-0.76482, 0.00183695, 0, 0.334745, 
-0.746586, 0.00177418, 0, 0.356833, 
-0.7281, 0.00170628, 0, 0.379654, 
-0.709842, 0.00164063, 0, 0.403221, 
-0.692019, 0.00157355, 0, 0.427548, 
-0.67364, 0.00150262, 0, 0.452651, 
-0.655277, 0.00143473, 0, 0.478545, 
-0.636438, 0.00136371, 0, 0.505246, 
-0.617364, 0.00129911, 0, 0.532768, 
-0.598603, 0.00123014, 0, 0.561122, 
-0.580195, 0.00116587, 0, 0.590309, 
-0.561786, 0.00110398, 0, 0.620318, 
-0.543377, 0.00104148, 0, 0.651102, 
-0.525093, 0.000983984, 0, 0.682545, 
-0.506791, 0.00092667, 0, 0.714286, 
-0.489291, 0.000874326, 0, 0.746032, 
-0.471811, 0.000821734, 0, 0.777778, 
-0.454435, 0.000774698, 0, 0.809524, 
-0.437493, 0.000727302, 0, 0.84127, 
-0.420977, 0.000684039, 0, 0.873016, 
-0.404729, 0.000643729, 0, 0.904762, 
-0.388756, 0.00060285, 0, 0.936508, 
-0.373344, 0.00056765, 0, 0.968254, 
-0.358191, 0.000531928, 0, 1, 
-1, 0.000832169, 0, 0, 
-1, 0.000832178, 0, 0, 
-1, 0.00083231, 0, 0, 
-0.999998, 0.000832893, 0, 0, 
-0.999995, 0.000834465, 0, 0, 
-0.999985, 0.000837791, 0, 0, 
-0.999969, 0.000843893, 0, 0, 
-0.999944, 0.000854086, 0, 0, 
-0.999903, 0.000870071, 0, 0, 
-0.999843, 0.000894042, 0, 0, 
-0.999759, 0.000928865, 0, 5.31805e-05, 
-0.999643, 0.000978242, 0, 0.000579385, 
-0.99948, 0.00104684, 0, 0.00182772, 
-0.999255, 0.00114012, 0, 0.00387804, 
-0.998885, 0.00126188, 0, 0.00675711, 
-0.997405, 0.00135888, 0, 0.010468, 
-0.99424, 0.00133626, 0, 0.0150019, 
-0.992458, 0.00140905, 0, 0.0203443, 
-0.990929, 0.00152305, 0, 0.0264786, 
-0.989116, 0.00165882, 0, 0.0333875, 
-0.985624, 0.00174128, 0, 0.0410537, 
-0.982003, 0.00182108, 0, 0.0494609, 
-0.978336, 0.00194498, 0, 0.058594, 
-0.973184, 0.00202708, 0, 0.0684396, 
-0.9678, 0.00212166, 0, 0.0789851, 
-0.961348, 0.00221366, 0, 0.0902199, 
-0.953841, 0.00228219, 0, 0.102135, 
-0.94534, 0.00235662, 0, 0.114721, 
-0.935552, 0.00240572, 0, 0.127972, 
-0.924064, 0.00244405, 0, 0.141884, 
-0.911827, 0.00247557, 0, 0.156451, 
-0.897731, 0.00248374, 0, 0.171672, 
-0.883409, 0.00249863, 0, 0.187545, 
-0.868625, 0.00246688, 0, 0.20407, 
-0.856529, 0.00246523, 0, 0.221249, 
-0.842999, 0.00242368, 0, 0.239083, 
-0.828505, 0.00237354, 0, 0.257578, 
-0.813825, 0.00232588, 0, 0.276738, 
-0.797813, 0.00226731, 0, 0.296569, 
-0.781097, 0.00219704, 0, 0.31708, 
-0.764038, 0.00212394, 0, 0.338281, 
-0.746067, 0.00204786, 0, 0.360181, 
-0.727687, 0.00196728, 0, 0.382794, 
-0.709571, 0.00188779, 0, 0.406133, 
-0.691503, 0.00180532, 0, 0.430213, 
-0.673673, 0.00171849, 0, 0.45505, 
-0.655732, 0.00164147, 0, 0.480662, 
-0.637399, 0.00155858, 0, 0.507065, 
-0.618616, 0.00147641, 0, 0.534278, 
-0.60005, 0.00140125, 0, 0.562313, 
-0.581713, 0.00132441, 0, 0.59118, 
-0.563546, 0.00125014, 0, 0.620875, 
-0.545605, 0.00118249, 0, 0.651373, 
-0.527559, 0.0011116, 0, 0.682593, 
-0.509764, 0.00104979, 0, 0.714286, 
-0.49193, 0.000985977, 0, 0.746032, 
-0.475011, 0.000928592, 0, 0.777778, 
-0.457878, 0.000873466, 0, 0.809524, 
-0.440979, 0.000819585, 0, 0.84127, 
-0.424613, 0.000772365, 0, 0.873016, 
-0.408549, 0.000722194, 0, 0.904762, 
-0.392771, 0.000680014, 0, 0.936508, 
-0.377317, 0.000636797, 0, 0.968254, 
-0.362352, 0.000598318, 0, 1, 
-1, 0.00114313, 0, 0, 
-1, 0.00114314, 0, 0, 
-0.999999, 0.00114331, 0, 0, 
-0.999998, 0.00114404, 0, 0, 
-0.999994, 0.00114601, 0, 0, 
-0.999984, 0.00115019, 0, 0, 
-0.999967, 0.00115784, 0, 0, 
-0.999937, 0.0011706, 0, 0, 
-0.999894, 0.00119054, 0, 0, 
-0.999828, 0.00122031, 0, 0, 
-0.999735, 0.00126331, 0, 0.000169263, 
-0.999606, 0.00132382, 0, 0.000949167, 
-0.999426, 0.0014071, 0, 0.00249668, 
-0.999173, 0.00151895, 0, 0.00486385, 
-0.99873, 0.00166102, 0, 0.00806321, 
-0.996243, 0.0017023, 0, 0.0120895, 
-0.993779, 0.00172782, 0, 0.0169288, 
-0.9919, 0.0018108, 0, 0.0225633, 
-0.990524, 0.00196028, 0, 0.028974, 
-0.98868, 0.00212014, 0, 0.036142, 
-0.984663, 0.00217598, 0, 0.044049, 
-0.981457, 0.00230563, 0, 0.0526781, 
-0.977608, 0.00243966, 0, 0.0620136, 
-0.972215, 0.00251336, 0, 0.0720418, 
-0.966798, 0.0026285, 0, 0.08275, 
-0.960241, 0.00271409, 0, 0.0941271, 
-0.952489, 0.00278381, 0, 0.106164, 
-0.944127, 0.00285399, 0, 0.118852, 
-0.934282, 0.00290994, 0, 0.132185, 
-0.923271, 0.00294558, 0, 0.146157, 
-0.910803, 0.00296269, 0, 0.160766, 
-0.896705, 0.00296803, 0, 0.176007, 
-0.88238, 0.00296637, 0, 0.19188, 
-0.867116, 0.00293163, 0, 0.208385, 
-0.853636, 0.00289418, 0, 0.225523, 
-0.840469, 0.00284663, 0, 0.243296, 
-0.82639, 0.00278594, 0, 0.261709, 
-0.811759, 0.00271618, 0, 0.280767, 
-0.796113, 0.00263187, 0, 0.300476, 
-0.779518, 0.00254589, 0, 0.320845, 
-0.763142, 0.00246003, 0, 0.341883, 
-0.745464, 0.00236529, 0, 0.363601, 
-0.727491, 0.00226536, 0, 0.386011, 
-0.709414, 0.00216375, 0, 0.409128, 
-0.691396, 0.00207127, 0, 0.432967, 
-0.67368, 0.00197106, 0, 0.457545, 
-0.656049, 0.00187022, 0, 0.482881, 
-0.638188, 0.00177605, 0, 0.508992, 
-0.620177, 0.00168482, 0, 0.535899, 
-0.601506, 0.00158909, 0, 0.563619, 
-0.58362, 0.00150583, 0, 0.592165, 
-0.565496, 0.00141791, 0, 0.621544, 
-0.54789, 0.00133693, 0, 0.651743, 
-0.530323, 0.00126038, 0, 0.682709, 
-0.512795, 0.00118556, 0, 0.714286, 
-0.495199, 0.00111527, 0, 0.746032, 
-0.478101, 0.0010489, 0, 0.777778, 
-0.461511, 0.000984264, 0, 0.809524, 
-0.444879, 0.000925909, 0, 0.84127, 
-0.428424, 0.000866582, 0, 0.873016, 
-0.412495, 0.000814463, 0, 0.904762, 
-0.396975, 0.000764498, 0, 0.936508, 
-0.381614, 0.000715967, 0, 0.968254, 
-0.366732, 0.000672483, 0, 1, 
-1, 0.00155501, 0, 0, 
-1, 0.00155503, 0, 0, 
-1, 0.00155524, 0, 0, 
-0.999998, 0.00155615, 0, 0, 
-0.999994, 0.0015586, 0, 0, 
-0.999983, 0.00156379, 0, 0, 
-0.999963, 0.0015733, 0, 0, 
-0.999932, 0.00158911, 0, 0, 
-0.999882, 0.00161376, 0, 0, 
-0.99981, 0.00165041, 0, 1.00875e-05, 
-0.999708, 0.00170304, 0, 0.000367658, 
-0.999565, 0.00177658, 0, 0.0014234, 
-0.999368, 0.00187688, 0, 0.00327939, 
-0.999081, 0.00200989, 0, 0.00596629, 
-0.99852, 0.00217177, 0, 0.0094852, 
-0.99549, 0.0021745, 0, 0.013824, 
-0.993252, 0.00222357, 0, 0.0189643, 
-0.991727, 0.00235022, 0, 0.0248856, 
-0.989951, 0.00250561, 0, 0.0315669, 
-0.988029, 0.00268829, 0, 0.0389881, 
-0.984029, 0.0027496, 0, 0.0471301, 
-0.980683, 0.00289793, 0, 0.0559754, 
-0.976554, 0.00303315, 0, 0.0655081, 
-0.97139, 0.00313257, 0, 0.0757138, 
-0.965544, 0.00323656, 0, 0.08658, 
-0.95912, 0.00333432, 0, 0.0980954, 
-0.951183, 0.0034039, 0, 0.110251, 
-0.942974, 0.00347515, 0, 0.123038, 
-0.932642, 0.00350381, 0, 0.13645, 
-0.922158, 0.00354519, 0, 0.150482, 
-0.909404, 0.00353851, 0, 0.165129, 
-0.896071, 0.0035435, 0, 0.18039, 
-0.881206, 0.00349936, 0, 0.196263, 
-0.866077, 0.00347256, 0, 0.212748, 
-0.85093, 0.003415, 0, 0.229847, 
-0.837703, 0.00333367, 0, 0.247561, 
-0.823878, 0.003249, 0, 0.265895, 
-0.809449, 0.00316347, 0, 0.284854, 
-0.794379, 0.00306351, 0, 0.304445, 
-0.778138, 0.0029499, 0, 0.324675, 
-0.761997, 0.00284099, 0, 0.345555, 
-0.744938, 0.00272104, 0, 0.367095, 
-0.727212, 0.00260715, 0, 0.389309, 
-0.709549, 0.00248855, 0, 0.41221, 
-0.691704, 0.00236783, 0, 0.435814, 
-0.673689, 0.00225178, 0, 0.460138, 
-0.656453, 0.00213765, 0, 0.485203, 
-0.639128, 0.00202178, 0, 0.511028, 
-0.621512, 0.00191443, 0, 0.537634, 
-0.603598, 0.00180977, 0, 0.565041, 
-0.58559, 0.00170456, 0, 0.593268, 
-0.567852, 0.00160927, 0, 0.622327, 
-0.5503, 0.00151395, 0, 0.652217, 
-0.533033, 0.00142499, 0, 0.682907, 
-0.515942, 0.00133955, 0, 0.714296, 
-0.498814, 0.0012602, 0, 0.746032, 
-0.481595, 0.00118188, 0, 0.777778, 
-0.465117, 0.00111171, 0, 0.809524, 
-0.448865, 0.00104091, 0, 0.84127, 
-0.432711, 0.000976618, 0, 0.873016, 
-0.416822, 0.00091859, 0, 0.904762, 
-0.401272, 0.000857704, 0, 0.936508, 
-0.386226, 0.000807172, 0, 0.968254, 
-0.371321, 0.00075464, 0, 1, 
-1, 0.00209596, 0, 0, 
-1, 0.00209598, 0, 0, 
-1, 0.00209624, 0, 0, 
-0.999997, 0.00209736, 0, 0, 
-0.999991, 0.00210039, 0, 0, 
-0.999979, 0.00210678, 0, 0, 
-0.999959, 0.00211847, 0, 0, 
-0.999925, 0.0021379, 0, 0, 
-0.99987, 0.00216809, 0, 0, 
-0.999791, 0.00221281, 0, 6.81487e-05, 
-0.999677, 0.00227669, 0, 0.000658161, 
-0.999521, 0.00236533, 0, 0.00200632, 
-0.999301, 0.00248514, 0, 0.0041779, 
-0.998977, 0.00264185, 0, 0.00718648, 
-0.998191, 0.00281695, 0, 0.0110238, 
-0.994801, 0.00278518, 0, 0.015672, 
-0.993091, 0.00288774, 0, 0.0211091, 
-0.991571, 0.00303931, 0, 0.0273123, 
-0.9897, 0.00321643, 0, 0.034259, 
-0.987023, 0.00337332, 0, 0.0419281, 
-0.983289, 0.00346146, 0, 0.0502998, 
-0.979892, 0.00363704, 0, 0.0593562, 
-0.975111, 0.00373601, 0, 0.069081, 
-0.970351, 0.0038842, 0, 0.0794598, 
-0.964131, 0.00397053, 0, 0.0904798, 
-0.957747, 0.00408078, 0, 0.10213, 
-0.949536, 0.00413533, 0, 0.114401, 
-0.941372, 0.00420305, 0, 0.127284, 
-0.931049, 0.00422815, 0, 0.140772, 
-0.920647, 0.00425048, 0, 0.154862, 
-0.908033, 0.0042281, 0, 0.169548, 
-0.895028, 0.00422026, 0, 0.184828, 
-0.879968, 0.00415042, 0, 0.200701, 
-0.864875, 0.00408821, 0, 0.217167, 
-0.84918, 0.00400909, 0, 0.234227, 
-0.834934, 0.00391178, 0, 0.251884, 
-0.821397, 0.00380066, 0, 0.270141, 
-0.807135, 0.00367974, 0, 0.289004, 
-0.792363, 0.00355172, 0, 0.308479, 
-0.776661, 0.003411, 0, 0.328575, 
-0.760705, 0.00328123, 0, 0.349301, 
-0.744408, 0.00314003, 0, 0.370668, 
-0.726994, 0.0029906, 0, 0.392689, 
-0.709598, 0.00285034, 0, 0.415379, 
-0.692112, 0.00271179, 0, 0.438754, 
-0.674435, 0.00257185, 0, 0.46283, 
-0.65676, 0.00243425, 0, 0.48763, 
-0.639982, 0.00230351, 0, 0.513173, 
-0.622983, 0.0021777, 0, 0.539482, 
-0.605471, 0.00204991, 0, 0.566579, 
-0.58796, 0.00193759, 0, 0.594488, 
-0.570463, 0.00181976, 0, 0.623226, 
-0.553058, 0.00171497, 0, 0.6528, 
-0.535894, 0.00161109, 0, 0.683198, 
-0.519089, 0.00151394, 0, 0.714354, 
-0.502454, 0.00142122, 0, 0.746032, 
-0.485681, 0.00133488, 0, 0.777778, 
-0.468935, 0.00124975, 0, 0.809524, 
-0.452951, 0.00117309, 0, 0.84127, 
-0.437139, 0.00110155, 0, 0.873016, 
-0.421446, 0.00103124, 0, 0.904762, 
-0.405951, 0.000966387, 0, 0.936508, 
-0.391003, 0.000908119, 0, 0.968254, 
-0.376198, 0.000848057, 0, 1, 
-1, 0.00280076, 0, 0, 
-1, 0.00280078, 0, 0, 
-0.999999, 0.00280109, 0, 0, 
-0.999997, 0.00280246, 0, 0, 
-0.999992, 0.00280616, 0, 0, 
-0.999979, 0.00281396, 0, 0, 
-0.999956, 0.00282822, 0, 0, 
-0.999916, 0.00285186, 0, 0, 
-0.999857, 0.0028885, 0, 0, 
-0.999768, 0.00294259, 0, 0.000196026, 
-0.999645, 0.00301946, 0, 0.00104842, 
-0.99947, 0.00312541, 0, 0.00270197, 
-0.999229, 0.00326733, 0, 0.00519449, 
-0.998852, 0.00344992, 0, 0.00852602, 
-0.997558, 0.00361052, 0, 0.0126804, 
-0.994417, 0.0035898, 0, 0.017635, 
-0.992824, 0.00372393, 0, 0.0233651, 
-0.991344, 0.00390695, 0, 0.0298456, 
-0.989337, 0.00410392, 0, 0.0370529, 
-0.985811, 0.00420987, 0, 0.044965, 
-0.982772, 0.00437488, 0, 0.0535616, 
-0.979001, 0.00455069, 0, 0.0628243, 
-0.974102, 0.00464462, 0, 0.0727367, 
-0.969197, 0.00480577, 0, 0.0832844, 
-0.962759, 0.00487818, 0, 0.0944545, 
-0.956207, 0.00498176, 0, 0.106236, 
-0.947909, 0.00503392, 0, 0.118619, 
-0.939596, 0.00507474, 0, 0.131595, 
-0.929642, 0.00509798, 0, 0.145159, 
-0.918807, 0.00508476, 0, 0.159305, 
-0.906921, 0.00505634, 0, 0.174028, 
-0.893312, 0.00498845, 0, 0.189327, 
-0.878933, 0.0049133, 0, 0.2052, 
-0.863986, 0.0048259, 0, 0.221647, 
-0.847936, 0.00470848, 0, 0.23867, 
-0.832253, 0.00456889, 0, 0.25627, 
-0.818619, 0.00442726, 0, 0.274453, 
-0.804788, 0.00427677, 0, 0.293222, 
-0.790241, 0.00411906, 0, 0.312585, 
-0.775162, 0.00394833, 0, 0.33255, 
-0.759463, 0.00377366, 0, 0.353126, 
-0.743598, 0.00361026, 0, 0.374324, 
-0.72697, 0.00343627, 0, 0.396158, 
-0.709646, 0.00326422, 0, 0.418641, 
-0.69277, 0.00309717, 0, 0.44179, 
-0.675371, 0.0029356, 0, 0.465624, 
-0.657863, 0.00277712, 0, 0.490163, 
-0.640772, 0.00261738, 0, 0.515429, 
-0.624441, 0.0024737, 0, 0.541445, 
-0.607497, 0.00233125, 0, 0.568236, 
-0.590438, 0.00218994, 0, 0.595828, 
-0.573224, 0.0020664, 0, 0.624242, 
-0.556168, 0.00193526, 0, 0.653496, 
-0.539232, 0.00182463, 0, 0.683588, 
-0.522352, 0.00170735, 0, 0.714482, 
-0.506172, 0.00160555, 0, 0.746032, 
-0.489842, 0.00150451, 0, 0.777778, 
-0.473463, 0.00140938, 0, 0.809524, 
-0.457266, 0.00132568, 0, 0.84127, 
-0.441609, 0.0012376, 0, 0.873016, 
-0.426348, 0.00116265, 0, 0.904762, 
-0.411002, 0.00108935, 0, 0.936508, 
-0.396045, 0.00101946, 0, 0.968254, 
-0.381448, 0.000955665, 0, 1, 
-1, 0.0037121, 0, 0, 
-1, 0.00371213, 0, 0, 
-1, 0.00371251, 0, 0, 
-0.999997, 0.00371417, 0, 0, 
-0.99999, 0.00371863, 0, 0, 
-0.999977, 0.00372807, 0, 0, 
-0.99995, 0.00374529, 0, 0, 
-0.999908, 0.0037738, 0, 0, 
-0.999843, 0.00381789, 0, 1.23679e-05, 
-0.999745, 0.00388273, 0, 0.000407442, 
-0.999608, 0.00397443, 0, 0.0015447, 
-0.999415, 0.00409998, 0, 0.00351387, 
-0.999143, 0.00426662, 0, 0.0063316, 
-0.9987, 0.00447625, 0, 0.00998679, 
-0.996363, 0.00455323, 0, 0.0144568, 
-0.994021, 0.00461052, 0, 0.0197151, 
-0.992372, 0.00476359, 0, 0.0257344, 
-0.991007, 0.00499101, 0, 0.0324882, 
-0.988767, 0.0051972, 0, 0.0399517, 
-0.984872, 0.00528407, 0, 0.0481022, 
-0.982004, 0.00548926, 0, 0.0569192, 
-0.977714, 0.00564385, 0, 0.0663839, 
-0.973076, 0.0057693, 0, 0.07648, 
-0.967565, 0.0058924, 0, 0.0871928, 
-0.961384, 0.00599629, 0, 0.0985096, 
-0.954435, 0.00605998, 0, 0.110419, 
-0.946303, 0.0061133, 0, 0.122912, 
-0.937662, 0.00612028, 0, 0.13598, 
-0.927867, 0.00612209, 0, 0.149617, 
-0.916475, 0.00604813, 0, 0.163817, 
-0.90541, 0.00603088, 0, 0.178577, 
-0.891591, 0.00592218, 0, 0.193894, 
-0.877573, 0.00578854, 0, 0.209767, 
-0.862511, 0.00566648, 0, 0.226196, 
-0.846861, 0.00551481, 0, 0.243182, 
-0.83068, 0.00533754, 0, 0.260728, 
-0.815725, 0.00515487, 0, 0.278837, 
-0.802321, 0.0049655, 0, 0.297515, 
-0.787826, 0.00475421, 0, 0.316768, 
-0.773454, 0.00456002, 0, 0.336605, 
-0.758224, 0.00434727, 0, 0.357034, 
-0.74265, 0.00414444, 0, 0.378067, 
-0.726729, 0.00393738, 0, 0.399717, 
-0.710155, 0.00373575, 0, 0.421999, 
-0.693312, 0.00353736, 0, 0.444928, 
-0.67653, 0.00334368, 0, 0.468523, 
-0.659444, 0.00315981, 0, 0.492806, 
-0.642051, 0.00297809, 0, 0.517798, 
-0.625758, 0.00280592, 0, 0.543525, 
-0.609615, 0.00264254, 0, 0.570012, 
-0.592919, 0.00248459, 0, 0.597288, 
-0.576298, 0.00233327, 0, 0.625379, 
-0.559489, 0.00219519, 0, 0.654307, 
-0.542891, 0.00205441, 0, 0.684084, 
-0.526255, 0.00193385, 0, 0.714693, 
-0.509853, 0.00180745, 0, 0.746044, 
-0.494131, 0.00169817, 0, 0.777778, 
-0.478114, 0.0015913, 0, 0.809524, 
-0.462274, 0.00148981, 0, 0.84127, 
-0.446412, 0.00139537, 0, 0.873016, 
-0.431274, 0.00130984, 0, 0.904762, 
-0.41635, 0.00122403, 0, 0.936508, 
-0.401476, 0.00114809, 0, 0.968254, 
-0.386993, 0.00107563, 0, 1, 
-1, 0.00488216, 0, 0, 
-1, 0.0048822, 0, 0, 
-1, 0.00488265, 0, 0, 
-0.999997, 0.00488463, 0, 0, 
-0.999988, 0.00488999, 0, 0, 
-0.999974, 0.00490129, 0, 0, 
-0.999946, 0.00492191, 0, 0, 
-0.999897, 0.00495598, 0, 0, 
-0.999825, 0.00500855, 0, 7.44791e-05, 
-0.999718, 0.00508559, 0, 0.000712744, 
-0.999565, 0.005194, 0, 0.00215249, 
-0.999352, 0.00534147, 0, 0.00444576, 
-0.999046, 0.00553523, 0, 0.00759216, 
-0.998492, 0.00577016, 0, 0.0115714, 
-0.995564, 0.00578487, 0, 0.0163556, 
-0.993339, 0.00586414, 0, 0.021915, 
-0.991834, 0.00606002, 0, 0.0282201, 
-0.990496, 0.00633312, 0, 0.0352433, 
-0.987826, 0.00651941, 0, 0.042959, 
-0.98383, 0.00660842, 0, 0.0513439, 
-0.98109, 0.00685523, 0, 0.0603772, 
-0.976131, 0.00695778, 0, 0.0700402, 
-0.971922, 0.00714236, 0, 0.0803163, 
-0.965901, 0.00721437, 0, 0.0911908, 
-0.959606, 0.00732017, 0, 0.102651, 
-0.952504, 0.00735788, 0, 0.114686, 
-0.944365, 0.00738493, 0, 0.127286, 
-0.935652, 0.00737969, 0, 0.140443, 
-0.925813, 0.00733612, 0, 0.154151, 
-0.914397, 0.00723094, 0, 0.168405, 
-0.903257, 0.00714002, 0, 0.183201, 
-0.890015, 0.00700149, 0, 0.198536, 
-0.876014, 0.00682813, 0, 0.214409, 
-0.861436, 0.00665567, 0, 0.23082, 
-0.845752, 0.00644526, 0, 0.24777, 
-0.829169, 0.00621635, 0, 0.265263, 
-0.813435, 0.00597789, 0, 0.283301, 
-0.799701, 0.00575694, 0, 0.301889, 
-0.785726, 0.00549866, 0, 0.321035, 
-0.77152, 0.0052503, 0, 0.340746, 
-0.75683, 0.00499619, 0, 0.361032, 
-0.741951, 0.0047543, 0, 0.381904, 
-0.726367, 0.0045084, 0, 0.403374, 
-0.710537, 0.00426784, 0, 0.425457, 
-0.693965, 0.00403487, 0, 0.448169, 
-0.677724, 0.0038075, 0, 0.47153, 
-0.66117, 0.00359431, 0, 0.495561, 
-0.644274, 0.00338354, 0, 0.520284, 
-0.627449, 0.00318163, 0, 0.545725, 
-0.611645, 0.00299672, 0, 0.571911, 
-0.595614, 0.00281016, 0, 0.598873, 
-0.579426, 0.00264252, 0, 0.62664, 
-0.563016, 0.00247509, 0, 0.655239, 
-0.546728, 0.00232647, 0, 0.684692, 
-0.530539, 0.00217803, 0, 0.714998, 
-0.514164, 0.00204216, 0, 0.746106, 
-0.498344, 0.00191403, 0, 0.777778, 
-0.482957, 0.00179203, 0, 0.809524, 
-0.467336, 0.00167695, 0, 0.84127, 
-0.451994, 0.00157567, 0, 0.873016, 
-0.436514, 0.00147113, 0, 0.904762, 
-0.42178, 0.00138034, 0, 0.936508, 
-0.407271, 0.00129219, 0, 0.968254, 
-0.392822, 0.0012098, 0, 1, 
-1, 0.00637427, 0, 0, 
-1, 0.00637431, 0, 0, 
-0.999999, 0.00637485, 0, 0, 
-0.999996, 0.00637721, 0, 0, 
-0.999987, 0.00638357, 0, 0, 
-0.999971, 0.006397, 0, 0, 
-0.999939, 0.00642142, 0, 0, 
-0.999888, 0.00646177, 0, 0, 
-0.999807, 0.00652387, 0, 0.000207916, 
-0.999689, 0.00661454, 0, 0.00112053, 
-0.99952, 0.00674155, 0, 0.00287719, 
-0.999283, 0.00691313, 0, 0.00550138, 
-0.998936, 0.00713598, 0, 0.00897928, 
-0.998165, 0.00738501, 0, 0.0132829, 
-0.994847, 0.00734388, 0, 0.01838, 
-0.993182, 0.00749991, 0, 0.0242381, 
-0.991665, 0.0077246, 0, 0.0308261, 
-0.989708, 0.00797579, 0, 0.0381152, 
-0.986663, 0.00813011, 0, 0.0460794, 
-0.983288, 0.00830365, 0, 0.0546951, 
-0.980104, 0.00853496, 0, 0.0639412, 
-0.974855, 0.00861045, 0, 0.0737988, 
-0.97045, 0.00879133, 0, 0.0842515, 
-0.964509, 0.00886377, 0, 0.0952848, 
-0.957594, 0.00890346, 0, 0.106886, 
-0.950546, 0.00893289, 0, 0.119044, 
-0.942225, 0.00890074, 0, 0.131749, 
-0.933365, 0.00886826, 0, 0.144994, 
-0.923202, 0.0087316, 0, 0.158772, 
-0.912605, 0.00863082, 0, 0.173078, 
-0.901099, 0.00847403, 0, 0.187908, 
-0.888177, 0.00825838, 0, 0.203261, 
-0.873955, 0.00801834, 0, 0.219134, 
-0.860091, 0.00779026, 0, 0.235527, 
-0.84434, 0.00752478, 0, 0.252443, 
-0.828517, 0.00724074, 0, 0.269883, 
-0.81239, 0.00693769, 0, 0.287851, 
-0.79721, 0.00664817, 0, 0.306352, 
-0.783489, 0.00634763, 0, 0.325393, 
-0.769514, 0.00604221, 0, 0.344981, 
-0.755419, 0.00573568, 0, 0.365126, 
-0.741083, 0.00544359, 0, 0.385839, 
-0.726059, 0.00515515, 0, 0.407132, 
-0.710809, 0.00487139, 0, 0.429021, 
-0.695052, 0.00459846, 0, 0.451521, 
-0.678886, 0.00433412, 0, 0.474651, 
-0.663042, 0.00407981, 0, 0.498433, 
-0.646634, 0.00384264, 0, 0.522889, 
-0.630117, 0.00360897, 0, 0.548048, 
-0.613804, 0.00338863, 0, 0.573936, 
-0.598338, 0.00318486, 0, 0.600584, 
-0.582687, 0.00298377, 0, 0.628027, 
-0.566809, 0.00280082, 0, 0.656295, 
-0.550817, 0.00262255, 0, 0.685417, 
-0.534937, 0.00245835, 0, 0.715406, 
-0.519151, 0.00230574, 0, 0.74624, 
-0.503118, 0.0021549, 0, 0.777778, 
-0.487723, 0.00202008, 0, 0.809524, 
-0.472725, 0.00189355, 0, 0.84127, 
-0.457599, 0.00177108, 0, 0.873016, 
-0.442558, 0.00165843, 0, 0.904762, 
-0.427624, 0.00155494, 0, 0.936508, 
-0.413171, 0.00145273, 0, 0.968254, 
-0.399122, 0.00136454, 0, 1, 
-1, 0.00826496, 0, 0, 
-1, 0.00826499, 0, 0, 
-1, 0.00826564, 0, 0, 
-0.999996, 0.00826842, 0, 0, 
-0.999987, 0.00827589, 0, 0, 
-0.999967, 0.00829167, 0, 0, 
-0.999933, 0.00832037, 0, 0, 
-0.999876, 0.00836768, 0, 1.09568e-05, 
-0.999786, 0.00844031, 0, 0.000427176, 
-0.999655, 0.00854603, 0, 0.00163837, 
-0.999468, 0.00869337, 0, 0.00372401, 
-0.999203, 0.008891, 0, 0.00668519, 
-0.998803, 0.00914387, 0, 0.0104969, 
-0.99748, 0.00935838, 0, 0.0151251, 
-0.994446, 0.00933309, 0, 0.0205338, 
-0.99292, 0.00953084, 0, 0.0266884, 
-0.991414, 0.0097893, 0, 0.0335565, 
-0.989049, 0.0100228, 0, 0.0411087, 
-0.98582, 0.0101664, 0, 0.0493182, 
-0.982441, 0.0103582, 0, 0.0581613, 
-0.978595, 0.0105292, 0, 0.0676169, 
-0.973495, 0.0106274, 0, 0.0776661, 
-0.968405, 0.0107261, 0, 0.0882926, 
-0.962717, 0.0108234, 0, 0.0994818, 
-0.955478, 0.0108102, 0, 0.111221, 
-0.948275, 0.0107914, 0, 0.123499, 
-0.940006, 0.0107161, 0, 0.136308, 
-0.930831, 0.0106309, 0, 0.149639, 
-0.920648, 0.0104083, 0, 0.163485, 
-0.910205, 0.0102312, 0, 0.177843, 
-0.898445, 0.0100051, 0, 0.192707, 
-0.885986, 0.00971928, 0, 0.208077, 
-0.872204, 0.00940747, 0, 0.22395, 
-0.858436, 0.0091085, 0, 0.240326, 
-0.843454, 0.00876595, 0, 0.257208, 
-0.827437, 0.00839794, 0, 0.274596, 
-0.811488, 0.00803692, 0, 0.292496, 
-0.796038, 0.00767352, 0, 0.310911, 
-0.781083, 0.0073097, 0, 0.329849, 
-0.767642, 0.00694032, 0, 0.349316, 
-0.753901, 0.00657476, 0, 0.369323, 
-0.740131, 0.00622699, 0, 0.38988, 
-0.725845, 0.0058838, 0, 0.410999, 
-0.710991, 0.00555586, 0, 0.432696, 
-0.696002, 0.00523089, 0, 0.454987, 
-0.680461, 0.00492494, 0, 0.47789, 
-0.664875, 0.00463464, 0, 0.501426, 
-0.649273, 0.00435422, 0, 0.52562, 
-0.63302, 0.0040875, 0, 0.550498, 
-0.61705, 0.00384075, 0, 0.576089, 
-0.601154, 0.00359557, 0, 0.602427, 
-0.586008, 0.00337636, 0, 0.629544, 
-0.570699, 0.00316019, 0, 0.657479, 
-0.555166, 0.00296033, 0, 0.686264, 
-0.539645, 0.00277551, 0, 0.715924, 
-0.524159, 0.00259499, 0, 0.746459, 
-0.508682, 0.00243257, 0, 0.777789, 
-0.493163, 0.00227851, 0, 0.809524, 
-0.478004, 0.00213083, 0, 0.84127, 
-0.46347, 0.00199502, 0, 0.873016, 
-0.448778, 0.00186967, 0, 0.904762, 
-0.434105, 0.00174732, 0, 0.936508, 
-0.419576, 0.00163861, 0, 0.968254, 
-0.405541, 0.00153341, 0, 1, 
-1, 0.0106462, 0, 0, 
-1, 0.0106462, 0, 0, 
-0.999999, 0.010647, 0, 0, 
-0.999995, 0.0106502, 0, 0, 
-0.999985, 0.0106589, 0, 0, 
-0.999964, 0.0106773, 0, 0, 
-0.999925, 0.0107106, 0, 0, 
-0.999861, 0.0107655, 0, 7.12986e-05, 
-0.999763, 0.0108497, 0, 0.000743959, 
-0.999616, 0.0109716, 0, 0.00227361, 
-0.999408, 0.0111408, 0, 0.0046983, 
-0.999112, 0.0113659, 0, 0.00800158, 
-0.998637, 0.0116475, 0, 0.0121493, 
-0.996223, 0.0117231, 0, 0.0171023, 
-0.994006, 0.0118064, 0, 0.0228217, 
-0.992444, 0.0120254, 0, 0.0292711, 
-0.991028, 0.0123314, 0, 0.036417, 
-0.98803, 0.0124954, 0, 0.0442295, 
-0.984816, 0.0126538, 0, 0.0526815, 
-0.981399, 0.0128537, 0, 0.0617491, 
-0.977085, 0.0129694, 0, 0.0714115, 
-0.972154, 0.013091, 0, 0.0816495, 
-0.966617, 0.0131166, 0, 0.0924471, 
-0.960628, 0.0131583, 0, 0.10379, 
-0.953295, 0.0131094, 0, 0.115665, 
-0.94575, 0.0129966, 0, 0.128062, 
-0.937654, 0.0128796, 0, 0.140972, 
-0.927716, 0.0126477, 0, 0.154387, 
-0.917932, 0.0123889, 0, 0.168301, 
-0.907719, 0.012131, 0, 0.182709, 
-0.89584, 0.0118013, 0, 0.197608, 
-0.883526, 0.0114145, 0, 0.212994, 
-0.870301, 0.0110075, 0, 0.228867, 
-0.856272, 0.0106019, 0, 0.245227, 
-0.842251, 0.0101938, 0, 0.262074, 
-0.826466, 0.00973254, 0, 0.279412, 
-0.810859, 0.0092846, 0, 0.297244, 
-0.795051, 0.00883304, 0, 0.315575, 
-0.780053, 0.00840272, 0, 0.334412, 
-0.76575, 0.00796438, 0, 0.35376, 
-0.752298, 0.00752526, 0, 0.373631, 
-0.739153, 0.00711486, 0, 0.394034, 
-0.725514, 0.00670361, 0, 0.414983, 
-0.711473, 0.00632656, 0, 0.436491, 
-0.696936, 0.00595206, 0, 0.458575, 
-0.682126, 0.00559191, 0, 0.481253, 
-0.667027, 0.00525362, 0, 0.504547, 
-0.651875, 0.00493805, 0, 0.528481, 
-0.636463, 0.00462848, 0, 0.553081, 
-0.620641, 0.00433936, 0, 0.578377, 
-0.604931, 0.00407, 0, 0.604404, 
-0.589549, 0.00380864, 0, 0.631197, 
-0.574712, 0.00357049, 0, 0.658795, 
-0.559775, 0.00334466, 0, 0.687238, 
-0.544514, 0.00312505, 0, 0.716559, 
-0.529555, 0.00293199, 0, 0.746776, 
-0.514402, 0.00274204, 0, 0.777849, 
-0.499302, 0.00256647, 0, 0.809524, 
-0.484114, 0.00239901, 0, 0.84127, 
-0.469308, 0.00225148, 0, 0.873016, 
-0.455133, 0.00210178, 0, 0.904762, 
-0.440939, 0.0019727, 0, 0.936508, 
-0.426627, 0.00184382, 0, 0.968254, 
-0.412509, 0.00172548, 0, 1, 
-1, 0.013628, 0, 0, 
-1, 0.0136281, 0, 0, 
-0.999999, 0.0136289, 0, 0, 
-0.999995, 0.0136327, 0, 0, 
-0.999983, 0.0136427, 0, 0, 
-0.99996, 0.0136638, 0, 0, 
-0.999917, 0.0137022, 0, 0, 
-0.999846, 0.0137652, 0, 0.000204627, 
-0.999736, 0.0138615, 0, 0.00116837, 
-0.999573, 0.0140007, 0, 0.00303325, 
-0.99934, 0.0141927, 0, 0.00580613, 
-0.999004, 0.0144457, 0, 0.00945626, 
-0.998407, 0.0147489, 0, 0.0139421, 
-0.995464, 0.014731, 0, 0.0192202, 
-0.993328, 0.0148283, 0, 0.0252495, 
-0.991799, 0.0150797, 0, 0.0319921, 
-0.990397, 0.0154316, 0, 0.0394138, 
-0.986835, 0.0155005, 0, 0.0474843, 
-0.983938, 0.0157308, 0, 0.0561763, 
-0.980154, 0.0158753, 0, 0.065466, 
-0.975659, 0.0159581, 0, 0.0753325, 
-0.970171, 0.0159832, 0, 0.0857571, 
-0.964803, 0.0160084, 0, 0.0967235, 
-0.958366, 0.0159484, 0, 0.108218, 
-0.950613, 0.0158001, 0, 0.120227, 
-0.942874, 0.0155845, 0, 0.132741, 
-0.935005, 0.0154292, 0, 0.145751, 
-0.924991, 0.0150742, 0, 0.159249, 
-0.914814, 0.0146757, 0, 0.17323, 
-0.904743, 0.0143097, 0, 0.187687, 
-0.893216, 0.0138695, 0, 0.202619, 
-0.880769, 0.0133706, 0, 0.218021, 
-0.868136, 0.0128606, 0, 0.233894, 
-0.85469, 0.0123403, 0, 0.250238, 
-0.840593, 0.0118091, 0, 0.267052, 
-0.825808, 0.011253, 0, 0.284341, 
-0.81009, 0.0107099, 0, 0.302106, 
-0.795041, 0.0101636, 0, 0.320354, 
-0.779757, 0.00964041, 0, 0.33909, 
-0.764697, 0.00911896, 0, 0.358322, 
-0.750913, 0.00859533, 0, 0.378059, 
-0.738175, 0.00811592, 0, 0.398311, 
-0.725242, 0.00764504, 0, 0.41909, 
-0.711864, 0.00718885, 0, 0.440412, 
-0.698009, 0.00675843, 0, 0.462292, 
-0.683841, 0.00634984, 0, 0.484748, 
-0.669391, 0.00595502, 0, 0.507802, 
-0.654731, 0.00558671, 0, 0.531477, 
-0.639805, 0.00523578, 0, 0.555802, 
-0.624789, 0.00490834, 0, 0.580805, 
-0.609325, 0.00459448, 0, 0.606522, 
-0.593975, 0.00430342, 0, 0.63299, 
-0.578983, 0.00403019, 0, 0.66025, 
-0.564442, 0.0037707, 0, 0.688346, 
-0.549835, 0.0035316, 0, 0.717319, 
-0.535039, 0.00330255, 0, 0.7472, 
-0.520403, 0.00308932, 0, 0.777982, 
-0.505687, 0.00289335, 0, 0.809524, 
-0.490939, 0.00270818, 0, 0.84127, 
-0.476233, 0.0025343, 0, 0.873016, 
-0.461624, 0.00237097, 0, 0.904762, 
-0.447833, 0.00222065, 0, 0.936508, 
-0.433992, 0.00207561, 0, 0.968254, 
-0.420147, 0.00194955, 0, 1, 
-1, 0.0173415, 0, 0, 
-1, 0.0173416, 0, 0, 
-0.999999, 0.0173426, 0, 0, 
-0.999994, 0.0173468, 0, 0, 
-0.999983, 0.0173582, 0, 0, 
-0.999954, 0.0173822, 0, 0, 
-0.999908, 0.0174258, 0, 6.69501e-06, 
-0.999828, 0.0174973, 0, 0.000427399, 
-0.999705, 0.0176063, 0, 0.00171019, 
-0.999524, 0.0177631, 0, 0.0039248, 
-0.999263, 0.0179781, 0, 0.00705382, 
-0.998878, 0.0182579, 0, 0.0110552, 
-0.998012, 0.0185551, 0, 0.0158812, 
-0.994614, 0.0184264, 0, 0.0214852, 
-0.993132, 0.0186384, 0, 0.0278239, 
-0.991563, 0.0189067, 0, 0.0348585, 
-0.989298, 0.0191577, 0, 0.0425544, 
-0.986036, 0.0192522, 0, 0.050881, 
-0.982558, 0.0194063, 0, 0.059811, 
-0.978531, 0.019486, 0, 0.0693209, 
-0.974198, 0.0195847, 0, 0.0793894, 
-0.968148, 0.0194749, 0, 0.0899984, 
-0.962565, 0.0194277, 0, 0.101132, 
-0.956041, 0.0192991, 0, 0.112775, 
-0.947749, 0.0189893, 0, 0.124917, 
-0.94018, 0.018704, 0, 0.137547, 
-0.931649, 0.0183458, 0, 0.150655, 
-0.921798, 0.0178775, 0, 0.164236, 
-0.911573, 0.0173618, 0, 0.178281, 
-0.901569, 0.0168481, 0, 0.192788, 
-0.890341, 0.016265, 0, 0.207752, 
-0.877835, 0.0156199, 0, 0.223171, 
-0.865472, 0.0149516, 0, 0.239044, 
-0.852905, 0.0143274, 0, 0.255371, 
-0.838906, 0.0136643, 0, 0.272153, 
-0.824888, 0.0129903, 0, 0.289393, 
-0.809977, 0.0123218, 0, 0.307093, 
-0.794697, 0.0116572, 0, 0.325259, 
-0.780028, 0.0110307, 0, 0.343896, 
-0.765124, 0.0104236, 0, 0.363012, 
-0.750411, 0.00982189, 0, 0.382617, 
-0.737264, 0.00924397, 0, 0.402719, 
-0.724799, 0.00868719, 0, 0.423332, 
-0.712253, 0.00816476, 0, 0.444469, 
-0.699267, 0.00767261, 0, 0.466146, 
-0.685618, 0.00719746, 0, 0.488383, 
-0.671736, 0.00673916, 0, 0.511198, 
-0.657777, 0.00631937, 0, 0.534618, 
-0.643497, 0.0059241, 0, 0.558668, 
-0.62889, 0.00553927, 0, 0.58338, 
-0.614299, 0.0051934, 0, 0.608787, 
-0.599197, 0.00485985, 0, 0.634929, 
-0.584175, 0.00454357, 0, 0.661849, 
-0.569541, 0.00425787, 0, 0.689594, 
-0.555193, 0.00397905, 0, 0.718211, 
-0.540947, 0.00372364, 0, 0.747742, 
-0.526593, 0.00348599, 0, 0.778205, 
-0.512335, 0.00326103, 0, 0.80953, 
-0.498017, 0.00305137, 0, 0.84127, 
-0.483609, 0.00285485, 0, 0.873016, 
-0.469368, 0.00267472, 0, 0.904762, 
-0.455037, 0.00249945, 0, 0.936508, 
-0.441493, 0.00234792, 0, 0.968254, 
-0.428147, 0.00219936, 0, 1, 
-1, 0.0219422, 0, 0, 
-1, 0.0219423, 0, 0, 
-0.999998, 0.0219434, 0, 0, 
-0.999993, 0.0219481, 0, 0, 
-0.999981, 0.021961, 0, 0, 
-0.999949, 0.0219879, 0, 0, 
-0.999896, 0.0220367, 0, 5.93055e-05, 
-0.999808, 0.0221167, 0, 0.000753668, 
-0.99967, 0.0222383, 0, 0.00237884, 
-0.999466, 0.0224125, 0, 0.00495612, 
-0.999174, 0.0226495, 0, 0.00844887, 
-0.998725, 0.0229525, 0, 0.0128058, 
-0.996979, 0.0231123, 0, 0.0179742, 
-0.994317, 0.0230742, 0, 0.0239047, 
-0.992781, 0.0232895, 0, 0.0305526, 
-0.991191, 0.0235734, 0, 0.0378786, 
-0.987787, 0.0236152, 0, 0.0458476, 
-0.985092, 0.0237994, 0, 0.0544287, 
-0.981121, 0.0238553, 0, 0.0635952, 
-0.976924, 0.0238706, 0, 0.0733232, 
-0.97218, 0.0238704, 0, 0.0835922, 
-0.965956, 0.0236598, 0, 0.0943839, 
-0.959998, 0.0234735, 0, 0.105682, 
-0.953245, 0.0232277, 0, 0.117474, 
-0.944445, 0.0226973, 0, 0.129747, 
-0.937087, 0.0223527, 0, 0.142491, 
-0.928341, 0.0218144, 0, 0.155697, 
-0.9184, 0.0211516, 0, 0.169358, 
-0.907959, 0.0204553, 0, 0.183469, 
-0.89808, 0.0197673, 0, 0.198024, 
-0.887047, 0.0189915, 0, 0.21302, 
-0.875221, 0.0182082, 0, 0.228455, 
-0.86269, 0.0173584, 0, 0.244329, 
-0.850735, 0.0165718, 0, 0.260639, 
-0.837545, 0.0157524, 0, 0.277389, 
-0.823639, 0.0149482, 0, 0.29458, 
-0.809699, 0.0141431, 0, 0.312215, 
-0.794797, 0.0133527, 0, 0.3303, 
-0.780578, 0.0126193, 0, 0.34884, 
-0.766019, 0.0118914, 0, 0.367842, 
-0.751447, 0.0111839, 0, 0.387315, 
-0.737275, 0.010514, 0, 0.40727, 
-0.724545, 0.00987277, 0, 0.427717, 
-0.712644, 0.00926569, 0, 0.448672, 
-0.700432, 0.00869029, 0, 0.470149, 
-0.687664, 0.00814691, 0, 0.492167, 
-0.674288, 0.00763012, 0, 0.514746, 
-0.660966, 0.00714437, 0, 0.537911, 
-0.647264, 0.00668457, 0, 0.561688, 
-0.633431, 0.00626581, 0, 0.586108, 
-0.619133, 0.00585593, 0, 0.611206, 
-0.604935, 0.00548188, 0, 0.637022, 
-0.590236, 0.00513288, 0, 0.663599, 
-0.575473, 0.0047906, 0, 0.690989, 
-0.561228, 0.00448895, 0, 0.719242, 
-0.547054, 0.00420233, 0, 0.748411, 
-0.533175, 0.00392869, 0, 0.778531, 
-0.519163, 0.00367445, 0, 0.809583, 
-0.505328, 0.00344096, 0, 0.84127, 
-0.491446, 0.00322003, 0, 0.873016, 
-0.477356, 0.00301283, 0, 0.904762, 
-0.46356, 0.00282592, 0, 0.936508, 
-0.449623, 0.00264956, 0, 0.968254, 
-0.436068, 0.00246956, 0, 1, 
-1, 0.0276135, 0, 0, 
-1, 0.0276136, 0, 0, 
-0.999998, 0.0276148, 0, 0, 
-0.999993, 0.0276201, 0, 0, 
-0.999976, 0.0276342, 0, 0, 
-0.999945, 0.027664, 0, 0, 
-0.999884, 0.0277179, 0, 0.000186777, 
-0.999784, 0.027806, 0, 0.00119615, 
-0.99963, 0.0279394, 0, 0.00318407, 
-0.999401, 0.0281295, 0, 0.00613601, 
-0.999066, 0.0283858, 0, 0.00999966, 
-0.998524, 0.0287027, 0, 0.0147164, 
-0.995702, 0.0286256, 0, 0.0202295, 
-0.993593, 0.0286733, 0, 0.0264876, 
-0.992067, 0.0288989, 0, 0.0334451, 
-0.990548, 0.0292135, 0, 0.0410621, 
-0.986775, 0.0291296, 0, 0.0493033, 
-0.984054, 0.0293099, 0, 0.0581381, 
-0.979481, 0.0291881, 0, 0.0675397, 
-0.975297, 0.0291598, 0, 0.0774848, 
-0.96981, 0.028954, 0, 0.0879528, 
-0.963524, 0.028628, 0, 0.0989258, 
-0.957398, 0.0283135, 0, 0.110388, 
-0.950088, 0.0278469, 0, 0.122327, 
-0.941538, 0.0271798, 0, 0.134729, 
-0.933332, 0.0265388, 0, 0.147587, 
-0.924392, 0.0257776, 0, 0.16089, 
-0.914581, 0.024916, 0, 0.174631, 
-0.904347, 0.0240242, 0, 0.188806, 
-0.894324, 0.0231229, 0, 0.203409, 
-0.883724, 0.022153, 0, 0.218437, 
-0.872207, 0.0211355, 0, 0.233888, 
-0.859927, 0.0201048, 0, 0.249761, 
-0.848373, 0.0191263, 0, 0.266056, 
-0.836023, 0.0181306, 0, 0.282774, 
-0.82289, 0.0171718, 0, 0.299917, 
-0.809324, 0.0162196, 0, 0.317488, 
-0.795361, 0.0152622, 0, 0.335493, 
-0.781253, 0.01439, 0, 0.353936, 
-0.767338, 0.013533, 0, 0.372825, 
-0.753156, 0.0127244, 0, 0.392168, 
-0.739122, 0.0119454, 0, 0.411976, 
-0.725358, 0.0112054, 0, 0.432259, 
-0.712949, 0.010487, 0, 0.453032, 
-0.701621, 0.00984032, 0, 0.47431, 
-0.689703, 0.00921495, 0, 0.496111, 
-0.677216, 0.00862492, 0, 0.518455, 
-0.664217, 0.00806882, 0, 0.541367, 
-0.65137, 0.00755922, 0, 0.564872, 
-0.638, 0.00705705, 0, 0.589001, 
-0.62453, 0.00661266, 0, 0.613789, 
-0.610601, 0.00618432, 0, 0.639277, 
-0.59676, 0.00578033, 0, 0.66551, 
-0.582433, 0.00540927, 0, 0.692539, 
-0.568026, 0.00506104, 0, 0.720422, 
-0.55414, 0.0047353, 0, 0.749216, 
-0.540178, 0.00442889, 0, 0.778974, 
-0.526513, 0.00414363, 0, 0.809711, 
-0.512954, 0.00388237, 0, 0.84127, 
-0.499403, 0.00362875, 0, 0.873016, 
-0.486026, 0.00340827, 0, 0.904762, 
-0.472345, 0.00318597, 0, 0.936508, 
-0.458828, 0.00297635, 0, 0.968254, 
-0.445379, 0.00279447, 0, 1, 
-1, 0.0345716, 0, 0, 
-1, 0.0345717, 0, 0, 
-0.999999, 0.034573, 0, 0, 
-0.999991, 0.0345787, 0, 0, 
-0.999974, 0.0345941, 0, 0, 
-0.999937, 0.0346263, 0, 1.88589e-06, 
-0.999869, 0.0346847, 0, 0.000409212, 
-0.999757, 0.0347798, 0, 0.0017674, 
-0.999582, 0.0349233, 0, 0.00413658, 
-0.999322, 0.0351265, 0, 0.00747408, 
-0.998939, 0.0353967, 0, 0.0117157, 
-0.998219, 0.0357018, 0, 0.0167966, 
-0.994974, 0.0354726, 0, 0.0226573, 
-0.993201, 0.0355621, 0, 0.0292445, 
-0.991573, 0.0357641, 0, 0.0365123, 
-0.989301, 0.0359252, 0, 0.0444203, 
-0.985712, 0.0358017, 0, 0.0529335, 
-0.982411, 0.0358353, 0, 0.0620214, 
-0.977827, 0.035617, 0, 0.0716573, 
-0.973278, 0.0354398, 0, 0.0818185, 
-0.967397, 0.0350483, 0, 0.0924846, 
-0.960696, 0.0344795, 0, 0.103638, 
-0.954349, 0.0339861, 0, 0.115263, 
-0.946066, 0.0331323, 0, 0.127348, 
-0.938012, 0.032359, 0, 0.13988, 
-0.929413, 0.0314413, 0, 0.152849, 
-0.920355, 0.0304103, 0, 0.166248, 
-0.910586, 0.0292785, 0, 0.18007, 
-0.900609, 0.0281391, 0, 0.194308, 
-0.890093, 0.0269103, 0, 0.208958, 
-0.880013, 0.0257269, 0, 0.224018, 
-0.869001, 0.0244671, 0, 0.239485, 
-0.85751, 0.0232252, 0, 0.255359, 
-0.84582, 0.0220117, 0, 0.271637, 
-0.834383, 0.0208274, 0, 0.288324, 
-0.822158, 0.0196628, 0, 0.305419, 
-0.809056, 0.0185306, 0, 0.322927, 
-0.795833, 0.0174174, 0, 0.340851, 
-0.782547, 0.0163758, 0, 0.359198, 
-0.7689, 0.015391, 0, 0.377975, 
-0.755526, 0.0144488, 0, 0.397189, 
-0.741681, 0.0135372, 0, 0.416851, 
-0.728178, 0.0126957, 0, 0.436971, 
-0.714642, 0.0118812, 0, 0.457564, 
-0.702756, 0.0111165, 0, 0.478644, 
-0.69175, 0.0104145, 0, 0.500229, 
-0.680159, 0.00974439, 0, 0.522339, 
-0.668073, 0.00911926, 0, 0.544997, 
-0.655405, 0.00851393, 0, 0.56823, 
-0.642921, 0.00797637, 0, 0.592068, 
-0.629993, 0.00745119, 0, 0.616546, 
-0.616828, 0.00696972, 0, 0.641705, 
-0.603305, 0.00652425, 0, 0.66759, 
-0.589833, 0.00610188, 0, 0.694255, 
-0.575945, 0.00570834, 0, 0.72176, 
-0.561745, 0.00533384, 0, 0.750168, 
-0.548277, 0.00500001, 0, 0.779545, 
-0.534467, 0.00467582, 0, 0.809933, 
-0.521032, 0.00438092, 0, 0.841272, 
-0.507877, 0.00410348, 0, 0.873016, 
-0.494654, 0.00383618, 0, 0.904762, 
-0.481592, 0.00358699, 0, 0.936508, 
-0.468509, 0.00337281, 0, 0.968254, 
-0.455293, 0.00316196, 0, 1, 
-1, 0.0430698, 0, 0, 
-1, 0.0430699, 0, 0, 
-0.999998, 0.0430713, 0, 0, 
-0.999991, 0.0430774, 0, 0, 
-0.99997, 0.0430936, 0, 0, 
-0.999928, 0.0431277, 0, 4.06396e-05, 
-0.999852, 0.0431894, 0, 0.000744453, 
-0.999724, 0.0432895, 0, 0.0024806, 
-0.999527, 0.0434397, 0, 0.00524776, 
-0.99923, 0.0436507, 0, 0.00898169, 
-0.998783, 0.0439255, 0, 0.0136083, 
-0.997507, 0.0441104, 0, 0.0190582, 
-0.994418, 0.0438225, 0, 0.0252694, 
-0.992864, 0.0439396, 0, 0.0321879, 
-0.991127, 0.0440963, 0, 0.039767, 
-0.987331, 0.0438408, 0, 0.0479667, 
-0.98482, 0.0438991, 0, 0.0567521, 
-0.980384, 0.0435906, 0, 0.0660929, 
-0.975846, 0.0432544, 0, 0.075963, 
-0.970748, 0.0428294, 0, 0.0863398, 
-0.964303, 0.042153, 0, 0.0972034, 
-0.95772, 0.0414112, 0, 0.108537, 
-0.950747, 0.0405893, 0, 0.120325, 
-0.942533, 0.0394887, 0, 0.132554, 
-0.934045, 0.0383544, 0, 0.145215, 
-0.924942, 0.037057, 0, 0.158296, 
-0.91581, 0.0356993, 0, 0.17179, 
-0.90612, 0.0342402, 0, 0.185691, 
-0.896434, 0.0328078, 0, 0.199993, 
-0.88602, 0.031288, 0, 0.214691, 
-0.876081, 0.0297776, 0, 0.229782, 
-0.865608, 0.0282334, 0, 0.245265, 
-0.854924, 0.026749, 0, 0.261138, 
-0.843607, 0.0252601, 0, 0.277401, 
-0.832455, 0.0238214, 0, 0.294056, 
-0.821342, 0.0224682, 0, 0.311104, 
-0.809303, 0.0211297, 0, 0.328548, 
-0.796468, 0.0198387, 0, 0.346394, 
-0.784046, 0.0186227, 0, 0.364645, 
-0.771262, 0.0174561, 0, 0.38331, 
-0.758118, 0.0163806, 0, 0.402396, 
-0.745075, 0.0153287, 0, 0.421912, 
-0.731926, 0.0143648, 0, 0.44187, 
-0.71863, 0.0134363, 0, 0.462283, 
-0.705414, 0.0125603, 0, 0.483165, 
-0.693792, 0.0117508, 0, 0.504535, 
-0.683108, 0.0110016, 0, 0.52641, 
-0.67183, 0.0102757, 0, 0.548816, 
-0.66015, 0.00962044, 0, 0.571776, 
-0.647907, 0.00898031, 0, 0.595323, 
-0.635734, 0.00840812, 0, 0.61949, 
-0.623208, 0.00786211, 0, 0.644317, 
-0.610438, 0.00734954, 0, 0.669852, 
-0.597345, 0.00687688, 0, 0.696148, 
-0.584138, 0.0064347, 0, 0.723267, 
-0.5707, 0.00602236, 0, 0.75128, 
-0.556966, 0.0056324, 0, 0.780258, 
-0.543607, 0.00528277, 0, 0.810268, 
-0.530213, 0.00493999, 0, 0.841311, 
-0.516912, 0.00462265, 0, 0.873016, 
-0.503916, 0.0043307, 0, 0.904762, 
-0.491146, 0.00406858, 0, 0.936508, 
-0.478439, 0.00381436, 0, 0.968254, 
-0.465834, 0.00358004, 0, 1, 
-1, 0.053404, 0, 0, 
-1, 0.053404, 0, 0, 
-0.999998, 0.0534055, 0, 0, 
-0.999989, 0.0534116, 0, 0, 
-0.999968, 0.0534283, 0, 0, 
-0.999918, 0.0534633, 0, 0.000155895, 
-0.99983, 0.0535262, 0, 0.00120914, 
-0.999685, 0.0536281, 0, 0.00334941, 
-0.999461, 0.0537799, 0, 0.00653077, 
-0.999118, 0.0539902, 0, 0.0106718, 
-0.998582, 0.0542525, 0, 0.0156908, 
-0.995919, 0.0540318, 0, 0.0215148, 
-0.993735, 0.0538915, 0, 0.0280801, 
-0.992126, 0.0539558, 0, 0.0353323, 
-0.990266, 0.0540401, 0, 0.0432247, 
-0.986317, 0.0536065, 0, 0.0517172, 
-0.983213, 0.0534426, 0, 0.0607755, 
-0.978303, 0.0528622, 0, 0.0703698, 
-0.973665, 0.0523363, 0, 0.0804742, 
-0.968091, 0.0516165, 0, 0.0910666, 
-0.961026, 0.0505435, 0, 0.102128, 
-0.954333, 0.049523, 0, 0.113641, 
-0.946372, 0.0481698, 0, 0.125591, 
-0.938254, 0.0467674, 0, 0.137965, 
-0.929516, 0.0452341, 0, 0.150754, 
-0.920106, 0.0435084, 0, 0.163947, 
-0.910899, 0.04174, 0, 0.177537, 
-0.901532, 0.0399389, 0, 0.191516, 
-0.891919, 0.0380901, 0, 0.205881, 
-0.882006, 0.0362341, 0, 0.220626, 
-0.871965, 0.0343445, 0, 0.235749, 
-0.862146, 0.0324832, 0, 0.251248, 
-0.852058, 0.0306681, 0, 0.267121, 
-0.84161, 0.0289097, 0, 0.283368, 
-0.830806, 0.0272079, 0, 0.299992, 
-0.820475, 0.0256089, 0, 0.316992, 
-0.809514, 0.0240394, 0, 0.334374, 
-0.797865, 0.0225379, 0, 0.35214, 
-0.785621, 0.0211235, 0, 0.370296, 
-0.773764, 0.0197908, 0, 0.388849, 
-0.761629, 0.0185235, 0, 0.407807, 
-0.748891, 0.0173359, 0, 0.427178, 
-0.736437, 0.0162305, 0, 0.446974, 
-0.723706, 0.0151778, 0, 0.467207, 
-0.710606, 0.0141792, 0, 0.487892, 
-0.698019, 0.0132592, 0, 0.509046, 
-0.686203, 0.0123887, 0, 0.530687, 
-0.675692, 0.0115976, 0, 0.552839, 
-0.664826, 0.0108325, 0, 0.575527, 
-0.65349, 0.0101348, 0, 0.59878, 
-0.641774, 0.00947756, 0, 0.622634, 
-0.629794, 0.00886059, 0, 0.647128, 
-0.617647, 0.00828527, 0, 0.672309, 
-0.605341, 0.00775312, 0, 0.698231, 
-0.592718, 0.00726033, 0, 0.724958, 
-0.579746, 0.00679731, 0, 0.752563, 
-0.566763, 0.00636112, 0, 0.781127, 
-0.553516, 0.00595228, 0, 0.810733, 
-0.540118, 0.00556877, 0, 0.841426, 
-0.527325, 0.00523051, 0, 0.873016, 
-0.514266, 0.00490712, 0, 0.904762, 
-0.501406, 0.00460297, 0, 0.936508, 
-0.488922, 0.00431247, 0, 0.968254, 
-0.476541, 0.0040472, 0, 1, 
-1, 0.0659184, 0, 0, 
-1, 0.0659185, 0, 0, 
-0.999998, 0.06592, 0, 0, 
-0.999988, 0.0659259, 0, 0, 
-0.999963, 0.0659423, 0, 0, 
-0.999907, 0.0659764, 0, 0.000374173, 
-0.999806, 0.0660376, 0, 0.00182064, 
-0.999639, 0.0661361, 0, 0.00438938, 
-0.999378, 0.0662814, 0, 0.00800058, 
-0.998985, 0.0664779, 0, 0.0125594, 
-0.998285, 0.0666914, 0, 0.0179786, 
-0.995071, 0.0661989, 0, 0.0241822, 
-0.993172, 0.0660454, 0, 0.031106, 
-0.991438, 0.0660105, 0, 0.0386951, 
-0.988428, 0.0656875, 0, 0.0469031, 
-0.985218, 0.0652913, 0, 0.0556905, 
-0.981128, 0.0647107, 0, 0.065023, 
-0.976015, 0.0638491, 0, 0.0748716, 
-0.97097, 0.062993, 0, 0.0852111, 
-0.964582, 0.0617927, 0, 0.0960198, 
-0.957383, 0.0603626, 0, 0.107279, 
-0.949969, 0.0588128, 0, 0.118971, 
-0.941843, 0.0570274, 0, 0.131084, 
-0.933624, 0.0551885, 0, 0.143604, 
-0.924543, 0.053122, 0, 0.156521, 
-0.914919, 0.0508897, 0, 0.169825, 
-0.905773, 0.0486418, 0, 0.18351, 
-0.896434, 0.0463364, 0, 0.197569, 
-0.887195, 0.0440623, 0, 0.211997, 
-0.877706, 0.0417799, 0, 0.226789, 
-0.867719, 0.03945, 0, 0.241944, 
-0.858587, 0.037243, 0, 0.257458, 
-0.849317, 0.0350956, 0, 0.273331, 
-0.839585, 0.0329852, 0, 0.289563, 
-0.829856, 0.0310028, 0, 0.306154, 
-0.819589, 0.0290953, 0, 0.323108, 
-0.809714, 0.0272738, 0, 0.340426, 
-0.79934, 0.0255631, 0, 0.358113, 
-0.788224, 0.0239175, 0, 0.376174, 
-0.776619, 0.0223831, 0, 0.394616, 
-0.76521, 0.0209298, 0, 0.413445, 
-0.753716, 0.0195786, 0, 0.432671, 
-0.741564, 0.0183001, 0, 0.452305, 
-0.729413, 0.0171259, 0, 0.472358, 
-0.717146, 0.0159933, 0, 0.492845, 
-0.70436, 0.0149495, 0, 0.513783, 
-0.69219, 0.0139681, 0, 0.535189, 
-0.680289, 0.0130577, 0, 0.557086, 
-0.669611, 0.0122198, 0, 0.5795, 
-0.659113, 0.0114174, 0, 0.602459, 
-0.648148, 0.0106729, 0, 0.625997, 
-0.636905, 0.00998997, 0, 0.650154, 
-0.625154, 0.00934313, 0, 0.674976, 
-0.613481, 0.00874839, 0, 0.700518, 
-0.60154, 0.00818265, 0, 0.726845, 
-0.58943, 0.00766889, 0, 0.754032, 
-0.576828, 0.00717153, 0, 0.782167, 
-0.564194, 0.00672696, 0, 0.811344, 
-0.551501, 0.00630863, 0, 0.841644, 
-0.538635, 0.00592177, 0, 0.873016, 
-0.525724, 0.00554888, 0, 0.904762, 
-0.513209, 0.00520225, 0, 0.936508, 
-0.500457, 0.00488231, 0, 0.968254, 
-0.48799, 0.00457153, 0, 1, 
-1, 0.0810131, 0, 0, 
-1, 0.0810133, 0, 0, 
-0.999997, 0.0810145, 0, 0, 
-0.999985, 0.08102, 0, 0, 
-0.999956, 0.0810347, 0, 1.95392e-05, 
-0.999893, 0.0810656, 0, 0.000719365, 
-0.999777, 0.0811205, 0, 0.00259774, 
-0.999583, 0.081208, 0, 0.0056181, 
-0.999281, 0.0813343, 0, 0.00967469, 
-0.998813, 0.0814969, 0, 0.0146627, 
-0.997597, 0.0815217, 0, 0.0204903, 
-0.994379, 0.0808502, 0, 0.0270802, 
-0.992744, 0.0806792, 0, 0.0343674, 
-0.990745, 0.0804589, 0, 0.0422974, 
-0.986646, 0.0796107, 0, 0.0508241, 
-0.983611, 0.0790913, 0, 0.0599087, 
-0.978869, 0.0780746, 0, 0.0695175, 
-0.973475, 0.0768218, 0, 0.0796223, 
-0.967845, 0.0754926, 0, 0.0901982, 
-0.960778, 0.0737063, 0, 0.101224, 
-0.953333, 0.0718052, 0, 0.112682, 
-0.945274, 0.0695946, 0, 0.124555, 
-0.936955, 0.0672492, 0, 0.136831, 
-0.928319, 0.0647732, 0, 0.149496, 
-0.919075, 0.0620947, 0, 0.162542, 
-0.909114, 0.0591816, 0, 0.175958, 
-0.900137, 0.0563917, 0, 0.189739, 
-0.891069, 0.0535392, 0, 0.203877, 
-0.882262, 0.0507642, 0, 0.218368, 
-0.873232, 0.0479793, 0, 0.233208, 
-0.864042, 0.0452259, 0, 0.248393, 
-0.855002, 0.0425413, 0, 0.263923, 
-0.846569, 0.0400126, 0, 0.279796, 
-0.837714, 0.0375269, 0, 0.296012, 
-0.828918, 0.0352027, 0, 0.312573, 
-0.819783, 0.0330011, 0, 0.329479, 
-0.810129, 0.0308908, 0, 0.346734, 
-0.800866, 0.0289112, 0, 0.364342, 
-0.79093, 0.0270255, 0, 0.382307, 
-0.780593, 0.0252758, 0, 0.400637, 
-0.769511, 0.0236178, 0, 0.419337, 
-0.758558, 0.0220652, 0, 0.438418, 
-0.747632, 0.0206289, 0, 0.457888, 
-0.736146, 0.0192873, 0, 0.477761, 
-0.724093, 0.0180333, 0, 0.49805, 
-0.71234, 0.0168264, 0, 0.51877, 
-0.700201, 0.015746, 0, 0.53994, 
-0.687949, 0.0147027, 0, 0.561581, 
-0.676163, 0.0137512, 0, 0.583718, 
-0.665001, 0.0128655, 0, 0.60638, 
-0.65472, 0.0120366, 0, 0.629599, 
-0.644213, 0.0112604, 0, 0.653415, 
-0.633382, 0.0105413, 0, 0.677874, 
-0.62212, 0.00986498, 0, 0.70303, 
-0.610631, 0.00923308, 0, 0.728948, 
-0.599078, 0.00864206, 0, 0.755706, 
-0.587519, 0.00811784, 0, 0.783396, 
-0.575505, 0.00761237, 0, 0.812121, 
-0.563148, 0.00713949, 0, 0.841989, 
-0.550828, 0.00668379, 0, 0.873035, 
-0.538458, 0.00627716, 0, 0.904762, 
-0.525905, 0.00588336, 0, 0.936508, 
-0.513517, 0.00552687, 0, 0.968254, 
-0.501395, 0.00519681, 0, 1, 
-1, 0.0991506, 0, 0, 
-1, 0.0991504, 0, 0, 
-0.999996, 0.0991515, 0, 0, 
-0.999984, 0.0991558, 0, 0, 
-0.999947, 0.0991672, 0, 0.000114389, 
-0.999874, 0.0991912, 0, 0.00121503, 
-0.999739, 0.0992331, 0, 0.00356108, 
-0.999514, 0.0992983, 0, 0.00705583, 
-0.999159, 0.0993877, 0, 0.011574, 
-0.998586, 0.0994837, 0, 0.017003, 
-0.995731, 0.0988425, 0, 0.0232484, 
-0.993384, 0.098276, 0, 0.0302318, 
-0.991615, 0.0979269, 0, 0.0378884, 
-0.989029, 0.0973432, 0, 0.0461641, 
-0.985373, 0.0963539, 0, 0.0550136, 
-0.981278, 0.0952306, 0, 0.0643988, 
-0.975777, 0.0936233, 0, 0.0742868, 
-0.970526, 0.0920219, 0, 0.08465, 
-0.963755, 0.0898912, 0, 0.0954644, 
-0.956676, 0.0876064, 0, 0.106709, 
-0.948099, 0.0847751, 0, 0.118367, 
-0.939718, 0.0818638, 0, 0.130423, 
-0.931305, 0.078857, 0, 0.142862, 
-0.922342, 0.0756127, 0, 0.155674, 
-0.912842, 0.0721473, 0, 0.168849, 
-0.903304, 0.0686195, 0, 0.182378, 
-0.89411, 0.0650589, 0, 0.196255, 
-0.885512, 0.0616022, 0, 0.210473, 
-0.877193, 0.0582434, 0, 0.225027, 
-0.86877, 0.0548979, 0, 0.239915, 
-0.860267, 0.0516095, 0, 0.255132, 
-0.851915, 0.048468, 0, 0.270678, 
-0.843912, 0.0454447, 0, 0.286551, 
-0.836039, 0.0425612, 0, 0.302751, 
-0.828245, 0.0398752, 0, 0.31928, 
-0.820159, 0.0373198, 0, 0.336138, 
-0.81167, 0.034916, 0, 0.35333, 
-0.802659, 0.0326402, 0, 0.370858, 
-0.793921, 0.0304901, 0, 0.388727, 
-0.784713, 0.0284857, 0, 0.406944, 
-0.774946, 0.0266186, 0, 0.425515, 
-0.76448, 0.0248593, 0, 0.444449, 
-0.753793, 0.0232114, 0, 0.463756, 
-0.743506, 0.0217039, 0, 0.483447, 
-0.732555, 0.0202841, 0, 0.503535, 
-0.720965, 0.0189648, 0, 0.524036, 
-0.709422, 0.0177189, 0, 0.544967, 
-0.697756, 0.0165626, 0, 0.56635, 
-0.685566, 0.015483, 0, 0.588208, 
-0.673987, 0.0144892, 0, 0.610569, 
-0.66244, 0.0135607, 0, 0.633466, 
-0.651675, 0.0126956, 0, 0.656936, 
-0.641598, 0.0118788, 0, 0.681025, 
-0.63121, 0.0111261, 0, 0.705788, 
-0.620515, 0.010437, 0, 0.731289, 
-0.609366, 0.00978747, 0, 0.757606, 
-0.598137, 0.00917257, 0, 0.784834, 
-0.586966, 0.00859778, 0, 0.813085, 
-0.575549, 0.00806802, 0, 0.842485, 
-0.563797, 0.00757294, 0, 0.87313, 
-0.551758, 0.00710592, 0, 0.904762, 
-0.539894, 0.0066841, 0, 0.936508, 
-0.527901, 0.00627901, 0, 0.968254, 
-0.515819, 0.00590506, 0, 1, 
-1, 0.120864, 0, 0, 
-1, 0.120864, 0, 0, 
-0.999996, 0.120864, 0, 0, 
-0.99998, 0.120867, 0, 0, 
-0.99994, 0.120872, 0, 0.000323805, 
-0.999852, 0.120884, 0, 0.00188695, 
-0.999693, 0.120903, 0, 0.00473489, 
-0.999426, 0.120929, 0, 0.00872711, 
-0.999002, 0.120955, 0, 0.0137237, 
-0.998235, 0.120918, 0, 0.0196068, 
-0.994608, 0.119764, 0, 0.0262803, 
-0.992997, 0.119265, 0, 0.0336657, 
-0.990968, 0.11863, 0, 0.0416987, 
-0.987002, 0.117261, 0, 0.0503261, 
-0.983524, 0.116008, 0, 0.0595034, 
-0.97875, 0.114252, 0, 0.0691935, 
-0.972651, 0.11193, 0, 0.0793645, 
-0.966613, 0.109554, 0, 0.0899894, 
-0.959275, 0.106612, 0, 0.101045, 
-0.951272, 0.103375, 0, 0.112512, 
-0.942323, 0.0996593, 0, 0.124372, 
-0.933679, 0.0958841, 0, 0.136611, 
-0.924822, 0.0919264, 0, 0.149216, 
-0.915742, 0.0878061, 0, 0.162176, 
-0.906348, 0.0834893, 0, 0.175482, 
-0.896883, 0.0790849, 0, 0.189125, 
-0.887741, 0.0746745, 0, 0.203098, 
-0.87986, 0.0705772, 0, 0.217396, 
-0.871998, 0.0665004, 0, 0.232015, 
-0.864325, 0.0625413, 0, 0.24695, 
-0.856685, 0.058678, 0, 0.2622, 
-0.84925, 0.0550063, 0, 0.277761, 
-0.841719, 0.0514727, 0, 0.293634, 
-0.834756, 0.0481398, 0, 0.309819, 
-0.827853, 0.0450172, 0, 0.326315, 
-0.820888, 0.0420968, 0, 0.343126, 
-0.813616, 0.0393702, 0, 0.360254, 
-0.805767, 0.0367771, 0, 0.377701, 
-0.797338, 0.0343274, 0, 0.395474, 
-0.789122, 0.0320529, 0, 0.413577, 
-0.780601, 0.0299485, 0, 0.432018, 
-0.771424, 0.0279811, 0, 0.450803, 
-0.761502, 0.0261054, 0, 0.469944, 
-0.751166, 0.0243942, 0, 0.489451, 
-0.741276, 0.0228087, 0, 0.509337, 
-0.730898, 0.0213265, 0, 0.529617, 
-0.719878, 0.0199307, 0, 0.550307, 
-0.708379, 0.0186574, 0, 0.571428, 
-0.697165, 0.0174446, 0, 0.593003, 
-0.685554, 0.0163144, 0, 0.615059, 
-0.673631, 0.015276, 0, 0.637628, 
-0.662385, 0.0143003, 0, 0.660746, 
-0.651059, 0.0134112, 0, 0.684459, 
-0.640452, 0.0125794, 0, 0.70882, 
-0.630536, 0.011793, 0, 0.733893, 
-0.620316, 0.0110547, 0, 0.759755, 
-0.609722, 0.0103668, 0, 0.786505, 
-0.598804, 0.00973009, 0, 0.814259, 
-0.587871, 0.00912811, 0, 0.843157, 
-0.577121, 0.00858915, 0, 0.87334, 
-0.566019, 0.00807333, 0, 0.904762, 
-0.554664, 0.00759687, 0, 0.936508, 
-0.543101, 0.00714759, 0, 0.968254, 
-0.531558, 0.00673418, 0, 1, 
-1, 0.146767, 0, 0, 
-1, 0.146767, 0, 0, 
-0.999997, 0.146767, 0, 0, 
-0.999977, 0.146765, 0, 3.1721e-06, 
-0.999929, 0.146762, 0, 0.000682576, 
-0.999823, 0.146753, 0, 0.00276398, 
-0.999633, 0.146735, 0, 0.00614773, 
-0.999314, 0.146699, 0, 0.0106614, 
-0.998796, 0.14662, 0, 0.0161546, 
-0.997124, 0.146107, 0, 0.0225064, 
-0.994062, 0.144857, 0, 0.0296198, 
-0.992154, 0.144011, 0, 0.037417, 
-0.989186, 0.142712, 0, 0.0458349, 
-0.985279, 0.140926, 0, 0.0548211, 
-0.980826, 0.13885, 0, 0.0643325, 
-0.975056, 0.136168, 0, 0.074333, 
-0.969005, 0.133217, 0, 0.0847918, 
-0.961554, 0.12959, 0, 0.0956827, 
-0.954206, 0.125886, 0, 0.106983, 
-0.945046, 0.121335, 0, 0.118675, 
-0.935678, 0.116492, 0, 0.130741, 
-0.926748, 0.111635, 0, 0.143166, 
-0.917764, 0.106625, 0, 0.155939, 
-0.908358, 0.101325, 0, 0.169049, 
-0.899219, 0.0960249, 0, 0.182487, 
-0.890089, 0.0906527, 0, 0.196245, 
-0.881488, 0.0853905, 0, 0.210317, 
-0.874031, 0.0804177, 0, 0.224696, 
-0.866932, 0.0756005, 0, 0.23938, 
-0.859976, 0.0709019, 0, 0.254364, 
-0.853375, 0.0664391, 0, 0.269646, 
-0.846971, 0.0622012, 0, 0.285223, 
-0.840483, 0.058129, 0, 0.301096, 
-0.833969, 0.0542762, 0, 0.317265, 
-0.82806, 0.0507042, 0, 0.333729, 
-0.822128, 0.047368, 0, 0.350491, 
-0.815989, 0.044272, 0, 0.367554, 
-0.809336, 0.0413444, 0, 0.38492, 
-0.802177, 0.038601, 0, 0.402594, 
-0.79441, 0.0360227, 0, 0.420582, 
-0.786573, 0.0336383, 0, 0.43889, 
-0.778619, 0.0314321, 0, 0.457526, 
-0.77, 0.029362, 0, 0.476499, 
-0.760698, 0.0274102, 0, 0.49582, 
-0.750932, 0.0256146, 0, 0.5155, 
-0.740993, 0.023974, 0, 0.535555, 
-0.731159, 0.0224182, 0, 0.556, 
-0.720836, 0.0209889, 0, 0.576855, 
-0.709913, 0.0196411, 0, 0.598143, 
-0.698415, 0.0183824, 0, 0.619888, 
-0.68745, 0.0172222, 0, 0.642123, 
-0.676154, 0.0161509, 0, 0.664883, 
-0.664383, 0.0151397, 0, 0.688211, 
-0.6533, 0.0141873, 0, 0.71216, 
-0.642072, 0.0133105, 0, 0.736792, 
-0.631412, 0.0124932, 0, 0.762186, 
-0.621622, 0.0117408, 0, 0.788439, 
-0.611681, 0.0110358, 0, 0.815671, 
-0.60142, 0.0103775, 0, 0.844034, 
-0.59083, 0.00975623, 0, 0.873698, 
-0.580254, 0.00918084, 0, 0.904765, 
-0.569841, 0.00864721, 0, 0.936508, 
-0.559224, 0.0081573, 0, 0.968254, 
-0.548315, 0.00767924, 0, 1, 
-1, 0.177563, 0, 0, 
-1, 0.177563, 0, 0, 
-0.999994, 0.177562, 0, 0, 
-0.999972, 0.177555, 0, 6.64171e-05, 
-0.999914, 0.177536, 0, 0.0012276, 
-0.999787, 0.177496, 0, 0.00388025, 
-0.999556, 0.17742, 0, 0.00783461, 
-0.999165, 0.177285, 0, 0.0128953, 
-0.9985, 0.177037, 0, 0.0189053, 
-0.995388, 0.175634, 0, 0.025742, 
-0.993102, 0.174375, 0, 0.033309, 
-0.990992, 0.173121, 0, 0.0415298, 
-0.986932, 0.170896, 0, 0.0503425, 
-0.982786, 0.16847, 0, 0.0596965, 
-0.977592, 0.165455, 0, 0.0695498, 
-0.971075, 0.161676, 0, 0.0798676, 
-0.963967, 0.157458, 0, 0.0906202, 
-0.956397, 0.152836, 0, 0.101783, 
-0.947489, 0.147467, 0, 0.113333, 
-0.937564, 0.14145, 0, 0.125254, 
-0.928182, 0.135383, 0, 0.137529, 
-0.919027, 0.129212, 0, 0.150144, 
-0.909618, 0.12276, 0, 0.163088, 
-0.900492, 0.116273, 0, 0.176351, 
-0.891671, 0.1098, 0, 0.189924, 
-0.883146, 0.103362, 0, 0.203799, 
-0.875151, 0.0970799, 0, 0.21797, 
-0.868338, 0.0911732, 0, 0.232433, 
-0.862033, 0.0854966, 0, 0.247182, 
-0.856107, 0.0800691, 0, 0.262216, 
-0.850644, 0.0749618, 0, 0.27753, 
-0.845261, 0.070079, 0, 0.293124, 
-0.839885, 0.0654321, 0, 0.308997, 
-0.834609, 0.0610975, 0, 0.325149, 
-0.829083, 0.0569741, 0, 0.341581, 
-0.82404, 0.0531736, 0, 0.358294, 
-0.818968, 0.049665, 0, 0.37529, 
-0.813496, 0.0463856, 0, 0.392573, 
-0.807533, 0.0433217, 0, 0.410148, 
-0.80099, 0.0404402, 0, 0.428019, 
-0.793891, 0.0377578, 0, 0.446192, 
-0.786281, 0.0352616, 0, 0.464676, 
-0.778773, 0.0329577, 0, 0.483478, 
-0.770737, 0.030808, 0, 0.502608, 
-0.762094, 0.0287964, 0, 0.522079, 
-0.752898, 0.0269254, 0, 0.541905, 
-0.743306, 0.0251926, 0, 0.5621, 
-0.733416, 0.023595, 0, 0.582684, 
-0.723742, 0.0221155, 0, 0.603677, 
-0.713543, 0.0207435, 0, 0.625106, 
-0.702755, 0.019434, 0, 0.646998, 
-0.691484, 0.0182046, 0, 0.66939, 
-0.680531, 0.0170771, 0, 0.692324, 
-0.66953, 0.0160339, 0, 0.715849, 
-0.658126, 0.0150677, 0, 0.740028, 
-0.646933, 0.0141551, 0, 0.764937, 
-0.636107, 0.0133179, 0, 0.790673, 
-0.625271, 0.0125284, 0, 0.817358, 
-0.615225, 0.0117937, 0, 0.84515, 
-0.605677, 0.0111181, 0, 0.874244, 
-0.59583, 0.0104759, 0, 0.904828, 
-0.585704, 0.00986672, 0, 0.936508, 
-0.575413, 0.00929712, 0, 0.968254, 
-0.565373, 0.00876712, 0, 1, 
-1, 0.214058, 0, 0, 
-0.999999, 0.214058, 0, 0, 
-0.999994, 0.214055, 0, 0, 
-0.999966, 0.214039, 0, 0.000259642, 
-0.999893, 0.213998, 0, 0.00200075, 
-0.999737, 0.21391, 0, 0.00527775, 
-0.999449, 0.213745, 0, 0.00983957, 
-0.99896, 0.213458, 0, 0.0154755, 
-0.9979, 0.212855, 0, 0.0220249, 
-0.994278, 0.210779, 0, 0.0293654, 
-0.992254, 0.20926, 0, 0.0374022, 
-0.98881, 0.206908, 0, 0.0460604, 
-0.984715, 0.204009, 0, 0.0552802, 
-0.979738, 0.200471, 0, 0.0650127, 
-0.972884, 0.195813, 0, 0.0752175, 
-0.965996, 0.190856, 0, 0.0858613, 
-0.957974, 0.185077, 0, 0.0969155, 
-0.949155, 0.17868, 0, 0.108356, 
-0.939288, 0.171513, 0, 0.120163, 
-0.928996, 0.163838, 0, 0.132319, 
-0.919563, 0.156246, 0, 0.144808, 
-0.910004, 0.148359, 0, 0.157618, 
-0.900791, 0.140417, 0, 0.170737, 
-0.892135, 0.132569, 0, 0.184155, 
-0.883803, 0.124741, 0, 0.197866, 
-0.876034, 0.117091, 0, 0.211861, 
-0.869219, 0.109835, 0, 0.226134, 
-0.863062, 0.102859, 0, 0.240682, 
-0.857795, 0.0962928, 0, 0.255499, 
-0.853009, 0.0900725, 0, 0.270583, 
-0.848603, 0.0842101, 0, 0.285931, 
-0.844335, 0.0786527, 0, 0.301542, 
-0.840208, 0.0734397, 0, 0.317415, 
-0.836035, 0.0685334, 0, 0.33355, 
-0.83172, 0.0639275, 0, 0.349948, 
-0.827135, 0.0595909, 0, 0.36661, 
-0.822797, 0.0556204, 0, 0.383539, 
-0.818387, 0.0519394, 0, 0.400738, 
-0.813565, 0.0485317, 0, 0.41821, 
-0.808142, 0.0453138, 0, 0.435961, 
-0.802212, 0.0423354, 0, 0.453997, 
-0.79573, 0.0395553, 0, 0.472324, 
-0.788741, 0.036988, 0, 0.490951, 
-0.781093, 0.0345688, 0, 0.509887, 
-0.773597, 0.0323297, 0, 0.529144, 
-0.765622, 0.0302719, 0, 0.548735, 
-0.757083, 0.0283477, 0, 0.568674, 
-0.747992, 0.0265562, 0, 0.588979, 
-0.738591, 0.0248844, 0, 0.609671, 
-0.728719, 0.0233342, 0, 0.630773, 
-0.719146, 0.0219081, 0, 0.652314, 
-0.709165, 0.0205711, 0, 0.674328, 
-0.69875, 0.0193248, 0, 0.696854, 
-0.687884, 0.0181582, 0, 0.719942, 
-0.676818, 0.0170746, 0, 0.743651, 
-0.666247, 0.0160718, 0, 0.768057, 
-0.655284, 0.0151262, 0, 0.793253, 
-0.64401, 0.0142561, 0, 0.819363, 
-0.633353, 0.0134327, 0, 0.846547, 
-0.622674, 0.012653, 0, 0.875017, 
-0.612265, 0.0119354, 0, 0.905021, 
-0.602455, 0.0112533, 0, 0.936508, 
-0.593147, 0.0106234, 0, 0.968254, 
-0.583592, 0.0100213, 0, 1, 
-1, 0.25717, 0, 0, 
-1, 0.25717, 0, 0, 
-0.999992, 0.257164, 0, 0, 
-0.999958, 0.257135, 0, 0.000641715, 
-0.999864, 0.25706, 0, 0.00305314, 
-0.999666, 0.256897, 0, 0.00700966, 
-0.999302, 0.256596, 0, 0.0122194, 
-0.998663, 0.25607, 0, 0.0184622, 
-0.995607, 0.254123, 0, 0.0255772, 
-0.993094, 0.252081, 0, 0.0334438, 
-0.9907, 0.249867, 0, 0.0419695, 
-0.98594, 0.246118, 0, 0.0510822, 
-0.981214, 0.242049, 0, 0.0607241, 
-0.974966, 0.236869, 0, 0.0708485, 
-0.967589, 0.230724, 0, 0.0814168, 
-0.95915, 0.223635, 0, 0.0923974, 
-0.950257, 0.21596, 0, 0.103763, 
-0.940165, 0.207296, 0, 0.115491, 
-0.929396, 0.197901, 0, 0.127562, 
-0.919288, 0.188437, 0, 0.13996, 
-0.909428, 0.178762, 0, 0.152669, 
-0.900105, 0.169072, 0, 0.165679, 
-0.891418, 0.159478, 0, 0.178979, 
-0.883347, 0.15002, 0, 0.192558, 
-0.875992, 0.140813, 0, 0.20641, 
-0.869466, 0.13196, 0, 0.220529, 
-0.863699, 0.123501, 0, 0.234907, 
-0.858553, 0.115436, 0, 0.249542, 
-0.854379, 0.107901, 0, 0.264428, 
-0.850894, 0.10088, 0, 0.279564, 
-0.847632, 0.0942296, 0, 0.294947, 
-0.844571, 0.0879861, 0, 0.310575, 
-0.84163, 0.0821534, 0, 0.326448, 
-0.838542, 0.0766409, 0, 0.342566, 
-0.835412, 0.0715322, 0, 0.358929, 
-0.831899, 0.0666883, 0, 0.375539, 
-0.828177, 0.0622175, 0, 0.392399, 
-0.82416, 0.0580452, 0, 0.40951, 
-0.820393, 0.054267, 0, 0.426878, 
-0.816068, 0.0507172, 0, 0.444506, 
-0.811201, 0.0474041, 0, 0.462399, 
-0.805785, 0.0443174, 0, 0.480566, 
-0.799878, 0.0414562, 0, 0.499013, 
-0.793469, 0.0388147, 0, 0.517749, 
-0.786473, 0.0363453, 0, 0.536785, 
-0.778874, 0.0340225, 0, 0.556134, 
-0.771277, 0.0318599, 0, 0.575808, 
-0.763426, 0.0298859, 0, 0.595826, 
-0.755044, 0.0280357, 0, 0.616207, 
-0.746161, 0.0262979, 0, 0.636973, 
-0.737124, 0.0247295, 0, 0.65815, 
-0.72761, 0.0232514, 0, 0.679772, 
-0.717822, 0.0218755, 0, 0.701876, 
-0.708279, 0.0205942, 0, 0.724509, 
-0.698333, 0.0193947, 0, 0.74773, 
-0.68802, 0.0182717, 0, 0.771609, 
-0.677321, 0.0172044, 0, 0.79624, 
-0.666504, 0.0162122, 0, 0.821743, 
-0.656184, 0.0152924, 0, 0.84828, 
-0.64556, 0.0144326, 0, 0.876069, 
-0.634636, 0.0136157, 0, 0.905404, 
-0.624124, 0.0128612, 0, 0.936508, 
-0.613914, 0.0121435, 0, 0.968254, 
-0.603589, 0.0114887, 0, 1, 
-1, 0.307946, 0, 0, 
-0.999999, 0.307946, 0, 0, 
-0.999988, 0.307934, 0, 2.04479e-05, 
-0.999944, 0.307886, 0, 0.00127833, 
-0.999824, 0.307756, 0, 0.00445047, 
-0.999565, 0.30748, 0, 0.00914678, 
-0.999085, 0.306967, 0, 0.0150498, 
-0.998103, 0.306005, 0, 0.0219367, 
-0.994249, 0.303028, 0, 0.0296485, 
-0.991806, 0.300435, 0, 0.038068, 
-0.987773, 0.296555, 0, 0.0471062, 
-0.982673, 0.2916, 0, 0.0566942, 
-0.976623, 0.285641, 0, 0.0667768, 
-0.968757, 0.27815, 0, 0.0773099, 
-0.959849, 0.269529, 0, 0.0882569, 
-0.950662, 0.260248, 0, 0.0995879, 
-0.940129, 0.249704, 0, 0.111277, 
-0.92895, 0.238291, 0, 0.123304, 
-0.917996, 0.226501, 0, 0.13565, 
-0.907813, 0.21467, 0, 0.148298, 
-0.898305, 0.202835, 0, 0.161237, 
-0.889626, 0.191158, 0, 0.174455, 
-0.88175, 0.179695, 0, 0.187941, 
-0.874714, 0.168548, 0, 0.201687, 
-0.868746, 0.15792, 0, 0.215687, 
-0.863703, 0.147807, 0, 0.229933, 
-0.859315, 0.138149, 0, 0.24442, 
-0.855538, 0.128993, 0, 0.259145, 
-0.852428, 0.120414, 0, 0.274103, 
-0.850168, 0.112498, 0, 0.289293, 
-0.848132, 0.105054, 0, 0.304711, 
-0.846291, 0.0981087, 0, 0.320357, 
-0.844431, 0.0915942, 0, 0.33623, 
-0.842493, 0.0855056, 0, 0.35233, 
-0.840368, 0.0798204, 0, 0.368658, 
-0.837979, 0.0745097, 0, 0.385214, 
-0.83523, 0.0695424, 0, 0.402002, 
-0.832091, 0.0649093, 0, 0.419023, 
-0.828667, 0.0606291, 0, 0.436282, 
-0.824805, 0.0566523, 0, 0.453782, 
-0.820988, 0.053023, 0, 0.471529, 
-0.816635, 0.0496365, 0, 0.489528, 
-0.811725, 0.0464658, 0, 0.507788, 
-0.806316, 0.0435082, 0, 0.526317, 
-0.800469, 0.0407873, 0, 0.545124, 
-0.794107, 0.038255, 0, 0.564221, 
-0.787218, 0.0358825, 0, 0.583621, 
-0.779872, 0.0336785, 0, 0.603341, 
-0.772097, 0.0316379, 0, 0.623397, 
-0.764484, 0.0297379, 0, 0.643813, 
-0.756428, 0.0279581, 0, 0.664611, 
-0.748022, 0.0263153, 0, 0.685824, 
-0.739268, 0.0247799, 0, 0.707488, 
-0.73024, 0.0233385, 0, 0.729646, 
-0.720893, 0.0220036, 0, 0.752354, 
-0.71119, 0.0207555, 0, 0.77568, 
-0.701791, 0.0195843, 0, 0.799715, 
-0.692184, 0.0184891, 0, 0.824574, 
-0.682258, 0.0174541, 0, 0.850417, 
-0.67206, 0.0164873, 0, 0.877466, 
-0.661718, 0.0155959, 0, 0.90604, 
-0.651462, 0.0147519, 0, 0.936528, 
-0.641467, 0.0139727, 0, 0.968254, 
-0.631229, 0.0132363, 0, 1, 
-1, 0.367573, 0, 0, 
-0.999999, 0.367571, 0, 0, 
-0.999984, 0.367553, 0, 0.000183361, 
-0.999925, 0.367473, 0, 0.00225254, 
-0.999759, 0.367259, 0, 0.00628165, 
-0.99941, 0.366801, 0, 0.0117858, 
-0.998739, 0.365946, 0, 0.018436, 
-0.995529, 0.363191, 0, 0.0260115, 
-0.992875, 0.360171, 0, 0.0343581, 
-0.989135, 0.355981, 0, 0.0433637, 
-0.984166, 0.350401, 0, 0.0529438, 
-0.977871, 0.343348, 0, 0.0630334, 
-0.96951, 0.334341, 0, 0.0735805, 
-0.959964, 0.323862, 0, 0.0845437, 
-0.950162, 0.312521, 0, 0.0958889, 
-0.938882, 0.299577, 0, 0.107588, 
-0.926992, 0.285573, 0, 0.119618, 
-0.915589, 0.271212, 0, 0.131957, 
-0.904791, 0.256611, 0, 0.144591, 
-0.895177, 0.242224, 0, 0.157503, 
-0.886403, 0.227952, 0, 0.170682, 
-0.878957, 0.214192, 0, 0.184117, 
-0.872418, 0.200795, 0, 0.197799, 
-0.867029, 0.188015, 0, 0.21172, 
-0.862835, 0.175975, 0, 0.225873, 
-0.859411, 0.164526, 0, 0.240253, 
-0.856655, 0.153693, 0, 0.254854, 
-0.854519, 0.14352, 0, 0.269673, 
-0.852828, 0.13397, 0, 0.284707, 
-0.851412, 0.124984, 0, 0.299953, 
-0.850609, 0.116748, 0, 0.315408, 
-0.849855, 0.10905, 0, 0.331073, 
-0.849017, 0.101839, 0, 0.346946, 
-0.848079, 0.0951359, 0, 0.363028, 
-0.846911, 0.0888774, 0, 0.379318, 
-0.845445, 0.0830375, 0, 0.395818, 
-0.84362, 0.0775843, 0, 0.41253, 
-0.841411, 0.0725054, 0, 0.429457, 
-0.838768, 0.0677691, 0, 0.446602, 
-0.835801, 0.0634016, 0, 0.463968, 
-0.832341, 0.0593095, 0, 0.481561, 
-0.828424, 0.0555121, 0, 0.499386, 
-0.824312, 0.052024, 0, 0.51745, 
-0.819918, 0.0487865, 0, 0.535761, 
-0.815072, 0.0457801, 0, 0.554328, 
-0.809863, 0.0430184, 0, 0.573162, 
-0.804164, 0.0404245, 0, 0.592275, 
-0.798034, 0.0380146, 0, 0.611681, 
-0.791436, 0.0357436, 0, 0.631398, 
-0.784498, 0.0336475, 0, 0.651445, 
-0.777125, 0.0316666, 0, 0.671845, 
-0.769365, 0.0298122, 0, 0.692628, 
-0.761579, 0.0281001, 0, 0.713827, 
-0.753746, 0.0265049, 0, 0.735484, 
-0.745573, 0.0250067, 0, 0.75765, 
-0.737083, 0.0236026, 0, 0.78039, 
-0.728545, 0.0223302, 0, 0.803789, 
-0.719691, 0.0211243, 0, 0.82796, 
-0.710569, 0.0199983, 0, 0.853056, 
-0.701216, 0.0189569, 0, 0.879298, 
-0.692094, 0.0179702, 0, 0.907014, 
-0.682909, 0.0170418, 0, 0.936691, 
-0.673509, 0.0161732, 0, 0.968254, 
-0.663863, 0.0153406, 0, 1, 
-1, 0.437396, 0, 0, 
-0.999998, 0.437394, 0, 0, 
-0.99998, 0.437364, 0, 0.000616725, 
-0.999891, 0.437233, 0, 0.00367925, 
-0.999656, 0.436878, 0, 0.00867446, 
-0.999148, 0.436121, 0, 0.0150679, 
-0.997959, 0.434565, 0, 0.022531, 
-0.993464, 0.430134, 0, 0.0308507, 
-0.990606, 0.426077, 0, 0.0398805, 
-0.985027, 0.419397, 0, 0.0495148, 
-0.978491, 0.41118, 0, 0.0596749, 
-0.969643, 0.40048, 0, 0.0703001, 
-0.959189, 0.38769, 0, 0.0813427, 
-0.948223, 0.373575, 0, 0.0927641, 
-0.935955, 0.357623, 0, 0.104533, 
-0.923237, 0.34043, 0, 0.116624, 
-0.911074, 0.322735, 0, 0.129015, 
-0.899724, 0.304791, 0, 0.141687, 
-0.890189, 0.287392, 0, 0.154626, 
-0.881796, 0.270248, 0, 0.167818, 
-0.874781, 0.253659, 0, 0.181252, 
-0.869166, 0.237786, 0, 0.194918, 
-0.864725, 0.222618, 0, 0.208807, 
-0.861565, 0.208357, 0, 0.222913, 
-0.859284, 0.194868, 0, 0.237229, 
-0.857677, 0.18212, 0, 0.25175, 
-0.856714, 0.17018, 0, 0.266473, 
-0.856155, 0.158969, 0, 0.281392, 
-0.8558, 0.148413, 0, 0.296505, 
-0.855672, 0.138578, 0, 0.311811, 
-0.855539, 0.129345, 0, 0.327306, 
-0.855689, 0.120861, 0, 0.342991, 
-0.855767, 0.112969, 0, 0.358864, 
-0.855618, 0.105593, 0, 0.374925, 
-0.85525, 0.0987451, 0, 0.391176, 
-0.854583, 0.0923727, 0, 0.407616, 
-0.853534, 0.0864143, 0, 0.424249, 
-0.852061, 0.0808338, 0, 0.441076, 
-0.850253, 0.0756771, 0, 0.4581, 
-0.848004, 0.0708612, 0, 0.475324, 
-0.845333, 0.0663784, 0, 0.492754, 
-0.842376, 0.0622631, 0, 0.510394, 
-0.838956, 0.0584112, 0, 0.528251, 
-0.835121, 0.0548328, 0, 0.546331, 
-0.830842, 0.0514838, 0, 0.564644, 
-0.826212, 0.048355, 0, 0.583198, 
-0.821522, 0.0454714, 0, 0.602005, 
-0.816551, 0.0428263, 0, 0.621078, 
-0.811211, 0.0403612, 0, 0.640434, 
-0.805479, 0.038039, 0, 0.660089, 
-0.799409, 0.0358739, 0, 0.680066, 
-0.79306, 0.0338727, 0, 0.70039, 
-0.786395, 0.0319986, 0, 0.721094, 
-0.779416, 0.030241, 0, 0.742215, 
-0.77214, 0.0285951, 0, 0.7638, 
-0.764636, 0.0270747, 0, 0.785912, 
-0.756836, 0.0256354, 0, 0.808628, 
-0.749315, 0.0243028, 0, 0.832055, 
-0.741561, 0.0230497, 0, 0.856338, 
-0.733589, 0.0218801, 0, 0.88169, 
-0.72548, 0.020784, 0, 0.908441, 
-0.717255, 0.0197702, 0, 0.937125, 
-0.708829, 0.0188168, 0, 0.968254, 
-0.700191, 0.0179113, 0, 1, 
-1, 0.518937, 0, 0, 
-0.999998, 0.518934, 0, 0, 
-0.999967, 0.518883, 0, 0.00147741, 
-0.999832, 0.51866, 0, 0.00573221, 
-0.999466, 0.518057, 0, 0.011826, 
-0.998644, 0.516753, 0, 0.0192116, 
-0.994458, 0.512347, 0, 0.027573, 
-0.991223, 0.507676, 0, 0.0367099, 
-0.985515, 0.500188, 0, 0.046487, 
-0.978308, 0.490409, 0, 0.0568071, 
-0.968359, 0.477357, 0, 0.0675984, 
-0.95682, 0.461752, 0, 0.0788059, 
-0.943929, 0.443797, 0, 0.090386, 
-0.930224, 0.423893, 0, 0.102304, 
-0.916514, 0.402682, 0, 0.114532, 
-0.903652, 0.380914, 0, 0.127047, 
-0.892315, 0.359212, 0, 0.139829, 
-0.882942, 0.338102, 0, 0.152861, 
-0.875438, 0.31773, 0, 0.16613, 
-0.869642, 0.298186, 0, 0.179623, 
-0.865304, 0.279491, 0, 0.193332, 
-0.862382, 0.261804, 0, 0.207247, 
-0.860667, 0.245146, 0, 0.22136, 
-0.859789, 0.229406, 0, 0.235666, 
-0.859608, 0.214605, 0, 0.250158, 
-0.859912, 0.200691, 0, 0.264832, 
-0.86053, 0.187623, 0, 0.279684, 
-0.861368, 0.17539, 0, 0.294711, 
-0.862237, 0.163901, 0, 0.309911, 
-0.863127, 0.153175, 0, 0.32528, 
-0.863923, 0.143147, 0, 0.340819, 
-0.864567, 0.133781, 0, 0.356524, 
-0.865013, 0.125042, 0, 0.372397, 
-0.86539, 0.116952, 0, 0.388438, 
-0.865591, 0.109476, 0, 0.404645, 
-0.865517, 0.102542, 0, 0.421022, 
-0.865084, 0.0960688, 0, 0.437568, 
-0.864309, 0.0900499, 0, 0.454287, 
-0.863151, 0.0844329, 0, 0.471181, 
-0.861649, 0.0792218, 0, 0.488253, 
-0.859742, 0.0743482, 0, 0.505507, 
-0.857446, 0.0697964, 0, 0.522948, 
-0.854757, 0.0655364, 0, 0.54058, 
-0.851783, 0.0616081, 0, 0.558412, 
-0.848516, 0.0579701, 0, 0.576449, 
-0.844897, 0.0545742, 0, 0.594701, 
-0.840956, 0.0514167, 0, 0.613178, 
-0.836676, 0.0484599, 0, 0.631892, 
-0.832075, 0.0456934, 0, 0.650856, 
-0.827191, 0.0431179, 0, 0.670088, 
-0.822295, 0.0407718, 0, 0.689606, 
-0.817294, 0.0386032, 0, 0.709434, 
-0.812013, 0.0365675, 0, 0.7296, 
-0.806465, 0.0346547, 0, 0.750138, 
-0.800691, 0.0328717, 0, 0.771093, 
-0.794709, 0.0312111, 0, 0.792519, 
-0.788493, 0.0296504, 0, 0.814488, 
-0.782049, 0.0281782, 0, 0.837097, 
-0.775403, 0.0267965, 0, 0.860481, 
-0.76857, 0.0255002, 0, 0.884842, 
-0.761536, 0.0242759, 0, 0.910494, 
-0.754303, 0.0231142, 0, 0.937985, 
-0.74692, 0.0220305, 0, 0.968254, 
-0.739744, 0.0210192, 0, 1, 
-1, 0.613914, 0, 0, 
-0.999996, 0.613907, 0, 9.63597e-05, 
-0.999942, 0.613814, 0, 0.00301243, 
-0.999704, 0.613407, 0, 0.00870385, 
-0.999046, 0.612302, 0, 0.0160714, 
-0.995516, 0.608266, 0, 0.0245899, 
-0.991726, 0.602863, 0, 0.033968, 
-0.985157, 0.593956, 0, 0.0440253, 
-0.97642, 0.581748, 0, 0.0546409, 
-0.964404, 0.565183, 0, 0.0657284, 
-0.950601, 0.545273, 0, 0.0772246, 
-0.935158, 0.522129, 0, 0.0890812, 
-0.919364, 0.496782, 0, 0.10126, 
-0.904754, 0.470571, 0, 0.113731, 
-0.89176, 0.444037, 0, 0.126469, 
-0.881492, 0.418322, 0, 0.139454, 
-0.873656, 0.393522, 0, 0.15267, 
-0.868053, 0.369795, 0, 0.166101, 
-0.864336, 0.347171, 0, 0.179736, 
-0.862259, 0.325737, 0, 0.193565, 
-0.861556, 0.305532, 0, 0.207578, 
-0.861776, 0.286416, 0, 0.221769, 
-0.862661, 0.268355, 0, 0.23613, 
-0.864015, 0.251334, 0, 0.250656, 
-0.865711, 0.235352, 0, 0.265343, 
-0.867519, 0.220302, 0, 0.280187, 
-0.869351, 0.206161, 0, 0.295183, 
-0.871144, 0.192908, 0, 0.31033, 
-0.872839, 0.180505, 0, 0.325624, 
-0.874307, 0.168848, 0, 0.341065, 
-0.875667, 0.158021, 0, 0.35665, 
-0.876758, 0.147877, 0, 0.37238, 
-0.87764, 0.138441, 0, 0.388253, 
-0.878237, 0.129627, 0, 0.404269, 
-0.878563, 0.121415, 0, 0.42043, 
-0.878572, 0.113741, 0, 0.436735, 
-0.87842, 0.106652, 0, 0.453187, 
-0.878057, 0.100097, 0, 0.469786, 
-0.877413, 0.0940128, 0, 0.486536, 
-0.87646, 0.0883461, 0, 0.503439, 
-0.875233, 0.0830924, 0, 0.520498, 
-0.8737, 0.0781975, 0, 0.537717, 
-0.871873, 0.07364, 0, 0.555102, 
-0.86978, 0.0694103, 0, 0.572657, 
-0.867405, 0.0654696, 0, 0.59039, 
-0.864751, 0.0617914, 0, 0.608307, 
-0.861818, 0.0583491, 0, 0.626419, 
-0.858645, 0.0551443, 0, 0.644733, 
-0.855307, 0.0521894, 0, 0.663264, 
-0.851736, 0.0494334, 0, 0.682025, 
-0.847927, 0.0468504, 0, 0.701032, 
-0.843888, 0.0444261, 0, 0.720308, 
-0.839629, 0.0421497, 0, 0.739875, 
-0.835158, 0.0400082, 0, 0.759764, 
-0.830509, 0.0380076, 0, 0.780014, 
-0.825714, 0.0361488, 0, 0.800673, 
-0.820729, 0.0343956, 0, 0.821803, 
-0.815751, 0.0327781, 0, 0.843492, 
-0.810752, 0.031275, 0, 0.86586, 
-0.805587, 0.0298542, 0, 0.889087, 
-0.800317, 0.0285397, 0, 0.913466, 
-0.79489, 0.0272948, 0, 0.93952, 
-0.789314, 0.0261139, 0, 0.96835, 
-0.783593, 0.0249938, 0, 1, 
-1, 0.724258, 0, 0, 
-0.999992, 0.724243, 0, 0.000726889, 
-0.99987, 0.724044, 0, 0.00569574, 
-0.999336, 0.72317, 0, 0.0131703, 
-0.996271, 0.719432, 0, 0.0220739, 
-0.991159, 0.712576, 0, 0.0319405, 
-0.982465, 0.700927, 0, 0.0425202, 
-0.97049, 0.684297, 0, 0.0536599, 
-0.953973, 0.661244, 0, 0.065258, 
-0.935545, 0.633804, 0, 0.0772428, 
-0.916596, 0.603071, 0, 0.0895617, 
-0.899353, 0.57105, 0, 0.102175, 
-0.885216, 0.539206, 0, 0.11505, 
-0.875076, 0.508714, 0, 0.128164, 
-0.868334, 0.479571, 0, 0.141495, 
-0.864414, 0.451796, 0, 0.155027, 
-0.862678, 0.425328, 0, 0.168745, 
-0.862835, 0.400352, 0, 0.182639, 
-0.864067, 0.376532, 0, 0.196699, 
-0.866086, 0.35391, 0, 0.210915, 
-0.868557, 0.332424, 0, 0.225282, 
-0.871271, 0.312053, 0, 0.239792, 
-0.874058, 0.292764, 0, 0.25444, 
-0.8768, 0.27453, 0, 0.269223, 
-0.87939, 0.257297, 0, 0.284135, 
-0.8819, 0.24114, 0, 0.299174, 
-0.884187, 0.225934, 0, 0.314337, 
-0.886262, 0.211669, 0, 0.329622, 
-0.888119, 0.198311, 0, 0.345026, 
-0.889709, 0.185783, 0, 0.360549, 
-0.891054, 0.174063, 0, 0.376189, 
-0.892196, 0.163143, 0, 0.391946, 
-0.893101, 0.152952, 0, 0.407819, 
-0.893803, 0.143475, 0, 0.423808, 
-0.894277, 0.134647, 0, 0.439914, 
-0.894532, 0.126434, 0, 0.456137, 
-0.894576, 0.1188, 0, 0.472479, 
-0.894393, 0.111694, 0, 0.48894, 
-0.893976, 0.105069, 0, 0.505523, 
-0.893346, 0.0989077, 0, 0.52223, 
-0.892502, 0.0931724, 0, 0.539064, 
-0.891441, 0.0878276, 0, 0.556028, 
-0.890276, 0.082903, 0, 0.573125, 
-0.888972, 0.0783505, 0, 0.590361, 
-0.887469, 0.0741083, 0, 0.607741, 
-0.885785, 0.0701633, 0, 0.62527, 
-0.883914, 0.0664835, 0, 0.642957, 
-0.881872, 0.0630567, 0, 0.660809, 
-0.879651, 0.0598527, 0, 0.678836, 
-0.877267, 0.0568615, 0, 0.69705, 
-0.874717, 0.05406, 0, 0.715465, 
-0.872012, 0.0514378, 0, 0.734098, 
-0.869157, 0.0489805, 0, 0.752968, 
-0.866155, 0.0466727, 0, 0.772101, 
-0.863014, 0.0445056, 0, 0.791529, 
-0.859748, 0.0424733, 0, 0.81129, 
-0.856416, 0.0405957, 0, 0.831438, 
-0.852958, 0.0388273, 0, 0.852044, 
-0.849382, 0.0371619, 0, 0.87321, 
-0.845694, 0.0355959, 0, 0.89509, 
-0.841893, 0.0341155, 0, 0.917932, 
-0.837981, 0.0327141, 0, 0.942204, 
-0.833963, 0.0313856, 0, 0.968981, 
-0.829847, 0.0301275, 0, 1, 
-1, 0.85214, 0, 0, 
-0.999969, 0.852095, 0, 0.00279627, 
-0.999483, 0.851408, 0, 0.0107635, 
-0.994545, 0.84579, 0, 0.0206454, 
-0.986188, 0.835231, 0, 0.0315757, 
-0.969847, 0.814687, 0, 0.0432021, 
-0.945951, 0.783735, 0, 0.0553396, 
-0.91917, 0.746074, 0, 0.0678766, 
-0.895488, 0.706938, 0, 0.0807395, 
-0.878232, 0.669534, 0, 0.0938767, 
-0.868252, 0.635168, 0, 0.10725, 
-0.863873, 0.603069, 0, 0.120832, 
-0.863369, 0.572514, 0, 0.134598, 
-0.86545, 0.543169, 0, 0.148533, 
-0.868803, 0.514578, 0, 0.16262, 
-0.872794, 0.486762, 0, 0.176849, 
-0.87702, 0.459811, 0, 0.19121, 
-0.881054, 0.433654, 0, 0.205694, 
-0.884974, 0.408574, 0, 0.220294, 
-0.888587, 0.384525, 0, 0.235005, 
-0.891877, 0.36156, 0, 0.24982, 
-0.894793, 0.339661, 0, 0.264737, 
-0.89743, 0.318913, 0, 0.279751, 
-0.899796, 0.299302, 0, 0.294859, 
-0.901943, 0.280843, 0, 0.310058, 
-0.903858, 0.263481, 0, 0.325346, 
-0.905574, 0.247197, 0, 0.340721, 
-0.907069, 0.231915, 0, 0.356181, 
-0.908379, 0.217614, 0, 0.371725, 
-0.90952, 0.20425, 0, 0.387353, 
-0.910483, 0.191758, 0, 0.403063, 
-0.91128, 0.180092, 0, 0.418854, 
-0.911936, 0.169222, 0, 0.434727, 
-0.912454, 0.159098, 0, 0.450682, 
-0.912835, 0.149668, 0, 0.466718, 
-0.913078, 0.140884, 0, 0.482837, 
-0.913192, 0.132709, 0, 0.499038, 
-0.913175, 0.125095, 0, 0.515324, 
-0.91304, 0.118012, 0, 0.531695, 
-0.912781, 0.111417, 0, 0.548153, 
-0.91241, 0.105281, 0, 0.5647, 
-0.911924, 0.0995691, 0, 0.581338, 
-0.911331, 0.0942531, 0, 0.59807, 
-0.910637, 0.0893076, 0, 0.6149, 
-0.90984, 0.0846998, 0, 0.63183, 
-0.908941, 0.0804044, 0, 0.648865, 
-0.907944, 0.0763984, 0, 0.666011, 
-0.906857, 0.0726638, 0, 0.683273, 
-0.90568, 0.0691783, 0, 0.700659, 
-0.904416, 0.0659222, 0, 0.718176, 
-0.903067, 0.0628782, 0, 0.735834, 
-0.901637, 0.0600307, 0, 0.753646, 
-0.900128, 0.0573647, 0, 0.771625, 
-0.898544, 0.0548668, 0, 0.78979, 
-0.89689, 0.052527, 0, 0.808162, 
-0.895165, 0.0503306, 0, 0.826771, 
-0.893371, 0.0482668, 0, 0.845654, 
-0.891572, 0.0463605, 0, 0.864863, 
-0.889763, 0.0445998, 0, 0.884472, 
-0.887894, 0.0429451, 0, 0.904592, 
-0.885967, 0.0413884, 0, 0.925407, 
-0.883984, 0.0399224, 0, 0.947271, 
-0.881945, 0.0385404, 0, 0.97105, 
-0.879854, 0.0372362, 0, 1, 
-0.999804, 0.995833, 0, 0, 
-0.938155, 0.933611, 0, 0.015873, 
-0.864755, 0.854311, 0, 0.031746, 
-0.888594, 0.865264, 0, 0.0476191, 
-0.905575, 0.863922, 0, 0.0634921, 
-0.915125, 0.850558, 0, 0.0793651, 
-0.920665, 0.829254, 0, 0.0952381, 
-0.924073, 0.802578, 0, 0.111111, 
-0.926304, 0.772211, 0, 0.126984, 
-0.927829, 0.739366, 0, 0.142857, 
-0.928924, 0.705033, 0, 0.15873, 
-0.92973, 0.670019, 0, 0.174603, 
-0.930339, 0.634993, 0, 0.190476, 
-0.930811, 0.600485, 0, 0.206349, 
-0.931191, 0.566897, 0, 0.222222, 
-0.93149, 0.534485, 0, 0.238095, 
-0.931737, 0.503429, 0, 0.253968, 
-0.931939, 0.473811, 0, 0.269841, 
-0.932108, 0.445668, 0, 0.285714, 
-0.93225, 0.418993, 0, 0.301587, 
-0.932371, 0.393762, 0, 0.31746, 
-0.932474, 0.369939, 0, 0.333333, 
-0.932562, 0.347479, 0, 0.349206, 
-0.932638, 0.326336, 0, 0.365079, 
-0.932703, 0.306462, 0, 0.380952, 
-0.93276, 0.287805, 0, 0.396825, 
-0.932809, 0.270313, 0, 0.412698, 
-0.932851, 0.253933, 0, 0.428571, 
-0.932887, 0.23861, 0, 0.444444, 
-0.932917, 0.224289, 0, 0.460318, 
-0.932943, 0.210917, 0, 0.476191, 
-0.932965, 0.19844, 0, 0.492064, 
-0.932982, 0.186807, 0, 0.507937, 
-0.932995, 0.175966, 0, 0.52381, 
-0.933005, 0.165869, 0, 0.539683, 
-0.933011, 0.156468, 0, 0.555556, 
-0.933013, 0.147719, 0, 0.571429, 
-0.933013, 0.139579, 0, 0.587302, 
-0.93301, 0.132007, 0, 0.603175, 
-0.933004, 0.124965, 0, 0.619048, 
-0.932994, 0.118416, 0, 0.634921, 
-0.932982, 0.112326, 0, 0.650794, 
-0.932968, 0.106663, 0, 0.666667, 
-0.93295, 0.101397, 0, 0.68254, 
-0.932931, 0.0964993, 0, 0.698413, 
-0.932908, 0.0919438, 0, 0.714286, 
-0.932883, 0.0877057, 0, 0.730159, 
-0.932856, 0.0837623, 0, 0.746032, 
-0.932827, 0.0800921, 0, 0.761905, 
-0.932796, 0.0766754, 0, 0.777778, 
-0.932762, 0.0734936, 0, 0.793651, 
-0.932727, 0.0705296, 0, 0.809524, 
-0.932689, 0.0677676, 0, 0.825397, 
-0.93265, 0.0651929, 0, 0.84127, 
-0.932609, 0.0627917, 0, 0.857143, 
-0.932565, 0.0605515, 0, 0.873016, 
-0.932521, 0.0584606, 0, 0.888889, 
-0.932474, 0.0565082, 0, 0.904762, 
-0.932427, 0.0546841, 0, 0.920635, 
-0.932377, 0.0529793, 0, 0.936508, 
-0.932326, 0.0513851, 0, 0.952381, 
-0.932274, 0.0498936, 0, 0.968254, 
-0.93222, 0.0484975, 0, 0.984127, 
-0.932164, 0.0471899, 0, 1, 
-];